@@ -2,17 +2,27 @@
  * @file c_benchmarks.c
  * @brief Main entry point for benchmark execution on RP2040 (Raspberry Pi Pico).
  *
- * Selects and runs a specific benchmark based on the configured BENCHMARK_MODE.
- * This file acts as the top-level controller for both software and hardware tests.
+ * By default (BENCHMARK_INTERACTIVE = 1) the firmware waits for line
+ * commands over USB serial (see bench_command.h), so benchmarks, parameters,
+ * repetitions and the system clock can be changed without reflashing; use
+ * host/bench_client.c to drive sweeps. With BENCHMARK_INTERACTIVE = 0 it
+ * runs every registered benchmark selected by BENCHMARK_FILTER once at boot,
+ * followed by the stack/heap memory pass when BENCHMARK_MEMORY = 1. Set
+ * BENCHMARK_SWEEP to a ratio (e.g. 2) to sweep each benchmark's parameter
+ * geometrically instead of running its default set (bench_registry.h).
+ * Set BENCHMARK_SYNC_PIN to a free GPIO to emit clock sync pulses for the
+ * GPIO probe from boot (bench_sync.h; also `sync pin=N` at run time).
  *
- * Mode mapping:
- *   1 → Software benchmark suite (Fibonacci, Sorting, FFT, etc.)
- *   2 → GPIO toggle timing
- *   3 → PWM setup timing
- *   4 → ADC read timing
- *   5 → Interrupt latency (button press → ISR)
- *   6 → UART transmission
- *   7 → I2C master write
+ * Benchmarks are described in the static registry (bench_registry.h /
+ * bench_list.h), so a single image can run the whole suite or any subset.
+ *
+ * Filter values:
+ *   "software"           → Software benchmark suite (Fibonacci, Sorting, FFT, etc.)
+ *   "hardware"           → All hardware benchmarks (need the wiring in readme.md)
+ *   "all"                → Everything, in registration order
+ *   "<task>"             → One benchmark, e.g. "fft", "gpio", "pwm", "adc",
+ *                          "interrupt", "uart", "i2c"
+ *   "<task>.<method>"    → One variant, e.g. "fibonacci.recursive"
  *
  * Note:
  *   USB serial output requires a delay before printing to ensure the host is ready.
@@ -24,41 +34,57 @@
 #include <stdio.h>
 #include "pico/stdlib.h"
 #include "benchmarks.h"
+#include "bench_arena.h"
+#include "bench_command.h"
+#include "bench_sync.h"
+#include "bench_timer.h"
 
-#define BENCHMARK_MODE 1  ///< Change this value to select which benchmark to run
+// Both can be overridden per target, as the isolated BENCH_BUILD_MATRIX builds do
+#ifndef BENCHMARK_INTERACTIVE
+#define BENCHMARK_INTERACTIVE 1      ///< 1: serial command mode, 0: run BENCHMARK_FILTER at boot
+#endif
+#ifndef BENCHMARK_FILTER
+#define BENCHMARK_FILTER "software"  ///< Change this value to select which benchmarks to run
+#endif
+#ifndef BENCHMARK_MEMORY
+#define BENCHMARK_MEMORY 1           ///< 1: follow the batch run with the stack/heap pass
+#endif
+#ifndef BENCHMARK_SWEEP
+#define BENCHMARK_SWEEP 0            ///< Sweep ratio of the batch run, 0: default parameters
+#endif
+#ifndef BENCHMARK_SYNC_PIN
+#define BENCHMARK_SYNC_PIN -1        ///< GPIO for probe clock sync pulses, -1: off
+#endif
 
 int main() {
     stdio_init_all();
+    bench_timer_init();  // Start the SysTick cycle counter and calibrate
+    if (BENCHMARK_SYNC_PIN >= 0) {
+        bench_sync_start((unsigned)BENCHMARK_SYNC_PIN);
+    }
+
+#if BENCHMARK_INTERACTIVE
+    // No start-up delay needed: the host sends commands once it is connected
+    bench_cmd_serve();
+#endif
+
     sleep_ms(10000);  // Give USB serial host time to initialise
 
-    printf("Benchmark Mode: %d\n", BENCHMARK_MODE);
+    printf("Benchmark Filter: %s\n", BENCHMARK_FILTER);
+#ifdef BENCH_PROFILE
+    printf("Build Profile: %s\n", BENCH_PROFILE);
+#endif
+    printf("----------------------\n");
+    bench_timer_print_calibration();
+    printf("Benchmark Arena: %lu bytes\n", (unsigned long)bench_arena_capacity());
     printf("----------------------\n");
 
-    switch (BENCHMARK_MODE) {
-        case 1:
-            run_software_benchmarks();
-            break;
-        case 2:
-            benchmark_gpio_toggle();     // GPIO output toggling test
-            break;
-        case 3:
-            benchmark_pwm();             // PWM setup time measurement
-            break;
-        case 4:
-            benchmark_adc();             // Analogue-to-digital read timing
-            break;
-        case 5:
-            benchmark_interrupt();       // ISR latency from GPIO input
-            break;
-        case 6:
-            benchmark_uart();            // UART TX timing (to logger Pico)
-            break;
-        case 7:
-            benchmark_i2c();             // I2C master write latency
-            break;
-        default:
-            printf("Invalid benchmark mode selected.\n");
-            break;
+    const bench_run_opts_t opts = { .sweep = BENCHMARK_SWEEP };
+    if (bench_run_matching_with(BENCHMARK_FILTER, &opts) == 0) {
+        printf("No benchmark matches filter \"%s\". Registered benchmarks:\n", BENCHMARK_FILTER);
+        bench_print_registry(NULL);
+    } else if (BENCHMARK_MEMORY) {
+        bench_profile_memory_matching_with(BENCHMARK_FILTER, &opts);
     }
 
     // Keep USB serial active after benchmark completes
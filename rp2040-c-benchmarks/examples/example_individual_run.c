@@ -7,12 +7,18 @@
  * binary size, and runtime results only reflect the selected benchmark.
  *
  * Steps for reproducible measurement:
- * 1. Swap the benchmark call inside `main()` (e.g., `benchmark_fibonacci();`)
+ * 1. Swap the descriptor run inside `main()` (e.g., `bench_run(&bench_fibonacci_recursive);`)
  * 2. In `CMakeLists.txt`, **comment out all other source files** under `add_executable()`
- *    except the one being tested (e.g., `src/fibonacci/benchmark.c`)
+ *    except the one being tested (e.g., `src/fibonacci/benchmark.c`) and the
+ *    harness in `src/common/` other than `registry.c` (the descriptor is
+ *    referenced directly, so the registry table is not needed)
  * 3. Rebuild with `cmake --build . --clean-first`
  * 4. Collect runtime + memory metrics
  *
+ * The BENCH_BUILD_MATRIX option in CMakeLists.txt now generates these isolated
+ * images automatically (c_bench_<task>_<profile>); this file documents the
+ * procedure behind the original results.
+ *
  * This method was used for:
  *   - Flash/RAM usage (.elf, .map, .S files)
  *   - Runtime timing (CSV output)
@@ -23,13 +29,16 @@
 #include <stdio.h>
 #include "pico/stdlib.h"
 #include "benchmarks.h"
+#include "bench_timer.h"
 
 int main() {
     stdio_init_all();
     sleep_ms(10000);  // Allow USB serial to initialise
+    bench_timer_init();
 
     printf("Benchmark Mode: Fibonacci\n");
     printf("--------------------------\n");
 
-    benchmark_fibonacci();  // Swap this line per benchmark
+    extern const bench_desc_t bench_fibonacci_recursive;
+    bench_run(&bench_fibonacci_recursive);  // Swap this line per benchmark
 }
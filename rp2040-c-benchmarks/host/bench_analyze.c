@@ -0,0 +1,856 @@
+/**
+ * @file bench_analyze.c
+ * @brief Summarise and compare result logs of the C and TinyGo suites.
+ *
+ * Streams the CSV captured from either suite (serial logs, bench_client or
+ * bench_decode output, host runs) and writes:
+ *
+ *   OUT/c/<Task>_Summary.csv, OUT/tinygo/<Task>_Summary_csv.csv
+ *       Per-benchmark summaries in the results/summary schema,
+ *       `task,method,<param>,avg_us_mean,avg_us_std`: the mean and sample
+ *       standard deviation of the run times of every parameter.
+ *   OUT/comparison.csv
+ *       One row per (task, method, param) with the median, MAD and p99−p50
+ *       jitter of each suite, and the C/TinyGo speedup (TinyGo median / C
+ *       median; above 1 the C build is faster) with a bootstrap confidence
+ *       interval.
+ *   OUT/scaling.csv
+ *       Fits of t ≈ a + b·f(n) for f = n, n·log2(n), n² and n³ over every
+ *       size sweep (at least three sizes), with the relative RMS error of
+ *       each model, the best one, and the log-log slope (the empirical
+ *       exponent).
+ *   OUT/report.md
+ *       All of the above as one Markdown report.
+ *
+ * Logs are read with bench_log.h, so they may mix tables and other text;
+ * rows ending in `skip` or `invalid` are counted in the report.
+ *
+ *   - Summary rows contribute their time (the median of a run for the
+ *     kernel benchmarks) as one run, and p99_us − time_us as its tail.
+ *     Repeated logs of the same build give several runs per parameter.
+ *   - Raw rows (`bench_decode -r`, with an `index` column) contribute every
+ *     sample; the MAD, p99−p50 and bootstrap then use the samples.
+ *   - With a `clk_khz` column (`bench_client -k`), the clock is appended to
+ *     the method (`multiply@133000kHz`), so each clock is its own benchmark.
+ *
+ * Statistics use the suite's nearest-rank percentiles. The bootstrap draws
+ * both suites' observations with replacement from the PCG32 generator of
+ * bench_data.h, so the intervals are reproducible for a given seed.
+ *
+ * Usage:
+ *   bench_analyze [-o DIR] [-b RESAMPLES] [-s SEED] [-c C_LOG]... [-g TINYGO_LOG]...
+ *
+ *   -o   Output directory (default: analysis)
+ *   -b   Bootstrap resamples (default: 2000)
+ *   -s   Bootstrap seed (default: 1)
+ *   -c   Log of the C suite ("-" for stdin); repeatable
+ *   -g   Log of the TinyGo suite; repeatable
+ *
+ * Example:
+ *   bench_analyze -c c_run1.csv -c c_run2.csv -g tinygo_run1.csv -o results/analysis
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "bench_data.h"
+#include "bench_log.h"
+
+#define MAX_NAME 64
+#define MAX_PATH 512
+
+#define DEFAULT_RESAMPLES 2000
+#define CI_LEVEL_PCT 95  ///< Confidence level of the bootstrap intervals
+#define MIN_SWEEP_POINTS 3
+
+typedef enum { LANG_C, LANG_GO, NUM_LANGS } lang_t;
+
+static const char* const lang_dirs[NUM_LANGS] = {"c", "tinygo"};
+static const char* const lang_labels[NUM_LANGS] = {"C", "TinyGo"};
+static const char* const summary_suffix[NUM_LANGS] = {"_Summary.csv", "_Summary_csv.csv"};
+
+/// Task names printed in upper case in summary file names, as in results/summary
+static const char* const acronyms[] = {"adc", "fft", "gpio", "i2c", "pwm", "uart"};
+
+/**
+ * @brief Growable array of observations in microseconds.
+ */
+typedef struct {
+    double* v;
+    size_t n;
+    size_t cap;
+} series_t;
+
+/**
+ * @brief Everything one suite logged for one benchmark and parameter.
+ */
+typedef struct {
+    series_t samples;  ///< Raw per-iteration samples (bench_decode -r)
+    series_t runs;     ///< One time per summary row
+    series_t tails;    ///< p99_us − time_us per summary row
+    unsigned long skipped;
+    unsigned long invalid;
+} side_t;
+
+/**
+ * @brief One (task, method, param) across both suites.
+ */
+typedef struct {
+    char task[MAX_NAME];
+    char method[MAX_NAME];
+    char param_name[MAX_NAME];
+    char param[MAX_NAME];
+    side_t side[NUM_LANGS];
+} entry_t;
+
+/**
+ * @brief Per-suite input totals for the report.
+ */
+typedef struct {
+    unsigned files;
+    unsigned long rows;
+    unsigned long samples;
+    unsigned long skipped;
+    unsigned long invalid;
+} totals_t;
+
+/**
+ * @brief Robust summary of one suite's observations for an entry.
+ */
+typedef struct {
+    const series_t* obs;  ///< Samples if any, else runs (sorted)
+    double median;
+    double mad;
+    double p99_p50;
+    bool has_p99_p50;
+} jitter_t;
+
+static entry_t* entries = NULL;
+static size_t num_entries = 0;
+static size_t entries_cap = 0;
+static size_t last_entry = SIZE_MAX;  ///< Lookup cache: consecutive rows share a key
+
+static totals_t totals[NUM_LANGS];
+
+static const char* out_dir = "analysis";
+static unsigned resamples = DEFAULT_RESAMPLES;
+static uint64_t seed = 1;
+
+static void* xrealloc(void* p, size_t size) {
+    p = realloc(p, size);
+    if (!p) {
+        fprintf(stderr, "bench_analyze: out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+static void series_push(series_t* s, double v) {
+    if (s->n == s->cap) {
+        s->cap = s->cap ? 2 * s->cap : 16;
+        s->v = xrealloc(s->v, s->cap * sizeof(double));
+    }
+    s->v[s->n++] = v;
+}
+
+static int compare_double(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static void series_sort(series_t* s) {
+    if (s->n) {
+        qsort(s->v, s->n, sizeof(double), compare_double);
+    }
+}
+
+/**
+ * @brief Nearest-rank percentile of a sorted array (as bench_stats.h).
+ */
+static double percentile(const double* sorted, size_t n, double pct) {
+    size_t rank = (size_t)ceil(pct * (double)n / 100.0 - 1e-9);
+    if (rank < 1) {
+        rank = 1;
+    }
+    return sorted[rank - 1];
+}
+
+static double median_of(const series_t* s) {
+    return percentile(s->v, s->n, 50.0);
+}
+
+/**
+ * @brief Median absolute deviation of a sorted series.
+ */
+static double mad_of(const series_t* s, double median) {
+    double* dev = xrealloc(NULL, s->n * sizeof(double));
+    for (size_t i = 0; i < s->n; i++) {
+        dev[i] = fabs(s->v[i] - median);
+    }
+    qsort(dev, s->n, sizeof(double), compare_double);
+    double mad = percentile(dev, s->n, 50.0);
+    free(dev);
+    return mad;
+}
+
+// ----------------------------------------------------
+// Input
+// ----------------------------------------------------
+
+static bool equals(const char* a, const char* b) {
+    return strcmp(a, b) == 0;
+}
+
+static entry_t* find_entry(const char* task, const char* method, const char* param_name,
+                           const char* param) {
+    if (last_entry < num_entries) {
+        entry_t* e = &entries[last_entry];
+        if (equals(e->task, task) && equals(e->method, method) && equals(e->param, param)) {
+            return e;
+        }
+    }
+    for (size_t i = 0; i < num_entries; i++) {
+        entry_t* e = &entries[i];
+        if (equals(e->task, task) && equals(e->method, method) && equals(e->param, param)) {
+            last_entry = i;
+            return e;
+        }
+    }
+
+    if (num_entries == entries_cap) {
+        entries_cap = entries_cap ? 2 * entries_cap : 64;
+        entries = xrealloc(entries, entries_cap * sizeof(entry_t));
+    }
+    entry_t* e = &entries[num_entries];
+    memset(e, 0, sizeof(*e));
+    snprintf(e->task, sizeof(e->task), "%s", task);
+    snprintf(e->method, sizeof(e->method), "%s", method);
+    snprintf(e->param_name, sizeof(e->param_name), "%s", param_name);
+    snprintf(e->param, sizeof(e->param), "%s", param);
+    last_entry = num_entries++;
+    return e;
+}
+
+/**
+ * @brief Record one log row (bench_log_fn) for the suite in ctx.
+ */
+static void add_row(const bench_log_row_t* row, void* ctx) {
+    lang_t lang = *(const lang_t*)ctx;
+    char method[MAX_NAME];
+    if (row->clk_khz) {
+        snprintf(method, sizeof(method), "%s@%skHz", row->method, row->clk_khz);
+    } else {
+        snprintf(method, sizeof(method), "%s", row->method);
+    }
+
+    entry_t* e = find_entry(row->task, method, row->param_name, row->param);
+    side_t* side = &e->side[lang];
+    totals[lang].rows++;
+    switch (row->kind) {
+        case BENCH_LOG_SKIP:
+            side->skipped++;
+            totals[lang].skipped++;
+            break;
+        case BENCH_LOG_INVALID:
+            side->invalid++;
+            totals[lang].invalid++;
+            break;
+        case BENCH_LOG_SAMPLE:
+            series_push(&side->samples, row->time_us);
+            totals[lang].samples++;
+            break;
+        case BENCH_LOG_RUN:
+            series_push(&side->runs, row->time_us);
+            if (row->has_p99) {
+                series_push(&side->tails, row->p99_us - row->time_us);
+            }
+            break;
+    }
+}
+
+static bool read_log(const char* path, lang_t lang) {
+    totals[lang].files++;
+    return bench_log_read(path, add_row, &lang);
+}
+
+// ----------------------------------------------------
+// Statistics
+// ----------------------------------------------------
+
+/**
+ * @brief Median, MAD and p99−p50 of one suite's observations for an entry.
+ *
+ * Uses the raw samples when there are any; otherwise the run times, with
+ * the per-row p99_us − time_us tails for p99−p50 where the table had them.
+ */
+static jitter_t summarise_side(side_t* side) {
+    jitter_t j = {0};
+    j.obs = side->samples.n ? &side->samples : &side->runs;
+    if (!j.obs->n) {
+        return j;
+    }
+    j.median = median_of(j.obs);
+    j.mad = mad_of(j.obs, j.median);
+    if (side->samples.n || !side->tails.n) {
+        j.p99_p50 = percentile(j.obs->v, j.obs->n, 99.0) - j.median;
+        j.has_p99_p50 = j.obs->n > 1;
+    } else {
+        j.p99_p50 = median_of(&side->tails);
+        j.has_p99_p50 = true;
+    }
+    return j;
+}
+
+/**
+ * @brief Median of a resample (with replacement) of a sorted series.
+ *
+ * Resampling a sorted array only needs the resampled indices: the element
+ * at the median rank of the resample is sorted[k], where k is the index at
+ * which the cumulative draw count reaches that rank. Counting the draws
+ * makes each resample O(n) without sorting.
+ */
+static double resample_median(const series_t* s, uint32_t* counts, bench_rng_t* rng) {
+    memset(counts, 0, s->n * sizeof(uint32_t));
+    for (size_t i = 0; i < s->n; i++) {
+        counts[bench_rng_below(rng, (uint32_t)s->n)]++;
+    }
+    size_t rank = (s->n + 1) / 2;  // nearest-rank p50
+    size_t seen = 0;
+    for (size_t k = 0; k < s->n; k++) {
+        seen += counts[k];
+        if (seen >= rank) {
+            return s->v[k];
+        }
+    }
+    return s->v[s->n - 1];
+}
+
+/**
+ * @brief Percentile bootstrap interval of median(go) / median(c).
+ */
+static bool bootstrap_speedup(const series_t* c, const series_t* go, uint64_t stream,
+                              double* low, double* high) {
+    if (c->n < 2 || go->n < 2 || !resamples) {
+        return false;
+    }
+    bench_rng_t rng;
+    bench_rng_seed(&rng, seed, stream);
+
+    uint32_t* counts = xrealloc(NULL, (c->n > go->n ? c->n : go->n) * sizeof(uint32_t));
+    double* ratios = xrealloc(NULL, resamples * sizeof(double));
+    size_t n = 0;
+    for (unsigned b = 0; b < resamples; b++) {
+        double mc = resample_median(c, counts, &rng);
+        double mg = resample_median(go, counts, &rng);
+        if (mc > 0.0) {
+            ratios[n++] = mg / mc;
+        }
+    }
+    free(counts);
+
+    bool ok = n > 0;
+    if (ok) {
+        qsort(ratios, n, sizeof(double), compare_double);
+        *low = percentile(ratios, n, (100.0 - CI_LEVEL_PCT) / 2.0);
+        *high = percentile(ratios, n, 100.0 - (100.0 - CI_LEVEL_PCT) / 2.0);
+    }
+    free(ratios);
+    return ok;
+}
+
+static void mean_std(const series_t* s, double* mean, double* std) {
+    double sum = 0.0;
+    for (size_t i = 0; i < s->n; i++) {
+        sum += s->v[i];
+    }
+    *mean = sum / (double)s->n;
+    double sq = 0.0;
+    for (size_t i = 0; i < s->n; i++) {
+        double d = s->v[i] - *mean;
+        sq += d * d;
+    }
+    *std = s->n > 1 ? sqrt(sq / (double)(s->n - 1)) : 0.0;
+}
+
+// ----------------------------------------------------
+// Scaling fits
+// ----------------------------------------------------
+
+typedef enum { MODEL_N, MODEL_NLOGN, MODEL_N2, MODEL_N3, NUM_MODELS } model_t;
+
+static const char* const model_names[NUM_MODELS] = {"n", "nlogn", "n2", "n3"};
+
+/**
+ * @brief Result of fitting the models to one sweep.
+ */
+typedef struct {
+    const char* task;
+    const char* method;
+    const char* param_name;
+    lang_t lang;
+    size_t points;
+    double min_n, max_n;
+    double exponent;  ///< Least-squares slope of log t against log n
+    double a[NUM_MODELS], b[NUM_MODELS], rel_rms[NUM_MODELS];
+    model_t best;
+} fit_t;
+
+static double model_term(model_t m, double n) {
+    switch (m) {
+        case MODEL_N: return n;
+        case MODEL_NLOGN: return n * log2(n);
+        case MODEL_N2: return n * n;
+        default: return n * n * n;
+    }
+}
+
+/**
+ * @brief Fit t ≈ a + b·f(n) for every model, weighting by 1/t² (relative error).
+ */
+static void fit_sweep(const double* n, const double* t, size_t k, fit_t* fit) {
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (size_t i = 0; i < k; i++) {
+        double x = log(n[i]), y = log(t[i]);
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        sxy += x * y;
+    }
+    fit->exponent = (k * sxy - sx * sy) / (k * sxx - sx * sx);
+
+    fit->best = MODEL_N;
+    for (int m = 0; m < NUM_MODELS; m++) {
+        double sw = 0, sf = 0, sff = 0, st = 0, sft = 0;
+        for (size_t i = 0; i < k; i++) {
+            double w = 1.0 / (t[i] * t[i]);
+            double f = model_term((model_t)m, n[i]);
+            sw += w;
+            sf += w * f;
+            sff += w * f * f;
+            st += w * t[i];
+            sft += w * f * t[i];
+        }
+        double det = sw * sff - sf * sf;
+        double b = det != 0.0 ? (sw * sft - sf * st) / det : 0.0;
+        double a = (st - b * sf) / sw;
+
+        double err = 0.0;
+        for (size_t i = 0; i < k; i++) {
+            double r = (a + b * model_term((model_t)m, n[i]) - t[i]) / t[i];
+            err += r * r;
+        }
+        fit->a[m] = a;
+        fit->b[m] = b;
+        fit->rel_rms[m] = sqrt(err / (double)k);
+        if (fit->rel_rms[m] < fit->rel_rms[fit->best]) {
+            fit->best = (model_t)m;
+        }
+    }
+}
+
+/**
+ * @brief Fit every (suite, task, method) with at least MIN_SWEEP_POINTS numeric sizes.
+ */
+static fit_t* fit_all(size_t* num_fits) {
+    fit_t* fits = NULL;
+    size_t count = 0;
+    bool* done = xrealloc(NULL, num_entries * sizeof(bool) + 1);
+    double* n = xrealloc(NULL, num_entries * sizeof(double) + 1);
+    double* t = xrealloc(NULL, num_entries * sizeof(double) + 1);
+
+    for (int lang = 0; lang < NUM_LANGS; lang++) {
+        memset(done, 0, num_entries * sizeof(bool));
+        for (size_t i = 0; i < num_entries; i++) {
+            if (done[i]) {
+                continue;
+            }
+            size_t k = 0;
+            for (size_t j = i; j < num_entries; j++) {
+                entry_t* e = &entries[j];
+                if (!equals(e->task, entries[i].task) || !equals(e->method, entries[i].method)) {
+                    continue;
+                }
+                done[j] = true;
+                jitter_t s = summarise_side(&e->side[lang]);
+                double size;
+                if (s.obs && s.obs->n && s.median > 0.0 && bench_log_number(e->param, &size) &&
+                    size > 1.0) {
+                    n[k] = size;
+                    t[k] = s.median;
+                    k++;
+                }
+            }
+            if (k < MIN_SWEEP_POINTS) {
+                continue;
+            }
+
+            fits = xrealloc(fits, (count + 1) * sizeof(fit_t));
+            fit_t* fit = &fits[count++];
+            memset(fit, 0, sizeof(*fit));
+            fit->task = entries[i].task;
+            fit->method = entries[i].method;
+            fit->param_name = entries[i].param_name;
+            fit->lang = (lang_t)lang;
+            fit->points = k;
+            fit->min_n = fit->max_n = n[0];
+            for (size_t j = 1; j < k; j++) {
+                fit->min_n = n[j] < fit->min_n ? n[j] : fit->min_n;
+                fit->max_n = n[j] > fit->max_n ? n[j] : fit->max_n;
+            }
+            fit_sweep(n, t, k, fit);
+        }
+    }
+
+    free(done);
+    free(n);
+    free(t);
+    *num_fits = count;
+    return fits;
+}
+
+// ----------------------------------------------------
+// Output
+// ----------------------------------------------------
+
+static void make_dir(const char* path) {
+    if (mkdir(path, 0777) != 0 && errno != EEXIST) {
+        perror(path);
+        exit(1);
+    }
+}
+
+static FILE* open_output(const char* path) {
+    FILE* out = fopen(path, "w");
+    if (!out) {
+        perror(path);
+        exit(1);
+    }
+    printf("%s\n", path);
+    return out;
+}
+
+/**
+ * @brief File name stem of a task, as in results/summary (`fft` → `FFT`, `matrix` → `Matrix`).
+ */
+static void task_file_name(const char* task, char* out, size_t size) {
+    for (size_t i = 0; i < sizeof(acronyms) / sizeof(acronyms[0]); i++) {
+        if (equals(task, acronyms[i])) {
+            snprintf(out, size, "%s", task);
+            for (char* p = out; *p; p++) {
+                *p = (*p >= 'a' && *p <= 'z') ? (char)(*p - 'a' + 'A') : *p;
+            }
+            return;
+        }
+    }
+    snprintf(out, size, "%s", task);
+    for (char* p = out; *p; p++) {
+        bool plain = (*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z') ||
+                     (*p >= '0' && *p <= '9') || *p == '_' || *p == '-';
+        *p = plain ? *p : '_';
+    }
+    if (out[0] >= 'a' && out[0] <= 'z') {
+        out[0] = (char)(out[0] - 'a' + 'A');
+    }
+}
+
+/**
+ * @brief Run times of an entry: the summary rows, else the median of the raw samples.
+ */
+static bool entry_runs(side_t* side, series_t* median_only, const series_t** runs) {
+    if (side->runs.n) {
+        *runs = &side->runs;
+        return true;
+    }
+    if (side->samples.n) {
+        median_only->v[0] = median_of(&side->samples);
+        *runs = median_only;
+        return true;
+    }
+    return false;
+}
+
+static void write_summaries(lang_t lang) {
+    char path[MAX_PATH];
+    char name[MAX_NAME];
+    double one;
+    series_t median_only = {&one, 1, 1};
+
+    snprintf(path, sizeof(path), "%s/%s", out_dir, lang_dirs[lang]);
+    make_dir(path);
+
+    for (size_t i = 0; i < num_entries; i++) {
+        const series_t* runs;
+        bool first = true;
+        for (size_t j = 0; j < i && first; j++) {
+            first = !equals(entries[j].task, entries[i].task);
+        }
+        if (!first) {
+            continue;
+        }
+
+        FILE* out = NULL;
+        for (size_t j = i; j < num_entries; j++) {
+            entry_t* e = &entries[j];
+            if (!equals(e->task, entries[i].task) || !entry_runs(&e->side[lang], &median_only, &runs)) {
+                continue;
+            }
+            if (!out) {
+                task_file_name(e->task, name, sizeof(name));
+                snprintf(path, sizeof(path), "%s/%s/%s%s", out_dir, lang_dirs[lang], name,
+                         summary_suffix[lang]);
+                out = open_output(path);
+                if (e->param_name[0]) {
+                    fprintf(out, "task,method,%s,avg_us_mean,avg_us_std\n", e->param_name);
+                } else {
+                    fprintf(out, "task,method,avg_us_mean,avg_us_std\n");
+                }
+            }
+            double mean, std;
+            mean_std(runs, &mean, &std);
+            if (e->param_name[0]) {
+                fprintf(out, "%s,%s,%s,%.10g,%.10g\n", e->task, e->method, e->param, mean, std);
+            } else {
+                fprintf(out, "%s,%s,%.10g,%.10g\n", e->task, e->method, mean, std);
+            }
+        }
+        if (out) {
+            fclose(out);
+        }
+    }
+}
+
+/**
+ * @brief Per-entry comparison, computed once for the CSV and the report.
+ */
+typedef struct {
+    const entry_t* entry;
+    jitter_t side[NUM_LANGS];
+    bool has_speedup;
+    double speedup;
+    bool has_ci;
+    double ci_low, ci_high;
+} comparison_t;
+
+static void print_value(FILE* out, bool present, double v) {
+    if (present) {
+        fprintf(out, ",%.10g", v);
+    } else {
+        fprintf(out, ",");
+    }
+}
+
+static void write_comparison(const comparison_t* cmp) {
+    char path[MAX_PATH];
+    snprintf(path, sizeof(path), "%s/comparison.csv", out_dir);
+    FILE* out = open_output(path);
+
+    fprintf(out, "task,method,param_name,param");
+    for (int lang = 0; lang < NUM_LANGS; lang++) {
+        const char* l = lang_dirs[lang];
+        fprintf(out, ",%s_median_us,%s_mad_us,%s_p99_p50_us,%s_n", l, l, l, l);
+    }
+    fprintf(out, ",speedup,speedup_ci_low,speedup_ci_high\n");
+
+    for (size_t i = 0; i < num_entries; i++) {
+        const comparison_t* c = &cmp[i];
+        fprintf(out, "%s,%s,%s,%s", c->entry->task, c->entry->method, c->entry->param_name,
+                c->entry->param);
+        for (int lang = 0; lang < NUM_LANGS; lang++) {
+            const jitter_t* j = &c->side[lang];
+            bool present = j->obs && j->obs->n;
+            print_value(out, present, j->median);
+            print_value(out, present, j->mad);
+            print_value(out, j->has_p99_p50, j->p99_p50);
+            fprintf(out, ",%lu", present ? (unsigned long)j->obs->n : 0ul);
+        }
+        print_value(out, c->has_speedup, c->speedup);
+        print_value(out, c->has_ci, c->ci_low);
+        print_value(out, c->has_ci, c->ci_high);
+        fprintf(out, "\n");
+    }
+    fclose(out);
+}
+
+static void write_scaling(const fit_t* fits, size_t num_fits) {
+    char path[MAX_PATH];
+    snprintf(path, sizeof(path), "%s/scaling.csv", out_dir);
+    FILE* out = open_output(path);
+
+    fprintf(out, "language,task,method,param_name,points,min_n,max_n,exponent,model,a_us,b_us,"
+                 "rel_rms,best\n");
+    for (size_t i = 0; i < num_fits; i++) {
+        const fit_t* f = &fits[i];
+        for (int m = 0; m < NUM_MODELS; m++) {
+            fprintf(out, "%s,%s,%s,%s,%lu,%.10g,%.10g,%.4f,%s,%.10g,%.10g,%.6f,%d\n",
+                    lang_dirs[f->lang], f->task, f->method, f->param_name,
+                    (unsigned long)f->points, f->min_n, f->max_n, f->exponent, model_names[m],
+                    f->a[m], f->b[m], f->rel_rms[m], m == (int)f->best);
+        }
+    }
+    fclose(out);
+}
+
+static void report_cell(FILE* out, bool present, const char* format, double v) {
+    fprintf(out, " | ");
+    if (present) {
+        fprintf(out, format, v);
+    } else {
+        fprintf(out, "-");
+    }
+}
+
+static void write_report(const comparison_t* cmp, const fit_t* fits, size_t num_fits) {
+    char path[MAX_PATH];
+    snprintf(path, sizeof(path), "%s/report.md", out_dir);
+    FILE* out = open_output(path);
+
+    fprintf(out, "# Benchmark Analysis\n\n");
+    fprintf(out, "| Suite | Logs | Rows | Raw samples | Skipped | Invalid |\n");
+    fprintf(out, "|---|---|---|---|---|---|\n");
+    for (int lang = 0; lang < NUM_LANGS; lang++) {
+        const totals_t* t = &totals[lang];
+        fprintf(out, "| %s | %u | %lu | %lu | %lu | %lu |\n", lang_labels[lang], t->files,
+                t->rows, t->samples, t->skipped, t->invalid);
+    }
+
+    fprintf(out, "\n## C vs TinyGo\n\n");
+    fprintf(out, "Speedup is the TinyGo median over the C median: above 1 the C build is "
+                 "faster. Intervals are %d%% percentile bootstraps of the ratio of medians "
+                 "(%u resamples, seed %llu), drawn from the raw samples where a log had them "
+                 "and from the run times otherwise.\n\n",
+            CI_LEVEL_PCT, resamples, (unsigned long long)seed);
+    fprintf(out, "| Task | Method | Param | C (us) | TinyGo (us) | Speedup | %d%% CI |\n",
+            CI_LEVEL_PCT);
+    fprintf(out, "|---|---|---|---|---|---|---|\n");
+    for (size_t i = 0; i < num_entries; i++) {
+        const comparison_t* c = &cmp[i];
+        if (!c->has_speedup) {
+            continue;
+        }
+        fprintf(out, "| %s | %s | %s", c->entry->task, c->entry->method, c->entry->param);
+        report_cell(out, true, "%.3f", c->side[LANG_C].median);
+        report_cell(out, true, "%.3f", c->side[LANG_GO].median);
+        report_cell(out, true, "%.3f", c->speedup);
+        fprintf(out, " | ");
+        if (c->has_ci) {
+            fprintf(out, "%.3f – %.3f", c->ci_low, c->ci_high);
+        } else {
+            fprintf(out, "-");
+        }
+        fprintf(out, " |\n");
+    }
+
+    fprintf(out, "\n## Jitter\n\n");
+    fprintf(out, "MAD is the median absolute deviation from the median; p99−p50 is the tail "
+                 "above the median (from the raw samples, else the median of the per-run "
+                 "p99_us − time_us). All in microseconds.\n\n");
+    fprintf(out, "| Task | Method | Param | C MAD | C p99−p50 | TinyGo MAD | TinyGo p99−p50 |\n");
+    fprintf(out, "|---|---|---|---|---|---|---|\n");
+    for (size_t i = 0; i < num_entries; i++) {
+        const comparison_t* c = &cmp[i];
+        fprintf(out, "| %s | %s | %s", c->entry->task, c->entry->method, c->entry->param);
+        for (int lang = 0; lang < NUM_LANGS; lang++) {
+            const jitter_t* j = &c->side[lang];
+            report_cell(out, j->obs && j->obs->n, "%.3f", j->mad);
+            report_cell(out, j->has_p99_p50, "%.3f", j->p99_p50);
+        }
+        fprintf(out, " |\n");
+    }
+
+    fprintf(out, "\n## Scaling\n\n");
+    fprintf(out, "Weighted least-squares fits of t ≈ a + b·f(n) over each size sweep; the "
+                 "best model has the lowest relative RMS error. The exponent is the log-log "
+                 "slope (1 for linear, 2 for quadratic, 3 for cubic).\n\n");
+    fprintf(out, "| Suite | Task | Method | Sizes | Exponent | Best fit | a (us) | b (us) | "
+                 "Rel. RMS |\n");
+    fprintf(out, "|---|---|---|---|---|---|---|---|---|\n");
+    for (size_t i = 0; i < num_fits; i++) {
+        const fit_t* f = &fits[i];
+        fprintf(out, "| %s | %s | %s | %lu (%s %.10g–%.10g) | %.3f | %s | %.4g | %.4g | %.2f%% |\n",
+                lang_labels[f->lang], f->task, f->method, (unsigned long)f->points,
+                f->param_name, f->min_n, f->max_n, f->exponent, model_names[f->best],
+                f->a[f->best], f->b[f->best], 100.0 * f->rel_rms[f->best]);
+    }
+    fclose(out);
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: bench_analyze [-o DIR] [-b RESAMPLES] [-s SEED] "
+                    "[-c C_LOG]... [-g TINYGO_LOG]...\n");
+}
+
+int main(int argc, char** argv) {
+    int opt;
+    bool ok = true;
+    unsigned inputs = 0;
+    while ((opt = getopt(argc, argv, "o:b:s:c:g:h")) != -1) {
+        switch (opt) {
+            case 'o': out_dir = optarg; break;
+            case 'b': resamples = (unsigned)strtoul(optarg, NULL, 0); break;
+            case 's': seed = strtoull(optarg, NULL, 0); break;
+            case 'c': ok &= read_log(optarg, LANG_C); inputs++; break;
+            case 'g': ok &= read_log(optarg, LANG_GO); inputs++; break;
+            default: usage(); return 2;
+        }
+    }
+    if (optind != argc || !inputs) {
+        usage();
+        return 2;
+    }
+    if (!ok) {
+        return 1;
+    }
+    if (!num_entries) {
+        fprintf(stderr, "bench_analyze: no benchmark rows found\n");
+        return 1;
+    }
+
+    for (size_t i = 0; i < num_entries; i++) {
+        for (int lang = 0; lang < NUM_LANGS; lang++) {
+            side_t* s = &entries[i].side[lang];
+            series_sort(&s->samples);
+            series_sort(&s->runs);
+            series_sort(&s->tails);
+        }
+    }
+
+    comparison_t* cmp = xrealloc(NULL, num_entries * sizeof(comparison_t));
+    for (size_t i = 0; i < num_entries; i++) {
+        comparison_t* c = &cmp[i];
+        memset(c, 0, sizeof(*c));
+        c->entry = &entries[i];
+        for (int lang = 0; lang < NUM_LANGS; lang++) {
+            c->side[lang] = summarise_side(&entries[i].side[lang]);
+        }
+        const jitter_t* jc = &c->side[LANG_C];
+        const jitter_t* jg = &c->side[LANG_GO];
+        c->has_speedup = jc->obs->n && jg->obs->n && jc->median > 0.0;
+        if (c->has_speedup) {
+            c->speedup = jg->median / jc->median;
+            c->has_ci = bootstrap_speedup(jc->obs, jg->obs, i, &c->ci_low, &c->ci_high);
+        }
+    }
+
+    size_t num_fits;
+    fit_t* fits = fit_all(&num_fits);
+
+    make_dir(out_dir);
+    write_summaries(LANG_C);
+    write_summaries(LANG_GO);
+    write_comparison(cmp);
+    write_scaling(fits, num_fits);
+    write_report(cmp, fits, num_fits);
+
+    free(fits);
+    free(cmp);
+    return 0;
+}
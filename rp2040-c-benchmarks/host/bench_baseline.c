@@ -0,0 +1,587 @@
+/**
+ * @file bench_baseline.c
+ * @brief Record performance baselines and detect regressions against them.
+ *
+ * A baseline file (results/baselines/ in each suite) holds the run medians
+ * of every benchmark, keyed by language, optimisation profile, clock, task,
+ * method and parameter:
+ *
+ *   language,profile,clk_khz,task,method,param_name,param,kind,count,median_us,samples
+ *
+ * `samples` lists one median per run in microseconds, ascending and
+ * space-separated, with runs of equal values written as `value:count`, and
+ * `kind` is `runs`. A summary row is one run; raw samples (`bench_decode
+ * -r`) are split into runs where their index restarts at 0, and each run is
+ * reduced to its median. The samples inside one run are not independent
+ * (cache state, clock phase and background load are shared), so only
+ * medians of separate runs are tested; record and check several runs, at
+ * least five for p < 0.01. Older rows of kind `samples` hold the raw samples
+ * of a single run and count as that run's median.
+ *
+ *   record  Reads logs (bench_log.h) and writes their sample sets into the
+ *           baseline file, replacing rows with the same key and keeping
+ *           the others.
+ *   check   Compares the logs with the baseline and prints one CSV row per
+ *           benchmark:
+ *
+ *             task,method,param,base_median_us,new_median_us,change_pct,p_value,status
+ *
+ *           A benchmark has `regressed` if its median grew by more than the
+ *           threshold and by at least the minimum delta, and a one-sided
+ *           Mann-Whitney U test says the new run medians are larger
+ *           (p < alpha); `improved` is the mirror image.
+ *           Otherwise it is `unchanged`, or `new` without a baseline row,
+ *           `invalid` if it failed verification, or `skip`. The test is
+ *           exact for small sets without ties and uses the normal
+ *           approximation with tie correction otherwise. Regressions and
+ *           invalid rows are listed on stderr and make the exit status 1.
+ *
+ * The keys of a row are the -l, -O and -k options; a `clk_khz` column in the
+ * log (`bench_client -k`) overrides -k row by row.
+ *
+ * Usage:
+ *   bench_baseline record [-l LANG] [-O PROFILE] [-k CLK_KHZ] BASELINE [LOG...]
+ *   bench_baseline check [-l LANG] [-O PROFILE] [-k CLK_KHZ] [-t PCT] [-m TICKS]
+ *                  [-a ALPHA] BASELINE [LOG...]
+ *
+ *   -l   Language key (default: c)
+ *   -O   Optimisation profile key (default: O2)
+ *   -k   Clock key in kHz (default: 125000)
+ *   -t   Regression threshold on the median, in percent (default: 5)
+ *   -m   Minimum change of the median, in timer ticks (default: 4): cycles
+ *        of the clock key, or nanoseconds for `host`. Changes of a tick or
+ *        two are timer resolution, not regressions.
+ *   -a   Significance level of the test (default: 0.01)
+ *   LOG  Result logs; stdin if none or "-"
+ *
+ * Example:
+ *   for i in 1 2 3 4 5; do c_benchmarks_host -b fft | bench_decode -r; done |
+ *       bench_baseline check -O host -k host base.csv
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_log.h"
+
+#define MAX_NAME 64
+#define EXACT_MAX_N 20  ///< Largest set size for the exact U distribution
+
+#define DEFAULT_THRESHOLD_PCT 5.0
+#define DEFAULT_MIN_TICKS 4.0
+#define DEFAULT_ALPHA 0.01
+#define HOST_TICK_US 0.001  ///< The host build times with clock_gettime (ns)
+
+static const char* const baseline_header =
+    "language,profile,clk_khz,task,method,param_name,param,kind,count,median_us,samples";
+
+/**
+ * @brief Growable array of observations in microseconds.
+ */
+typedef struct {
+    double* v;
+    size_t n;
+    size_t cap;
+} series_t;
+
+/**
+ * @brief One baseline row, or the observations of one benchmark in the new logs.
+ */
+typedef struct {
+    char language[MAX_NAME];
+    char profile[MAX_NAME];
+    char clk_khz[MAX_NAME];
+    char task[MAX_NAME];
+    char method[MAX_NAME];
+    char param_name[MAX_NAME];
+    char param[MAX_NAME];
+    series_t runs;     ///< One median per run
+    series_t current;  ///< Raw samples of the run being read (new logs only)
+    unsigned long skipped;
+    unsigned long invalid;
+} entry_t;
+
+/**
+ * @brief A list of entries with a lookup cache for consecutive rows.
+ */
+typedef struct {
+    entry_t* items;
+    size_t n;
+    size_t cap;
+    size_t last;
+} entry_list_t;
+
+static const char* opt_language = "c";
+static const char* opt_profile = "O2";
+static const char* opt_clk = "125000";
+
+static void* xrealloc(void* p, size_t size) {
+    p = realloc(p, size);
+    if (!p) {
+        fprintf(stderr, "bench_baseline: out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+static bool equals(const char* a, const char* b) {
+    return strcmp(a, b) == 0;
+}
+
+static void series_push(series_t* s, double v) {
+    if (s->n == s->cap) {
+        s->cap = s->cap ? 2 * s->cap : 16;
+        s->v = xrealloc(s->v, s->cap * sizeof(double));
+    }
+    s->v[s->n++] = v;
+}
+
+static int compare_double(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static void series_sort(series_t* s) {
+    if (s->n) {
+        qsort(s->v, s->n, sizeof(double), compare_double);
+    }
+}
+
+/**
+ * @brief Nearest-rank median of a sorted series (as bench_stats.h).
+ */
+static double median_of(const series_t* s) {
+    size_t rank = (s->n + 1) / 2;
+    return s->v[rank ? rank - 1 : 0];
+}
+
+static bool same_key(const entry_t* a, const entry_t* b) {
+    return equals(a->language, b->language) && equals(a->profile, b->profile) &&
+           equals(a->clk_khz, b->clk_khz) && equals(a->task, b->task) &&
+           equals(a->method, b->method) && equals(a->param, b->param);
+}
+
+static entry_t* find_entry(entry_list_t* list, const entry_t* key, bool create) {
+    if (list->last < list->n && same_key(&list->items[list->last], key)) {
+        return &list->items[list->last];
+    }
+    for (size_t i = 0; i < list->n; i++) {
+        if (same_key(&list->items[i], key)) {
+            list->last = i;
+            return &list->items[i];
+        }
+    }
+    if (!create) {
+        return NULL;
+    }
+
+    if (list->n == list->cap) {
+        list->cap = list->cap ? 2 * list->cap : 64;
+        list->items = xrealloc(list->items, list->cap * sizeof(entry_t));
+    }
+    entry_t* e = &list->items[list->n];
+    *e = *key;
+    list->last = list->n++;
+    return e;
+}
+
+// ----------------------------------------------------
+// New logs
+// ----------------------------------------------------
+
+/**
+ * @brief Reduce the raw samples read so far to one run median.
+ */
+static void end_run(entry_t* e) {
+    if (e->current.n) {
+        series_sort(&e->current);
+        series_push(&e->runs, median_of(&e->current));
+        e->current.n = 0;
+    }
+}
+
+/**
+ * @brief Record one log row (bench_log_fn) into the entry list in ctx.
+ */
+static void add_row(const bench_log_row_t* row, void* ctx) {
+    entry_t key = {0};
+    snprintf(key.language, sizeof(key.language), "%s", opt_language);
+    snprintf(key.profile, sizeof(key.profile), "%s", opt_profile);
+    snprintf(key.clk_khz, sizeof(key.clk_khz), "%s", row->clk_khz ? row->clk_khz : opt_clk);
+    snprintf(key.task, sizeof(key.task), "%s", row->task);
+    snprintf(key.method, sizeof(key.method), "%s", row->method);
+    snprintf(key.param_name, sizeof(key.param_name), "%s", row->param_name);
+    snprintf(key.param, sizeof(key.param), "%s", row->param);
+
+    entry_t* e = find_entry(ctx, &key, true);
+    switch (row->kind) {
+        case BENCH_LOG_SKIP: e->skipped++; break;
+        case BENCH_LOG_INVALID: e->invalid++; break;
+        case BENCH_LOG_SAMPLE:
+            if (row->run_start) {
+                end_run(e);
+            }
+            series_push(&e->current, row->time_us);
+            break;
+        case BENCH_LOG_RUN: series_push(&e->runs, row->time_us); break;
+    }
+}
+
+static bool read_logs(char** paths, int count, entry_list_t* list) {
+    bool ok = true;
+    if (!count) {
+        ok = bench_log_read("-", add_row, list);
+    }
+    for (int i = 0; i < count; i++) {
+        ok &= bench_log_read(paths[i], add_row, list);
+    }
+    for (size_t i = 0; i < list->n; i++) {
+        end_run(&list->items[i]);
+        series_sort(&list->items[i].runs);
+    }
+    return ok;
+}
+
+// ----------------------------------------------------
+// Baseline file
+// ----------------------------------------------------
+
+/**
+ * @brief Copy the next comma-separated field of *line into out.
+ */
+static bool next_field(char** line, char* out, size_t size) {
+    if (!*line) {
+        return false;
+    }
+    char* comma = strchr(*line, ',');
+    size_t len = comma ? (size_t)(comma - *line) : strlen(*line);
+    snprintf(out, size, "%.*s", (int)len, *line);
+    *line = comma ? comma + 1 : NULL;
+    return true;
+}
+
+/**
+ * @brief Parse the `value[:count] ...` samples field.
+ */
+static bool parse_samples(char* text, series_t* out) {
+    for (char* tok = strtok(text, " "); tok; tok = strtok(NULL, " ")) {
+        char* end;
+        double v = strtod(tok, &end);
+        unsigned long count = 1;
+        if (*end == ':') {
+            count = strtoul(end + 1, &end, 10);
+        }
+        if (*end != '\0' || end == tok || !count) {
+            return false;
+        }
+        while (count--) {
+            series_push(out, v);
+        }
+    }
+    return out->n > 0;
+}
+
+/**
+ * @brief Load a baseline file; a missing file is an empty baseline.
+ */
+static bool load_baseline(const char* path, entry_list_t* list) {
+    FILE* in = fopen(path, "r");
+    if (!in) {
+        return true;
+    }
+
+    char* line = NULL;
+    size_t cap = 0;
+    unsigned long line_no = 0;
+    bool ok = true;
+    while (ok && getline(&line, &cap, in) != -1) {
+        line_no++;
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line_no == 1 || !line[0]) {
+            continue;  // header
+        }
+
+        entry_t e = {0};
+        char kind[MAX_NAME], count[MAX_NAME], median[MAX_NAME];
+        char* p = line;
+        ok = next_field(&p, e.language, sizeof(e.language)) &&
+             next_field(&p, e.profile, sizeof(e.profile)) &&
+             next_field(&p, e.clk_khz, sizeof(e.clk_khz)) &&
+             next_field(&p, e.task, sizeof(e.task)) &&
+             next_field(&p, e.method, sizeof(e.method)) &&
+             next_field(&p, e.param_name, sizeof(e.param_name)) &&
+             next_field(&p, e.param, sizeof(e.param)) && next_field(&p, kind, sizeof(kind)) &&
+             next_field(&p, count, sizeof(count)) && next_field(&p, median, sizeof(median)) &&
+             p && parse_samples(p, &e.runs);
+        if (!ok) {
+            fprintf(stderr, "%s:%lu: malformed baseline row\n", path, line_no);
+            break;
+        }
+        series_sort(&e.runs);
+        if (equals(kind, "samples")) {
+            e.runs.v[0] = median_of(&e.runs);  // Raw samples of one run
+            e.runs.n = 1;
+        }
+        *find_entry(list, &e, true) = e;
+    }
+
+    free(line);
+    fclose(in);
+    return ok;
+}
+
+static bool save_baseline(const char* path, const entry_list_t* list) {
+    FILE* out = fopen(path, "w");
+    if (!out) {
+        perror(path);
+        return false;
+    }
+
+    fprintf(out, "%s\n", baseline_header);
+    for (size_t i = 0; i < list->n; i++) {
+        const entry_t* e = &list->items[i];
+        const series_t* s = &e->runs;
+        fprintf(out, "%s,%s,%s,%s,%s,%s,%s,runs,%lu,%.10g,", e->language, e->profile, e->clk_khz,
+                e->task, e->method, e->param_name, e->param, (unsigned long)s->n, median_of(s));
+        for (size_t j = 0; j < s->n;) {
+            size_t k = j;
+            while (k < s->n && s->v[k] == s->v[j]) {
+                k++;
+            }
+            fprintf(out, j ? " %.10g" : "%.10g", s->v[j]);
+            if (k - j > 1) {
+                fprintf(out, ":%lu", (unsigned long)(k - j));
+            }
+            j = k;
+        }
+        fprintf(out, "\n");
+    }
+    return fclose(out) == 0;
+}
+
+static int record(const char* path, char** logs, int num_logs) {
+    entry_list_t base = {0}, run = {0};
+    if (!load_baseline(path, &base) || !read_logs(logs, num_logs, &run)) {
+        return 1;
+    }
+
+    unsigned long recorded = 0;
+    for (size_t i = 0; i < run.n; i++) {
+        entry_t* e = &run.items[i];
+        if (e->invalid) {
+            fprintf(stderr, "bench_baseline: %s.%s %s=%s failed verification, not recorded\n",
+                    e->task, e->method, e->param_name, e->param);
+            continue;
+        }
+        if (!e->runs.n) {
+            continue;  // skipped
+        }
+        *find_entry(&base, e, true) = *e;
+        recorded++;
+    }
+
+    if (!save_baseline(path, &base)) {
+        return 1;
+    }
+    fprintf(stderr, "bench_baseline: %lu benchmark(s) recorded in %s\n", recorded, path);
+    return 0;
+}
+
+// ----------------------------------------------------
+// Regression check
+// ----------------------------------------------------
+
+/**
+ * @brief One-sided Mann-Whitney U p-values of y against x (both sorted).
+ *
+ * p_greater is the probability, under the null hypothesis of identical
+ * distributions, of a U statistic of y at least as large as observed (y
+ * tends to be larger); p_less is the opposite tail.
+ */
+static void mann_whitney(const series_t* x, const series_t* y, double* p_greater,
+                         double* p_less) {
+    size_t nx = x->n, ny = y->n, total = nx + ny;
+
+    // Rank sum of y over the merged sets, averaging tied ranks
+    double rank_sum = 0.0, ties = 0.0, rank = 1.0;
+    for (size_t i = 0, j = 0; i < nx || j < ny;) {
+        double v = (j >= ny || (i < nx && x->v[i] <= y->v[j])) ? x->v[i] : y->v[j];
+        size_t cx = 0, cy = 0;
+        while (i < nx && x->v[i] == v) {
+            i++;
+            cx++;
+        }
+        while (j < ny && y->v[j] == v) {
+            j++;
+            cy++;
+        }
+        double t = (double)(cx + cy);
+        rank_sum += cy * (rank + (t - 1.0) / 2.0);
+        ties += t * t * t - t;
+        rank += t;
+    }
+    double u = rank_sum - ny * (ny + 1.0) / 2.0;
+
+    if (ties == 0.0 && nx <= EXACT_MAX_N && ny <= EXACT_MAX_N) {
+        // Exact null distribution: ways[i][j][u] arrangements of i x's and j
+        // y's with U = u. The largest element is either a y (above all i x's,
+        // adding i to U) or an x (adding nothing).
+        size_t umax = nx * ny;
+        size_t stride = umax + 1;
+        double* ways = xrealloc(NULL, (nx + 1) * (ny + 1) * stride * sizeof(double));
+        for (size_t i = 0; i <= nx; i++) {
+            for (size_t j = 0; j <= ny; j++) {
+                double* w = &ways[(i * (ny + 1) + j) * stride];
+                for (size_t k = 0; k <= umax; k++) {
+                    if (i == 0 || j == 0) {
+                        w[k] = k == 0;
+                        continue;
+                    }
+                    const double* with_y = &ways[(i * (ny + 1) + j - 1) * stride];
+                    const double* with_x = &ways[((i - 1) * (ny + 1) + j) * stride];
+                    w[k] = (k >= i ? with_y[k - i] : 0.0) + with_x[k];
+                }
+            }
+        }
+
+        const double* w = &ways[(nx * (ny + 1) + ny) * stride];
+        double all = 0.0, ge = 0.0, le = 0.0;
+        size_t observed = (size_t)llround(u);
+        for (size_t k = 0; k <= umax; k++) {
+            all += w[k];
+            ge += k >= observed ? w[k] : 0.0;
+            le += k <= observed ? w[k] : 0.0;
+        }
+        free(ways);
+        *p_greater = ge / all;
+        *p_less = le / all;
+        return;
+    }
+
+    double mean = nx * (double)ny / 2.0;
+    double var = nx * (double)ny / 12.0 * ((total + 1.0) - ties / (total * (total - 1.0)));
+    if (var <= 0.0) {
+        *p_greater = *p_less = 1.0;  // every value equal
+        return;
+    }
+    double sd = sqrt(var);
+    *p_greater = 0.5 * erfc((u - mean - 0.5) / sd / sqrt(2.0));
+    *p_less = 0.5 * erfc(-(u - mean + 0.5) / sd / sqrt(2.0));
+}
+
+/**
+ * @brief Duration of one timer tick for a clock key, in microseconds.
+ */
+static double tick_us(const char* clk_khz) {
+    double khz;
+    return bench_log_number(clk_khz, &khz) && khz > 0.0 ? 1000.0 / khz : HOST_TICK_US;
+}
+
+static int check(const char* path, char** logs, int num_logs, double threshold_pct,
+                 double min_ticks, double alpha) {
+    entry_list_t base = {0}, run = {0};
+    if (!load_baseline(path, &base) || !read_logs(logs, num_logs, &run)) {
+        return 1;
+    }
+
+    unsigned long compared = 0, regressed = 0, improved = 0, invalid = 0, fresh = 0;
+    printf("task,method,param,base_median_us,new_median_us,change_pct,p_value,status\n");
+    for (size_t i = 0; i < run.n; i++) {
+        entry_t* e = &run.items[i];
+        const entry_t* b = find_entry(&base, e, false);
+        const series_t* obs = &e->runs;
+        printf("%s,%s,%s,", e->task, e->method, e->param);
+
+        if (e->invalid) {
+            printf(b ? "%.10g,,,,invalid\n" : ",,,,invalid\n", b ? median_of(&b->runs) : 0.0);
+            fprintf(stderr, "INVALID     %s.%s %s=%s failed verification\n", e->task, e->method,
+                    e->param_name, e->param);
+            invalid++;
+            continue;
+        }
+        if (!obs->n) {
+            printf(",,,,skip\n");
+            continue;
+        }
+        double now = median_of(obs);
+        if (!b) {
+            printf(",%.10g,,,new\n", now);
+            fresh++;
+            continue;
+        }
+
+        double was = median_of(&b->runs);
+        double change = was > 0.0 ? 100.0 * (now - was) / was : 0.0;
+        double min_delta = min_ticks * tick_us(e->clk_khz);
+        double p_greater, p_less;
+        mann_whitney(&b->runs, obs, &p_greater, &p_less);
+        double p = now >= was ? p_greater : p_less;
+
+        const char* status = "unchanged";
+        if (change > threshold_pct && now - was >= min_delta && p_greater < alpha) {
+            status = "regressed";
+            regressed++;
+            fprintf(stderr, "REGRESSION  %s.%s %s=%s: %.3f -> %.3f us (%+.1f%%, p=%.2g)\n",
+                    e->task, e->method, e->param_name, e->param, was, now, change, p);
+        } else if (change < -threshold_pct && was - now >= min_delta && p_less < alpha) {
+            status = "improved";
+            improved++;
+        }
+        compared++;
+        printf("%.10g,%.10g,%.2f,%.3g,%s\n", was, now, change, p, status);
+    }
+
+    fprintf(stderr,
+            "bench_baseline: %lu compared, %lu regressed, %lu improved, %lu invalid, %lu new "
+            "(threshold %g%% and %g ticks, alpha %g)\n",
+            compared, regressed, improved, invalid, fresh, threshold_pct, min_ticks, alpha);
+    return regressed || invalid ? 1 : 0;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: bench_baseline record [-l LANG] [-O PROFILE] [-k CLK_KHZ] BASELINE [LOG...]\n"
+            "       bench_baseline check [-l LANG] [-O PROFILE] [-k CLK_KHZ] [-t PCT] [-m TICKS] "
+            "[-a ALPHA] BASELINE [LOG...]\n");
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2 || (!equals(argv[1], "record") && !equals(argv[1], "check"))) {
+        usage();
+        return 2;
+    }
+    bool recording = equals(argv[1], "record");
+
+    double threshold_pct = DEFAULT_THRESHOLD_PCT;
+    double min_ticks = DEFAULT_MIN_TICKS;
+    double alpha = DEFAULT_ALPHA;
+    int opt;
+    optind = 2;
+    while ((opt = getopt(argc, argv, "l:O:k:t:m:a:h")) != -1) {
+        switch (opt) {
+            case 'l': opt_language = optarg; break;
+            case 'O': opt_profile = optarg; break;
+            case 'k': opt_clk = optarg; break;
+            case 't': threshold_pct = atof(optarg); break;
+            case 'm': min_ticks = atof(optarg); break;
+            case 'a': alpha = atof(optarg); break;
+            default: usage(); return 2;
+        }
+    }
+    if (optind >= argc) {
+        usage();
+        return 2;
+    }
+
+    const char* path = argv[optind];
+    char** logs = &argv[optind + 1];
+    int num_logs = argc - optind - 1;
+    return recording ? record(path, logs, num_logs)
+                     : check(path, logs, num_logs, threshold_pct, min_ticks, alpha);
+}
@@ -0,0 +1,374 @@
+/**
+ * @file bench_client.c
+ * @brief Host-side client for the serial command protocol (bench_command.h).
+ *
+ * Sends commands to the benchmark firmware over its USB CDC serial port and
+ * writes the body of each framed response to stdout, so a full sweep runs
+ * without rebuilding or reflashing. For testing without a board, `-x` runs
+ * a command (normally the host build in `-i` mode) on a pseudo-terminal and
+ * talks to it exactly as it would to the device.
+ *
+ * Usage:
+ *   bench_client (-d DEVICE | -x COMMAND) [-s FILTER] [-k KHZ,...] [-t SEC] [command ...]
+ *
+ *   -d DEVICE   Serial port of the firmware, e.g. /dev/ttyACM0
+ *   -x COMMAND  Run COMMAND on a pty instead, e.g. "./c_benchmarks_host -i"
+ *   -s FILTER   Sweep: run every benchmark matching FILTER, one at a time
+ *   -k KHZ,...  Repeat the sweep/commands at each system clock (set clk=KHZ);
+ *               output rows are then prefixed with a clk_khz column
+ *   -t SEC      Timeout waiting for each output line (default 120)
+ *   command     Sent in order after the sweep; if neither a sweep nor
+ *               commands are given, commands are read from stdin
+ *
+ * Examples:
+ *   bench_client -d /dev/ttyACM0 -s software -k 125000,200000 > sweep.csv
+ *   bench_client -x "./c_benchmarks_host -i" "run fft n=64,128 reps=200"
+ *
+ * Exit status is non-zero if any command answered with `@end error`.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#define _XOPEN_SOURCE 600
+#define _DEFAULT_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+#include "bench_command.h"
+
+#define LINE_MAX_LEN 512
+#define MAX_CLOCKS 16
+#define MAX_SWEEP 64
+#define SYNC_ATTEMPTS 10  ///< ping attempts (1 s apart) before giving up
+
+/**
+ * @brief Connection to the firmware plus a small line reassembly buffer.
+ */
+typedef struct {
+    int fd;
+    pid_t child;  ///< Child process for -x, or 0
+    char buf[LINE_MAX_LEN];
+    size_t len;
+    int timeout_ms;
+} conn_t;
+
+static void set_raw(int fd) {
+    struct termios tio;
+    if (tcgetattr(fd, &tio) == 0) {
+        cfmakeraw(&tio);  // No echo, no CR/LF translation
+        cfsetispeed(&tio, B115200);
+        cfsetospeed(&tio, B115200);
+        tcsetattr(fd, TCSANOW, &tio);
+    }
+}
+
+static bool open_device(conn_t* c, const char* path) {
+    c->fd = open(path, O_RDWR | O_NOCTTY);
+    if (c->fd < 0) {
+        fprintf(stderr, "bench_client: %s: %s\n", path, strerror(errno));
+        return false;
+    }
+    set_raw(c->fd);
+    tcflush(c->fd, TCIOFLUSH);
+    return true;
+}
+
+/**
+ * @brief Start `command` via /bin/sh with a pty as its stdin/stdout.
+ */
+static bool open_pty(conn_t* c, const char* command) {
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+        perror("bench_client: pty");
+        return false;
+    }
+    const char* slave_name = ptsname(master);
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("bench_client: fork");
+        return false;
+    }
+    if (pid == 0) {
+        setsid();
+        int slave = open(slave_name, O_RDWR);
+        if (slave < 0) {
+            _exit(127);
+        }
+        set_raw(slave);
+        dup2(slave, STDIN_FILENO);
+        dup2(slave, STDOUT_FILENO);
+        close(slave);
+        close(master);
+        execl("/bin/sh", "sh", "-c", command, (char*)NULL);
+        _exit(127);
+    }
+
+    c->fd = master;
+    c->child = pid;
+    return true;
+}
+
+static void close_conn(conn_t* c) {
+    close(c->fd);
+    if (c->child > 0) {
+        kill(c->child, SIGTERM);
+        waitpid(c->child, NULL, 0);
+    }
+}
+
+/**
+ * @brief Read one line (CR stripped) into `line`.
+ *
+ * @return 1 on success, 0 on timeout, -1 on end of stream or error.
+ */
+static int read_line(conn_t* c, char* line, size_t size, int timeout_ms) {
+    for (;;) {
+        char* nl = memchr(c->buf, '\n', c->len);
+        if (nl) {
+            size_t n = (size_t)(nl - c->buf);
+            size_t copy = n < size - 1 ? n : size - 1;
+            memcpy(line, c->buf, copy);
+            line[copy] = '\0';
+            if (copy > 0 && line[copy - 1] == '\r') {
+                line[copy - 1] = '\0';
+            }
+            c->len -= n + 1;
+            memmove(c->buf, nl + 1, c->len);
+            return 1;
+        }
+        if (c->len == sizeof(c->buf)) {
+            c->len = 0;  // Overlong line: discard
+        }
+
+        struct pollfd pfd = { .fd = c->fd, .events = POLLIN };
+        int r = poll(&pfd, 1, timeout_ms);
+        if (r == 0) {
+            return 0;
+        }
+        if (r < 0) {
+            return -1;
+        }
+        ssize_t got = read(c->fd, c->buf + c->len, sizeof(c->buf) - c->len);
+        if (got <= 0) {
+            return -1;  // EOF, or EIO once the pty child has exited
+        }
+        c->len += (size_t)got;
+    }
+}
+
+static bool send_line(conn_t* c, const char* command) {
+    size_t len = strlen(command);
+    return write(c->fd, command, len) == (ssize_t)len && write(c->fd, "\n", 1) == 1;
+}
+
+typedef void (*body_fn_t)(const char* line, void* user);
+
+/**
+ * @brief Send one command and pass each body line of its response to `body`.
+ *
+ * Lines before the @begin frame (boot banners, stale output) are skipped.
+ *
+ * @return 1 on `@end ok`, 0 on `@end error`, -1 on timeout or disconnect.
+ */
+static int transact(conn_t* c, const char* command, body_fn_t body, void* user, int timeout_ms) {
+    char line[LINE_MAX_LEN];
+    bool in_frame = false;
+
+    if (!send_line(c, command)) {
+        return -1;
+    }
+
+    for (;;) {
+        int r = read_line(c, line, sizeof(line), timeout_ms);
+        if (r <= 0) {
+            return -1;
+        }
+        if (!in_frame) {
+            in_frame = strncmp(line, BENCH_FRAME_BEGIN, strlen(BENCH_FRAME_BEGIN)) == 0;
+            continue;
+        }
+        if (strncmp(line, BENCH_FRAME_END, strlen(BENCH_FRAME_END)) == 0) {
+            if (strcmp(line, BENCH_FRAME_END " ok") == 0) {
+                return 1;
+            }
+            fprintf(stderr, "bench_client: '%s': %s\n", command,
+                    line + strlen(BENCH_FRAME_END " "));
+            return 0;
+        }
+        if (body) {
+            body(line, user);
+        }
+    }
+}
+
+/**
+ * @brief Wait until the firmware answers `ping`, e.g. right after USB enumerates.
+ */
+static bool sync_firmware(conn_t* c) {
+    for (int i = 0; i < SYNC_ATTEMPTS; i++) {
+        if (transact(c, "ping", NULL, NULL, 1000) == 1) {
+            return true;
+        }
+    }
+    fprintf(stderr, "bench_client: firmware did not answer ping\n");
+    return false;
+}
+
+/// Current clk_khz prefix for output rows (NULL when not sweeping clocks)
+static const char* clock_prefix = NULL;
+
+static void print_body(const char* line, void* user) {
+    (void)user;
+    if (clock_prefix && strchr(line, ',')) {
+        bool header = strncmp(line, "task,", 5) == 0 || strncmp(line, "backend,", 8) == 0;
+        printf("%s,%s\n", header ? "clk_khz" : clock_prefix, line);
+    } else {
+        printf("%s\n", line);
+    }
+    fflush(stdout);
+}
+
+/**
+ * @brief Collect "task.method" names from the body of a `list` response.
+ */
+typedef struct {
+    char names[MAX_SWEEP][64];
+    size_t count;
+} sweep_t;
+
+static void collect_names(const char* line, void* user) {
+    sweep_t* sweep = user;
+    const char* comma = strchr(line, ',');
+    const char* comma2 = comma ? strchr(comma + 1, ',') : NULL;
+    if (!comma2 || strncmp(line, "task,", 5) == 0 || sweep->count == MAX_SWEEP) {
+        return;
+    }
+    snprintf(sweep->names[sweep->count], sizeof(sweep->names[0]), "%.*s.%.*s",
+             (int)(comma - line), line, (int)(comma2 - comma - 1), comma + 1);
+    sweep->count++;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: bench_client (-d DEVICE | -x COMMAND) [-s FILTER] [-k KHZ,...] "
+            "[-t SEC] [command ...]\n");
+}
+
+int main(int argc, char** argv) {
+    const char* device = NULL;
+    const char* exec_cmd = NULL;
+    const char* sweep_filter = NULL;
+    char* clocks[MAX_CLOCKS];
+    size_t num_clocks = 0;
+    int timeout_s = 120;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "d:x:s:k:t:h")) != -1) {
+        switch (opt) {
+            case 'd': device = optarg; break;
+            case 'x': exec_cmd = optarg; break;
+            case 's': sweep_filter = optarg; break;
+            case 't': timeout_s = atoi(optarg); break;
+            case 'k':
+                for (char* tok = strtok(optarg, ","); tok && num_clocks < MAX_CLOCKS;
+                     tok = strtok(NULL, ",")) {
+                    clocks[num_clocks++] = tok;
+                }
+                break;
+            default:
+                usage();
+                return 2;
+        }
+    }
+    if ((device == NULL) == (exec_cmd == NULL) || timeout_s <= 0) {
+        usage();
+        return 2;
+    }
+
+    conn_t conn = { .fd = -1, .child = 0, .len = 0, .timeout_ms = timeout_s * 1000 };
+    if (device ? !open_device(&conn, device) : !open_pty(&conn, exec_cmd)) {
+        return 1;
+    }
+    if (!sync_firmware(&conn)) {
+        close_conn(&conn);
+        return 1;
+    }
+
+    static sweep_t sweep;
+    if (sweep_filter) {
+        char list_cmd[BENCH_CMD_MAX_LINE];
+        snprintf(list_cmd, sizeof(list_cmd), "list %s", sweep_filter);
+        if (transact(&conn, list_cmd, collect_names, &sweep, conn.timeout_ms) != 1) {
+            close_conn(&conn);
+            return 1;
+        }
+    }
+
+    bool from_stdin = sweep_filter == NULL && optind == argc;
+    int failures = 0;
+    size_t passes = num_clocks ? num_clocks : 1;
+
+    for (size_t k = 0; k < passes; k++) {
+        char command[BENCH_CMD_MAX_LINE];
+
+        if (num_clocks) {
+            clock_prefix = clocks[k];
+            snprintf(command, sizeof(command), "set clk=%s", clocks[k]);
+            if (transact(&conn, command, print_body, NULL, conn.timeout_ms) != 1) {
+                failures++;
+                continue;
+            }
+        }
+
+        for (size_t i = 0; i < sweep.count; i++) {
+            snprintf(command, sizeof(command), "run %s", sweep.names[i]);
+            int r = transact(&conn, command, print_body, NULL, conn.timeout_ms);
+            if (r < 0) {
+                fprintf(stderr, "bench_client: no response to '%s'\n", command);
+                close_conn(&conn);
+                return 1;
+            }
+            failures += r == 0;
+        }
+
+        for (int i = optind; i < argc; i++) {
+            int r = transact(&conn, argv[i], print_body, NULL, conn.timeout_ms);
+            if (r < 0) {
+                fprintf(stderr, "bench_client: no response to '%s'\n", argv[i]);
+                close_conn(&conn);
+                return 1;
+            }
+            failures += r == 0;
+        }
+
+        if (from_stdin) {
+            while (fgets(command, sizeof(command), stdin)) {
+                command[strcspn(command, "\r\n")] = '\0';
+                if (command[0] == '\0') {
+                    continue;
+                }
+                int r = transact(&conn, command, print_body, NULL, conn.timeout_ms);
+                if (r < 0) {
+                    fprintf(stderr, "bench_client: no response to '%s'\n", command);
+                    close_conn(&conn);
+                    return 1;
+                }
+                failures += r == 0;
+            }
+            break;  // stdin can only be consumed once
+        }
+    }
+
+    close_conn(&conn);
+    return failures ? 1 : 0;
+}
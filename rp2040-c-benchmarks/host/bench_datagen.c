@@ -0,0 +1,99 @@
+/**
+ * @file bench_datagen.c
+ * @brief Print reference sequences of every input-data generator (bench_data.h).
+ *
+ * The TinyGo suite's src/datagen prints the same table from its port of the
+ * generators (src/common/data.go); scripts/check_data_parity.sh runs both
+ * and compares them byte for byte. Each generator uses its own stream of
+ * the given seed:
+ *
+ *   stream  generator  parameters
+ *   0       pcg32      raw 32-bit outputs
+ *   1       below      bound 1000
+ *   2       uniform    [-1000000, 1000000]
+ *   3       gaussian   mean 0, standard deviation 1000
+ *   4       runs       run length 16
+ *   5       tones      bins 5 and 37 at 0.5 and 0.25 full scale, noise ±64
+ *   -       sin        bench_data_sin_q15 at phase i · (2^32 / count)
+ *
+ * Output format:
+ *   generator,index,value
+ *
+ * Usage:
+ *   bench_datagen [SEED [COUNT]]   (defaults: seed 1, count 1024)
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench_data.h"
+
+static const bench_tone_t datagen_tones[] = {{5, 16384}, {37, 8192}};
+
+static void print_i32(const char* generator, const int32_t* values, int count) {
+    for (int i = 0; i < count; i++) {
+        printf("%s,%d,%ld\n", generator, i, (long)values[i]);
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc > 3 || (argc > 1 && argv[1][0] == '-')) {
+        fprintf(stderr, "usage: %s [SEED [COUNT]]\n", argv[0]);
+        return 2;
+    }
+    uint64_t seed = argc > 1 ? strtoull(argv[1], NULL, 0) : 1;
+    int count = argc > 2 ? atoi(argv[2]) : 1024;
+    if (count < 1) {
+        fprintf(stderr, "bench_datagen: COUNT must be at least 1\n");
+        return 2;
+    }
+
+    int32_t* values = malloc((size_t)count * sizeof(int32_t));
+    int16_t* samples = malloc((size_t)count * sizeof(int16_t));
+    if (!values || !samples) {
+        fprintf(stderr, "bench_datagen: out of memory\n");
+        return 1;
+    }
+
+    printf("generator,index,value\n");
+    bench_rng_t rng;
+
+    bench_rng_seed(&rng, seed, 0);
+    for (int i = 0; i < count; i++) {
+        printf("pcg32,%d,%lu\n", i, (unsigned long)bench_rng_next(&rng));
+    }
+
+    bench_rng_seed(&rng, seed, 1);
+    for (int i = 0; i < count; i++) {
+        printf("below,%d,%lu\n", i, (unsigned long)bench_rng_below(&rng, 1000));
+    }
+
+    bench_rng_seed(&rng, seed, 2);
+    bench_data_uniform_i32(values, count, &rng, -1000000, 1000000);
+    print_i32("uniform", values, count);
+
+    bench_rng_seed(&rng, seed, 3);
+    bench_data_gaussian_i32(values, count, &rng, 0, 1000);
+    print_i32("gaussian", values, count);
+
+    bench_rng_seed(&rng, seed, 4);
+    bench_data_sorted_runs_i32(values, count, &rng, 16);
+    print_i32("runs", values, count);
+
+    bench_rng_seed(&rng, seed, 5);
+    bench_data_tones_i16(samples, count, datagen_tones,
+                         (int)(sizeof(datagen_tones) / sizeof(datagen_tones[0])), &rng, 64);
+    for (int i = 0; i < count; i++) {
+        printf("tones,%d,%d\n", i, samples[i]);
+    }
+
+    for (int i = 0; i < count; i++) {
+        uint32_t phase = (uint32_t)(((uint64_t)i << 32) / (uint64_t)count);
+        printf("sin,%d,%d\n", i, bench_data_sin_q15(phase));
+    }
+
+    free(values);
+    free(samples);
+    return 0;
+}
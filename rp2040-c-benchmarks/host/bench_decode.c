@@ -0,0 +1,576 @@
+/**
+ * @file bench_decode.c
+ * @brief Decode a bench_wire.h binary stream back into the suite's CSV.
+ *
+ * Reads a captured serial stream (file or stdin) that may mix text and
+ * binary frames. Text is passed through unchanged; result frames become the
+ * same `task,method,<param>,time_us,...,valid` rows the runner prints in CSV
+ * mode (statistics are recomputed from the transmitted samples with the
+ * suite's own reduction; runs that failed verification become `invalid` rows
+ * as on the device), and probe edge frames become `timestamp_us,state`
+ * rows. Frames with a bad CRC are skipped and counted on stderr.
+ *
+ * Self-check (-s): encodes result frames with random samples and with
+ * samples either side of the 24-bit SysTick wrap, skipped results and edge
+ * batches that wrap the 32-bit timestamp, decodes them and checks every
+ * field exactly. Each frame must then fail its CRC with one payload byte
+ * flipped, be rejected when truncated, and be refused by an encoder buffer
+ * one byte too small; a payload with an over-long varint must be rejected.
+ * Exits 1 on the first mismatch.
+ *
+ * Usage:
+ *   bench_decode [-r] [FILE]
+ *   bench_decode -s [-S SEED]
+ *
+ *   -r       Print every raw sample (task,method,<param>,index,cycles,time_us)
+ *            instead of the summary row
+ *   -S SEED  Self-check generator seed (default: 1)
+ *
+ * Example:
+ *   cat /dev/ttyACM0 > capture.bin      # firmware in `set format=binary`
+ *   bench_decode capture.bin > results.csv
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_data.h"
+#include "bench_stats.h"
+#include "bench_wire.h"
+
+#define WINDOW_SIZE (2u * (BENCH_WIRE_HEADER_SIZE + BENCH_WIRE_MAX_PAYLOAD + BENCH_WIRE_CRC_SIZE))
+#define MAX_EDGES 65536  ///< Upper bound on edges per frame (payload-limited anyway)
+#define TEXT_MAX 1024
+#define SYSTICK_WRAP 0x1000000u  ///< 24-bit SysTick period (bench_timer.h)
+#define CHECK_ROUNDS 200         ///< Random frames of each kind in the self-check
+
+static uint8_t window[WINDOW_SIZE];
+static uint32_t samples[BENCH_MAX_SAMPLES];
+static uint32_t timestamps[MAX_EDGES];
+static uint8_t check_frame[BENCH_WIRE_RESULT_FRAME_SIZE(BENCH_MAX_SAMPLES)];
+static uint32_t check_values[BENCH_MAX_SAMPLES];
+
+/// What was printed last, so headers are repeated only when the layout changes
+static enum { LAST_TEXT, LAST_RESULT, LAST_EDGES } last_output = LAST_TEXT;
+static char last_task[BENCH_WIRE_MAX_NAME];
+static char last_method[BENCH_WIRE_MAX_NAME];
+
+static char text[TEXT_MAX];
+static size_t text_len = 0;
+
+static bool raw_samples = false;
+static unsigned long bad_frames = 0;
+static unsigned long packed_frames = 0;
+
+static void flush_text(void) {
+    if (text_len) {
+        fwrite(text, 1, text_len, stdout);
+        text_len = 0;
+    }
+}
+
+static void put_text(uint8_t c) {
+    if (text_len == sizeof(text)) {
+        flush_text();
+    }
+    text[text_len++] = (char)c;
+    if (c == '\n') {
+        flush_text();
+        last_output = LAST_TEXT;
+    }
+}
+
+static void print_params(const bench_wire_result_t* r) {
+    for (uint8_t i = 0; i < r->num_params; i++) {
+        printf(i ? ";%ld" : "%ld", (long)r->params[i]);
+    }
+}
+
+static void handle_result(const bench_wire_result_t* r) {
+    bool new_block = last_output != LAST_RESULT ||
+                     strcmp(last_task, r->task) != 0 || strcmp(last_method, r->method) != 0;
+    if (new_block) {
+        if (raw_samples) {
+            printf("task,method,%s,index,cycles,time_us\n", r->param_name);
+        } else {
+            printf("task,method,%s," BENCH_STATS_CSV_COLUMNS ",valid\n", r->param_name);
+        }
+        snprintf(last_task, sizeof(last_task), "%s", r->task);
+        snprintf(last_method, sizeof(last_method), "%s", r->method);
+        last_output = LAST_RESULT;
+    }
+
+    if (r->flags & BENCH_WIRE_FLAG_SKIPPED) {
+        printf("%s,%s,", r->task, r->method);
+        print_params(r);
+        printf(",skip\n");
+        return;
+    }
+
+    // Raw mode keeps the samples of invalid runs for inspection
+    if (raw_samples) {
+        double us_per_cycle = 1000000.0 / r->timer_hz;
+        for (uint32_t i = 0; i < r->num_samples; i++) {
+            printf("%s,%s,", r->task, r->method);
+            print_params(r);
+            printf(",%lu,%lu,%.3f\n", (unsigned long)i, (unsigned long)r->samples[i],
+                   r->samples[i] * us_per_cycle);
+        }
+        return;
+    }
+
+    if (!(r->flags & BENCH_WIRE_FLAG_VALID)) {
+        printf("%s,%s,", r->task, r->method);
+        print_params(r);
+        printf(",invalid\n");
+        return;
+    }
+
+    bench_stats_t stats;
+    bench_stats_reduce(r->samples, r->num_samples, &stats);
+    stats.raw_median = r->raw_median;
+    stats.overhead = r->overhead;
+
+    printf("%s,%s,", r->task, r->method);
+    print_params(r);
+    printf(",");
+    bench_print_stats_hz(&stats, r->timer_hz);
+    printf(",1\n");
+}
+
+static void handle_edges(const bench_wire_edges_t* e) {
+    if (last_output != LAST_EDGES) {
+        printf("timestamp_us,state\n");
+        last_output = LAST_EDGES;
+    }
+    for (uint32_t i = 0; i < e->num_edges; i++) {
+        int state = (e->first_state ^ (i & 1u)) & 1;
+        if (e->timer_hz == 1000000u) {
+            printf("%lu,%d\n", (unsigned long)e->timestamps[i], state);
+        } else {
+            printf("%.3f,%d\n", e->timestamps[i] * 1000000.0 / e->timer_hz, state);
+        }
+    }
+}
+
+/**
+ * @brief Decode one validated frame.
+ */
+static void handle_frame(bench_wire_type_t type, const uint8_t* payload, size_t len) {
+    flush_text();
+
+    if (type == BENCH_WIRE_RESULT) {
+        static bench_wire_result_t result;
+        if (bench_wire_decode_result(payload, len, &result, samples, BENCH_MAX_SAMPLES)) {
+            handle_result(&result);
+            return;
+        }
+    } else if (type == BENCH_WIRE_EDGES) {
+        static bench_wire_edges_t edges;
+        if (bench_wire_decode_edges(payload, len, &edges, timestamps, MAX_EDGES)) {
+            handle_edges(&edges);
+            return;
+        }
+    } else if (type == BENCH_WIRE_EDGES_PACKED) {
+        packed_frames++;  // tools/host/edge_unpack decodes these
+        return;
+    }
+    bad_frames++;  // Valid CRC but unknown type or malformed payload
+}
+
+// ----------------------------------------------------
+// Self-check
+// ----------------------------------------------------
+
+/**
+ * @brief Reject the frame in check_frame with one payload byte flipped, truncated or cut short.
+ *
+ * @param len Length of the valid frame in check_frame.
+ */
+static bool check_damage(const char* what, size_t len, bench_rng_t* rng) {
+    bench_wire_type_t type;
+    const uint8_t* payload;
+    size_t payload_len;
+    size_t frame_len;
+
+    for (size_t cut = 0; cut < len; cut++) {
+        if (bench_wire_parse_frame(check_frame, cut, &type, &payload, &payload_len, &frame_len) !=
+            BENCH_WIRE_FRAME_INCOMPLETE) {
+            fprintf(stderr, "bench_decode: %s: frame truncated to %zu of %zu bytes accepted\n",
+                    what, cut, len);
+            return false;
+        }
+    }
+
+    size_t plen = len - BENCH_WIRE_HEADER_SIZE - BENCH_WIRE_CRC_SIZE;
+    if (plen > 0) {
+        size_t at = BENCH_WIRE_HEADER_SIZE + bench_rng_below(rng, (uint32_t)plen);
+        uint8_t flip = (uint8_t)(1u + bench_rng_below(rng, 255));
+        check_frame[at] ^= flip;
+        bench_wire_frame_status_t status =
+            bench_wire_parse_frame(check_frame, len, &type, &payload, &payload_len, &frame_len);
+        check_frame[at] ^= flip;
+        if (status != BENCH_WIRE_FRAME_BAD) {
+            fprintf(stderr, "bench_decode: %s: payload byte %zu flipped, CRC still accepted\n",
+                    what, at - BENCH_WIRE_HEADER_SIZE);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Validate the frame in check_frame and return its payload.
+ */
+static bool check_parse(const char* what, size_t len, bench_wire_type_t expected,
+                        const uint8_t** payload, size_t* payload_len) {
+    bench_wire_type_t type;
+    size_t frame_len;
+    if (len == 0 ||
+        bench_wire_parse_frame(check_frame, len, &type, payload, payload_len, &frame_len) !=
+            BENCH_WIRE_FRAME_OK ||
+        type != expected || frame_len != len) {
+        fprintf(stderr, "bench_decode: %s: encoded frame not accepted\n", what);
+        return false;
+    }
+    return true;
+}
+
+static bool check_result(const char* what, const bench_wire_result_t* in, bench_rng_t* rng) {
+    size_t len = bench_wire_encode_result(check_frame, sizeof(check_frame), in);
+    const uint8_t* payload;
+    size_t payload_len;
+    if (!check_parse(what, len, BENCH_WIRE_RESULT, &payload, &payload_len)) {
+        return false;
+    }
+
+    static bench_wire_result_t out;
+    bool same = bench_wire_decode_result(payload, payload_len, &out, samples, BENCH_MAX_SAMPLES) &&
+                strcmp(out.task, in->task) == 0 && strcmp(out.method, in->method) == 0 &&
+                strcmp(out.param_name, in->param_name) == 0 && out.num_params == in->num_params &&
+                memcmp(out.params, in->params, in->num_params * sizeof(in->params[0])) == 0 &&
+                out.timer_hz == in->timer_hz && out.overhead == in->overhead &&
+                out.raw_median == in->raw_median && out.flags == in->flags &&
+                out.num_samples == in->num_samples &&
+                memcmp(out.samples, in->samples, in->num_samples * sizeof(in->samples[0])) == 0;
+    if (!same) {
+        fprintf(stderr, "bench_decode: %s: result %s/%s did not round-trip\n", what, in->task,
+                in->method);
+        return false;
+    }
+    if (payload_len > 0 &&
+        bench_wire_decode_result(payload, payload_len - 1, &out, samples, BENCH_MAX_SAMPLES)) {
+        fprintf(stderr, "bench_decode: %s: truncated result payload accepted\n", what);
+        return false;
+    }
+    if (bench_wire_encode_result(check_frame, len - 1, in) != 0) {
+        fprintf(stderr, "bench_decode: %s: result encoded into a buffer too small\n", what);
+        return false;
+    }
+    bench_wire_encode_result(check_frame, sizeof(check_frame), in);
+    return check_damage(what, len, rng);
+}
+
+static bool check_edges(const char* what, const bench_wire_edges_t* in, bench_rng_t* rng) {
+    size_t len = bench_wire_encode_edges(check_frame, sizeof(check_frame), in);
+    const uint8_t* payload;
+    size_t payload_len;
+    if (!check_parse(what, len, BENCH_WIRE_EDGES, &payload, &payload_len)) {
+        return false;
+    }
+
+    static bench_wire_edges_t out;
+    bool same = bench_wire_decode_edges(payload, payload_len, &out, timestamps, MAX_EDGES) &&
+                out.pin == in->pin && out.first_state == in->first_state &&
+                out.timer_hz == in->timer_hz && out.num_edges == in->num_edges &&
+                memcmp(out.timestamps, in->timestamps, in->num_edges * sizeof(in->timestamps[0])) == 0;
+    if (!same) {
+        fprintf(stderr, "bench_decode: %s: %lu edges on pin %u did not round-trip\n", what,
+                (unsigned long)in->num_edges, in->pin);
+        return false;
+    }
+    if (bench_wire_decode_edges(payload, payload_len - 1, &out, timestamps, MAX_EDGES)) {
+        fprintf(stderr, "bench_decode: %s: truncated edge payload accepted\n", what);
+        return false;
+    }
+    if (bench_wire_encode_edges(check_frame, len - 1, in) != 0) {
+        fprintf(stderr, "bench_decode: %s: edges encoded into a buffer too small\n", what);
+        return false;
+    }
+    bench_wire_encode_edges(check_frame, sizeof(check_frame), in);
+    return check_damage(what, len, rng);
+}
+
+static void random_name(char* out, bench_rng_t* rng) {
+    uint32_t len = 1 + bench_rng_below(rng, BENCH_WIRE_MAX_NAME - 1);
+    for (uint32_t i = 0; i < len; i++) {
+        out[i] = (char)('!' + bench_rng_below(rng, '~' - '!' + 1));
+    }
+    out[len] = '\0';
+}
+
+static void random_result(bench_wire_result_t* r, bench_rng_t* rng) {
+    memset(r, 0, sizeof(*r));
+    random_name(r->task, rng);
+    random_name(r->method, rng);
+    random_name(r->param_name, rng);
+    r->num_params = (uint8_t)bench_rng_below(rng, BENCH_WIRE_MAX_PARAMS + 1);
+    for (uint8_t i = 0; i < r->num_params; i++) {
+        r->params[i] = (int32_t)bench_rng_next(rng);
+    }
+    r->timer_hz = bench_rng_next(rng);
+    r->overhead = bench_rng_next(rng);
+    r->raw_median = bench_rng_next(rng);
+    r->flags = BENCH_WIRE_FLAG_VALID;
+    r->samples = check_values;
+}
+
+/**
+ * @brief Results with random samples (ascending as the runner sends them, and unordered).
+ */
+static bool check_random_results(bench_rng_t* rng) {
+    bench_wire_result_t r;
+    for (int round = 0; round < CHECK_ROUNDS; round++) {
+        random_result(&r, rng);
+        r.num_samples = 1 + bench_rng_below(rng, BENCH_MAX_SAMPLES);
+        uint32_t range = round & 2 ? 0xFFFFFFFFu : 1u + bench_rng_below(rng, 100000);
+        uint32_t value = bench_rng_below(rng, range);
+        for (uint32_t i = 0; i < r.num_samples; i++) {
+            if (round & 1) {
+                value = bench_rng_below(rng, range);  // Unordered, full-range deltas
+            } else if (value < range) {
+                value += bench_rng_below(rng, range - value) / 64;
+            }
+            check_values[i] = value;
+        }
+        if (!check_result("random samples", &r, rng)) {
+            return false;
+        }
+    }
+    printf("bench_decode: %d results with random samples: OK\n", CHECK_ROUNDS);
+    return true;
+}
+
+/**
+ * @brief Results at the limits of the 24-bit SysTick (cycle counts up to 2^24 - 1).
+ */
+static bool check_systick_results(bench_rng_t* rng) {
+    bench_wire_result_t r;
+    for (int round = 0; round < CHECK_ROUNDS; round++) {
+        random_result(&r, rng);
+        r.timer_hz = 125000000u;
+        r.overhead = bench_rng_below(rng, 64);
+        r.raw_median = SYSTICK_WRAP - 1 - bench_rng_below(rng, 16);
+        r.num_samples = 1 + bench_rng_below(rng, BENCH_MAX_SAMPLES);
+
+        // Ascending, clustered either side of the wrap and at zero
+        uint32_t value = 0;
+        for (uint32_t i = 0; i < r.num_samples; i++) {
+            uint32_t step = bench_rng_below(rng, 3);
+            uint32_t near_wrap = SYSTICK_WRAP - r.num_samples * 2u;
+            if (i == r.num_samples / 2 && value < near_wrap) {
+                value = near_wrap;  // Jump from near zero to just below the wrap
+            }
+            value += step;
+            if (value >= SYSTICK_WRAP) {
+                value = SYSTICK_WRAP - 1;
+            }
+            check_values[i] = value;
+        }
+        if (round == 0) {
+            check_values[0] = 0;
+            check_values[r.num_samples - 1] = SYSTICK_WRAP - 1;
+        }
+        if (!check_result("SysTick-wrap samples", &r, rng)) {
+            return false;
+        }
+    }
+
+    // Summary rows without samples: skipped parameters and failed verification
+    random_result(&r, rng);
+    r.flags = BENCH_WIRE_FLAG_SKIPPED;
+    if (!check_result("skipped result", &r, rng)) {
+        return false;
+    }
+    random_result(&r, rng);
+    r.flags = 0;
+    r.num_samples = 1;
+    check_values[0] = SYSTICK_WRAP - 1;
+    if (!check_result("invalid result", &r, rng)) {
+        return false;
+    }
+    printf("bench_decode: %d results across the 24-bit SysTick wrap, skipped and invalid rows: OK\n",
+           CHECK_ROUNDS);
+    return true;
+}
+
+/**
+ * @brief Edge batches whose timestamps wrap 2^32, plus an empty batch.
+ */
+static bool check_edge_batches(bench_rng_t* rng) {
+    bench_wire_edges_t e;
+    for (int round = 0; round <= CHECK_ROUNDS; round++) {
+        e.pin = (uint8_t)bench_rng_below(rng, 30);
+        e.first_state = (uint8_t)bench_rng_below(rng, 2);
+        e.timer_hz = round & 1 ? 1000000u : 125000000u;
+        e.num_edges = round == CHECK_ROUNDS ? 0 : 1 + bench_rng_below(rng, BENCH_MAX_SAMPLES);
+        e.timestamps = check_values;
+
+        uint32_t t = 0xFFFFFFFFu - bench_rng_below(rng, 1000000);
+        for (uint32_t i = 0; i < e.num_edges; i++) {
+            t += bench_rng_below(rng, 8) == 0 ? bench_rng_next(rng) : bench_rng_below(rng, 2000);
+            check_values[i] = t;
+        }
+        if (!check_edges("edge batch", &e, rng)) {
+            return false;
+        }
+    }
+    printf("bench_decode: %d edge batches across the 32-bit wrap: OK\n", CHECK_ROUNDS + 1);
+    return true;
+}
+
+/**
+ * @brief Payloads with a varint longer than 64 bits in each field position.
+ */
+static bool check_overlong_varints(void) {
+    static const uint8_t result_prefix[] = {1, 't', 1, 'm', 1, 'n', 0, 1, 0, 0, BENCH_WIRE_FLAG_VALID};
+    static const uint8_t edges_prefix[] = {2, 1, 1};
+    uint8_t* payload = check_frame + BENCH_WIRE_HEADER_SIZE;
+
+    for (int type = BENCH_WIRE_RESULT; type <= BENCH_WIRE_EDGES; type++) {
+        const uint8_t* prefix = type == BENCH_WIRE_RESULT ? result_prefix : edges_prefix;
+        size_t prefix_len = type == BENCH_WIRE_RESULT ? sizeof(result_prefix) : sizeof(edges_prefix);
+        // In the count after the prefix, then in the first sample or timestamp
+        for (size_t field = prefix_len; field <= prefix_len + 1; field++) {
+            size_t len = 0;
+            for (size_t i = 0; i < field; i++) {
+                payload[len++] = i < prefix_len ? prefix[i] : 1;  // Count of 1
+            }
+            for (int i = 0; i < 10; i++) {
+                payload[len++] = 0x80;
+            }
+            payload[len++] = 0x01;
+
+            bench_wire_seal_frame(check_frame, (bench_wire_type_t)type, len);
+            bench_wire_result_t r;
+            bench_wire_edges_t e;
+            bool accepted = type == BENCH_WIRE_RESULT
+                ? bench_wire_decode_result(payload, len, &r, samples, BENCH_MAX_SAMPLES)
+                : bench_wire_decode_edges(payload, len, &e, timestamps, MAX_EDGES);
+            if (accepted) {
+                fprintf(stderr, "bench_decode: over-long varint at payload byte %zu of a type %d frame accepted\n",
+                        field, type);
+                return false;
+            }
+        }
+    }
+    printf("bench_decode: over-long varints rejected: OK\n");
+    return true;
+}
+
+static bool self_check(uint64_t seed) {
+    bench_rng_t rng;
+    bench_rng_seed(&rng, seed, 8);
+    return check_random_results(&rng) && check_systick_results(&rng) &&
+           check_edge_batches(&rng) && check_overlong_varints();
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: bench_decode [-r] [FILE]\n"
+            "       bench_decode -s [-S SEED]\n");
+}
+
+int main(int argc, char** argv) {
+    bool synthetic = false;
+    uint64_t seed = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "rsS:")) != -1) {
+        switch (opt) {
+            case 'r': raw_samples = true; break;
+            case 's': synthetic = true; break;
+            case 'S': seed = strtoull(optarg, NULL, 0); break;
+            default:
+                usage();
+                return 2;
+        }
+    }
+    if (optind < argc - 1 || (synthetic && (optind < argc || raw_samples))) {
+        usage();
+        return 2;
+    }
+    if (synthetic) {
+        return self_check(seed) ? 0 : 1;
+    }
+    int argi = optind;
+
+    FILE* in = stdin;
+    if (argi < argc) {
+        in = fopen(argv[argi], "rb");
+        if (!in) {
+            perror(argv[argi]);
+            return 1;
+        }
+    }
+
+    size_t start = 0;
+    size_t end = 0;
+    bool eof = false;
+
+    while (!eof || start < end) {
+        // Refill: compact the window, then read as much as fits
+        if (!eof) {
+            if (start > 0) {
+                memmove(window, window + start, end - start);
+                end -= start;
+                start = 0;
+            }
+            size_t got = fread(window + end, 1, sizeof(window) - end, in);
+            end += got;
+            if (got == 0) {
+                eof = true;
+            }
+        }
+
+        while (start < end) {
+            if (window[start] != BENCH_WIRE_MAGIC0) {
+                put_text(window[start++]);
+                continue;
+            }
+
+            bench_wire_type_t type;
+            const uint8_t* payload;
+            size_t payload_len;
+            size_t frame_len;
+            bench_wire_frame_status_t status = bench_wire_parse_frame(
+                window + start, end - start, &type, &payload, &payload_len, &frame_len);
+
+            if (status == BENCH_WIRE_FRAME_OK) {
+                handle_frame(type, payload, payload_len);
+                start += frame_len;
+            } else if (status == BENCH_WIRE_FRAME_INCOMPLETE && !eof) {
+                break;  // Read more
+            } else {
+                bad_frames++;
+                start++;  // Resynchronise on the next magic byte
+            }
+        }
+    }
+
+    flush_text();
+    if (in != stdin) {
+        fclose(in);
+    }
+    if (packed_frames) {
+        fprintf(stderr, "bench_decode: %lu packed edge frame(s) skipped, decode them with edge_unpack\n",
+                packed_frames);
+    }
+    if (bad_frames) {
+        fprintf(stderr, "bench_decode: %lu bad frame(s) skipped\n", bad_frames);
+        return 1;
+    }
+    return 0;
+}
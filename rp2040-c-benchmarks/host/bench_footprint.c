@@ -0,0 +1,590 @@
+/**
+ * @file bench_footprint.c
+ * @brief Break a firmware image's flash and RAM use down per translation unit.
+ *
+ * Accepts either a GNU ld map file or an ELF file and prints one CSV row per
+ * unit with its .text/.rodata/.data/.bss bytes:
+ *
+ *   unit,text,rodata,data,bss,flash_bytes,ram_bytes
+ *
+ * where flash_bytes = text + rodata + data (initialised data is stored in
+ * flash) and ram_bytes = data + bss. Rows are sorted by flash use and end
+ * with a `(total)` row.
+ *
+ *   - Map files (the `.elf.map` the Pico SDK writes next to every C image)
+ *     attribute each input section to its object file, so units are the
+ *     suite's translation units, e.g. `src/fft/benchmark.c`, plus SDK and
+ *     library objects. Sections are classified by the output section they
+ *     were placed in, so code the SDK linker script copies to RAM counts as
+ *     data, as it occupies both flash and RAM.
+ *   - ELF files are attributed by symbol. TinyGo compiles the whole program
+ *     into one object, so units are Go packages (`main`, `runtime`,
+ *     `machine`, ...), taken from the symbol names. For a C ELF, symbols are
+ *     grouped by the source file recorded in the symbol table where
+ *     available. Bytes covered by no sized symbol (string literals, padding)
+ *     are reported as `(unattributed)`.
+ *
+ * When given a C ELF with a map file next to it (`<file>.map`), the map is
+ * used automatically.
+ *
+ * Usage:
+ *   bench_footprint [-o OUT.csv] FILE.elf|FILE.map
+ *
+ * Example:
+ *   bench_footprint build/c_bench_fft_O2.elf > results/memory/c_fft_O2.csv
+ *   bench_footprint build/fft.elf > results/memory/tinygo_fft.csv
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_LINE 1024
+#define MAX_UNIT_NAME 160
+
+typedef enum { CLASS_NONE = -1, CLASS_TEXT, CLASS_RODATA, CLASS_DATA, CLASS_BSS, NUM_CLASSES } class_t;
+
+/**
+ * @brief Accumulated bytes for one translation unit or package.
+ */
+typedef struct {
+    char name[MAX_UNIT_NAME];
+    unsigned long bytes[NUM_CLASSES];
+} unit_t;
+
+static unit_t* units = NULL;
+static size_t num_units = 0;
+static size_t cap_units = 0;
+
+static unit_t* find_unit(const char* name) {
+    for (size_t i = 0; i < num_units; i++) {
+        if (strcmp(units[i].name, name) == 0) {
+            return &units[i];
+        }
+    }
+    if (num_units == cap_units) {
+        cap_units = cap_units ? cap_units * 2 : 64;
+        units = realloc(units, cap_units * sizeof(*units));
+        if (!units) {
+            fprintf(stderr, "bench_footprint: out of memory\n");
+            exit(1);
+        }
+    }
+    unit_t* u = &units[num_units++];
+    memset(u, 0, sizeof(*u));
+    snprintf(u->name, sizeof(u->name), "%s", name);
+    return u;
+}
+
+static void add_bytes(const char* unit, class_t cls, unsigned long size) {
+    if (cls != CLASS_NONE && size > 0) {
+        find_unit(unit)->bytes[cls] += size;
+    }
+}
+
+static bool starts_with(const char* s, const char* prefix) {
+    return strncmp(s, prefix, strlen(prefix)) == 0;
+}
+
+/**
+ * @brief Classify a section by name (output or input section).
+ *
+ * Covers the Pico SDK linker scripts and the usual GNU/LLVM section names;
+ * debug and metadata sections are CLASS_NONE.
+ */
+static class_t classify_section(const char* name) {
+    static const struct {
+        const char* prefix;
+        class_t cls;
+    } table[] = {
+        { ".text", CLASS_TEXT },          { ".init", CLASS_TEXT },
+        { ".fini", CLASS_TEXT },          { ".boot2", CLASS_TEXT },
+        { ".vectors", CLASS_TEXT },       { ".reset", CLASS_TEXT },
+        { ".flash_begin", CLASS_TEXT },   { ".flash_end", CLASS_TEXT },
+        { ".rodata", CLASS_RODATA },      { ".ARM.extab", CLASS_RODATA },
+        { ".ARM.exidx", CLASS_RODATA },   { ".binary_info", CLASS_RODATA },
+        { ".flashdata", CLASS_RODATA },   { ".embedded_block", CLASS_RODATA },
+        { ".eh_frame", CLASS_RODATA },    { ".preinit_array", CLASS_RODATA },
+        { ".init_array", CLASS_RODATA },  { ".fini_array", CLASS_RODATA },
+        { ".data", CLASS_DATA },          { ".sdata", CLASS_DATA },
+        { ".time_critical", CLASS_DATA }, { ".scratch_x", CLASS_DATA },
+        { ".scratch_y", CLASS_DATA },     { ".tdata", CLASS_DATA },
+        { ".bss", CLASS_BSS },            { ".sbss", CLASS_BSS },
+        { ".tbss", CLASS_BSS },           { "COMMON", CLASS_BSS },
+        { ".uninitialized_data", CLASS_BSS }, { ".ram_vector_table", CLASS_BSS },
+        { ".heap", CLASS_BSS },           { ".stack", CLASS_BSS },
+        { ".stack1", CLASS_BSS },         { ".noinit", CLASS_BSS },
+    };
+    for (size_t i = 0; i < sizeof(table) / sizeof(table[0]); i++) {
+        if (starts_with(name, table[i].prefix)) {
+            return table[i].cls;
+        }
+    }
+    return CLASS_NONE;
+}
+
+// ----------------------------------------------------
+// GNU ld map files
+// ----------------------------------------------------
+
+/**
+ * @brief Shorten an object path from a map file to a readable unit name.
+ *
+ * CMake objects ("CMakeFiles/<target>.dir/src/fft/benchmark.c.obj") become
+ * the source path ("src/fft/benchmark.c"); Pico SDK sources are shown from
+ * "pico-sdk/"; archive members keep only the archive and member names.
+ * A name longer than `cap` keeps its end, after "...".
+ */
+static void unit_from_object(const char* path, char* out, size_t cap) {
+    const char* p = path;
+    const char* dir = strstr(p, ".dir/");
+    if (dir) {
+        p = dir + 5;
+    }
+    const char* sdk = strstr(p, "pico-sdk/");
+    if (sdk) {
+        p = sdk;
+    }
+    if (strchr(p, '(')) {
+        // Archive member: "/usr/lib/.../libc.a(lib_a-memcpy.o)"
+        const char* paren = strchr(p, '(');
+        const char* base = paren;
+        while (base > p && base[-1] != '/') {
+            base--;
+        }
+        p = base;
+    }
+
+    size_t len = strlen(p);
+    if (len > 4 && strcmp(p + len - 4, ".obj") == 0) {
+        len -= 4;
+    } else if (!strchr(p, '(') && len > 2 && strcmp(p + len - 2, ".o") == 0) {
+        len -= 2;
+    }
+
+    // Too long for the table: keep the end, which tells units apart
+    size_t skip = 0;
+    if (len >= cap) {
+        skip = len - (cap - 4);
+        memcpy(out, "...", 3);
+    }
+    memcpy(out + (skip ? 3 : 0), p + skip, len - skip);
+    out[(skip ? 3 : 0) + len - skip] = '\0';
+}
+
+/**
+ * @brief Parse the "Linker script and memory map" part of a GNU ld map.
+ *
+ * Input section lines start with one space and look like
+ *   " .text.fib_recursive  0x10000350  0x1c  path/to/object.obj"
+ * with the address, size and object moved to the next line when the
+ * section name is long. Output section lines start in column 0.
+ */
+static bool parse_map(FILE* in) {
+    char line[MAX_LINE];
+    bool in_map = false;
+    class_t output_class = CLASS_NONE;
+    char pending[MAX_LINE] = "";  // Input section name waiting for its address line
+
+    while (fgets(line, sizeof(line), in)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (!in_map) {
+            in_map = starts_with(line, "Linker script and memory map");
+            continue;
+        }
+        if (line[0] == '\0') {
+            pending[0] = '\0';
+            continue;
+        }
+
+        char name[MAX_LINE];
+        char object[MAX_LINE];
+        unsigned long addr;
+        unsigned long size;
+
+        if (line[0] != ' ') {
+            // Output section, e.g. ".text  0x10000100  0x5000"
+            if (sscanf(line, "%1023s", name) == 1) {
+                output_class = classify_section(name);
+            }
+            pending[0] = '\0';
+            continue;
+        }
+
+        const char* body = line + 1;
+        if (pending[0]) {
+            // Continuation line: "                0x... 0x... object"
+            if (sscanf(body, " 0x%lx 0x%lx %1023[^\n]", &addr, &size, object) == 3) {
+                snprintf(name, sizeof(name), "%s", pending);
+            } else {
+                pending[0] = '\0';
+                continue;
+            }
+            pending[0] = '\0';
+        } else if (body[0] == ' ' || body[0] == '*') {
+            // Symbol lines, "*(.text*)" patterns and "*fill*" padding
+            if (starts_with(body, "*fill*") &&
+                sscanf(body, "*fill* 0x%lx 0x%lx", &addr, &size) == 2 && addr != 0) {
+                add_bytes("(padding)", output_class, size);
+            }
+            continue;
+        } else {
+            int fields = sscanf(body, "%1023s 0x%lx 0x%lx %1023[^\n]", name, &addr, &size, object);
+            if (fields == 1) {
+                snprintf(pending, sizeof(pending), "%s", name);
+                continue;
+            }
+            if (fields == 3) {
+                snprintf(object, sizeof(object), "(linker)");
+            } else if (fields != 4) {
+                continue;
+            }
+        }
+
+        class_t cls = output_class != CLASS_NONE ? output_class : classify_section(name);
+        if (cls == CLASS_NONE || (addr == 0 && cls != CLASS_BSS)) {
+            continue;  // Debug/metadata, or not allocated
+        }
+        char unit[MAX_UNIT_NAME];
+        unit_from_object(object, unit, sizeof(unit));
+        add_bytes(unit, cls, size);
+    }
+    return in_map;
+}
+
+// ----------------------------------------------------
+// ELF files (32- and 64-bit, little-endian)
+// ----------------------------------------------------
+
+#define SHT_SYMTAB 2
+#define SHT_NOBITS 8
+#define SHF_WRITE 0x1u
+#define SHF_ALLOC 0x2u
+#define SHF_EXECINSTR 0x4u
+#define STT_FILE 4
+#define SHN_LORESERVE 0xFF00u
+
+typedef struct {
+    uint32_t type;
+    uint64_t flags;
+    uint64_t offset;
+    uint64_t size;
+    uint32_t link;
+    uint64_t entsize;
+    class_t cls;
+} section_t;
+
+static uint64_t rd(const uint8_t* p, int bytes) {
+    uint64_t v = 0;
+    for (int i = bytes - 1; i >= 0; i--) {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+/**
+ * @brief Go package of a TinyGo symbol, or NULL if it is not a Go symbol.
+ *
+ * "main.FibRecursive" → "main";
+ * "rp2040-tinygo-benchmarks/src/common.Measure" → "rp2040-tinygo-benchmarks/src/common";
+ * "(*machine.UART).Write" → "machine".
+ */
+static const char* go_package(const char* sym, char* out, size_t cap) {
+    const char* p = sym;
+    if (*p == '(') {
+        p++;
+        if (*p == '*') {
+            p++;
+        }
+    }
+    const char* slash = strrchr(p, '/');
+    const char* dot = strchr(slash ? slash : p, '.');
+    if (!dot || dot == p || *p == '.' || *p == '_' || *p == '$') {
+        return NULL;
+    }
+    size_t len = (size_t)(dot - p);
+    if (len >= cap) {
+        len = cap - 1;
+    }
+    memcpy(out, p, len);
+    out[len] = '\0';
+    return out;
+}
+
+static bool parse_elf(const uint8_t* img, size_t len) {
+    if (len < 52 || memcmp(img, "\x7f" "ELF", 4) != 0 || img[5] != 1) {
+        return false;  // Not little-endian ELF
+    }
+    bool is64 = img[4] == 2;
+    size_t ehsize = is64 ? 64 : 52;
+    if (len < ehsize) {
+        return false;
+    }
+
+    uint64_t shoff = is64 ? rd(img + 0x28, 8) : rd(img + 0x20, 4);
+    size_t shentsize = (size_t)rd(img + (is64 ? 0x3A : 0x2E), 2);
+    size_t shnum = (size_t)rd(img + (is64 ? 0x3C : 0x30), 2);
+    if (shnum == 0 || shoff + (uint64_t)shnum * shentsize > len) {
+        return false;
+    }
+
+    section_t* secs = calloc(shnum, sizeof(*secs));
+    if (!secs) {
+        return false;
+    }
+    unsigned long section_totals[NUM_CLASSES] = { 0 };
+    size_t symtab = 0;
+
+    for (size_t i = 0; i < shnum; i++) {
+        const uint8_t* sh = img + shoff + i * shentsize;
+        section_t* s = &secs[i];
+        s->type = (uint32_t)rd(sh + 4, 4);
+        if (is64) {
+            s->flags = rd(sh + 8, 8);
+            s->offset = rd(sh + 24, 8);
+            s->size = rd(sh + 32, 8);
+            s->link = (uint32_t)rd(sh + 40, 4);
+            s->entsize = rd(sh + 56, 8);
+        } else {
+            s->flags = rd(sh + 8, 4);
+            s->offset = rd(sh + 16, 4);
+            s->size = rd(sh + 20, 4);
+            s->link = (uint32_t)rd(sh + 24, 4);
+            s->entsize = rd(sh + 36, 4);
+        }
+
+        s->cls = CLASS_NONE;
+        if (s->flags & SHF_ALLOC) {
+            if (s->flags & SHF_EXECINSTR) {
+                s->cls = CLASS_TEXT;
+            } else if (s->type == SHT_NOBITS) {
+                s->cls = CLASS_BSS;
+            } else if (s->flags & SHF_WRITE) {
+                s->cls = CLASS_DATA;
+            } else {
+                s->cls = CLASS_RODATA;
+            }
+            section_totals[s->cls] += (unsigned long)s->size;
+        }
+        if (s->type == SHT_SYMTAB && !symtab) {
+            symtab = i;
+        }
+    }
+
+    if (!symtab) {
+        fprintf(stderr, "bench_footprint: no symbol table (stripped binary?)\n");
+        free(secs);
+        return false;
+    }
+
+    const section_t* st = &secs[symtab];
+    const section_t* strs = st->link < shnum ? &secs[st->link] : NULL;
+    size_t symsize = is64 ? 24 : 16;
+    if (!strs || st->offset + st->size > len || strs->offset + strs->size > len) {
+        free(secs);
+        return false;
+    }
+
+    unsigned long attributed[NUM_CLASSES] = { 0 };
+    const char* current_file = NULL;
+    size_t count = (size_t)(st->size / symsize);
+
+    // Go package names only apply to Go binaries; in C, "name.constprop.0"
+    // style suffixes come from compiler-generated clones
+    bool is_go = false;
+    for (size_t i = 1; i < count && !is_go; i++) {
+        uint32_t name_off = (uint32_t)rd(img + st->offset + i * symsize, 4);
+        is_go = name_off < strs->size &&
+                starts_with((const char*)img + strs->offset + name_off, "runtime.");
+    }
+
+    for (size_t i = 1; i < count; i++) {
+        const uint8_t* sym = img + st->offset + i * symsize;
+        uint32_t name_off = (uint32_t)rd(sym, 4);
+        uint8_t info = is64 ? sym[4] : sym[12];
+        size_t shndx = (size_t)rd(sym + (is64 ? 6 : 14), 2);
+        uint64_t size = is64 ? rd(sym + 16, 8) : rd(sym + 8, 4);
+        const char* name = name_off < strs->size ? (const char*)img + strs->offset + name_off : "";
+
+        if ((info & 0x0F) == STT_FILE) {
+            current_file = name;  // Local symbols that follow belong to this file
+            continue;
+        }
+        bool local = (info >> 4) == 0;
+        if (size == 0 || shndx == 0 || shndx >= SHN_LORESERVE || shndx >= shnum ||
+            secs[shndx].cls == CLASS_NONE) {
+            continue;
+        }
+
+        char pkg[MAX_UNIT_NAME];
+        const char* unit = is_go ? go_package(name, pkg, sizeof(pkg)) : NULL;
+        if (!unit) {
+            unit = local && current_file ? current_file : "(global)";
+        }
+        add_bytes(unit, secs[shndx].cls, (unsigned long)size);
+        attributed[secs[shndx].cls] += (unsigned long)size;
+    }
+
+    for (int c = 0; c < NUM_CLASSES; c++) {
+        if (section_totals[c] > attributed[c]) {
+            add_bytes("(unattributed)", (class_t)c, section_totals[c] - attributed[c]);
+        }
+    }
+
+    free(secs);
+    return true;
+}
+
+// ----------------------------------------------------
+// Output
+// ----------------------------------------------------
+
+static unsigned long flash_of(const unit_t* u) {
+    return u->bytes[CLASS_TEXT] + u->bytes[CLASS_RODATA] + u->bytes[CLASS_DATA];
+}
+
+static int compare_units(const void* a, const void* b) {
+    const unit_t* ua = a;
+    const unit_t* ub = b;
+    unsigned long fa = flash_of(ua);
+    unsigned long fb = flash_of(ub);
+    if (fa != fb) {
+        return fa < fb ? 1 : -1;
+    }
+    unsigned long ra = ua->bytes[CLASS_DATA] + ua->bytes[CLASS_BSS];
+    unsigned long rb = ub->bytes[CLASS_DATA] + ub->bytes[CLASS_BSS];
+    if (ra != rb) {
+        return ra < rb ? 1 : -1;
+    }
+    return strcmp(ua->name, ub->name);
+}
+
+static void print_row(FILE* out, const char* name, const unsigned long* b) {
+    // Quote names containing commas (e.g. archive members) for CSV safety
+    bool quote = strchr(name, ',') != NULL;
+    fprintf(out, quote ? "\"%s\"" : "%s", name);
+    fprintf(out, ",%lu,%lu,%lu,%lu,%lu,%lu\n", b[CLASS_TEXT], b[CLASS_RODATA], b[CLASS_DATA],
+            b[CLASS_BSS], b[CLASS_TEXT] + b[CLASS_RODATA] + b[CLASS_DATA],
+            b[CLASS_DATA] + b[CLASS_BSS]);
+}
+
+static void print_table(FILE* out) {
+    qsort(units, num_units, sizeof(*units), compare_units);
+
+    unsigned long total[NUM_CLASSES] = { 0 };
+    fprintf(out, "unit,text,rodata,data,bss,flash_bytes,ram_bytes\n");
+    for (size_t i = 0; i < num_units; i++) {
+        print_row(out, units[i].name, units[i].bytes);
+        for (int c = 0; c < NUM_CLASSES; c++) {
+            total[c] += units[i].bytes[c];
+        }
+    }
+    print_row(out, "(total)", total);
+}
+
+static uint8_t* read_file(const char* path, size_t* len) {
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        return NULL;
+    }
+    size_t cap = 1 << 16;
+    size_t n = 0;
+    uint8_t* buf = malloc(cap);
+    size_t got;
+    while (buf && (got = fread(buf + n, 1, cap - n, f)) > 0) {
+        n += got;
+        if (n == cap) {
+            cap *= 2;
+            uint8_t* grown = realloc(buf, cap);
+            if (!grown) {
+                free(buf);
+            }
+            buf = grown;
+        }
+    }
+    fclose(f);
+    *len = n;
+    return buf;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: bench_footprint [-o OUT.csv] FILE.elf|FILE.map\n");
+}
+
+int main(int argc, char** argv) {
+    const char* out_path = NULL;
+    int opt;
+    while ((opt = getopt(argc, argv, "o:")) != -1) {
+        switch (opt) {
+            case 'o': out_path = optarg; break;
+            default:
+                usage();
+                return 2;
+        }
+    }
+    if (argc - optind != 1) {
+        usage();
+        return 2;
+    }
+    const char* path = argv[optind];
+
+    size_t len = 0;
+    uint8_t* img = read_file(path, &len);
+    if (!img) {
+        perror(path);
+        return 1;
+    }
+
+    bool ok;
+    bool is_elf = len >= 4 && memcmp(img, "\x7f" "ELF", 4) == 0;
+    char map_path[MAX_LINE];
+    FILE* map = NULL;
+
+    if (is_elf) {
+        // Prefer the linker map next to a C image: it knows the object files
+        snprintf(map_path, sizeof(map_path), "%s.map", path);
+        map = fopen(map_path, "r");
+        if (!map) {
+            size_t plen = strlen(path);
+            if (plen > 4 && strcmp(path + plen - 4, ".elf") == 0) {
+                snprintf(map_path, sizeof(map_path), "%.*s.map", (int)(plen - 4), path);
+                map = fopen(map_path, "r");
+            }
+        }
+    } else {
+        map = fopen(path, "r");
+    }
+
+    if (map) {
+        ok = parse_map(map);
+        fclose(map);
+    } else {
+        ok = is_elf && parse_elf(img, len);
+    }
+    free(img);
+
+    if (!ok) {
+        fprintf(stderr, "bench_footprint: %s is not a GNU ld map or a readable ELF file\n", path);
+        return 1;
+    }
+
+    FILE* out = stdout;
+    if (out_path) {
+        out = fopen(out_path, "w");
+        if (!out) {
+            perror(out_path);
+            return 1;
+        }
+    }
+    print_table(out);
+    if (out != stdout) {
+        fclose(out);
+    }
+    free(units);
+    return 0;
+}
@@ -0,0 +1,166 @@
+/**
+ * @file bench_log.c
+ * @brief Reader for the result logs of both suites (see bench_log.h).
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench_log.h"
+
+#define MAX_LINE 1024
+#define MAX_FIELDS 32
+#define MAX_NAME 64
+
+/// Time columns in order of preference (kernel, hardware and latency tables)
+static const char* const time_columns[] = {
+    "time_us", "avg_time_us", "avg_us", "latency_us", "setup_time_us",
+};
+
+/**
+ * @brief Column positions of the table being read (-1 when absent).
+ */
+typedef struct {
+    bool active;
+    int num_fields;
+    int task, method, param, time, p99, index, clk;
+    char param_name[MAX_NAME];
+} layout_t;
+
+static bool equals(const char* a, const char* b) {
+    return strcmp(a, b) == 0;
+}
+
+static bool ends_with(const char* s, const char* suffix) {
+    size_t n = strlen(s);
+    size_t m = strlen(suffix);
+    return n >= m && strcmp(s + n - m, suffix) == 0;
+}
+
+/**
+ * @brief Split a line in place at commas (the suites never quote fields).
+ */
+static int split_fields(char* line, char** fields) {
+    line[strcspn(line, "\r\n")] = '\0';
+    int n = 0;
+    char* p = line;
+    while (n < MAX_FIELDS) {
+        fields[n++] = p;
+        p = strchr(p, ',');
+        if (!p) {
+            break;
+        }
+        *p++ = '\0';
+    }
+    return n;
+}
+
+static int find_column(char** fields, int n, const char* name) {
+    for (int i = 0; i < n; i++) {
+        if (equals(fields[i], name)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool bench_log_number(const char* s, double* out) {
+    char* end;
+    if (!*s) {
+        return false;
+    }
+    *out = strtod(s, &end);
+    return *end == '\0' && isfinite(*out);
+}
+
+/**
+ * @brief Read a header line into the layout; tables without a time column are inactive.
+ */
+static void read_header(layout_t* layout, char** fields, int n) {
+    memset(layout, 0, sizeof(*layout));
+    layout->num_fields = n;
+    layout->task = find_column(fields, n, "task");
+    layout->method = find_column(fields, n, "method");
+    layout->p99 = find_column(fields, n, "p99_us");
+    layout->index = find_column(fields, n, "index");
+    layout->clk = find_column(fields, n, "clk_khz");
+    layout->time = -1;
+    for (size_t i = 0; i < sizeof(time_columns) / sizeof(time_columns[0]) && layout->time < 0; i++) {
+        layout->time = find_column(fields, n, time_columns[i]);
+    }
+
+    layout->param = -1;
+    int next = layout->method + 1;
+    if (next > 0 && next < n && !ends_with(fields[next], "_us") &&
+        !ends_with(fields[next], "_cycles") && next != layout->index) {
+        layout->param = next;
+        snprintf(layout->param_name, sizeof(layout->param_name), "%s", fields[next]);
+    }
+    layout->active = layout->method > layout->task && layout->time >= 0;
+}
+
+/**
+ * @brief Pass one data row of an active table to the callback.
+ */
+static void read_row(const layout_t* layout, char** fields, int n, bench_log_fn fn, void* ctx) {
+    const char* last = fields[n - 1];
+    bench_log_row_t row = {0};
+    if (equals(last, "skip")) {
+        row.kind = BENCH_LOG_SKIP;
+    } else if (equals(last, "invalid")) {
+        row.kind = BENCH_LOG_INVALID;
+    } else if (n != layout->num_fields) {
+        return;  // text that is not part of the table
+    } else {
+        row.kind = layout->index >= 0 ? BENCH_LOG_SAMPLE : BENCH_LOG_RUN;
+        if (!bench_log_number(fields[layout->time], &row.time_us)) {
+            return;
+        }
+        row.has_p99 = layout->p99 >= 0 && bench_log_number(fields[layout->p99], &row.p99_us);
+        row.run_start = layout->index >= 0 && equals(fields[layout->index], "0");
+    }
+
+    // Skip and invalid rows end after the parameter
+    int last_key = layout->param > layout->method ? layout->param : layout->method;
+    if (last_key >= n || !*fields[layout->task]) {
+        return;
+    }
+
+    row.task = fields[layout->task];
+    row.method = fields[layout->method];
+    row.param_name = layout->param_name;
+    row.param = layout->param >= 0 ? fields[layout->param] : "";
+    row.clk_khz = layout->clk >= 0 && layout->clk < n ? fields[layout->clk] : NULL;
+    fn(&row, ctx);
+}
+
+bool bench_log_read(const char* path, bench_log_fn fn, void* ctx) {
+    FILE* in = equals(path, "-") ? stdin : fopen(path, "r");
+    if (!in) {
+        perror(path);
+        return false;
+    }
+
+    layout_t layout = {0};
+    char line[MAX_LINE];
+    char* fields[MAX_FIELDS];
+    while (fgets(line, sizeof(line), in)) {
+        int n = split_fields(line, fields);
+        if (n < 2) {
+            continue;
+        }
+        if (find_column(fields, n, "task") >= 0 && find_column(fields, n, "method") >= 0) {
+            read_header(&layout, fields, n);
+        } else if (layout.active) {
+            read_row(&layout, fields, n, fn, ctx);
+        }
+    }
+
+    if (in != stdin) {
+        fclose(in);
+    }
+    return true;
+}
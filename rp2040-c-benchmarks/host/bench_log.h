@@ -0,0 +1,70 @@
+/**
+ * @file bench_log.h
+ * @brief Reader for the result logs of both suites, shared by the host analysis tools.
+ *
+ * A log is whatever was captured from a run: serial output, bench_client or
+ * bench_decode output, or a host run. It may mix tables, banners and other
+ * text. Tables are recognised by their header lines, and the header in force
+ * decides how the rows below it are read:
+ *
+ *   - A table is used if it has `task` and `method` columns and a time
+ *     column, the first of `time_us`, `avg_time_us`, `avg_us`, `latency_us`
+ *     and `setup_time_us` present. Other tables (memory, speedup, accuracy,
+ *     calibration) are ignored.
+ *   - The column after `method` is the parameter unless it is a
+ *     measurement (`*_us`, `*_cycles`).
+ *   - Tables with an `index` column (`bench_decode -r`) hold one raw sample
+ *     per row, and index 0 starts a new run; other rows are one run each,
+ *     summarised by its median.
+ *   - Rows ending in `skip` or `invalid` are reported as such.
+ *   - A `clk_khz` column (`bench_client -k`) is passed on with each row.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef BENCH_LOG_H
+#define BENCH_LOG_H
+
+#include <stdbool.h>
+
+/**
+ * @brief What a log row holds.
+ */
+typedef enum {
+    BENCH_LOG_RUN,      ///< One run: time_us is its median (or the table's time)
+    BENCH_LOG_SAMPLE,   ///< One raw sample of a run
+    BENCH_LOG_SKIP,     ///< The parameter was skipped (did not fit)
+    BENCH_LOG_INVALID,  ///< The output failed verification
+} bench_log_kind_t;
+
+/**
+ * @brief One benchmark row; the strings are valid only during the callback.
+ */
+typedef struct {
+    const char* task;
+    const char* method;
+    const char* param_name;  ///< "" if the table has no parameter
+    const char* param;       ///< "" if the table has no parameter
+    const char* clk_khz;     ///< NULL without a clk_khz column
+    bench_log_kind_t kind;
+    double time_us;          ///< RUN and SAMPLE rows
+    bool run_start;          ///< SAMPLE row with index 0 (first sample of a run)
+    bool has_p99;
+    double p99_us;           ///< RUN rows with a p99_us column
+} bench_log_row_t;
+
+typedef void (*bench_log_fn)(const bench_log_row_t* row, void* ctx);
+
+/**
+ * @brief Call fn for every benchmark row of a log ("-" for stdin).
+ *
+ * @return false (after printing the error) if the file could not be opened
+ */
+bool bench_log_read(const char* path, bench_log_fn fn, void* ctx);
+
+/**
+ * @brief Parse a whole field as a finite number.
+ */
+bool bench_log_number(const char* s, double* out);
+
+#endif  // BENCH_LOG_H
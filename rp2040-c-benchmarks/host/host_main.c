@@ -0,0 +1,98 @@
+/**
+ * @file host_main.c
+ * @brief Entry point for the host (Linux) build of the software benchmarks.
+ *
+ * Runs the same registry filter as `BENCHMARK_FILTER` on the device (default
+ * "software", or FILTER), compiled natively against the timing shim in
+ * `host/include/`. Output is the same CSV that the RP2040 prints over USB
+ * serial, written to stdout.
+ *
+ * This build exists for fast iteration on kernel changes and for catching
+ * regressions before flashing hardware. Absolute timings are host timings and
+ * are not comparable with RP2040 results.
+ *
+ * Hardware benchmarks (GPIO, ADC, PWM, ...) are not available on the host.
+ *
+ * Usage:
+ *   c_benchmarks_host [-b] [-m] [-s RATIO] [FILTER]
+ *   c_benchmarks_host -i
+ *
+ *   -b        Write results as bench_wire.h binary frames (decode with
+ *             bench_decode)
+ *   -m        Follow the timing run with the memory pass (stack high-water
+ *             mark and heap usage, see bench_memory.h)
+ *   -s RATIO  Sweep each benchmark's parameter geometrically instead of
+ *             running its default set (BENCHMARK_SWEEP on the device)
+ *   -i        Serve the serial command protocol (bench_command.h) on
+ *             stdin/stdout, standing in for the device when testing host
+ *             tooling
+ *
+ * Example:
+ *   bench_client -x "./c_benchmarks_host -i" list "run fft n=64,128"
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "benchmarks.h"
+#include "bench_arena.h"
+#include "bench_command.h"
+#include "bench_timer.h"
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: c_benchmarks_host [-b] [-m] [-s RATIO] [FILTER]\n"
+            "       c_benchmarks_host -i\n");
+}
+
+int main(int argc, char **argv) {
+    bool memory = false;
+    bool interactive = false;
+    bench_run_opts_t opts = { .sweep = 0 };
+    int opt;
+    while ((opt = getopt(argc, argv, "bims:")) != -1) {
+        switch (opt) {
+            case 'b': bench_set_format(BENCH_FORMAT_BINARY); break;
+            case 'i': interactive = true; break;
+            case 'm': memory = true; break;
+            case 's': opts.sweep = atoi(optarg); break;
+            default:
+                usage();
+                return 2;
+        }
+    }
+    if (argc - optind > 1 || (interactive && optind < argc)) {
+        usage();
+        return 2;
+    }
+    const char *filter = optind < argc ? argv[optind] : BENCH_CATEGORY_SOFTWARE;
+
+    bench_timer_init();
+
+    if (interactive) {
+        bench_cmd_serve();
+        return 0;
+    }
+
+    printf("Benchmark Filter: %s (host)\n", filter);
+    printf("----------------------\n");
+    bench_timer_print_calibration();
+    printf("Benchmark Arena: %lu bytes\n", (unsigned long)bench_arena_capacity());
+    printf("----------------------\n");
+
+    if (bench_run_matching_with(filter, &opts) == 0) {
+        printf("No benchmark matches filter \"%s\". Registered benchmarks:\n", filter);
+        bench_print_registry(NULL);
+        return 1;
+    }
+
+    if (memory) {
+        bench_profile_memory_matching_with(filter, &opts);
+    }
+
+    return 0;
+}
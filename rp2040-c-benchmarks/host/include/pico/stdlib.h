@@ -0,0 +1,32 @@
+/**
+ * @file stdlib.h
+ * @brief Host (Linux) stand-in for the Pico SDK `pico/stdlib.h`.
+ *
+ * Pulls in the host timing shim and stubs out the few SDK helpers the
+ * software benchmarks touch, so the kernels build unchanged on Linux.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef HOST_PICO_STDLIB_H
+#define HOST_PICO_STDLIB_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "pico/time.h"
+
+typedef unsigned int uint;
+
+/**
+ * @brief No-op: stdout is already available on the host.
+ */
+static inline bool stdio_init_all(void) {
+    return true;
+}
+
+/**
+ * @brief No-op busy-wait hint (matches the SDK signature).
+ */
+static inline void tight_loop_contents(void) {}
+
+#endif  // HOST_PICO_STDLIB_H
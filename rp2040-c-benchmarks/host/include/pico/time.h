@@ -0,0 +1,73 @@
+/**
+ * @file time.h
+ * @brief Host (Linux) stand-in for the Pico SDK `pico/time.h` timing API.
+ *
+ * Provides the subset of the SDK timing functions used by the software
+ * benchmarks so that the unmodified kernels in `src/` can be compiled and
+ * timed on a Linux machine. All times are derived from the monotonic clock
+ * (`clock_gettime(CLOCK_MONOTONIC)`) and expressed in microseconds, matching
+ * the units of the RP2040's 64-bit timer.
+ *
+ * Only used by the host build (`host/CMakeLists.txt`); the device build uses
+ * the real Pico SDK headers.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef HOST_PICO_TIME_H
+#define HOST_PICO_TIME_H
+
+#include <stdint.h>
+#include <time.h>
+
+typedef uint64_t absolute_time_t;  ///< Microseconds since an arbitrary epoch
+
+/**
+ * @brief Microseconds elapsed on the host monotonic clock.
+ */
+static inline uint64_t time_us_64(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+/**
+ * @brief Lower 32 bits of the microsecond clock (wraps after ~71 minutes).
+ */
+static inline uint32_t time_us_32(void) {
+    return (uint32_t)time_us_64();
+}
+
+/**
+ * @brief Current time as an absolute_time_t.
+ */
+static inline absolute_time_t get_absolute_time(void) {
+    return time_us_64();
+}
+
+/**
+ * @brief Signed difference `to - from` in microseconds.
+ */
+static inline int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to) {
+    return (int64_t)(to - from);
+}
+
+/**
+ * @brief Sleep for the given number of microseconds.
+ */
+static inline void sleep_us(uint64_t us) {
+    struct timespec ts = {
+        .tv_sec = (time_t)(us / 1000000u),
+        .tv_nsec = (long)(us % 1000000u) * 1000L,
+    };
+    nanosleep(&ts, NULL);
+}
+
+/**
+ * @brief Sleep for the given number of milliseconds.
+ */
+static inline void sleep_ms(uint32_t ms) {
+    sleep_us((uint64_t)ms * 1000u);
+}
+
+#endif  // HOST_PICO_TIME_H
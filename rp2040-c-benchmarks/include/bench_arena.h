@@ -0,0 +1,63 @@
+/**
+ * @file bench_arena.h
+ * @brief Bump allocator for benchmark buffers, sized to the free SRAM.
+ *
+ * Kernel benchmarks take their problem size at run time (the descriptor's
+ * parameter) and allocate their arrays from this arena in setup, instead of
+ * declaring static arrays of a fixed maximum size. A size whose buffers do
+ * not fit makes setup return false, which the runner reports as a `skip`
+ * row, so the limit is the memory actually left over by the image rather
+ * than a constant in each benchmark, and an oversized request can never run
+ * into the stack.
+ *
+ * The runner calls bench_arena_reset() before every setup, so a benchmark
+ * owns the whole arena for one parameter and never frees anything.
+ * Allocations are BENCH_ARENA_ALIGN-aligned and uninitialised.
+ *
+ * Device: on first use the arena claims, in one malloc() block, all the
+ * heap left between the current break and the linker script's heap limit
+ * (`__StackLimit`, the end of main RAM; the stacks live in SCRATCH_X/Y),
+ * less BENCH_ARENA_HEAP_RESERVE for the C library and any later malloc().
+ * The block is never freed.
+ * Host: a static array of BENCH_HOST_ARENA_BYTES, about the RP2040's free
+ * SRAM, so the same sizes are skipped on both.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef BENCH_ARENA_H
+#define BENCH_ARENA_H
+
+#include <stddef.h>
+
+#define BENCH_ARENA_ALIGN 8u  ///< Alignment of every allocation (int64_t, double)
+
+#ifndef BENCH_ARENA_HEAP_RESERVE
+#define BENCH_ARENA_HEAP_RESERVE (8u * 1024u)  ///< Heap left to malloc() on the device
+#endif
+
+#ifndef BENCH_HOST_ARENA_BYTES
+#define BENCH_HOST_ARENA_BYTES (200u * 1024u)  ///< Arena size of the host build
+#endif
+
+/**
+ * @brief Allocate `size` bytes, or return NULL if the arena is full.
+ */
+void* bench_arena_alloc(size_t size);
+
+/**
+ * @brief Release every allocation (called by the runner before each setup).
+ */
+void bench_arena_reset(void);
+
+/**
+ * @brief Total arena size in bytes.
+ */
+size_t bench_arena_capacity(void);
+
+/**
+ * @brief Bytes allocated since the last bench_arena_reset().
+ */
+size_t bench_arena_used(void);
+
+#endif  // BENCH_ARENA_H
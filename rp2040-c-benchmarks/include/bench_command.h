@@ -0,0 +1,120 @@
+/**
+ * @file bench_command.h
+ * @brief Line-based serial command interface for the benchmark firmware.
+ *
+ * Lets a host drive the suite over USB CDC without rebuilding or reflashing.
+ * Each input line is one command; each command produces exactly one framed
+ * response so a client can tell where results start and end:
+ *
+ *   @begin <verb>
+ *   ...body (CSV, same format as the batch output)...
+ *   @end ok                      (or: @end error <message>)
+ *
+ * Commands:
+ *   help                           List commands
+ *   ping                           Liveness check, answers "pong"
+ *   list [filter]                  Registered benchmarks (see bench_matches())
+ *   run <filter> [key=value ...]   Run matching benchmarks; keys:
+ *                                    n=a,b,...   parameter set (the benchmark's
+ *                                                own column name, e.g. size=,
+ *                                                is accepted as well); an item
+ *                                                a..b or a..b*r expands to
+ *                                                a, a·r, a·r², ... up to b
+ *                                                (r = 2 if omitted)
+ *                                    sweep=r     geometric sweep with ratio r
+ *                                                over each benchmark's own
+ *                                                range (bench_registry.h)
+ *                                    reps=, warmup=, budget_ms=
+ *   mem <filter> [n=...|sweep=r]   Stack high-water mark, heap and arena
+ *                                  usage per parameter (untimed, see
+ *                                  bench_memory.h)
+ *   set key=value ...              Session defaults: reps, warmup, budget_ms,
+ *                                  format (csv or binary, see bench_wire.h),
+ *                                  clk (system clock in kHz, device only).
+ *                                  Nothing changes unless every argument
+ *                                  is valid
+ *   get                            Current session settings
+ *   calibrate                      Re-run timer overhead calibration
+ *   sync [pin=<gpio>|pin=off]      Start or stop clock sync pulses for the
+ *                                  probe and show the sync pin (device
+ *                                  only, see bench_sync.h)
+ *
+ * The parser and dispatcher are plain C on top of stdio, so the same code is
+ * built into the Linux host binary (`c_benchmarks_host -i`) and can be
+ * exercised through a pseudo-terminal with host/bench_client.c.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef BENCH_COMMAND_H
+#define BENCH_COMMAND_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define BENCH_CMD_MAX_LINE 160   ///< Longest accepted command line (incl. NUL)
+#define BENCH_CMD_MAX_ARGS 8     ///< Most key=value arguments per command
+#define BENCH_CMD_MAX_PARAMS 32  ///< Most values in an n=a,b,... list (ranges expanded)
+
+#define BENCH_FRAME_BEGIN "@begin"  ///< First line of every response
+#define BENCH_FRAME_END "@end"      ///< Last line of every response
+
+/**
+ * @brief Result of parsing a command line.
+ */
+typedef enum {
+    BENCH_CMD_OK,
+    BENCH_CMD_EMPTY,          ///< Blank line (not an error, no response)
+    BENCH_CMD_TOO_LONG,       ///< Line exceeds BENCH_CMD_MAX_LINE
+    BENCH_CMD_TOO_MANY_ARGS,  ///< More than BENCH_CMD_MAX_ARGS arguments
+    BENCH_CMD_BAD_ARG,        ///< Positional argument after key=value, or empty key
+} bench_cmd_status_t;
+
+/**
+ * @brief One key=value argument.
+ */
+typedef struct {
+    const char* key;
+    const char* value;
+} bench_cmd_arg_t;
+
+/**
+ * @brief A tokenised command line. All strings point into `buffer`.
+ */
+typedef struct {
+    char buffer[BENCH_CMD_MAX_LINE];
+    const char* verb;    ///< First word, e.g. "run"
+    const char* target;  ///< Optional positional argument, e.g. "fft"
+    bench_cmd_arg_t args[BENCH_CMD_MAX_ARGS];
+    size_t num_args;
+} bench_cmd_t;
+
+/**
+ * @brief Split a command line into verb, optional target and key=value pairs.
+ *
+ * Whitespace separates words; a trailing CR/LF is ignored.
+ */
+bench_cmd_status_t bench_cmd_parse(const char* line, bench_cmd_t* cmd);
+
+/**
+ * @brief Human-readable description of a parse status.
+ */
+const char* bench_cmd_status_str(bench_cmd_status_t status);
+
+/**
+ * @brief Parse and execute one command line, printing a framed response.
+ *
+ * Blank lines are ignored and produce no output.
+ *
+ * @return false if the command failed (the response ends in `@end error`).
+ */
+bool bench_cmd_execute(const char* line);
+
+/**
+ * @brief Read commands from stdin and execute them until end of input.
+ *
+ * On the device stdin never ends, so this does not return.
+ */
+void bench_cmd_serve(void);
+
+#endif  // BENCH_COMMAND_H
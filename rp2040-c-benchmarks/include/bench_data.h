@@ -0,0 +1,104 @@
+/**
+ * @file bench_data.h
+ * @brief Seeded input-data generators, bit-identical to the TinyGo suite.
+ *
+ * Benchmarks that need non-trivial input draw it from here rather than
+ * building it inline, so a distribution is written once per language and
+ * both suites time exactly the same data. src/common/data.go implements
+ * the same functions on the same integer arithmetic; no floating point is
+ * involved anywhere, so results cannot drift with the compiler, libm or
+ * soft-float routines.
+ *
+ * The generator is PCG32 (XSH-RR output, 64-bit LCG state). A (seed,
+ * stream) pair selects one of 2^63 independent sequences.
+ *
+ * Parity is checked on the host by scripts/check_data_parity.sh, which
+ * diffs the reference output of host/bench_datagen.c against the TinyGo
+ * suite's src/datagen.
+ *
+ * Source (algorithmic reference):
+ * https://www.pcg-random.org/download.html
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef BENCH_DATA_H
+#define BENCH_DATA_H
+
+#include <stdint.h>
+
+/**
+ * @brief PCG32 generator state.
+ */
+typedef struct {
+    uint64_t state;  ///< LCG state
+    uint64_t inc;    ///< LCG increment (stream), always odd
+} bench_rng_t;
+
+/**
+ * @brief One sine component of bench_data_tones_i16().
+ */
+typedef struct {
+    uint32_t bin;       ///< Whole cycles over the n output samples
+    int16_t amplitude;  ///< Peak amplitude in Q15
+} bench_tone_t;
+
+/**
+ * @brief Seed the generator (pcg32_srandom_r).
+ */
+void bench_rng_seed(bench_rng_t* rng, uint64_t seed, uint64_t stream);
+
+/**
+ * @brief Next 32-bit output.
+ */
+uint32_t bench_rng_next(bench_rng_t* rng);
+
+/**
+ * @brief Value in [0, bound) from one output, by multiply-shift.
+ *
+ * Slightly biased for bounds that are not powers of two (below 2^-32 per
+ * value for small bounds), but branch-free and reproducible.
+ */
+uint32_t bench_rng_below(bench_rng_t* rng, uint32_t bound);
+
+/**
+ * @brief Uniform keys in [lo, hi] (inclusive; the full int32 range is allowed).
+ */
+void bench_data_uniform_i32(int32_t* out, int n, bench_rng_t* rng, int32_t lo, int32_t hi);
+
+/**
+ * @brief Bell-shaped keys with the given mean and standard deviation.
+ *
+ * Irwin–Hall approximation: the sum of four 16-bit uniforms, centred and
+ * scaled by √3 (as 887/512) so the variance matches. Values stay within
+ * about ±3.46 standard deviations and saturate at the int32 limits.
+ */
+void bench_data_gaussian_i32(int32_t* out, int n, bench_rng_t* rng, int32_t mean, int32_t stddev);
+
+/**
+ * @brief Consecutive ascending runs of run_length keys (the last may be shorter).
+ *
+ * Each run starts at a random key in [0, 2^20) and rises by 0..7 per step,
+ * the shape of concatenated, already-sorted sensor batches.
+ */
+void bench_data_sorted_runs_i32(int32_t* out, int n, bench_rng_t* rng, int run_length);
+
+/**
+ * @brief Sine of a phase in Q15, with 2^32 phase units per turn.
+ *
+ * Quarter-wave 5th-order polynomial, exact at the quadrant ends; the error
+ * is below 2^-11 of full scale.
+ */
+int16_t bench_data_sin_q15(uint32_t phase);
+
+/**
+ * @brief Sum of whole-cycle sine tones plus uniform noise, in Q15.
+ *
+ * Sample i of a tone is amplitude · sin(2π · bin · i / n). Noise is
+ * uniform in [-noise, noise] (no generator output is drawn if noise is 0),
+ * and the sum saturates to int16.
+ */
+void bench_data_tones_i16(int16_t* out, int n, const bench_tone_t* tones, int num_tones,
+                          bench_rng_t* rng, int16_t noise);
+
+#endif  // BENCH_DATA_H
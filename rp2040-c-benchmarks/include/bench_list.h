@@ -0,0 +1,83 @@
+/**
+ * @file bench_list.h
+ * @brief X-macro list of all registered benchmark descriptors.
+ *
+ * Each entry names a `const bench_desc_t bench_<id>` defined in one of the
+ * `src/<task>/benchmark.c` files. Registration order is run order.
+ *
+ *   BENCH_ENTRY(id)  - available on every platform
+ *   Hardware entries are only listed for device builds.
+ *
+ * Included by src/common/registry.c only; no include guard by design.
+ *
+ * @author Samuel Ivuerah
+ */
+
+// Software benchmarks (CPU-bound, no external components)
+BENCH_ENTRY(fibonacci_iterative)
+BENCH_ENTRY(fibonacci_recursive)
+BENCH_ENTRY(bubblesort_bubble)
+BENCH_ENTRY(quicksort_quick)
+BENCH_ENTRY(sort_median3_sorted)
+BENCH_ENTRY(sort_median3_reversed)
+BENCH_ENTRY(sort_median3_random)
+BENCH_ENTRY(sort_median3_few_unique)
+BENCH_ENTRY(sort_median3_organ_pipe)
+BENCH_ENTRY(sort_ninther_sorted)
+BENCH_ENTRY(sort_ninther_reversed)
+BENCH_ENTRY(sort_ninther_random)
+BENCH_ENTRY(sort_ninther_few_unique)
+BENCH_ENTRY(sort_ninther_organ_pipe)
+BENCH_ENTRY(sort_iterative_sorted)
+BENCH_ENTRY(sort_iterative_reversed)
+BENCH_ENTRY(sort_iterative_random)
+BENCH_ENTRY(sort_iterative_few_unique)
+BENCH_ENTRY(sort_iterative_organ_pipe)
+BENCH_ENTRY(sort_introsort_sorted)
+BENCH_ENTRY(sort_introsort_reversed)
+BENCH_ENTRY(sort_introsort_random)
+BENCH_ENTRY(sort_introsort_few_unique)
+BENCH_ENTRY(sort_introsort_organ_pipe)
+BENCH_ENTRY(sort_merge_sorted)
+BENCH_ENTRY(sort_merge_reversed)
+BENCH_ENTRY(sort_merge_random)
+BENCH_ENTRY(sort_merge_few_unique)
+BENCH_ENTRY(sort_merge_organ_pipe)
+BENCH_ENTRY(sort_radix_sorted)
+BENCH_ENTRY(sort_radix_reversed)
+BENCH_ENTRY(sort_radix_random)
+BENCH_ENTRY(sort_radix_few_unique)
+BENCH_ENTRY(sort_radix_organ_pipe)
+BENCH_ENTRY(sort_merge_parallel_random)
+BENCH_ENTRY(sort_speedup)
+BENCH_ENTRY(loop_for_loop)
+BENCH_ENTRY(matrix_multiply)
+BENCH_ENTRY(matrix_naive)
+BENCH_ENTRY(matrix_transposed)
+BENCH_ENTRY(matrix_blocked)
+BENCH_ENTRY(matrix_parallel)
+BENCH_ENTRY(matrix_i16)
+BENCH_ENTRY(matrix_i8)
+BENCH_ENTRY(matrix_f32)
+BENCH_ENTRY(matrix_speedup)
+BENCH_ENTRY(fft_radix2)
+BENCH_ENTRY(fft_plan_radix2)
+BENCH_ENTRY(fft_plan_radix4)
+BENCH_ENTRY(fft_plan_real)
+BENCH_ENTRY(fft_q15)
+BENCH_ENTRY(fft_q15_bfp)
+BENCH_ENTRY(fft_q15_parallel)
+BENCH_ENTRY(fft_q31)
+BENCH_ENTRY(fft_q31_bfp)
+BENCH_ENTRY(fft_accuracy)
+BENCH_ENTRY(fft_speedup)
+
+#if !BENCH_HOST
+// Hardware benchmarks (timing with GPIOs, peripherals)
+BENCH_ENTRY(gpio_toggle)
+BENCH_ENTRY(pwm_setup)
+BENCH_ENTRY(adc_single_read)
+BENCH_ENTRY(interrupt_triggered)
+BENCH_ENTRY(uart_send)
+BENCH_ENTRY(i2c_write)
+#endif
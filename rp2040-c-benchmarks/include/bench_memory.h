@@ -0,0 +1,92 @@
+/**
+ * @file bench_memory.h
+ * @brief Stack high-water marks and heap usage per benchmark.
+ *
+ * Stack usage is measured by painting: before a kernel runs, the free stack
+ * below the caller is filled with a known pattern; afterwards the lowest
+ * overwritten word gives the deepest point the kernel (and any interrupt
+ * that fired meanwhile) reached. Recursive kernels such as fib_recursive()
+ * and quick_sort() on reverse-ordered input are where this matters.
+ *
+ * On the device the painted region runs from the end of the SCRATCH_Y data
+ * (`__scratch_y_end__`) up to just below the caller, i.e. the reserved main
+ * stack plus the unused part of SCRATCH_Y below it, so `stack_free_bytes`
+ * is the real headroom before the stack runs into other memory. On the host
+ * a fixed BENCH_HOST_STACK_PAINT_BYTES region below the caller is painted.
+ *
+ * Heap usage comes from the allocator's mallinfo(): bytes in use and the
+ * size of the malloc arena obtained from the system (sbrk), which newlib
+ * never returns, so the arena is also the heap high-water mark. Benchmark
+ * buffers come from the benchmark arena (bench_arena.h), which is claimed
+ * once and so never shows up as heap growth; `arena_bytes` is the part of
+ * it the kernel's setup allocated.
+ *
+ * Memory rows are produced by a separate, untimed pass (bench_profile_memory_with()
+ * in bench_registry.h), so painting never disturbs the timing samples:
+ *   task,method,<param>,stack_bytes,stack_free_bytes,heap_bytes,heap_arena_bytes,arena_bytes,valid
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef BENCH_MEMORY_H
+#define BENCH_MEMORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define BENCH_MEMORY_CSV_COLUMNS "stack_bytes,stack_free_bytes,heap_bytes,heap_arena_bytes,arena_bytes"
+
+#define BENCH_STACK_PAINT_WORD 0xC5C5C5C5u  ///< Fill pattern for unused stack
+
+/**
+ * Bytes left unpainted below bench_stack_paint()'s own frame so it never
+ * overwrites its spills (x86-64 leaf functions may also use the 128-byte red
+ * zone). Usage shallower than this cannot be resolved and reads as the guard.
+ */
+#if BENCH_HOST
+#define BENCH_STACK_GUARD 160u
+#else
+#define BENCH_STACK_GUARD 64u
+#endif
+
+#define BENCH_HOST_STACK_PAINT_BYTES (64u * 1024u)  ///< Painted region on the host
+#define BENCH_HOST_STACK_HEADROOM (1024u * 1024u)   ///< Stack assumed free on the host
+
+/**
+ * @brief Fill the free stack below the caller with BENCH_STACK_PAINT_WORD.
+ *
+ * Call immediately before the code to be measured, from the same function
+ * that will call bench_stack_measure() afterwards.
+ */
+void bench_stack_paint(void);
+
+/**
+ * @brief Scan the region painted by the last bench_stack_paint().
+ *
+ * @param used       Bytes of stack used below the painting caller (at least
+ *                   BENCH_STACK_GUARD, see above)
+ * @param free_bytes Painted bytes never touched (remaining headroom)
+ */
+void bench_stack_measure(uint32_t* used, uint32_t* free_bytes);
+
+/**
+ * @brief Stack bytes left below the caller.
+ *
+ * Device: the distance from the caller's frame down to the end of
+ * SCRATCH_Y, the same region bench_stack_paint() covers. Host: a fixed
+ * BENCH_HOST_STACK_HEADROOM. Setup hooks of recursive kernels compare it
+ * with their worst-case depth and skip sizes that would overflow.
+ */
+size_t bench_stack_headroom(void);
+
+/**
+ * @brief Heap bytes currently allocated (mallinfo uordblks).
+ */
+size_t bench_heap_in_use(void);
+
+/**
+ * @brief Size of the malloc arena obtained from the system (mallinfo arena).
+ */
+size_t bench_heap_arena(void);
+
+#endif  // BENCH_MEMORY_H
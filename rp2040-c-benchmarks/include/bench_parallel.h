@@ -0,0 +1,70 @@
+/**
+ * @file bench_parallel.h
+ * @brief Fork-join execution of a kernel on both RP2040 cores.
+ *
+ * The suite runs on core 0; core 1 is otherwise idle. bench_parallel_run()
+ * calls the same worker function on both cores, passing each its worker
+ * index, and returns once both have finished. Work is split statically by
+ * that index (rows of a matrix, butterflies of an FFT stage, halves of an
+ * array), so there is no scheduler and no locking in the kernels.
+ *
+ * Device: core 1 is launched once, on first use, with
+ * multicore_launch_core1(), and then waits on the inter-core FIFO. A run
+ * is one FIFO word to core 1 and one back. bench_parallel_barrier()
+ * exchanges one word in each direction, so each core waits for the other
+ * without polling shared memory.
+ *
+ * Host: a std::thread plays core 1 (src/common/parallel_host.cpp), so the
+ * parallel kernels can be checked and timed without a board.
+ *
+ * Worker functions must not print, and on the device core 1 runs them on
+ * its own small stack (PICO_CORE1_STACK_SIZE, 2 KB by default).
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef BENCH_PARALLEL_H
+#define BENCH_PARALLEL_H
+
+#include "bench_registry.h"
+
+#define BENCH_PARALLEL_WORKERS 2  ///< Worker 0 is the calling core, worker 1 is core 1
+
+/**
+ * @brief Worker function: called once per worker with the same context.
+ *
+ * @param ctx    Context passed to bench_parallel_run().
+ * @param worker Worker index, 0 .. BENCH_PARALLEL_WORKERS - 1.
+ */
+typedef void (*bench_parallel_fn_t)(void* ctx, int worker);
+
+/**
+ * @brief Run fn on every worker and wait for all of them to return.
+ *
+ * Must be called from core 0 (the host's main thread), and not from
+ * inside a worker.
+ */
+void bench_parallel_run(bench_parallel_fn_t fn, void* ctx);
+
+/**
+ * @brief Wait until every worker of the current run has reached the barrier.
+ *
+ * Only valid inside a worker function. Every worker must call it the same
+ * number of times. Writes made before the barrier are visible to every
+ * worker after it.
+ */
+void bench_parallel_barrier(void);
+
+/**
+ * @brief Print the speedup of a parallel variant over its single-core kernel.
+ *
+ * Times both descriptors at each of the parallel descriptor's parameters
+ * with the default repetition settings and prints one row per parameter:
+ *   task,method,<param_name>,single_us,parallel_us,speedup,efficiency,valid
+ * where speedup = single / parallel (median times) and efficiency =
+ * speedup / BENCH_PARALLEL_WORKERS. A parameter that either descriptor
+ * skips prints a `skip` row, and a failed verification an `invalid` row.
+ */
+void bench_parallel_report(const bench_desc_t* single, const bench_desc_t* parallel);
+
+#endif  // BENCH_PARALLEL_H
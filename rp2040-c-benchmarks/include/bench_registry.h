@@ -0,0 +1,183 @@
+/**
+ * @file bench_registry.h
+ * @brief Table-driven benchmark registry and runner.
+ *
+ * Every benchmark variant is described by a bench_desc_t that lives next to
+ * its kernel in `src/<task>/benchmark.c`. The descriptors are collected in a
+ * static table (src/common/registry.c, populated from bench_list.h) which the
+ * runner iterates or filters, so a single image can run the whole suite and
+ * adding a variant only needs a descriptor plus one line in bench_list.h.
+ *
+ * Two kinds of descriptor exist:
+ *   - Kernel descriptors provide setup/prepare/run/verify/teardown hooks and
+ *     a parameter set. The runner times `run` with the statistics engine for
+ *     each parameter and prints one CSV row per parameter.
+ *   - Standalone descriptors provide a single `standalone` function that does
+ *     its own timing and output (used by the hardware benchmarks).
+ *
+ * Kernel descriptors take their parameter (problem size, iteration count,
+ * ...) at run time and allocate their buffers from the benchmark arena
+ * (bench_arena.h) in setup, so any parameter can be requested; one that
+ * exceeds the free memory, or the kernel's own limits, is reported as a
+ * `skip` row. Instead of the default parameter set, a run can sweep the
+ * parameter geometrically from the first default up to the descriptor's
+ * sweep_max (bench_run_opts_t.sweep), giving a scaling curve per variant.
+ *
+ * Output format for kernel descriptors:
+ *   task,method,<param_name>,time_us,...(see bench_stats.h),valid
+ * or, with BENCH_FORMAT_BINARY, one bench_wire.h result frame per row
+ * carrying every sample (decoded back to the same CSV on the host).
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef BENCH_REGISTRY_H
+#define BENCH_REGISTRY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "bench_stats.h"
+
+#define BENCH_CATEGORY_SOFTWARE "software"  ///< CPU-bound, no external parts
+#define BENCH_CATEGORY_HARDWARE "hardware"  ///< Needs peripherals or wiring
+
+/**
+ * @brief Description of one benchmark variant.
+ */
+typedef struct {
+    const char* task;        ///< Benchmark name, e.g. "fibonacci"
+    const char* method;      ///< Variant name, e.g. "recursive"
+    const char* category;    ///< BENCH_CATEGORY_SOFTWARE or BENCH_CATEGORY_HARDWARE
+
+    const char* param_name;  ///< CSV column name for the parameter, e.g. "size"
+    const int* params;       ///< Default parameter set
+    size_t num_params;       ///< Number of entries in params
+    int sweep_max;           ///< Last parameter of a geometric sweep; 0 if it does not sweep
+
+    void* ctx;               ///< Kernel state shared by all hooks
+
+    /// Per-parameter preparation (untimed). Return false to skip the parameter.
+    bool (*setup)(void* ctx, int param);
+    /// Per-iteration preparation (untimed), e.g. refilling an array. Optional.
+    bench_fn_t prepare;
+    /// The timed kernel.
+    bench_fn_t run;
+    /// Check the output of the last run. Optional; NULL means always valid.
+    bool (*verify)(void* ctx);
+    /// Per-parameter cleanup. Optional.
+    void (*teardown)(void* ctx);
+
+    /// Self-timed benchmark; when set, all kernel hooks above are ignored.
+    void (*standalone)(void);
+} bench_desc_t;
+
+/**
+ * @brief Per-run overrides, e.g. from the serial command interface.
+ */
+typedef struct {
+    const int* params;             ///< Parameter set, or NULL for the descriptor's defaults
+    size_t num_params;             ///< Number of entries in params
+    int sweep;                     ///< Sweep ratio (>= 2) when params is NULL, or 0 for none
+    const bench_config_t* config;  ///< Repetition settings, or NULL for defaults
+} bench_run_opts_t;
+
+#define BENCH_SWEEP_MAX_PARAMS 32  ///< Most points of one geometric sweep
+
+/**
+ * @brief Result encoding used by the runner for kernel descriptors.
+ */
+typedef enum {
+    BENCH_FORMAT_CSV,     ///< printf-formatted CSV rows (default)
+    BENCH_FORMAT_BINARY,  ///< bench_wire.h frames including all samples
+} bench_format_t;
+
+/// All registered benchmarks, in bench_list.h order.
+extern const bench_desc_t* const bench_registry[];
+extern const size_t bench_registry_count;
+
+/**
+ * @brief Run one benchmark and print its CSV output.
+ */
+void bench_run(const bench_desc_t* desc);
+
+/**
+ * @brief Run one benchmark with overridden parameters and/or repetitions.
+ *
+ * Overrides apply to kernel descriptors only; standalone benchmarks ignore
+ * them. `opts` may be NULL, which is equivalent to bench_run().
+ */
+void bench_run_with(const bench_desc_t* desc, const bench_run_opts_t* opts);
+
+/**
+ * @brief Fill a geometric sequence first, first·ratio, ... up to last.
+ *
+ * @param out      Receives the sequence.
+ * @param max_out  Capacity of out; the sequence is cut short when full.
+ * @return Number of values written (0 if first < 1, last < first or ratio < 2).
+ */
+size_t bench_geometric_params(int first, int last, int ratio, int* out, size_t max_out);
+
+/**
+ * @brief Check whether a benchmark is selected by a filter string.
+ *
+ * A filter matches "all", the category, the task, or "task.method".
+ */
+bool bench_matches(const bench_desc_t* desc, const char* filter);
+
+/**
+ * @brief Run every registered benchmark selected by a filter.
+ *
+ * A divider line is printed after each benchmark.
+ *
+ * @param filter See bench_matches().
+ * @return Number of benchmarks run.
+ */
+int bench_run_matching(const char* filter);
+
+/**
+ * @brief bench_run_matching() with per-run overrides (see bench_run_with()).
+ */
+int bench_run_matching_with(const char* filter, const bench_run_opts_t* opts);
+
+/**
+ * @brief Measure the stack and heap usage of one kernel benchmark.
+ *
+ * An untimed pass, separate from bench_run(): for each parameter, setup and
+ * prepare run, the free stack is painted, `run` is called once, and the
+ * stack high-water mark, the heap growth since before setup and the arena
+ * allocations are printed (see bench_memory.h):
+ *   task,method,<param_name>,stack_bytes,...,arena_bytes,valid
+ *
+ * Standalone benchmarks do their own timing loop and are not profiled.
+ * Repetition settings in `opts` are ignored; only the parameters (or the
+ * sweep) are used.
+ *
+ * @return false if the descriptor is standalone (nothing printed).
+ */
+bool bench_profile_memory_with(const bench_desc_t* desc, const bench_run_opts_t* opts);
+
+/**
+ * @brief bench_profile_memory_with() for every benchmark selected by a filter.
+ *
+ * @return Number of benchmarks profiled.
+ */
+int bench_profile_memory_matching_with(const char* filter, const bench_run_opts_t* opts);
+
+/**
+ * @brief Select the runner's result encoding (default BENCH_FORMAT_CSV).
+ */
+void bench_set_format(bench_format_t format);
+
+/**
+ * @brief Current result encoding.
+ */
+bench_format_t bench_get_format(void);
+
+/**
+ * @brief Print the registry as CSV (task,method,category,params).
+ *
+ * @param filter Only list benchmarks selected by this filter (NULL for all).
+ */
+void bench_print_registry(const char* filter);
+
+#endif  // BENCH_REGISTRY_H
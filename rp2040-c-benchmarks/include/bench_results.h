@@ -0,0 +1,135 @@
+/**
+ * @file bench_results.h
+ * @brief Deferred result sink: fixed-size records in a preallocated RAM ring.
+ *
+ * Formatting and printing over USB CDC costs tens of microseconds and wakes
+ * the USB stack, so it must not happen inside timed code or an ISR whose
+ * latency is being measured. Instead, measured code appends a small
+ * fixed-size record to a ring buffer, and the records are formatted and
+ * printed after the measured phase (bench_ring_drain()).
+ *
+ * The ring is single-producer / single-consumer and lock-free: the producer
+ * (e.g. an ISR) only writes `head`, the consumer only writes `tail`, and both
+ * are aligned 32-bit words, which the Cortex-M0+ reads and writes atomically.
+ * No interrupts are masked and no spinlock is taken. Use one ring per
+ * producing context (e.g. one per ISR, one per core).
+ *
+ * When the ring is full new records are dropped and counted rather than
+ * overwriting records the consumer may be reading.
+ *
+ * Usage:
+ *   BENCH_RING_DEFINE(latency_ring, 64);
+ *   // in the ISR:
+ *   bench_ring_push(&latency_ring, gpio, events, cycles);
+ *   // after the measured phase:
+ *   bench_ring_drain(&latency_ring, print_latency, NULL);
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef BENCH_RESULTS_H
+#define BENCH_RESULTS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+/**
+ * @brief One result record (16 bytes).
+ *
+ * The meaning of `tag` and `value` is up to the benchmark, e.g. GPIO and
+ * edge events for an interrupt, or sample index and reading for the ADC.
+ */
+typedef struct {
+    uint32_t tag;
+    uint32_t value;
+    uint64_t cycles;
+} bench_record_t;
+
+/**
+ * @brief Ring state. Capacity must be a power of two.
+ */
+typedef struct {
+    bench_record_t* records;
+    uint32_t mask;               ///< capacity - 1
+    volatile uint32_t head;      ///< Next slot to write (producer only)
+    volatile uint32_t tail;      ///< Next slot to read (consumer only)
+    volatile uint32_t dropped;   ///< Records rejected because the ring was full
+} bench_ring_t;
+
+/**
+ * @brief Define a static ring with `capacity` records (a power of two).
+ */
+#define BENCH_RING_DEFINE(name, capacity)                                      \
+    _Static_assert(((capacity) & ((capacity) - 1)) == 0,                       \
+                   "ring capacity must be a power of two");                    \
+    static bench_record_t name##_records[capacity];                            \
+    static bench_ring_t name = { name##_records, (capacity) - 1u, 0, 0, 0 }
+
+/**
+ * @brief Append a record. Safe to call from an ISR; never blocks.
+ *
+ * @return false if the ring was full and the record was dropped.
+ */
+static inline bool bench_ring_push(bench_ring_t* ring, uint32_t tag, uint32_t value,
+                                   uint64_t cycles) {
+    uint32_t head = ring->head;
+    if (head - ring->tail > ring->mask) {
+        ring->dropped++;
+        return false;
+    }
+
+    bench_record_t* rec = &ring->records[head & ring->mask];
+    rec->tag = tag;
+    rec->value = value;
+    rec->cycles = cycles;
+
+    // Publish the record before the new head
+    atomic_thread_fence(memory_order_release);
+    ring->head = head + 1u;
+    return true;
+}
+
+/**
+ * @brief Remove the oldest record.
+ *
+ * @return false if the ring is empty.
+ */
+bool bench_ring_pop(bench_ring_t* ring, bench_record_t* out);
+
+/**
+ * @brief Number of records waiting to be read.
+ */
+uint32_t bench_ring_count(const bench_ring_t* ring);
+
+/**
+ * @brief Discard all records and clear the drop counter.
+ *
+ * Only call while the producer is idle (e.g. before enabling its IRQ).
+ */
+void bench_ring_reset(bench_ring_t* ring);
+
+/**
+ * @brief Callback that formats one record (typically a printf of a CSV row).
+ */
+typedef void (*bench_record_fn_t)(const bench_record_t* rec, void* user);
+
+/**
+ * @brief Pop every record and pass it to `fn`, then flush stdout.
+ *
+ * Call from a low-priority context once measurement has finished. If any
+ * records were dropped a `# dropped,<n>` line is printed.
+ *
+ * @return Number of records drained.
+ */
+uint32_t bench_ring_drain(bench_ring_t* ring, bench_record_fn_t fn, void* user);
+
+/**
+ * @brief Let buffered serial output drain before a measured phase starts.
+ *
+ * Flushes stdout and, on the device, waits briefly so the USB stack is idle
+ * rather than transmitting earlier output during the measurement.
+ */
+void bench_output_settle(void);
+
+#endif  // BENCH_RESULTS_H
@@ -0,0 +1,85 @@
+/**
+ * @file bench_sink.h
+ * @brief Compiler barriers and checksums that keep benchmark work alive.
+ *
+ * A kernel whose output is never read may legally be shrunk or removed by
+ * the optimiser, especially at -O2/-O3 with LTO, where calls through the
+ * registry can be devirtualised and inlined. Every kernel therefore passes
+ * its output through one of these barriers inside the timed region and
+ * has its output verified (checksum or reference comparison) afterwards.
+ *
+ * The barriers are empty inline-assembly statements: they emit no
+ * instructions, but the compiler must assume the asm reads the value (and,
+ * for the pointer forms, any memory), so the work that produced it cannot
+ * be dropped or moved past the barrier. GCC and Clang accept the same
+ * syntax; other compilers fall back to a volatile store.
+ *
+ * The TinyGo suite uses the same idea through common.Sink (an atomic store
+ * that LLVM will not eliminate), so both languages keep identical work.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef BENCH_SINK_H
+#define BENCH_SINK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+
+/**
+ * @brief Force `value` to be computed (kept in a register) at this point.
+ */
+static inline void bench_sink_u32(uint32_t value) {
+    __asm__ volatile("" : : "r"(value));
+}
+
+/**
+ * @brief Treat the memory behind `p` as read here (and possibly written).
+ *
+ * Stores to the buffer before this point cannot be removed, and loads after
+ * it cannot be hoisted above it.
+ */
+static inline void bench_sink_ptr(const void* p) {
+    __asm__ volatile("" : : "r"(p) : "memory");
+}
+
+/**
+ * @brief Prevent the compiler caching any memory value across this point.
+ */
+static inline void bench_clobber_memory(void) {
+    __asm__ volatile("" : : : "memory");
+}
+
+#else
+
+extern volatile uint32_t bench_sink_word;
+
+static inline void bench_sink_u32(uint32_t value) {
+    bench_sink_word = value;
+}
+
+static inline void bench_sink_ptr(const void* p) {
+    bench_sink_word = (uint32_t)(uintptr_t)p;
+}
+
+static inline void bench_clobber_memory(void) {
+    (void)bench_sink_word;
+}
+
+#endif
+
+/**
+ * @brief FNV-1a checksum of a buffer, for comparing kernel output.
+ */
+static inline uint32_t bench_checksum(const void* data, size_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ p[i]) * 16777619u;
+    }
+    return h;
+}
+
+#endif  // BENCH_SINK_H
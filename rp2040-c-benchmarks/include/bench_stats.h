@@ -0,0 +1,127 @@
+/**
+ * @file bench_stats.h
+ * @brief Repetition and statistics engine shared by all benchmarks.
+ *
+ * Runs a kernel for a number of warm-up iterations followed by a number of
+ * measured iterations, timing each measured iteration individually with the
+ * cycle timer (bench_timer.h). Samples are stored in cycles in a fixed,
+ * statically allocated buffer (no heap use) and reduced on the device to
+ * min / median / p90 / p99 / max / mean / stddev.
+ *
+ * A kernel is described by two callbacks sharing a context pointer:
+ *   - `setup` (optional, untimed) runs before every iteration, e.g. to
+ *     refill an array that the previous iteration sorted.
+ *   - `run` (timed) executes the work being measured.
+ *
+ * Both phases also stop early once they exceed `budget_us`, so slow kernels
+ * (e.g. recursive Fibonacci at n = 35) still complete in reasonable time.
+ * At least one measured sample is always taken.
+ *
+ * The calibrated timer-read overhead (bench_timer_overhead_cycles()) is
+ * subtracted from every sample; the uncorrected median is kept alongside.
+ *
+ * CSV output keeps the original `time_us` column (now the corrected median,
+ * with sub-microsecond precision) in its original position and appends the
+ * remaining statistics after it, followed by the median in cycles, the raw
+ * (uncorrected) median and the overhead that was subtracted.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef BENCH_STATS_H
+#define BENCH_STATS_H
+
+#include <stdint.h>
+
+#define BENCH_MAX_SAMPLES 4096        ///< Capacity of the shared sample buffer
+#define BENCH_DEFAULT_WARMUP 10       ///< Default warm-up iterations
+#define BENCH_DEFAULT_REPS 1000       ///< Default measured iterations
+#define BENCH_DEFAULT_BUDGET_US 2000000u  ///< Default per-phase time budget (2 s)
+
+/// Column names printed after a benchmark's own leading columns.
+#define BENCH_STATS_CSV_COLUMNS "time_us,min_us,p90_us,p99_us,max_us,mean_us,stddev_us,reps,cycles,raw_time_us,overhead_cycles"
+
+/**
+ * @brief Callback signature for kernel setup and run phases.
+ */
+typedef void (*bench_fn_t)(void* ctx);
+
+/**
+ * @brief Repetition settings for one measurement.
+ */
+typedef struct {
+    uint32_t warmup;     ///< Untimed warm-up iterations
+    uint32_t reps;       ///< Measured iterations (capped at BENCH_MAX_SAMPLES)
+    uint32_t budget_us;  ///< Per-phase time budget in microseconds
+} bench_config_t;
+
+/**
+ * @brief Summary statistics over the measured samples (cycles).
+ *
+ * All fields except raw_median are overhead-corrected.
+ */
+typedef struct {
+    uint32_t count;       ///< Number of samples collected
+    uint32_t min;
+    uint32_t median;
+    uint32_t p90;
+    uint32_t p99;
+    uint32_t max;
+    float mean;
+    float stddev;         ///< Sample standard deviation (n - 1)
+    uint32_t raw_median;  ///< Median before overhead subtraction
+    uint32_t overhead;    ///< Overhead subtracted from the median sample
+} bench_stats_t;
+
+/**
+ * @brief Default configuration (BENCH_DEFAULT_* values).
+ */
+bench_config_t bench_default_config(void);
+
+/**
+ * @brief Run a kernel repeatedly and compute timing statistics.
+ *
+ * @param cfg   Repetition settings (NULL for defaults).
+ * @param setup Untimed per-iteration setup (may be NULL).
+ * @param run   Timed kernel.
+ * @param ctx   Context passed to both callbacks.
+ * @param out   Receives the computed statistics.
+ */
+void bench_measure(const bench_config_t* cfg, bench_fn_t setup, bench_fn_t run,
+                   void* ctx, bench_stats_t* out);
+
+/**
+ * @brief Reduce ascending samples to count/min/percentiles/max/mean/stddev.
+ *
+ * raw_median and overhead are left for the caller to fill in. Used by
+ * bench_measure() and by host tools that receive raw samples.
+ */
+void bench_stats_reduce(const uint32_t* sorted, uint32_t n, bench_stats_t* out);
+
+/**
+ * @brief Samples of the most recent bench_measure() call.
+ *
+ * The samples are sorted ascending and overhead-corrected (cycles), and stay
+ * valid until the next measurement.
+ *
+ * @param out Receives a pointer to the shared sample buffer.
+ * @return Number of samples.
+ */
+uint32_t bench_last_samples(const uint32_t** out);
+
+/**
+ * @brief Print the statistics columns (BENCH_STATS_CSV_COLUMNS), no newline.
+ *
+ * Times are converted from cycles to microseconds using bench_timer_hz().
+ *
+ * Intended to follow a benchmark's own leading columns, e.g.
+ * `printf("bubblesort,bubble,%d,", n); bench_print_stats(&stats);`
+ */
+void bench_print_stats(const bench_stats_t* stats);
+
+/**
+ * @brief bench_print_stats() for samples taken at a given cycle frequency.
+ */
+void bench_print_stats_hz(const bench_stats_t* stats, uint32_t hz);
+
+#endif  // BENCH_STATS_H
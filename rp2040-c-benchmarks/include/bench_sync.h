@@ -0,0 +1,89 @@
+/**
+ * @file bench_sync.h
+ * @brief Clock sync pulses for relating this board's time to the GPIO probe's.
+ *
+ * The probe (../tools, gpio_probe) timestamps edges with its own clock, so
+ * its timestamps cannot be compared with times taken on this board. With
+ * sync running, a PWM slice drives a dedicated GPIO with one pulse every
+ * BENCH_SYNC_PERIOD_US, generated in hardware from clk_sys, so the rising
+ * edges are exactly periodic in this board's time and cost no CPU. The
+ * probe captures the line next to the signals under test, fits its own
+ * clock against the pulses and reports every edge on this board's timeline
+ * as well (tools/include/clock_sync.h).
+ *
+ * Timeline: nanoseconds since pulse 0, which starts when sync is started.
+ * Pulse k rises at exactly k * BENCH_SYNC_PERIOD_US. bench_sync_ns() places
+ * any bench_timer_now() timestamp on the same timeline to the cycle, so a
+ * benchmark can report when it acted (bench_sync_mark()) and the probe's
+ * output shows when the effect appeared.
+ *
+ * Pulse numbering: the high time of each pulse carries one symbol, so the
+ * probe can number pulses it did not see from the start. Pulses come in
+ * frames of BENCH_SYNC_FRAME_PULSES: pulse k with j = k % 32 is
+ *
+ *   j == 0   marker  (BENCH_SYNC_MARKER_US high)
+ *   j >= 1   bit j-1 of the frame number k / 32, LSB first
+ *            (BENCH_SYNC_ONE_US for 1, BENCH_SYNC_ZERO_US for 0)
+ *
+ * so one complete frame (0.32 s) numbers every pulse. The protocol
+ * constants are SDK-free and shared with the probe and the tools host build.
+ *
+ * Device only: bench_sync_start() reports failure on the host build.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef BENCH_SYNC_H
+#define BENCH_SYNC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "bench_timer.h"
+
+#define BENCH_SYNC_PERIOD_US 10000u   ///< Pulse spacing (a multiple of 1000, see bench_sync_start())
+#define BENCH_SYNC_FRAME_PULSES 32u   ///< Marker + 31 frame number bits
+#define BENCH_SYNC_ZERO_US 1000u      ///< High time of a 0 bit
+#define BENCH_SYNC_ONE_US 2000u       ///< High time of a 1 bit
+#define BENCH_SYNC_MARKER_US 4000u    ///< High time of a frame marker
+
+/**
+ * @brief Start (or restart) the pulses on `pin`; pulse 0 starts now.
+ *
+ * Needs a PWM slice of its own, and a clk_sys in whole kHz so that a period
+ * is a whole number of cycles (set_sys_clock_khz() guarantees this). Call
+ * again after changing clk_sys or recalibrating bench_timer (which resets
+ * SysTick): the timeline then starts again at 0 and the probe re-locks.
+ *
+ * @return false on the host build, or if the period cannot be generated.
+ */
+bool bench_sync_start(unsigned pin);
+
+/**
+ * @brief Stop the pulses and release the pin.
+ */
+void bench_sync_stop(void);
+
+/**
+ * @brief GPIO of the running sync, or -1.
+ */
+int bench_sync_pin(void);
+
+/**
+ * @brief Place a timestamp on the sync timeline.
+ *
+ * The microsecond part of the timestamp resolves the SysTick wraps, so any
+ * timestamp from the last 71 minutes converts to the cycle.
+ *
+ * @return Nanoseconds since pulse 0 (negative before it), or INT64_MIN if
+ *         sync is not running.
+ */
+int64_t bench_sync_ns(bench_timestamp_t t);
+
+/**
+ * @brief Print `sync_mark,<label>,<main_us>` for a timestamp, if sync is running.
+ *
+ * main_us has nanosecond digits, like the probe's `main_us` column.
+ */
+void bench_sync_mark(const char* label, bench_timestamp_t t);
+
+#endif  // BENCH_SYNC_H
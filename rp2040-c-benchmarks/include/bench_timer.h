@@ -0,0 +1,150 @@
+/**
+ * @file bench_timer.h
+ * @brief Cycle-accurate timing abstraction for the benchmark suite.
+ *
+ * On the RP2040 this reads the Cortex-M0+ SysTick counter, a 24-bit down
+ * counter clocked from clk_sys, giving single-cycle resolution instead of the
+ * 1 µs resolution of get_absolute_time(). SysTick wraps every 2^24 cycles
+ * (~134 ms at 125 MHz), so each timestamp also records the 32-bit microsecond
+ * timer: short intervals are measured from SysTick (with wrap handling), and
+ * intervals too long for SysTick fall back to the microsecond timer scaled
+ * to cycles.
+ *
+ * On the host build (BENCH_HOST) timestamps come from
+ * clock_gettime(CLOCK_MONOTONIC) and one "cycle" is one nanosecond, so the
+ * same code path runs unchanged on Linux.
+ *
+ * Reading the timer is not free: an empty timed region still reports the
+ * cost of two timestamp reads plus the subtraction. bench_timer_init()
+ * therefore runs a calibration phase that measures an empty region many
+ * times and records the median overhead for each backend, which the
+ * statistics engine subtracts from every sample.
+ *
+ * Usage:
+ *   bench_timer_init();                    // once at startup (calibrates)
+ *   bench_timestamp_t t0 = bench_timer_now();
+ *   kernel();
+ *   uint64_t cycles = bench_timer_elapsed_cycles(t0, bench_timer_now());
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef BENCH_TIMER_H
+#define BENCH_TIMER_H
+
+#include <stdint.h>
+
+#if BENCH_HOST
+#include <time.h>
+#else
+#include "pico/stdlib.h"
+#include "hardware/structs/systick.h"
+#endif
+
+#define BENCH_CALIBRATION_SAMPLES 255  ///< Empty regions timed per backend
+
+/**
+ * @brief Underlying clock used for an interval.
+ */
+typedef enum {
+    BENCH_BACKEND_CYCLES,    ///< SysTick (device) or clock_gettime (host)
+    BENCH_BACKEND_US_TIMER,  ///< Microsecond timer fallback (device only)
+    BENCH_BACKEND_COUNT
+} bench_backend_t;
+
+/**
+ * @brief A point in time captured by bench_timer_now().
+ */
+typedef struct {
+#if BENCH_HOST
+    uint64_t ns;       ///< Monotonic clock in nanoseconds
+#else
+    uint32_t us;       ///< Lower 32 bits of the microsecond timer
+    uint32_t systick;  ///< SysTick current value (24-bit, counts down)
+#endif
+} bench_timestamp_t;
+
+/**
+ * @brief Enable the cycle counter, cache the clock frequency and calibrate.
+ *
+ * Must be called once before any other bench_timer function. Safe to call
+ * more than once; calibration only runs the first time.
+ */
+void bench_timer_init(void);
+
+/**
+ * @brief Re-read the clock frequency, reconfigure and calibrate again.
+ *
+ * Call after changing clk_sys (e.g. set_sys_clock_khz()).
+ */
+void bench_timer_recalibrate(void);
+
+/**
+ * @brief Frequency of the cycle counter in Hz (clk_sys, or 1 GHz on host).
+ */
+uint32_t bench_timer_hz(void);
+
+/**
+ * @brief Capture the current time.
+ */
+static inline bench_timestamp_t bench_timer_now(void) {
+    bench_timestamp_t t;
+#if BENCH_HOST
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    t.ns = (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#else
+    t.us = time_us_32();
+    t.systick = systick_hw->cvr;
+#endif
+    return t;
+}
+
+/**
+ * @brief Cycles elapsed between two timestamps.
+ *
+ * Uses SysTick when the interval is safely shorter than its wrap period,
+ * otherwise converts the microsecond timer delta to cycles.
+ *
+ * @param start Earlier timestamp.
+ * @param end   Later timestamp.
+ * @return Elapsed cycles.
+ */
+uint64_t bench_timer_elapsed_cycles(bench_timestamp_t start, bench_timestamp_t end);
+
+/**
+ * @brief Backend that bench_timer_elapsed_cycles() uses for an interval.
+ *
+ * @param cycles Raw elapsed cycles of the interval.
+ */
+bench_backend_t bench_timer_backend_for(uint64_t cycles);
+
+/**
+ * @brief Calibrated median overhead of an empty timed region, in cycles.
+ */
+uint32_t bench_timer_overhead_cycles(bench_backend_t backend);
+
+/**
+ * @brief Remove the calibrated overhead from a raw measurement.
+ *
+ * @param raw_cycles Value returned by bench_timer_elapsed_cycles().
+ * @return raw_cycles minus the overhead of its backend, clamped at zero.
+ */
+uint64_t bench_timer_subtract_overhead(uint64_t raw_cycles);
+
+/**
+ * @brief Print the calibration results as CSV (backend,overhead_cycles).
+ */
+void bench_timer_print_calibration(void);
+
+/**
+ * @brief Convert cycles to nanoseconds.
+ */
+uint64_t bench_cycles_to_ns(uint64_t cycles);
+
+/**
+ * @brief Convert cycles to microseconds (fractional).
+ */
+double bench_cycles_to_us(double cycles);
+
+#endif  // BENCH_TIMER_H
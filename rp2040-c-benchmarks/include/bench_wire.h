@@ -0,0 +1,188 @@
+/**
+ * @file bench_wire.h
+ * @brief Compact binary framing for result records (optional CSV replacement).
+ *
+ * Formatting every sample or probe edge with printf, and sending it as text,
+ * makes the CPU and USB bandwidth the bottleneck for large repetition counts.
+ * This format carries the same information in a fraction of the bytes, and
+ * host/bench_decode.c turns it back into the usual CSV.
+ *
+ * Frame layout (multi-byte fixed fields are little-endian):
+ *
+ *   magic      2 bytes   0xB5 0x57
+ *   version    1 byte    BENCH_WIRE_VERSION
+ *   type       1 byte    bench_wire_type_t
+ *   length     2 bytes   payload length
+ *   payload    length bytes
+ *   crc        2 bytes   CRC-16/CCITT-FALSE over version..payload
+ *
+ * The first magic byte is not ASCII, so frames can be interleaved with text
+ * on the same serial stream; the decoder passes text through unchanged.
+ *
+ * Payload encodings use unsigned LEB128 varints ("uv") and zigzag varints
+ * ("sv"); strings are a uv length followed by the bytes.
+ *
+ *   BENCH_WIRE_RESULT (one CSV row of the benchmark runner):
+ *     task, method, param_name          strings (benchmark id)
+ *     num_params uv, params sv...        parameter tuple
+ *     timer_hz uv, overhead uv, raw_median uv, flags u8
+ *     num_samples uv, samples[0] uv, then sv deltas samples[i] - samples[i-1]
+ *   Samples are overhead-corrected cycles in ascending order, exactly as the
+ *   statistics engine reduced them, so the decoder reproduces every column.
+ *
+ *   BENCH_WIRE_EDGES (a batch of probe edges):
+ *     pin u8, first_state u8, timer_hz uv
+ *     num_edges uv, timestamps[0] uv, then uv deltas (mod 2^32)
+ *   The level alternates on every edge, starting at first_state.
+ *
+ *   BENCH_WIRE_EDGES_PACKED (compressed probe edges, any pin count):
+ *     Built in place by the tools firmware (tools/include/edge_pack.h, which
+ *     documents the payload) and sealed with bench_wire_seal_frame().
+ *     bench_decode does not decode it; tools/host/edge_unpack does.
+ *
+ * This header and src/common/wire.c have no dependencies on the rest of the
+ * suite, so the tools firmware builds them directly from this directory.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef BENCH_WIRE_H
+#define BENCH_WIRE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define BENCH_WIRE_MAGIC0 0xB5
+#define BENCH_WIRE_MAGIC1 0x57
+#define BENCH_WIRE_VERSION 1
+
+#define BENCH_WIRE_HEADER_SIZE 6                ///< magic + version + type + length
+#define BENCH_WIRE_CRC_SIZE 2
+#define BENCH_WIRE_MAX_PAYLOAD 0xFFFFu
+#define BENCH_WIRE_MAX_NAME 32                  ///< Longest task/method/param name (incl. NUL)
+#define BENCH_WIRE_MAX_PARAMS 4                 ///< Longest parameter tuple
+
+#define BENCH_WIRE_FLAG_VALID 0x01u    ///< verify() accepted the output
+#define BENCH_WIRE_FLAG_SKIPPED 0x02u  ///< setup() rejected the parameter
+
+/// Frame capacity needed for a result with `n` samples (worst-case varints).
+#define BENCH_WIRE_RESULT_FRAME_SIZE(n) \
+    (BENCH_WIRE_HEADER_SIZE + BENCH_WIRE_CRC_SIZE + 3 * BENCH_WIRE_MAX_NAME + \
+     BENCH_WIRE_MAX_PARAMS * 5 + 40 + (n) * 5)
+
+/**
+ * @brief Record types.
+ */
+typedef enum {
+    BENCH_WIRE_RESULT = 1,  ///< Benchmark result with its samples
+    BENCH_WIRE_EDGES = 2,   ///< Probe edge timestamps
+    BENCH_WIRE_EDGES_PACKED = 3,  ///< Compressed probe edges (tools/include/edge_pack.h)
+} bench_wire_type_t;
+
+/**
+ * @brief One benchmark result (one CSV row).
+ */
+typedef struct {
+    char task[BENCH_WIRE_MAX_NAME];
+    char method[BENCH_WIRE_MAX_NAME];
+    char param_name[BENCH_WIRE_MAX_NAME];
+    uint8_t num_params;
+    int32_t params[BENCH_WIRE_MAX_PARAMS];
+    uint32_t timer_hz;       ///< Cycles per second of the samples
+    uint32_t overhead;       ///< Timer overhead subtracted from the median
+    uint32_t raw_median;     ///< Median before overhead subtraction
+    uint8_t flags;           ///< BENCH_WIRE_FLAG_*
+    uint32_t num_samples;
+    const uint32_t* samples; ///< Ascending, overhead-corrected cycles
+} bench_wire_result_t;
+
+/**
+ * @brief A batch of edges captured on one pin.
+ */
+typedef struct {
+    uint8_t pin;
+    uint8_t first_state;         ///< Level after the first edge
+    uint32_t timer_hz;           ///< Timestamp ticks per second
+    uint32_t num_edges;
+    const uint32_t* timestamps;  ///< Edge times (32-bit, may wrap)
+} bench_wire_edges_t;
+
+/**
+ * @brief CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF).
+ */
+uint16_t bench_wire_crc16(const uint8_t* data, size_t len);
+
+/**
+ * @brief Encode a result frame.
+ *
+ * @return Frame length in bytes, or 0 if it does not fit in `cap`.
+ */
+size_t bench_wire_encode_result(uint8_t* out, size_t cap, const bench_wire_result_t* result);
+
+/**
+ * @brief Encode an edge batch frame.
+ *
+ * @return Frame length in bytes, or 0 if it does not fit in `cap`.
+ */
+size_t bench_wire_encode_edges(uint8_t* out, size_t cap, const bench_wire_edges_t* edges);
+
+/**
+ * @brief Add the header and CRC around a payload built in place.
+ *
+ * For encoders that write their own payload: it must start at
+ * out + BENCH_WIRE_HEADER_SIZE, and BENCH_WIRE_CRC_SIZE bytes after it must
+ * be free.
+ *
+ * @return Frame length in bytes, or 0 if the payload is too long.
+ */
+size_t bench_wire_seal_frame(uint8_t* out, bench_wire_type_t type, size_t payload_len);
+
+/**
+ * @brief Outcome of bench_wire_parse_frame().
+ */
+typedef enum {
+    BENCH_WIRE_FRAME_OK,
+    BENCH_WIRE_FRAME_INCOMPLETE,  ///< Need more bytes
+    BENCH_WIRE_FRAME_BAD,         ///< Not a valid frame at this position (bad magic, version or CRC)
+} bench_wire_frame_status_t;
+
+/**
+ * @brief Validate a frame at the start of `data`.
+ *
+ * @param type        Receives the record type.
+ * @param payload     Receives a pointer to the payload inside `data`.
+ * @param payload_len Receives the payload length.
+ * @param frame_len   Receives the total frame length (to advance past it).
+ */
+bench_wire_frame_status_t bench_wire_parse_frame(const uint8_t* data, size_t len,
+                                                 bench_wire_type_t* type,
+                                                 const uint8_t** payload, size_t* payload_len,
+                                                 size_t* frame_len);
+
+/**
+ * @brief Decode a BENCH_WIRE_RESULT payload.
+ *
+ * @param samples     Storage for the samples; result->samples points here.
+ * @param max_samples Capacity of `samples`.
+ * @return false if the payload is malformed or has too many samples.
+ */
+bool bench_wire_decode_result(const uint8_t* payload, size_t len, bench_wire_result_t* result,
+                              uint32_t* samples, uint32_t max_samples);
+
+/**
+ * @brief Decode a BENCH_WIRE_EDGES payload.
+ *
+ * @param timestamps  Storage for the timestamps; edges->timestamps points here.
+ * @param max_edges   Capacity of `timestamps`.
+ * @return false if the payload is malformed or has too many edges.
+ */
+bool bench_wire_decode_edges(const uint8_t* payload, size_t len, bench_wire_edges_t* edges,
+                             uint32_t* timestamps, uint32_t max_edges);
+
+/**
+ * @brief Write an encoded frame to the serial output without CR/LF translation.
+ */
+void bench_wire_write(const uint8_t* frame, size_t len);
+
+#endif  // BENCH_WIRE_H
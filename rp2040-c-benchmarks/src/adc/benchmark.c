@@ -12,9 +12,14 @@
  *   - GND             → Other side of potentiometer
  *
  * Output format:
- *   task,method,reads,avg_time_us
+ *   task,method,reads,avg_time_us,avg_cycles,raw_avg_time_us
  *
- * Occasional read samples are also printed for verification purposes.
+ * The calibrated timer-read overhead is subtracted from each read; the
+ * uncorrected average is reported as raw_avg_time_us.
+ *
+ * Occasional read samples are also printed for verification purposes. They
+ * are recorded in a RAM ring during the timed loop and printed afterwards,
+ * so no USB serial output happens between timed reads.
  *
  * @author Samuel Ivuerah
  */
@@ -23,19 +28,31 @@
 #include "pico/stdlib.h"
 #include "hardware/adc.h"
 #include "pico/time.h"
-#include "benchmarks.h"
+#include "bench_registry.h"
+#include "bench_results.h"
+#include "bench_timer.h"
+
+BENCH_RING_DEFINE(sample_ring, 8);  ///< Every 250th of 1000 reads
+
+/**
+ * @brief Print one recorded ADC sample (index, value).
+ */
+static void print_sample(const bench_record_t* rec, void* user) {
+    (void)user;
+    printf("adc,sample,%lu,%lu\n", (unsigned long)rec->tag, (unsigned long)rec->value);
+}
 
 /**
  * @brief Executes ADC benchmark by sampling from GPIO26 (ADC0).
  *
- * Performs 1000 single-sample ADC reads, times each operation individually,
- * and calculates the average latency per read. A subset of values is printed
- * for manual inspection.
+ * Performs 1000 single-sample ADC reads, times each operation individually
+ * in cycles, and calculates the average latency per read. A subset of values
+ * is recorded and printed after the loop for manual inspection.
  *
  * @note Output is CSV-formatted.
  * @return void
  */
-void benchmark_adc(void) {
+static void benchmark_adc(void) {
     const int NUM_READS = 1000;
 
     // Initialise ADC subsystem and GPIO26
@@ -43,22 +60,40 @@ void benchmark_adc(void) {
     adc_gpio_init(26);     // GP26 = ADC0
     adc_select_input(0);   // Select ADC0 as input
 
-    printf("task,method,reads,avg_time_us\n");
+    printf("task,method,reads,avg_time_us,avg_cycles,raw_avg_time_us\n");
+    bench_output_settle();
+    bench_ring_reset(&sample_ring);
 
-    int64_t total_time = 0;
+    uint64_t total_cycles = 0;
+    uint64_t total_raw = 0;
 
     for (int i = 0; i < NUM_READS; ++i) {
-        absolute_time_t start = get_absolute_time();
+        bench_timestamp_t start = bench_timer_now();
         uint16_t value = adc_read();  // 12-bit result: 0–4095
-        int64_t elapsed = absolute_time_diff_us(start, get_absolute_time());
-        total_time += elapsed;
+        uint64_t raw = bench_timer_elapsed_cycles(start, bench_timer_now());
+        total_raw += raw;
+        total_cycles += bench_timer_subtract_overhead(raw);
 
-        // Print selected samples for debugging/visual validation
+        // Record selected samples for debugging/visual validation
         if (i % 250 == 0) {
-            printf("adc,sample,%d,%d\n", i, value);
+            bench_ring_push(&sample_ring, (uint32_t)i, value, raw);
         }
     }
 
-    int64_t avg_time = total_time / NUM_READS;
-    printf("adc,single_read,%d,%lld\n", NUM_READS, avg_time);
+    bench_ring_drain(&sample_ring, print_sample, NULL);
+
+    double avg_cycles = (double)total_cycles / NUM_READS;
+    double raw_avg_cycles = (double)total_raw / NUM_READS;
+    printf("adc,single_read,%d,%.3f,%.1f,%.3f\n", NUM_READS,
+           bench_cycles_to_us(avg_cycles), avg_cycles, bench_cycles_to_us(raw_avg_cycles));
 }
+
+/**
+ * @brief ADC read latency on GPIO26 (ADC0) (self-timed, needs external wiring).
+ */
+const bench_desc_t bench_adc_single_read = {
+    .task = "adc",
+    .method = "single_read",
+    .category = BENCH_CATEGORY_HARDWARE,
+    .standalone = benchmark_adc,
+};
@@ -6,14 +6,16 @@
  * a comparison-based sorting technique that repeatedly swaps adjacent
  * elements to order an array.
  *
- * Arrays are reverse-ordered to simulate worst-case performance.
- * Results are printed in CSV format via USB serial.
+ * Arrays are reverse-ordered to simulate worst-case performance. The benchmark
+ * is registered as a descriptor (bench_registry.h); each size is repeated by
+ * the shared statistics engine and the results are printed in CSV format via
+ * USB serial.
  *
  * Source (algorithmic reference):
  * https://en.wikipedia.org/wiki/Bubble_sort
  *
  * Output format:
- *   task,method,size,time_us
+ *   task,method,size,time_us,...(see bench_stats.h),valid
  *
  * @author Samuel Ivuerah
  */
@@ -21,7 +23,9 @@
 #include <stdio.h>
 #include "pico/stdlib.h"
 #include "pico/time.h"
-#include "benchmarks.h"
+#include "bench_arena.h"
+#include "bench_registry.h"
+#include "bench_sink.h"
 
 /**
  * @brief In-place Bubble Sort implementation.
@@ -46,35 +50,79 @@ static void bubble_sort(int* arr, int n) {
 }
 
 /**
- * @brief Executes the Bubble Sort benchmark for various array sizes.
- *
- * Populates arrays in descending order to represent the worst-case input
- * for Bubble Sort. Measures the time taken to sort each array using the
- * Pico SDK’s high-resolution timer. Outputs are printed in CSV format.
- *
- * @note Tested sizes: 10, 50, 100
- * @note CSV format: task,method,size,time_us
+ * @brief Kernel context for one array size.
  */
-void benchmark_bubble_sort(void) {
-    int sizes[] = {10, 50, 100};
-    int test[100];  // Sorting buffer
+typedef struct {
+    int* data;  ///< Sorting buffer (benchmark arena)
+    int n;      ///< Number of elements
+} sort_ctx_t;
 
-    printf("task,method,size,time_us\n");
+static sort_ctx_t sort_ctx;
 
-    for (int s = 0; s < sizeof(sizes) / sizeof(int); s++) {
-        int n = sizes[s];
+/// Default sizes: 10, 50, 100
+static const int sort_sizes[] = {10, 50, 100};
 
-        // Populate array in descending order (worst-case input)
-        for (int i = 0; i < n; i++) {
-            test[i] = n - i;
-        }
+#define SORT_SWEEP_MAX 5120  ///< Sweeps run 10, 20, 40, ... 5120 (O(n²): seconds per run at the top)
+
+static bool sort_setup(void* ctx, int n) {
+    sort_ctx_t* c = ctx;
+    if (n < 1) {
+        return false;
+    }
+    c->data = bench_arena_alloc((size_t)n * sizeof(int));
+    c->n = n;
+    return c->data != NULL;
+}
+
+/**
+ * @brief Fill the array in descending order (worst-case input).
+ */
+static void fill_descending(void* ctx) {
+    sort_ctx_t* c = ctx;
+    for (int i = 0; i < c->n; i++) {
+        c->data[i] = c->n - i;
+    }
+}
 
-        // Time the sorting operation
-        absolute_time_t start = get_absolute_time();
-        bubble_sort(test, n);
-        int64_t elapsed = absolute_time_diff_us(start, get_absolute_time());
+static void run_bubble_sort(void* ctx) {
+    sort_ctx_t* c = ctx;
+    bubble_sort(c->data, c->n);
+    bench_sink_ptr(c->data);
+}
 
-        // Print result in CSV format
-        printf("bubblesort,bubble,%d,%lld\n", n, elapsed);
+/**
+ * @brief Check the array holds exactly 1..n in ascending order.
+ *
+ * Comparing against the known sorted permutation (not just adjacent order)
+ * also catches a kernel that loses or duplicates elements.
+ */
+static bool verify_sorted(void* ctx) {
+    sort_ctx_t* c = ctx;
+    for (int i = 0; i < c->n; i++) {
+        if (c->data[i] != i + 1) {
+            return false;
+        }
     }
+    return true;
 }
+
+/**
+ * @brief Bubble Sort on reverse-ordered arrays of size 10, 50, 100.
+ *
+ * The array is allocated from the benchmark arena and refilled before every
+ * repetition.
+ */
+const bench_desc_t bench_bubblesort_bubble = {
+    .task = "bubblesort",
+    .method = "bubble",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = sort_sizes,
+    .num_params = sizeof(sort_sizes) / sizeof(sort_sizes[0]),
+    .sweep_max = SORT_SWEEP_MAX,
+    .ctx = &sort_ctx,
+    .setup = sort_setup,
+    .prepare = fill_descending,
+    .run = run_bubble_sort,
+    .verify = verify_sorted,
+};
@@ -0,0 +1,79 @@
+/**
+ * @file arena.c
+ * @brief Bump allocator for benchmark buffers (see bench_arena.h).
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "bench_arena.h"
+
+#if BENCH_HOST
+static _Alignas(BENCH_ARENA_ALIGN) unsigned char host_arena[BENCH_HOST_ARENA_BYTES];
+#else
+#include <unistd.h>
+
+/// Upper bound of the heap: the SDK linker script's (historically named)
+/// limit that _sbrk() grows the heap up to, the end of main RAM
+extern char __StackLimit;
+#endif
+
+static unsigned char* arena_base;
+static size_t arena_size;
+static size_t arena_offset;
+static bool arena_ready;
+
+/**
+ * @brief Claim the arena memory on first use.
+ */
+static void arena_init(void) {
+    arena_ready = true;
+#if BENCH_HOST
+    arena_base = host_arena;
+    arena_size = sizeof(host_arena);
+#else
+    // Everything between the current break and the heap limit, less the
+    // reserve; malloc() rounds its sbrk() request up, which the reserve absorbs
+    uintptr_t brk = (uintptr_t)sbrk(0);
+    uintptr_t limit = (uintptr_t)&__StackLimit;
+    if (limit <= brk + BENCH_ARENA_HEAP_RESERVE) {
+        return;
+    }
+    size_t size = (limit - brk - BENCH_ARENA_HEAP_RESERVE) & ~(size_t)(BENCH_ARENA_ALIGN - 1u);
+    arena_base = malloc(size);
+    arena_size = arena_base ? size : 0;
+#endif
+}
+
+void* bench_arena_alloc(size_t size) {
+    if (!arena_ready) {
+        arena_init();
+    }
+    size = (size + BENCH_ARENA_ALIGN - 1u) & ~(size_t)(BENCH_ARENA_ALIGN - 1u);
+    if (size > arena_size - arena_offset) {
+        return NULL;
+    }
+    void* p = arena_base + arena_offset;
+    arena_offset += size;
+    return p;
+}
+
+void bench_arena_reset(void) {
+    if (!arena_ready) {
+        arena_init();
+    }
+    arena_offset = 0;
+}
+
+size_t bench_arena_capacity(void) {
+    if (!arena_ready) {
+        arena_init();
+    }
+    return arena_size;
+}
+
+size_t bench_arena_used(void) {
+    return arena_offset;
+}
@@ -0,0 +1,564 @@
+/**
+ * @file command.c
+ * @brief Serial command parser and dispatcher (see bench_command.h).
+ *
+ * Commands are looked up in a static table. Each handler prints its response
+ * body and returns NULL on success or an error message; the dispatcher wraps
+ * the body in @begin/@end framing and flushes stdout so the response reaches
+ * the host immediately (USB CDC on the device, a pipe or pty on Linux).
+ *
+ * Session settings (repetitions, warm-up, budget) start at the engine
+ * defaults and persist until changed with `set`; `run` can override them
+ * for a single command.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench_command.h"
+#include "bench_registry.h"
+#include "bench_sync.h"
+#include "bench_timer.h"
+
+#if !BENCH_HOST
+#include "hardware/clocks.h"
+#include "pico/stdlib.h"
+#endif
+
+typedef const char* (*command_fn_t)(const bench_cmd_t* cmd);
+
+static bench_config_t session_config;
+static bool session_ready = false;
+
+/// Formatted error messages (handlers return a pointer to this)
+static char error_message[96];
+
+/**
+ * @brief Session repetition settings, initialised on first use.
+ */
+static bench_config_t* session(void) {
+    if (!session_ready) {
+        session_config = bench_default_config();
+        session_ready = true;
+    }
+    return &session_config;
+}
+
+bench_cmd_status_t bench_cmd_parse(const char* line, bench_cmd_t* cmd) {
+    size_t len = strlen(line);
+    if (len >= sizeof(cmd->buffer)) {
+        return BENCH_CMD_TOO_LONG;
+    }
+    memcpy(cmd->buffer, line, len + 1);
+
+    cmd->verb = NULL;
+    cmd->target = NULL;
+    cmd->num_args = 0;
+
+    char* p = cmd->buffer;
+    for (;;) {
+        while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') {
+            *p++ = '\0';
+        }
+        if (*p == '\0') {
+            break;
+        }
+
+        char* word = p;
+        while (*p && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n') {
+            p++;
+        }
+        if (*p) {
+            *p++ = '\0';
+        }
+
+        char* eq = strchr(word, '=');
+        if (cmd->verb == NULL) {
+            cmd->verb = word;
+        } else if (eq == NULL) {
+            // Only one positional argument, and it must precede key=value pairs
+            if (cmd->target != NULL || cmd->num_args > 0) {
+                return BENCH_CMD_BAD_ARG;
+            }
+            cmd->target = word;
+        } else {
+            if (eq == word) {
+                return BENCH_CMD_BAD_ARG;
+            }
+            if (cmd->num_args == BENCH_CMD_MAX_ARGS) {
+                return BENCH_CMD_TOO_MANY_ARGS;
+            }
+            *eq = '\0';
+            cmd->args[cmd->num_args].key = word;
+            cmd->args[cmd->num_args].value = eq + 1;
+            cmd->num_args++;
+        }
+    }
+
+    return cmd->verb ? BENCH_CMD_OK : BENCH_CMD_EMPTY;
+}
+
+const char* bench_cmd_status_str(bench_cmd_status_t status) {
+    switch (status) {
+        case BENCH_CMD_OK:            return "ok";
+        case BENCH_CMD_EMPTY:         return "empty line";
+        case BENCH_CMD_TOO_LONG:      return "line too long";
+        case BENCH_CMD_TOO_MANY_ARGS: return "too many arguments";
+        case BENCH_CMD_BAD_ARG:       return "malformed argument";
+    }
+    return "unknown error";
+}
+
+/**
+ * @brief Parse a decimal unsigned integer, rejecting trailing characters.
+ */
+static bool parse_u32(const char* s, uint32_t* out) {
+    if (*s < '0' || *s > '9') {
+        return false;
+    }
+    char* end;
+    unsigned long v = strtoul(s, &end, 10);
+    if (*end != '\0' || v > UINT32_MAX) {
+        return false;
+    }
+    *out = (uint32_t)v;
+    return true;
+}
+
+/**
+ * @brief Parse one non-negative decimal value of a parameter list.
+ *
+ * @return Pointer past the digits, or NULL if there are none or it overflows.
+ */
+static const char* parse_param_value(const char* s, long* v) {
+    if (*s < '0' || *s > '9') {
+        return NULL;
+    }
+    char* end;
+    *v = strtol(s, &end, 10);
+    return *v > INT32_MAX ? NULL : end;
+}
+
+/**
+ * @brief Parse a comma-separated list of non-negative parameters.
+ *
+ * Each item is a value or a geometric range `first..last` (doubling) or
+ * `first..last*ratio` (see bench_geometric_params()).
+ *
+ * @return Number of values parsed, or 0 on a malformed or oversized list.
+ */
+static size_t parse_params(const char* s, int* params) {
+    size_t n = 0;
+    while (*s) {
+        long first;
+        s = parse_param_value(s, &first);
+        if (s == NULL || n == BENCH_CMD_MAX_PARAMS) {
+            return 0;
+        }
+
+        if (s[0] == '.' && s[1] == '.') {
+            long last;
+            long ratio = 2;
+            s = parse_param_value(s + 2, &last);
+            if (s && *s == '*') {
+                s = parse_param_value(s + 1, &ratio);
+            }
+            if (s == NULL) {
+                return 0;
+            }
+            size_t count = bench_geometric_params((int)first, (int)last, (int)ratio, params + n,
+                                                  BENCH_CMD_MAX_PARAMS - n);
+            // Reject a range that is empty or did not fit
+            if (count == 0 || (long long)params[n + count - 1] * ratio <= last) {
+                return 0;
+            }
+            n += count;
+        } else {
+            params[n++] = (int)first;
+        }
+
+        if (*s != ',' && *s != '\0') {
+            return 0;
+        }
+        s = *s ? s + 1 : s;
+    }
+    return n;
+}
+
+/**
+ * @brief Apply a reps/warmup/budget_ms argument to a configuration.
+ *
+ * @return NULL if applied, an error message if the value is invalid, or
+ *         the empty string if the key is not a repetition setting.
+ */
+static const char* apply_config_arg(const bench_cmd_arg_t* arg, bench_config_t* cfg) {
+    uint32_t v;
+    bool is_reps = strcmp(arg->key, "reps") == 0;
+    bool is_warmup = strcmp(arg->key, "warmup") == 0;
+    bool is_budget = strcmp(arg->key, "budget_ms") == 0;
+
+    if (!is_reps && !is_warmup && !is_budget) {
+        return "";
+    }
+    if (!parse_u32(arg->value, &v)) {
+        snprintf(error_message, sizeof(error_message), "invalid %s '%s'", arg->key, arg->value);
+        return error_message;
+    }
+
+    if (is_reps) {
+        if (v == 0 || v > BENCH_MAX_SAMPLES) {
+            snprintf(error_message, sizeof(error_message), "reps must be 1-%d", BENCH_MAX_SAMPLES);
+            return error_message;
+        }
+        cfg->reps = v;
+    } else if (is_warmup) {
+        cfg->warmup = v;
+    } else {
+        if (v == 0 || v > UINT32_MAX / 1000u) {
+            return "budget_ms out of range";
+        }
+        cfg->budget_us = v * 1000u;
+    }
+    return NULL;
+}
+
+/**
+ * @brief True if `key` names the parameter of any benchmark matching filter.
+ */
+static bool is_param_key(const char* key, const char* filter) {
+    if (strcmp(key, "n") == 0) {
+        return true;
+    }
+    for (size_t i = 0; i < bench_registry_count; i++) {
+        const bench_desc_t* desc = bench_registry[i];
+        if (desc->param_name && strcmp(key, desc->param_name) == 0 &&
+            bench_matches(desc, filter)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static const char* cmd_help(const bench_cmd_t* cmd);
+
+static const char* cmd_ping(const bench_cmd_t* cmd) {
+    (void)cmd;
+    printf("pong\n");
+    return NULL;
+}
+
+static const char* cmd_list(const bench_cmd_t* cmd) {
+    bench_print_registry(cmd->target);
+    return NULL;
+}
+
+/**
+ * @brief Apply the key=value arguments of run/mem to a config and options.
+ *
+ * @return NULL on success, or an error message.
+ */
+static const char* parse_run_args(const bench_cmd_t* cmd, bench_config_t* cfg,
+                                  bench_run_opts_t* opts) {
+    static int params[BENCH_CMD_MAX_PARAMS];
+
+    for (size_t i = 0; i < cmd->num_args; i++) {
+        const bench_cmd_arg_t* arg = &cmd->args[i];
+        const char* err = apply_config_arg(arg, cfg);
+        if (err == NULL) {
+            continue;
+        }
+        if (*err) {
+            return err;
+        }
+        if (strcmp(arg->key, "sweep") == 0) {
+            uint32_t ratio;
+            if (!parse_u32(arg->value, &ratio) || ratio < 2 || ratio > 1000) {
+                snprintf(error_message, sizeof(error_message), "sweep must be 2-1000");
+                return error_message;
+            }
+            opts->sweep = (int)ratio;
+            continue;
+        }
+        if (!is_param_key(arg->key, cmd->target)) {
+            snprintf(error_message, sizeof(error_message), "unknown key '%s'", arg->key);
+            return error_message;
+        }
+        opts->num_params = parse_params(arg->value, params);
+        if (opts->num_params == 0) {
+            snprintf(error_message, sizeof(error_message), "invalid %s '%s'", arg->key, arg->value);
+            return error_message;
+        }
+        opts->params = params;
+    }
+    return NULL;
+}
+
+static const char* cmd_run(const bench_cmd_t* cmd) {
+    if (cmd->target == NULL) {
+        return "usage: run <filter> [n=a,b,...|n=a..b*r|sweep=r] [reps=] [warmup=] [budget_ms=]";
+    }
+
+    bench_config_t cfg = *session();
+    bench_run_opts_t opts = { .params = NULL, .num_params = 0, .sweep = 0, .config = &cfg };
+    const char* err = parse_run_args(cmd, &cfg, &opts);
+    if (err) {
+        return err;
+    }
+
+    if (bench_run_matching_with(cmd->target, &opts) == 0) {
+        snprintf(error_message, sizeof(error_message), "no benchmark matches '%s'", cmd->target);
+        return error_message;
+    }
+    return NULL;
+}
+
+static const char* cmd_mem(const bench_cmd_t* cmd) {
+    if (cmd->target == NULL) {
+        return "usage: mem <filter> [n=a,b,...|n=a..b*r|sweep=r]";
+    }
+
+    bench_config_t cfg = *session();
+    bench_run_opts_t opts = { .params = NULL, .num_params = 0, .sweep = 0, .config = &cfg };
+    const char* err = parse_run_args(cmd, &cfg, &opts);
+    if (err) {
+        return err;
+    }
+
+    if (bench_profile_memory_matching_with(cmd->target, &opts) == 0) {
+        snprintf(error_message, sizeof(error_message), "no kernel benchmark matches '%s'",
+                 cmd->target);
+        return error_message;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Restart running sync pulses after SysTick or clk_sys changed.
+ *
+ * The timeline starts again at 0 and the probe re-locks on its own.
+ */
+static void restart_sync(void) {
+    int pin = bench_sync_pin();
+    if (pin >= 0 && !bench_sync_start((unsigned)pin)) {
+        printf("sync stopped: clk_sys is not a whole number of kHz\n");
+    }
+}
+
+static const char* cmd_set(const bench_cmd_t* cmd) {
+    if (cmd->target != NULL || cmd->num_args == 0) {
+        return "usage: set key=value ... (reps, warmup, budget_ms, format, clk)";
+    }
+
+    // Check every argument before applying any, so a bad one changes nothing
+    bench_config_t cfg = *session();
+    bool set_format = false;
+    bench_format_t format = BENCH_FORMAT_CSV;
+    bool set_clk = false;
+    uint32_t khz = 0;
+    for (size_t i = 0; i < cmd->num_args; i++) {
+        const bench_cmd_arg_t* arg = &cmd->args[i];
+        const char* err = apply_config_arg(arg, &cfg);
+        if (err == NULL) {
+            continue;
+        }
+        if (*err) {
+            return err;
+        }
+        if (strcmp(arg->key, "format") == 0) {
+            if (strcmp(arg->value, "csv") == 0) {
+                format = BENCH_FORMAT_CSV;
+            } else if (strcmp(arg->value, "binary") == 0) {
+                format = BENCH_FORMAT_BINARY;
+            } else {
+                return "format must be csv or binary";
+            }
+            set_format = true;
+            continue;
+        }
+        if (strcmp(arg->key, "clk") != 0) {
+            snprintf(error_message, sizeof(error_message), "unknown key '%s'", arg->key);
+            return error_message;
+        }
+
+        if (!parse_u32(arg->value, &khz)) {
+            snprintf(error_message, sizeof(error_message), "invalid clk '%s'", arg->value);
+            return error_message;
+        }
+#if BENCH_HOST
+        return "clk is not supported on the host build";
+#else
+        uint vco, postdiv1, postdiv2;
+        if (!check_sys_clock_khz(khz, &vco, &postdiv1, &postdiv2)) {
+            snprintf(error_message, sizeof(error_message), "clk %lu kHz not achievable",
+                     (unsigned long)khz);
+            return error_message;
+        }
+        set_clk = true;
+#endif
+    }
+
+    if (set_format) {
+        bench_set_format(format);
+    }
+    if (set_clk) {
+#if !BENCH_HOST
+        set_sys_clock_khz(khz, true);
+        // SysTick runs from clk_sys: pick up the new rate and overhead
+        bench_timer_recalibrate();
+        bench_timer_print_calibration();
+        restart_sync();
+#endif
+    }
+    *session() = cfg;
+    return NULL;
+}
+
+static const char* cmd_get(const bench_cmd_t* cmd) {
+    (void)cmd;
+    const bench_config_t* cfg = session();
+    printf("key,value\n");
+    printf("timer_hz,%lu\n", (unsigned long)bench_timer_hz());
+    printf("reps,%lu\n", (unsigned long)cfg->reps);
+    printf("warmup,%lu\n", (unsigned long)cfg->warmup);
+    printf("budget_ms,%lu\n", (unsigned long)(cfg->budget_us / 1000u));
+    printf("format,%s\n", bench_get_format() == BENCH_FORMAT_BINARY ? "binary" : "csv");
+    return NULL;
+}
+
+static const char* cmd_calibrate(const bench_cmd_t* cmd) {
+    (void)cmd;
+    bench_timer_recalibrate();
+    bench_timer_print_calibration();
+    restart_sync();
+    return NULL;
+}
+
+static const char* cmd_sync(const bench_cmd_t* cmd) {
+    if (cmd->target != NULL || cmd->num_args > 1
+        || (cmd->num_args == 1 && strcmp(cmd->args[0].key, "pin") != 0)) {
+        return "usage: sync [pin=<gpio>|pin=off]";
+    }
+    if (cmd->num_args == 1) {
+        const char* value = cmd->args[0].value;
+        uint32_t pin = 0;
+        if (strcmp(value, "off") != 0 && !parse_u32(value, &pin)) {
+            snprintf(error_message, sizeof(error_message), "invalid pin '%s'", value);
+            return error_message;
+        }
+#if BENCH_HOST
+        (void)pin;
+        return "sync is not supported on the host build";
+#else
+        if (strcmp(value, "off") == 0) {
+            bench_sync_stop();
+        } else if (!bench_sync_start(pin)) {
+            snprintf(error_message, sizeof(error_message), "cannot start sync on GPIO%lu",
+                     (unsigned long)pin);
+            return error_message;
+        }
+#endif
+    }
+
+    printf("key,value\n");
+    printf("sync_pin,%d\n", bench_sync_pin());
+    printf("period_us,%u\n", BENCH_SYNC_PERIOD_US);
+    return NULL;
+}
+
+static const struct {
+    const char* verb;
+    command_fn_t fn;
+    const char* usage;
+} commands[] = {
+    { "help",      cmd_help,      "help" },
+    { "ping",      cmd_ping,      "ping" },
+    { "list",      cmd_list,      "list [filter]" },
+    { "run",       cmd_run,       "run <filter> [n=a,b,...|n=a..b*r|sweep=r] [reps=] [warmup=] [budget_ms=]" },
+    { "mem",       cmd_mem,       "mem <filter> [n=a,b,...|n=a..b*r|sweep=r]" },
+    { "set",       cmd_set,       "set [reps=] [warmup=] [budget_ms=] [format=csv|binary] [clk=<kHz>]" },
+    { "get",       cmd_get,       "get" },
+    { "calibrate", cmd_calibrate, "calibrate" },
+    { "sync",      cmd_sync,      "sync [pin=<gpio>|pin=off]" },
+};
+
+#define NUM_COMMANDS (sizeof(commands) / sizeof(commands[0]))
+
+static const char* cmd_help(const bench_cmd_t* cmd) {
+    (void)cmd;
+    for (size_t i = 0; i < NUM_COMMANDS; i++) {
+        printf("%s\n", commands[i].usage);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Print the closing frame line and flush.
+ */
+static bool end_frame(const char* error) {
+    if (error) {
+        printf(BENCH_FRAME_END " error %s\n", error);
+    } else {
+        printf(BENCH_FRAME_END " ok\n");
+    }
+    fflush(stdout);
+    return error == NULL;
+}
+
+bool bench_cmd_execute(const char* line) {
+    static bench_cmd_t cmd;  // Static: too large for comfort on the stack
+
+    bench_cmd_status_t status = bench_cmd_parse(line, &cmd);
+    if (status == BENCH_CMD_EMPTY) {
+        return true;
+    }
+    if (status != BENCH_CMD_OK) {
+        printf(BENCH_FRAME_BEGIN " ?\n");
+        return end_frame(bench_cmd_status_str(status));
+    }
+
+    printf(BENCH_FRAME_BEGIN " %s\n", cmd.verb);
+    for (size_t i = 0; i < NUM_COMMANDS; i++) {
+        if (strcmp(cmd.verb, commands[i].verb) == 0) {
+            return end_frame(commands[i].fn(&cmd));
+        }
+    }
+
+    snprintf(error_message, sizeof(error_message), "unknown command '%s' (try help)", cmd.verb);
+    return end_frame(error_message);
+}
+
+void bench_cmd_serve(void) {
+    static char line[BENCH_CMD_MAX_LINE];
+    size_t len = 0;
+    bool overflow = false;
+
+    for (;;) {
+        int c = getchar();
+
+        if (c == EOF || c == '\r' || c == '\n') {
+            if (overflow) {
+                printf(BENCH_FRAME_BEGIN " ?\n");
+                end_frame(bench_cmd_status_str(BENCH_CMD_TOO_LONG));
+            } else {
+                line[len] = '\0';
+                bench_cmd_execute(line);
+            }
+            len = 0;
+            overflow = false;
+
+            if (c == EOF) {
+                return;
+            }
+            continue;
+        }
+
+        if (len < sizeof(line) - 1) {
+            line[len++] = (char)c;
+        } else {
+            overflow = true;  // Drop the rest of the line, report at the end
+        }
+    }
+}
@@ -0,0 +1,115 @@
+/**
+ * @file data.c
+ * @brief Seeded input-data generators (see bench_data.h).
+ *
+ * Every operation here has a line-for-line counterpart in
+ * rp2040-tinygo-benchmarks/src/common/data.go. Signed division is used
+ * instead of right shifts wherever the operand can be negative: C99 and Go
+ * both truncate toward zero, while C leaves the shift of a negative value
+ * implementation-defined.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include "bench_data.h"
+
+#define PCG32_MULTIPLIER 6364136223846793005ull
+
+void bench_rng_seed(bench_rng_t* rng, uint64_t seed, uint64_t stream) {
+    rng->state = 0;
+    rng->inc = (stream << 1) | 1u;
+    bench_rng_next(rng);
+    rng->state += seed;
+    bench_rng_next(rng);
+}
+
+uint32_t bench_rng_next(bench_rng_t* rng) {
+    uint64_t old = rng->state;
+    rng->state = old * PCG32_MULTIPLIER + rng->inc;
+    uint32_t xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+    uint32_t rot = (uint32_t)(old >> 59);
+    return (xorshifted >> rot) | (xorshifted << ((32u - rot) & 31u));
+}
+
+uint32_t bench_rng_below(bench_rng_t* rng, uint32_t bound) {
+    return (uint32_t)(((uint64_t)bench_rng_next(rng) * bound) >> 32);
+}
+
+void bench_data_uniform_i32(int32_t* out, int n, bench_rng_t* rng, int32_t lo, int32_t hi) {
+    uint32_t range = (uint32_t)hi - (uint32_t)lo + 1u;  // 0: the full 2^32 range
+    for (int i = 0; i < n; i++) {
+        uint32_t r = range == 0 ? bench_rng_next(rng) : bench_rng_below(rng, range);
+        out[i] = (int32_t)((uint32_t)lo + r);
+    }
+}
+
+void bench_data_gaussian_i32(int32_t* out, int n, bench_rng_t* rng, int32_t mean, int32_t stddev) {
+    for (int i = 0; i < n; i++) {
+        uint32_t a = bench_rng_next(rng);
+        uint32_t b = bench_rng_next(rng);
+        int64_t sum = (int64_t)(a & 0xFFFFu) + (a >> 16) + (b & 0xFFFFu) + (b >> 16);
+
+        // sum has mean 2·65535 and variance 4·65536²/12: centre it, then
+        // scale by √3 / 65536 to unit variance
+        int64_t v = mean + (sum - 2 * 65535) * stddev * 887 / (65536 * 512);
+        if (v > INT32_MAX) {
+            v = INT32_MAX;
+        } else if (v < INT32_MIN) {
+            v = INT32_MIN;
+        }
+        out[i] = (int32_t)v;
+    }
+}
+
+void bench_data_sorted_runs_i32(int32_t* out, int n, bench_rng_t* rng, int run_length) {
+    int32_t v = 0;
+    for (int i = 0; i < n; i++) {
+        if (i % run_length == 0) {
+            v = (int32_t)bench_rng_below(rng, 1u << 20);
+        } else {
+            v += (int32_t)bench_rng_below(rng, 8);
+        }
+        out[i] = v;
+    }
+}
+
+int16_t bench_data_sin_q15(uint32_t phase) {
+    // sin(π/2 · x) ≈ x · (A − x² · (B − x² · C)) for x in [0, 1], with
+    // A = π/2, B = 2A − 5/2, C = A − 3/2 (all Q15): exact at x = 0 and 1
+    const uint64_t A = 51472;
+    const uint64_t B = 21024;
+    const uint64_t C = 2320;
+
+    uint32_t quadrant = phase >> 30;
+    uint64_t x = (phase >> 15) & 0x7FFFu;  // Position in the quadrant, Q15
+    if (quadrant & 1u) {
+        x = 32768 - x;
+    }
+    uint64_t x2 = (x * x) >> 15;
+    uint64_t y = (x * (A - ((x2 * (B - ((x2 * C) >> 15))) >> 15))) >> 15;
+    if (y > 32767) {
+        y = 32767;
+    }
+    return (quadrant & 2u) ? (int16_t)-(int32_t)y : (int16_t)y;
+}
+
+void bench_data_tones_i16(int16_t* out, int n, const bench_tone_t* tones, int num_tones,
+                          bench_rng_t* rng, int16_t noise) {
+    for (int i = 0; i < n; i++) {
+        int32_t sum = 0;
+        for (int t = 0; t < num_tones; t++) {
+            uint32_t phase = (uint32_t)(((((uint64_t)tones[t].bin * (uint64_t)i) % (uint64_t)n) << 32) /
+                                        (uint64_t)n);
+            sum += (int32_t)tones[t].amplitude * bench_data_sin_q15(phase) / 32768;
+        }
+        if (noise > 0) {
+            sum += (int32_t)bench_rng_below(rng, 2u * (uint32_t)noise + 1u) - noise;
+        }
+        if (sum > INT16_MAX) {
+            sum = INT16_MAX;
+        } else if (sum < INT16_MIN) {
+            sum = INT16_MIN;
+        }
+        out[i] = (int16_t)sum;
+    }
+}
@@ -0,0 +1,74 @@
+/**
+ * @file memory.c
+ * @brief Stack painting and heap statistics (see bench_memory.h).
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <malloc.h>
+#include "bench_memory.h"
+
+#if !BENCH_HOST
+/// End of the SCRATCH_Y data section; the main stack grows down towards it
+extern uint32_t __scratch_y_end__;
+#endif
+
+/// Region painted by the last bench_stack_paint() (word-aligned)
+static volatile uint32_t* paint_bottom;
+static volatile uint32_t* paint_top;
+/// Approximate stack pointer of the painting caller; usage is measured from here
+static uintptr_t paint_base;
+
+__attribute__((noinline)) void bench_stack_paint(void) {
+    // The address of a local is within a few words of the stack pointer
+    volatile uint32_t marker = 0;
+    paint_base = (uintptr_t)&marker;
+    uintptr_t top = (paint_base - BENCH_STACK_GUARD) & ~(uintptr_t)3u;
+
+#if BENCH_HOST
+    uintptr_t bottom = top - BENCH_HOST_STACK_PAINT_BYTES;
+#else
+    uintptr_t bottom = ((uintptr_t)&__scratch_y_end__ + 3u) & ~(uintptr_t)3u;
+#endif
+
+    paint_bottom = (volatile uint32_t*)bottom;
+    paint_top = (volatile uint32_t*)top;
+    for (volatile uint32_t* p = paint_bottom; p < paint_top; p++) {
+        *p = BENCH_STACK_PAINT_WORD;
+    }
+}
+
+void bench_stack_measure(uint32_t* used, uint32_t* free_bytes) {
+    volatile uint32_t* p = paint_bottom;
+    while (p < paint_top && *p == BENCH_STACK_PAINT_WORD) {
+        p++;
+    }
+    *used = (uint32_t)(paint_base - (uintptr_t)p);
+    *free_bytes = (uint32_t)((uintptr_t)p - (uintptr_t)paint_bottom);
+}
+
+__attribute__((noinline)) size_t bench_stack_headroom(void) {
+#if BENCH_HOST
+    return BENCH_HOST_STACK_HEADROOM;
+#else
+    volatile uint32_t marker = 0;
+    uintptr_t sp = (uintptr_t)&marker;
+    uintptr_t bottom = (uintptr_t)&__scratch_y_end__;
+    return sp > bottom ? (size_t)(sp - bottom) : 0;
+#endif
+}
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+// glibc deprecates mallinfo() (its fields are int) in favour of mallinfo2()
+#define BENCH_MALLINFO mallinfo2
+#else
+#define BENCH_MALLINFO mallinfo
+#endif
+
+size_t bench_heap_in_use(void) {
+    return (size_t)BENCH_MALLINFO().uordblks;
+}
+
+size_t bench_heap_arena(void) {
+    return (size_t)BENCH_MALLINFO().arena;
+}
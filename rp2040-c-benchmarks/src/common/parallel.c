@@ -0,0 +1,129 @@
+/**
+ * @file parallel.c
+ * @brief Dual-core fork-join (see bench_parallel.h) and speedup report.
+ *
+ * Device: core 1 runs worker_loop(). Each FIFO word core 0 pushes is
+ * either PARALLEL_RUN (run the job in `job_fn`/`job_ctx` as worker 1, then
+ * reply PARALLEL_DONE) or, inside a job, PARALLEL_BARRIER. The FIFO is
+ * strictly ordered and both workers make the same sequence of barrier
+ * calls, so every word is popped by the call it belongs to.
+ *
+ * The FIFO registers are not ordered against plain memory accesses by the
+ * compiler, so every push is preceded by a release fence and every pop
+ * followed by an acquire fence.
+ *
+ * Host: src/common/parallel_host.cpp provides the same three primitives
+ * with a std::thread; the speedup report below is shared.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <stdio.h>
+#include "bench_arena.h"
+#include "bench_parallel.h"
+#include "bench_results.h"
+#include "bench_timer.h"
+
+#if !BENCH_HOST
+#include "hardware/sync.h"
+#include "pico/multicore.h"
+
+#define PARALLEL_RUN 0x52554E31u      ///< "RUN1": start the current job
+#define PARALLEL_DONE 0x444F4E45u     ///< "DONE": core 1 finished the job
+#define PARALLEL_BARRIER 0x42415252u  ///< "BARR": a worker reached the barrier
+
+static bench_parallel_fn_t job_fn;
+static void* job_ctx;
+static bool core1_started = false;
+
+static void fifo_send(uint32_t word) {
+    __mem_fence_release();
+    multicore_fifo_push_blocking(word);
+}
+
+static uint32_t fifo_receive(void) {
+    uint32_t word = multicore_fifo_pop_blocking();
+    __mem_fence_acquire();
+    return word;
+}
+
+/**
+ * @brief Core 1 entry point: run jobs as worker 1 forever.
+ */
+static void worker_loop(void) {
+    for (;;) {
+        if (fifo_receive() != PARALLEL_RUN) {
+            continue;
+        }
+        job_fn(job_ctx, 1);
+        fifo_send(PARALLEL_DONE);
+    }
+}
+
+void bench_parallel_run(bench_parallel_fn_t fn, void* ctx) {
+    if (!core1_started) {
+        multicore_launch_core1(worker_loop);
+        core1_started = true;
+    }
+
+    job_fn = fn;
+    job_ctx = ctx;
+    fifo_send(PARALLEL_RUN);
+    fn(ctx, 0);
+    fifo_receive();  // PARALLEL_DONE
+}
+
+void bench_parallel_barrier(void) {
+    fifo_send(PARALLEL_BARRIER);
+    fifo_receive();
+}
+#endif  // !BENCH_HOST
+
+/**
+ * @brief Set up, time and verify one descriptor at one parameter.
+ *
+ * @return false if setup skipped the parameter.
+ */
+static bool measure_desc(const bench_desc_t* desc, int param, bench_stats_t* stats, bool* valid) {
+    bench_arena_reset();
+    if (desc->setup && !desc->setup(desc->ctx, param)) {
+        return false;
+    }
+    bench_output_settle();
+    bench_measure(NULL, desc->prepare, desc->run, desc->ctx, stats);
+    *valid = desc->verify ? desc->verify(desc->ctx) : true;
+    if (desc->teardown) {
+        desc->teardown(desc->ctx);
+    }
+    return true;
+}
+
+void bench_parallel_report(const bench_desc_t* single, const bench_desc_t* parallel) {
+    printf("task,method,%s,single_us,parallel_us,speedup,efficiency,valid\n",
+           parallel->param_name);
+
+    double us_per_cycle = 1e6 / bench_timer_hz();
+    for (size_t i = 0; i < parallel->num_params; i++) {
+        int param = parallel->params[i];
+        bench_stats_t single_stats;
+        bench_stats_t parallel_stats;
+        bool single_valid = false;
+        bool parallel_valid = false;
+
+        if (!measure_desc(single, param, &single_stats, &single_valid) ||
+            !measure_desc(parallel, param, &parallel_stats, &parallel_valid)) {
+            printf("%s,%s,%d,skip\n", parallel->task, parallel->method, param);
+            continue;
+        }
+        if (!single_valid || !parallel_valid) {
+            printf("%s,%s,%d,invalid\n", parallel->task, parallel->method, param);
+            continue;
+        }
+
+        double single_us = single_stats.median * us_per_cycle;
+        double parallel_us = parallel_stats.median * us_per_cycle;
+        double speedup = parallel_us > 0.0 ? single_us / parallel_us : 0.0;
+        printf("%s,%s,%d,%.3f,%.3f,%.3f,%.3f,1\n", parallel->task, parallel->method, param,
+               single_us, parallel_us, speedup, speedup / BENCH_PARALLEL_WORKERS);
+    }
+}
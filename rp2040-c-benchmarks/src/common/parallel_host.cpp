@@ -0,0 +1,99 @@
+/**
+ * @file parallel_host.cpp
+ * @brief Host backend of the fork-join layer (see bench_parallel.h).
+ *
+ * A std::thread started on first use plays core 1. Jobs are handed over
+ * with a mutex and condition variable, the host counterpart of the
+ * device's FIFO words. The barrier spins on an atomic generation counter
+ * (yielding, in case the host has a single CPU), as the stages between
+ * barriers are only microseconds long.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+extern "C" {
+#include "bench_parallel.h"
+}
+
+namespace {
+
+/// Job handover between the caller and the worker thread
+struct job_channel {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bench_parallel_fn_t fn = nullptr;
+    void* ctx = nullptr;
+    unsigned job_seq = 0;   ///< Incremented for every job
+    unsigned done_seq = 0;  ///< Last job worker 1 finished
+};
+
+/// Never destroyed: the detached worker still waits on it at exit, and
+/// destroying a condition variable with a waiter blocks forever
+job_channel& channel() {
+    static job_channel* c = new job_channel;
+    return *c;
+}
+
+std::once_flag worker_started;
+std::atomic<int> barrier_waiting{0};
+std::atomic<unsigned> barrier_generation{0};
+
+void worker_loop() {
+    job_channel& ch = channel();
+    unsigned seen = 0;
+    for (;;) {
+        bench_parallel_fn_t fn;
+        void* ctx;
+        {
+            std::unique_lock<std::mutex> lock(ch.mutex);
+            ch.cv.wait(lock, [&] { return ch.job_seq != seen; });
+            seen = ch.job_seq;
+            fn = ch.fn;
+            ctx = ch.ctx;
+        }
+        fn(ctx, 1);
+        {
+            std::lock_guard<std::mutex> lock(ch.mutex);
+            ch.done_seq = seen;
+        }
+        ch.cv.notify_all();
+    }
+}
+
+}  // namespace
+
+extern "C" void bench_parallel_run(bench_parallel_fn_t fn, void* ctx) {
+    job_channel& ch = channel();
+    std::call_once(worker_started, [] { std::thread(worker_loop).detach(); });
+
+    unsigned seq;
+    {
+        std::lock_guard<std::mutex> lock(ch.mutex);
+        ch.fn = fn;
+        ch.ctx = ctx;
+        seq = ++ch.job_seq;
+    }
+    ch.cv.notify_all();
+
+    fn(ctx, 0);
+
+    std::unique_lock<std::mutex> lock(ch.mutex);
+    ch.cv.wait(lock, [&] { return ch.done_seq == seq; });
+}
+
+extern "C" void bench_parallel_barrier(void) {
+    unsigned generation = barrier_generation.load(std::memory_order_acquire);
+    if (barrier_waiting.fetch_add(1, std::memory_order_acq_rel) + 1 == BENCH_PARALLEL_WORKERS) {
+        barrier_waiting.store(0, std::memory_order_relaxed);
+        barrier_generation.fetch_add(1, std::memory_order_release);
+        return;
+    }
+    while (barrier_generation.load(std::memory_order_acquire) == generation) {
+        std::this_thread::yield();
+    }
+}
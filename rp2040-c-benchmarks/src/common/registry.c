@@ -0,0 +1,28 @@
+/**
+ * @file registry.c
+ * @brief Static benchmark table built from bench_list.h.
+ *
+ * The isolated per-benchmark targets (BENCH_BUILD_MATRIX in CMakeLists.txt)
+ * compile this file with BENCH_LIST_HEADER pointing at a generated list that
+ * holds only one task's entries, so only that `benchmark.c` is linked.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include "bench_registry.h"
+
+#ifndef BENCH_LIST_HEADER
+#define BENCH_LIST_HEADER "bench_list.h"
+#endif
+
+#define BENCH_ENTRY(id) extern const bench_desc_t bench_##id;
+#include BENCH_LIST_HEADER
+#undef BENCH_ENTRY
+
+const bench_desc_t* const bench_registry[] = {
+#define BENCH_ENTRY(id) &bench_##id,
+#include BENCH_LIST_HEADER
+#undef BENCH_ENTRY
+};
+
+const size_t bench_registry_count = sizeof(bench_registry) / sizeof(bench_registry[0]);
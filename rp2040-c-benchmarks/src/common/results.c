@@ -0,0 +1,68 @@
+/**
+ * @file results.c
+ * @brief Consumer side of the deferred result ring (see bench_results.h).
+ *
+ * The producer side (bench_ring_push) is inline in the header so it can be
+ * called from an ISR without a function call into flash-resident code.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <stdio.h>
+#include "bench_results.h"
+
+#if !BENCH_HOST
+#include "pico/stdlib.h"
+
+#define SETTLE_MS 20  ///< Enough for a few hundred bytes of pending USB CDC output
+#endif
+
+bool bench_ring_pop(bench_ring_t* ring, bench_record_t* out) {
+    uint32_t tail = ring->tail;
+    if (tail == ring->head) {
+        return false;
+    }
+
+    // Read the record only after observing the head that published it
+    atomic_thread_fence(memory_order_acquire);
+    *out = ring->records[tail & ring->mask];
+
+    // Finish reading before handing the slot back to the producer
+    atomic_thread_fence(memory_order_release);
+    ring->tail = tail + 1u;
+    return true;
+}
+
+uint32_t bench_ring_count(const bench_ring_t* ring) {
+    return ring->head - ring->tail;
+}
+
+void bench_ring_reset(bench_ring_t* ring) {
+    ring->head = 0;
+    ring->tail = 0;
+    ring->dropped = 0;
+}
+
+uint32_t bench_ring_drain(bench_ring_t* ring, bench_record_fn_t fn, void* user) {
+    bench_record_t rec;
+    uint32_t count = 0;
+
+    while (bench_ring_pop(ring, &rec)) {
+        fn(&rec, user);
+        count++;
+    }
+
+    if (ring->dropped) {
+        printf("# dropped,%lu\n", (unsigned long)ring->dropped);
+    }
+    fflush(stdout);
+    return count;
+}
+
+void bench_output_settle(void) {
+    fflush(stdout);
+#if !BENCH_HOST
+    stdio_flush();
+    sleep_ms(SETTLE_MS);
+#endif
+}
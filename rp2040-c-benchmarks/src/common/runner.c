@@ -0,0 +1,297 @@
+/**
+ * @file runner.c
+ * @brief Runs registered benchmarks (see bench_registry.h).
+ *
+ * For kernel descriptors, each parameter goes through
+ * setup → bench_measure(prepare, run) → verify → teardown, and a CSV row is
+ * printed with the statistics and the verification result. Parameters that
+ * setup rejects are reported as a `skip` row, and a run whose output fails
+ * verification is reported as an `invalid` row with no timings, so a wrong
+ * (e.g. optimised-away) kernel can never show up as a speedup. The parameter set and the
+ * repetition settings can be overridden per run (bench_run_opts_t), and
+ * the parameter set can be replaced by a geometric sweep. The benchmark
+ * arena is reset before every setup.
+ *
+ * In binary mode each row is sent as a bench_wire.h result frame with the
+ * full sample array instead; headers are omitted and dividers stay text.
+ *
+ * The memory pass (bench_profile_memory_with()) reuses the same hooks but
+ * runs each parameter once, untimed, between stack painting and scanning.
+ * Its rows are always CSV.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "bench_arena.h"
+#include "bench_memory.h"
+#include "bench_registry.h"
+#include "bench_results.h"
+#include "bench_sink.h"
+#include "bench_timer.h"
+#include "bench_wire.h"
+
+static bench_format_t output_format = BENCH_FORMAT_CSV;
+
+#if !defined(__GNUC__) && !defined(__clang__)
+volatile uint32_t bench_sink_word;  ///< Fallback sink for bench_sink.h
+#endif
+
+/// Frame buffer for binary output, sized for a full sample buffer
+static uint8_t wire_frame[BENCH_WIRE_RESULT_FRAME_SIZE(BENCH_MAX_SAMPLES)];
+
+void bench_set_format(bench_format_t format) {
+    output_format = format;
+}
+
+bench_format_t bench_get_format(void) {
+    return output_format;
+}
+
+/**
+ * @brief Copy a name into a fixed-size wire field, truncating if needed.
+ */
+static void copy_name(char* dst, const char* src) {
+    snprintf(dst, BENCH_WIRE_MAX_NAME, "%s", src ? src : "");
+}
+
+/**
+ * @brief Send one result as a binary frame (stats == NULL for a skipped row).
+ *
+ * The samples are those of the last bench_measure() call.
+ */
+static void emit_wire_row(const bench_desc_t* desc, int param, const bench_stats_t* stats,
+                          bool valid) {
+    static bench_wire_result_t result;  // Static: three name buffers
+
+    copy_name(result.task, desc->task);
+    copy_name(result.method, desc->method);
+    copy_name(result.param_name, desc->param_name);
+    result.num_params = 1;
+    result.params[0] = param;
+    result.timer_hz = bench_timer_hz();
+
+    if (stats) {
+        result.overhead = stats->overhead;
+        result.raw_median = stats->raw_median;
+        result.flags = valid ? BENCH_WIRE_FLAG_VALID : 0;
+        result.num_samples = bench_last_samples(&result.samples);
+    } else {
+        result.overhead = 0;
+        result.raw_median = 0;
+        result.flags = BENCH_WIRE_FLAG_SKIPPED;
+        result.num_samples = 0;
+        result.samples = NULL;
+    }
+
+    size_t len = bench_wire_encode_result(wire_frame, sizeof(wire_frame), &result);
+    if (len) {
+        bench_wire_write(wire_frame, len);
+    }
+}
+
+size_t bench_geometric_params(int first, int last, int ratio, int* out, size_t max_out) {
+    if (first < 1 || last < first || ratio < 2) {
+        return 0;
+    }
+    size_t n = 0;
+    for (long long v = first; v <= last && n < max_out; v *= ratio) {
+        out[n++] = (int)v;
+    }
+    return n;
+}
+
+/**
+ * @brief Parameters of one run: the override, the sweep or the defaults.
+ *
+ * @param sweep Buffer for a sweep (BENCH_SWEEP_MAX_PARAMS entries).
+ */
+static size_t select_params(const bench_desc_t* desc, const bench_run_opts_t* opts, int* sweep,
+                            const int** params) {
+    if (opts && opts->params) {
+        *params = opts->params;
+        return opts->num_params;
+    }
+    if (opts && opts->sweep && desc->sweep_max > 0 && desc->num_params > 0) {
+        size_t n = bench_geometric_params(desc->params[0], desc->sweep_max, opts->sweep, sweep,
+                                          BENCH_SWEEP_MAX_PARAMS);
+        if (n > 0) {
+            *params = sweep;
+            return n;
+        }
+    }
+    *params = desc->params;
+    return desc->num_params;
+}
+
+void bench_run(const bench_desc_t* desc) {
+    bench_run_with(desc, NULL);
+}
+
+void bench_run_with(const bench_desc_t* desc, const bench_run_opts_t* opts) {
+    if (desc->standalone) {
+        desc->standalone();
+        return;
+    }
+
+    static int sweep[BENCH_SWEEP_MAX_PARAMS];
+    const int* params;
+    size_t num_params = select_params(desc, opts, sweep, &params);
+    const bench_config_t* config = opts ? opts->config : NULL;
+
+    bool binary = output_format == BENCH_FORMAT_BINARY;
+    if (!binary) {
+        printf("task,method,%s," BENCH_STATS_CSV_COLUMNS ",valid\n", desc->param_name);
+    }
+
+    for (size_t i = 0; i < num_params; i++) {
+        int param = params[i];
+
+        bench_arena_reset();
+        if (desc->setup && !desc->setup(desc->ctx, param)) {
+            if (binary) {
+                emit_wire_row(desc, param, NULL, false);
+            } else {
+                printf("%s,%s,%d,skip\n", desc->task, desc->method, param);
+            }
+            continue;
+        }
+
+        bench_stats_t stats;
+        bench_output_settle();  // Keep the previous row's USB traffic out of the samples
+        bench_measure(config, desc->prepare, desc->run, desc->ctx, &stats);
+
+        bool valid = desc->verify ? desc->verify(desc->ctx) : true;
+
+        if (desc->teardown) {
+            desc->teardown(desc->ctx);
+        }
+
+        if (binary) {
+            emit_wire_row(desc, param, &stats, valid);
+            continue;
+        }
+
+        if (!valid) {
+            printf("%s,%s,%d,invalid\n", desc->task, desc->method, param);
+            continue;
+        }
+
+        printf("%s,%s,%d,", desc->task, desc->method, param);
+        bench_print_stats(&stats);
+        printf(",1\n");
+    }
+}
+
+bool bench_profile_memory_with(const bench_desc_t* desc, const bench_run_opts_t* opts) {
+    if (desc->standalone) {
+        return false;
+    }
+
+    static int sweep[BENCH_SWEEP_MAX_PARAMS];
+    const int* params;
+    size_t num_params = select_params(desc, opts, sweep, &params);
+
+    printf("task,method,%s," BENCH_MEMORY_CSV_COLUMNS ",valid\n", desc->param_name);
+
+    for (size_t i = 0; i < num_params; i++) {
+        int param = params[i];
+        bench_arena_reset();
+        size_t heap_base = bench_heap_in_use();
+
+        if (desc->setup && !desc->setup(desc->ctx, param)) {
+            printf("%s,%s,%d,skip\n", desc->task, desc->method, param);
+            continue;
+        }
+        if (desc->prepare) {
+            desc->prepare(desc->ctx);
+        }
+
+        // Paint and scan from this frame so only the kernel's calls are counted
+        uint32_t stack_used;
+        uint32_t stack_free;
+        bench_stack_paint();
+        desc->run(desc->ctx);
+        bench_stack_measure(&stack_used, &stack_free);
+
+        size_t heap_in_use = bench_heap_in_use();
+        size_t heap_arena = bench_heap_arena();
+        size_t arena_used = bench_arena_used();
+        bool valid = desc->verify ? desc->verify(desc->ctx) : true;
+
+        if (desc->teardown) {
+            desc->teardown(desc->ctx);
+        }
+
+        if (!valid) {
+            printf("%s,%s,%d,invalid\n", desc->task, desc->method, param);
+            continue;
+        }
+        printf("%s,%s,%d,%lu,%lu,%lu,%lu,%lu,1\n", desc->task, desc->method, param,
+               (unsigned long)stack_used, (unsigned long)stack_free,
+               (unsigned long)(heap_in_use > heap_base ? heap_in_use - heap_base : 0),
+               (unsigned long)heap_arena, (unsigned long)arena_used);
+    }
+    return true;
+}
+
+int bench_profile_memory_matching_with(const char* filter, const bench_run_opts_t* opts) {
+    int count = 0;
+    for (size_t i = 0; i < bench_registry_count; i++) {
+        const bench_desc_t* desc = bench_registry[i];
+        if (!bench_matches(desc, filter) || !bench_profile_memory_with(desc, opts)) {
+            continue;
+        }
+        printf("----------------------\n");
+        count++;
+    }
+    return count;
+}
+
+bool bench_matches(const bench_desc_t* desc, const char* filter) {
+    if (strcmp(filter, "all") == 0 ||
+        strcmp(filter, desc->category) == 0 ||
+        strcmp(filter, desc->task) == 0) {
+        return true;
+    }
+
+    // "task.method"
+    size_t task_len = strlen(desc->task);
+    return strncmp(filter, desc->task, task_len) == 0 &&
+           filter[task_len] == '.' &&
+           strcmp(filter + task_len + 1, desc->method) == 0;
+}
+
+int bench_run_matching(const char* filter) {
+    return bench_run_matching_with(filter, NULL);
+}
+
+int bench_run_matching_with(const char* filter, const bench_run_opts_t* opts) {
+    int count = 0;
+    for (size_t i = 0; i < bench_registry_count; i++) {
+        const bench_desc_t* desc = bench_registry[i];
+        if (!bench_matches(desc, filter)) {
+            continue;
+        }
+        bench_run_with(desc, opts);
+        printf("----------------------\n");
+        count++;
+    }
+    return count;
+}
+
+void bench_print_registry(const char* filter) {
+    printf("task,method,category,params\n");
+    for (size_t i = 0; i < bench_registry_count; i++) {
+        const bench_desc_t* desc = bench_registry[i];
+        if (filter && !bench_matches(desc, filter)) {
+            continue;
+        }
+        printf("%s,%s,%s,", desc->task, desc->method, desc->category);
+        for (size_t p = 0; p < desc->num_params; p++) {
+            printf(p ? " %d" : "%d", desc->params[p]);
+        }
+        printf("\n");
+    }
+}
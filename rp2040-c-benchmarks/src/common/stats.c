@@ -0,0 +1,166 @@
+/**
+ * @file stats.c
+ * @brief Repetition and statistics engine (see bench_stats.h).
+ *
+ * Each measured iteration is timed in cycles with bench_timer (SysTick on the
+ * device) and stored, uncorrected, in a static buffer. Once collection
+ * completes the buffer is sorted in place, the raw median is recorded, and
+ * the calibrated timer overhead is subtracted from every sample before it is
+ * reduced to order statistics, mean and standard deviation. Subtracting a
+ * clamped overhead is monotonic, so the buffer stays sorted.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "bench_stats.h"
+#include "bench_timer.h"
+
+static uint32_t samples[BENCH_MAX_SAMPLES];  ///< Shared sample buffer (cycles)
+static uint32_t sample_count = 0;
+
+bench_config_t bench_default_config(void) {
+    bench_config_t cfg = {
+        .warmup = BENCH_DEFAULT_WARMUP,
+        .reps = BENCH_DEFAULT_REPS,
+        .budget_us = BENCH_DEFAULT_BUDGET_US,
+    };
+    return cfg;
+}
+
+/**
+ * @brief qsort comparator for uint32_t samples.
+ */
+static int compare_u32(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Nearest-rank percentile of a sorted sample array.
+ *
+ * @param sorted Samples in ascending order.
+ * @param n      Number of samples (> 0).
+ * @param pct    Percentile in the range 0–100.
+ */
+static uint32_t percentile(const uint32_t* sorted, uint32_t n, uint32_t pct) {
+    uint32_t rank = (pct * n + 99) / 100;  // ceil(pct/100 * n)
+    if (rank == 0) rank = 1;
+    return sorted[rank - 1];
+}
+
+void bench_stats_reduce(const uint32_t* sorted, uint32_t n, bench_stats_t* out) {
+    if (n == 0) {
+        *out = (bench_stats_t){ 0 };
+        return;
+    }
+
+    double sum = 0.0;
+    for (uint32_t i = 0; i < n; i++) {
+        sum += sorted[i];
+    }
+    double mean = sum / n;
+
+    double sq = 0.0;
+    for (uint32_t i = 0; i < n; i++) {
+        double d = sorted[i] - mean;
+        sq += d * d;
+    }
+
+    out->count = n;
+    out->min = sorted[0];
+    out->max = sorted[n - 1];
+    out->median = percentile(sorted, n, 50);
+    out->p90 = percentile(sorted, n, 90);
+    out->p99 = percentile(sorted, n, 99);
+    out->mean = (float)mean;
+    out->stddev = n > 1 ? (float)sqrt(sq / (n - 1)) : 0.0f;
+}
+
+/**
+ * @brief Reduce the sample buffer to summary statistics.
+ *
+ * Sorts the raw samples, records the raw median, then subtracts the
+ * calibrated timer overhead from each sample in place.
+ */
+static void compute_stats(bench_stats_t* out) {
+    uint32_t n = sample_count;
+    qsort(samples, n, sizeof(samples[0]), compare_u32);
+
+    uint32_t raw_median = percentile(samples, n, 50);
+    for (uint32_t i = 0; i < n; i++) {
+        samples[i] = (uint32_t)bench_timer_subtract_overhead(samples[i]);
+    }
+
+    bench_stats_reduce(samples, n, out);
+    out->raw_median = raw_median;
+    out->overhead = bench_timer_overhead_cycles(bench_timer_backend_for(raw_median));
+}
+
+void bench_measure(const bench_config_t* cfg, bench_fn_t setup, bench_fn_t run,
+                   void* ctx, bench_stats_t* out) {
+    bench_config_t defaults = bench_default_config();
+    if (cfg == NULL) {
+        cfg = &defaults;
+    }
+
+    uint32_t reps = cfg->reps;
+    if (reps == 0) reps = 1;
+    if (reps > BENCH_MAX_SAMPLES) reps = BENCH_MAX_SAMPLES;
+
+    uint64_t budget_ns = (uint64_t)cfg->budget_us * 1000u;
+
+    // Warm-up phase: untimed, bounded by the time budget
+    bench_timestamp_t phase_start = bench_timer_now();
+    for (uint32_t i = 0; i < cfg->warmup; i++) {
+        if (setup) setup(ctx);
+        run(ctx);
+        uint64_t phase = bench_timer_elapsed_cycles(phase_start, bench_timer_now());
+        if (bench_cycles_to_ns(phase) > budget_ns) {
+            break;
+        }
+    }
+
+    // Measured phase: always at least one sample
+    sample_count = 0;
+    phase_start = bench_timer_now();
+    while (sample_count < reps) {
+        if (setup) setup(ctx);
+
+        bench_timestamp_t start = bench_timer_now();
+        run(ctx);
+        uint64_t elapsed = bench_timer_elapsed_cycles(start, bench_timer_now());
+
+        samples[sample_count++] = elapsed > UINT32_MAX ? UINT32_MAX : (uint32_t)elapsed;
+
+        uint64_t phase = bench_timer_elapsed_cycles(phase_start, bench_timer_now());
+        if (bench_cycles_to_ns(phase) > budget_ns) {
+            break;
+        }
+    }
+
+    compute_stats(out);
+}
+
+uint32_t bench_last_samples(const uint32_t** out) {
+    *out = samples;
+    return sample_count;
+}
+
+void bench_print_stats(const bench_stats_t* stats) {
+    bench_print_stats_hz(stats, bench_timer_hz());
+}
+
+void bench_print_stats_hz(const bench_stats_t* stats, uint32_t hz) {
+    double us_per_cycle = 1000000.0 / hz;
+    printf("%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%lu,%lu,%.3f,%lu",
+           stats->median * us_per_cycle, stats->min * us_per_cycle,
+           stats->p90 * us_per_cycle, stats->p99 * us_per_cycle,
+           stats->max * us_per_cycle, stats->mean * us_per_cycle,
+           stats->stddev * us_per_cycle, (unsigned long)stats->count,
+           (unsigned long)stats->median, stats->raw_median * us_per_cycle,
+           (unsigned long)stats->overhead);
+}
@@ -0,0 +1,189 @@
+/**
+ * @file sync.c
+ * @brief Clock sync pulse generator (see bench_sync.h).
+ *
+ * Device: one PWM slice counts clk_sys / div up to TOP, so every counter
+ * wrap, and with it every rising edge of the sync pin, lies exactly one
+ * period of clk_sys cycles after the previous one. The pulse width (the
+ * compare level) is double-buffered by the hardware and only latched at a
+ * wrap, so the wrap interrupt writes the symbol of the pulse after the one
+ * that is starting and its latency never moves an edge. The handler takes
+ * the pulse number from the microsecond timer rather than counting wraps,
+ * so an interrupt held off for a whole period costs one symbol (which the
+ * probe tolerates) and never shifts the numbering.
+ *
+ * The timeline origin is a bench_timer_now() read immediately before the
+ * slice is enabled, a few cycles ahead of the first rising edge.
+ *
+ * Host: no pin to drive; bench_sync_start() fails.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <stdio.h>
+#include "bench_sync.h"
+
+#if !BENCH_HOST
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include "hardware/pwm.h"
+#include "hardware/sync.h"
+
+#define SYSTICK_MASK 0x00FFFFFFu
+
+static int sync_pin = -1;
+static unsigned sync_slice;
+static uint32_t sync_counts;        ///< PWM counts per period (TOP + 1)
+
+static bench_timestamp_t sync_start_ts;
+static uint64_t sync_start_us64;     ///< 64-bit µs timer at sync_start_ts
+static uint32_t sync_hz;
+
+/**
+ * @brief Compare level (high time in counts) that encodes pulse k.
+ */
+static uint16_t pulse_level(uint32_t k) {
+    uint32_t j = k % BENCH_SYNC_FRAME_PULSES;
+    uint32_t width_us;
+    if (j == 0) {
+        width_us = BENCH_SYNC_MARKER_US;
+    } else {
+        width_us = (k / BENCH_SYNC_FRAME_PULSES) >> (j - 1) & 1u ? BENCH_SYNC_ONE_US
+                                                                 : BENCH_SYNC_ZERO_US;
+    }
+    return (uint16_t)((uint64_t)sync_counts * width_us / BENCH_SYNC_PERIOD_US);
+}
+
+/**
+ * @brief PWM wrap: a pulse has just started, queue the symbol of the next.
+ */
+static void sync_wrap_irq(void) {
+    if (sync_pin < 0 || !(pwm_get_irq_status_mask() & (1u << sync_slice))) {
+        return;  // Shared handler: another slice wrapped
+    }
+    pwm_clear_irq(sync_slice);
+    // Nearest pulse start: the handler runs well within half a period of it
+    uint64_t elapsed_us = time_us_64() - sync_start_us64;
+    uint32_t k = (uint32_t)((elapsed_us + BENCH_SYNC_PERIOD_US / 2) / BENCH_SYNC_PERIOD_US);
+    pwm_set_gpio_level((unsigned)sync_pin, pulse_level(k + 1));
+}
+
+/**
+ * @brief Find a divider (in 1/16ths) and count with count * div16 = 16 * period.
+ *
+ * The smallest divider wins: it gives the finest pulse widths. The product
+ * is a whole number of cycles, so the fractional divider never moves a wrap.
+ */
+static bool find_divider(uint32_t period_cycles, uint32_t* div16, uint32_t* counts) {
+    uint64_t target = (uint64_t)period_cycles * 16u;
+    for (uint32_t d = 16; d < 256u * 16u; d++) {
+        if (target % d == 0 && target / d <= 65536u) {
+            *div16 = d;
+            *counts = (uint32_t)(target / d);
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
+bool bench_sync_start(unsigned pin) {
+#if BENCH_HOST
+    (void)pin;
+    return false;
+#else
+    bench_sync_stop();
+
+    uint32_t hz = bench_timer_hz();
+    if ((uint64_t)hz * BENCH_SYNC_PERIOD_US % 1000000u != 0 || pin >= NUM_BANK0_GPIOS) {
+        return false;
+    }
+    uint32_t div16;
+    if (!find_divider((uint32_t)((uint64_t)hz * BENCH_SYNC_PERIOD_US / 1000000u), &div16,
+                      &sync_counts)) {
+        return false;
+    }
+
+    sync_slice = pwm_gpio_to_slice_num(pin);
+    pwm_config config = pwm_get_default_config();
+    pwm_config_set_clkdiv_int_frac(&config, (uint8_t)(div16 >> 4), (uint8_t)(div16 & 15u));
+    pwm_config_set_wrap(&config, (uint16_t)(sync_counts - 1u));
+    pwm_init(sync_slice, &config, false);  // Also zeroes the counter
+    gpio_set_function(pin, GPIO_FUNC_PWM);
+
+    sync_pin = (int)pin;
+    sync_hz = hz;
+    pwm_set_gpio_level(pin, pulse_level(0));  // Slice disabled: latched now
+
+    pwm_clear_irq(sync_slice);
+    pwm_set_irq_enabled(sync_slice, true);
+    irq_add_shared_handler(PWM_IRQ_WRAP, sync_wrap_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(PWM_IRQ_WRAP, true);
+
+    uint32_t irq_state = save_and_disable_interrupts();
+    sync_start_ts = bench_timer_now();
+    pwm_set_enabled(sync_slice, true);     // Pulse 0 rises here
+    restore_interrupts(irq_state);
+    sync_start_us64 = time_us_64() - (uint32_t)(time_us_32() - sync_start_ts.us);
+
+    pwm_set_gpio_level(pin, pulse_level(1));  // Latched at the first wrap
+    return true;
+#endif
+}
+
+void bench_sync_stop(void) {
+#if !BENCH_HOST
+    if (sync_pin < 0) {
+        return;
+    }
+    pwm_set_irq_enabled(sync_slice, false);
+    pwm_set_enabled(sync_slice, false);
+    irq_remove_handler(PWM_IRQ_WRAP, sync_wrap_irq);
+    gpio_deinit((unsigned)sync_pin);
+    sync_pin = -1;
+#endif
+}
+
+int bench_sync_pin(void) {
+#if BENCH_HOST
+    return -1;
+#else
+    return sync_pin;
+#endif
+}
+
+int64_t bench_sync_ns(bench_timestamp_t t) {
+#if BENCH_HOST
+    (void)t;
+    return INT64_MIN;
+#else
+    if (sync_pin < 0) {
+        return INT64_MIN;
+    }
+    // Extend the 32-bit µs timer against the current 64-bit one
+    uint64_t now = time_us_64();
+    int64_t us = (int64_t)(now - (uint32_t)((uint32_t)now - t.us)) - (int64_t)sync_start_us64;
+
+    // µs place the event to within a few cycles; SysTick supplies the exact
+    // cycle count modulo 2^24, and the difference picks the right wrap.
+    int64_t coarse = us * (int64_t)sync_hz / 1000000;
+    uint32_t fine = (sync_start_ts.systick - t.systick) & SYSTICK_MASK;
+    int32_t correction = (int32_t)((fine - (uint32_t)coarse) << 8) >> 8;
+    int64_t cycles = coarse + correction;
+
+    uint64_t magnitude = cycles < 0 ? (uint64_t)-cycles : (uint64_t)cycles;
+    uint64_t ns = (magnitude / sync_hz) * 1000000000u
+                + (magnitude % sync_hz) * 1000000000u / sync_hz;
+    return cycles < 0 ? -(int64_t)ns : (int64_t)ns;
+#endif
+}
+
+void bench_sync_mark(const char* label, bench_timestamp_t t) {
+    int64_t ns = bench_sync_ns(t);
+    if (ns == INT64_MIN) {
+        return;
+    }
+    uint64_t magnitude = ns < 0 ? (uint64_t)-ns : (uint64_t)ns;
+    printf("sync_mark,%s,%s%llu.%03u\n", label, ns < 0 ? "-" : "",
+           (unsigned long long)(magnitude / 1000u), (unsigned)(magnitude % 1000u));
+}
@@ -0,0 +1,172 @@
+/**
+ * @file timer.c
+ * @brief Cycle-accurate timing backend (see bench_timer.h).
+ *
+ * Device: SysTick is configured with the maximum 24-bit reload value and the
+ * processor clock as its source. No SysTick interrupt is enabled; wraps are
+ * handled by masking the down-counter difference to 24 bits, which is valid
+ * while the interval is shorter than one wrap period. Longer intervals fall
+ * back to the microsecond timer.
+ *
+ * Host: clock_gettime(CLOCK_MONOTONIC), reported as a 1 GHz cycle counter.
+ *
+ * Calibration times BENCH_CALIBRATION_SAMPLES empty regions per backend and
+ * keeps the median, which is robust against the occasional interrupt.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include "bench_timer.h"
+
+#if !BENCH_HOST
+#include "hardware/clocks.h"
+#include "hardware/regs/m0plus.h"
+
+#define SYSTICK_MASK 0x00FFFFFFu  ///< SysTick is a 24-bit counter
+#endif
+
+static bool initialised = false;
+static uint32_t timer_hz = 1000000000u;
+static uint32_t overhead_cycles[BENCH_BACKEND_COUNT];
+
+/// Scratch buffer for calibration samples (static to keep it off the stack)
+static uint32_t calibration[BENCH_CALIBRATION_SAMPLES];
+
+static const char* const backend_names[BENCH_BACKEND_COUNT] = {
+#if BENCH_HOST
+    "clock_gettime",
+#else
+    "systick",
+#endif
+    "us_timer",
+};
+
+#if !BENCH_HOST
+/// Longest interval (µs) still measured with SysTick; 3/4 of one wrap period
+/// leaves margin for the ±1 µs uncertainty of the microsecond timer.
+static uint32_t systick_limit_us = 0;
+static uint64_t systick_limit_cycles = 0;
+#endif
+
+/**
+ * @brief Median of the calibration buffer (insertion sort, small n).
+ */
+static uint32_t calibration_median(void) {
+    for (int i = 1; i < BENCH_CALIBRATION_SAMPLES; i++) {
+        uint32_t v = calibration[i];
+        int j = i - 1;
+        while (j >= 0 && calibration[j] > v) {
+            calibration[j + 1] = calibration[j];
+            j--;
+        }
+        calibration[j + 1] = v;
+    }
+    return calibration[BENCH_CALIBRATION_SAMPLES / 2];
+}
+
+/**
+ * @brief Measure the median cost of an empty timed region for each backend.
+ */
+static void calibrate(void) {
+    // Cycle counter: exactly the sequence used around every kernel
+    for (int i = 0; i < BENCH_CALIBRATION_SAMPLES; i++) {
+        bench_timestamp_t start = bench_timer_now();
+        calibration[i] = (uint32_t)bench_timer_elapsed_cycles(start, bench_timer_now());
+    }
+    overhead_cycles[BENCH_BACKEND_CYCLES] = calibration_median();
+
+#if BENCH_HOST
+    overhead_cycles[BENCH_BACKEND_US_TIMER] = 0;  // Fallback never used on host
+#else
+    // Microsecond timer: usually below its resolution, so typically 0
+    for (int i = 0; i < BENCH_CALIBRATION_SAMPLES; i++) {
+        uint32_t start = time_us_32();
+        calibration[i] = time_us_32() - start;
+    }
+    overhead_cycles[BENCH_BACKEND_US_TIMER] =
+        (uint32_t)((uint64_t)calibration_median() * timer_hz / 1000000u);
+#endif
+}
+
+void bench_timer_init(void) {
+    if (initialised) {
+        return;
+    }
+#if !BENCH_HOST
+    timer_hz = clock_get_hz(clk_sys);
+
+    systick_hw->csr = 0;                  // Disable while configuring
+    systick_hw->rvr = SYSTICK_MASK;       // Full 24-bit range
+    systick_hw->cvr = 0;                  // Any write clears the counter
+    systick_hw->csr = M0PLUS_SYST_CSR_CLKSOURCE_BITS  // Processor clock (clk_sys)
+                    | M0PLUS_SYST_CSR_ENABLE_BITS;     // No interrupt
+
+    uint64_t wrap_us = ((uint64_t)SYSTICK_MASK + 1u) * 1000000u / timer_hz;
+    systick_limit_us = (uint32_t)(wrap_us * 3u / 4u);
+    systick_limit_cycles = (uint64_t)systick_limit_us * timer_hz / 1000000u;
+#endif
+    initialised = true;
+
+    calibrate();
+}
+
+void bench_timer_recalibrate(void) {
+    initialised = false;
+    bench_timer_init();
+}
+
+uint32_t bench_timer_hz(void) {
+    return timer_hz;
+}
+
+uint64_t bench_timer_elapsed_cycles(bench_timestamp_t start, bench_timestamp_t end) {
+#if BENCH_HOST
+    return end.ns - start.ns;
+#else
+    uint32_t us = end.us - start.us;
+    if (us < systick_limit_us) {
+        // Down-counter: start - end, modulo 2^24 handles a single wrap
+        return (start.systick - end.systick) & SYSTICK_MASK;
+    }
+    // Too long for SysTick: scale the microsecond delta
+    return (uint64_t)us * timer_hz / 1000000u;
+#endif
+}
+
+bench_backend_t bench_timer_backend_for(uint64_t cycles) {
+#if BENCH_HOST
+    (void)cycles;
+    return BENCH_BACKEND_CYCLES;
+#else
+    return cycles < systick_limit_cycles ? BENCH_BACKEND_CYCLES : BENCH_BACKEND_US_TIMER;
+#endif
+}
+
+uint32_t bench_timer_overhead_cycles(bench_backend_t backend) {
+    return overhead_cycles[backend];
+}
+
+uint64_t bench_timer_subtract_overhead(uint64_t raw_cycles) {
+    uint32_t overhead = overhead_cycles[bench_timer_backend_for(raw_cycles)];
+    return raw_cycles > overhead ? raw_cycles - overhead : 0u;
+}
+
+void bench_timer_print_calibration(void) {
+    printf("backend,overhead_cycles,hz\n");
+    for (int b = 0; b < BENCH_BACKEND_COUNT; b++) {
+        printf("%s,%lu,%lu\n", backend_names[b],
+               (unsigned long)overhead_cycles[b], (unsigned long)timer_hz);
+    }
+}
+
+uint64_t bench_cycles_to_ns(uint64_t cycles) {
+    // Split to avoid overflowing cycles * 1e9
+    return (cycles / timer_hz) * 1000000000u
+         + (cycles % timer_hz) * 1000000000u / timer_hz;
+}
+
+double bench_cycles_to_us(double cycles) {
+    return cycles * 1000000.0 / timer_hz;
+}
@@ -0,0 +1,328 @@
+/**
+ * @file wire.c
+ * @brief Binary result framing: encoder, decoder and CRC (see bench_wire.h).
+ *
+ * Encoding writes straight into a caller-provided buffer and never touches
+ * the heap. Decoding validates every length against the payload bounds, so
+ * a corrupted or truncated stream is rejected rather than over-read.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "bench_wire.h"
+
+#if !BENCH_HOST
+#include "pico/stdlib.h"
+#endif
+
+/**
+ * @brief Bounded output cursor.
+ */
+typedef struct {
+    uint8_t* p;
+    uint8_t* end;
+    bool overflow;
+} writer_t;
+
+/**
+ * @brief Bounded input cursor.
+ */
+typedef struct {
+    const uint8_t* p;
+    const uint8_t* end;
+    bool error;
+} reader_t;
+
+/// CRC-16/CCITT nibble table (16 entries keeps it small for the device)
+static const uint16_t crc_table[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+uint16_t bench_wire_crc16(const uint8_t* data, size_t len) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc = (uint16_t)((crc << 4) ^ crc_table[(crc >> 12) ^ (data[i] >> 4)]);
+        crc = (uint16_t)((crc << 4) ^ crc_table[(crc >> 12) ^ (data[i] & 0x0F)]);
+    }
+    return crc;
+}
+
+// ----------------------------------------------------
+// Encoding
+// ----------------------------------------------------
+
+static void put_u8(writer_t* w, uint8_t v) {
+    if (w->p < w->end) {
+        *w->p++ = v;
+    } else {
+        w->overflow = true;
+    }
+}
+
+static void put_uv(writer_t* w, uint64_t v) {
+    while (v >= 0x80) {
+        put_u8(w, (uint8_t)(v | 0x80));
+        v >>= 7;
+    }
+    put_u8(w, (uint8_t)v);
+}
+
+static void put_sv(writer_t* w, int64_t v) {
+    put_uv(w, ((uint64_t)v << 1) ^ (uint64_t)(v >> 63));  // zigzag
+}
+
+static void put_string(writer_t* w, const char* s) {
+    size_t len = 0;
+    while (len < BENCH_WIRE_MAX_NAME - 1 && s[len]) {
+        len++;
+    }
+    put_uv(w, len);
+    for (size_t i = 0; i < len; i++) {
+        put_u8(w, (uint8_t)s[i]);
+    }
+}
+
+/**
+ * @brief Reserve the frame header and position the writer at the payload.
+ */
+static void begin_frame(writer_t* w, uint8_t* out, size_t cap, bench_wire_type_t type) {
+    w->p = out;
+    w->end = out + cap;
+    w->overflow = false;
+    put_u8(w, BENCH_WIRE_MAGIC0);
+    put_u8(w, BENCH_WIRE_MAGIC1);
+    put_u8(w, BENCH_WIRE_VERSION);
+    put_u8(w, (uint8_t)type);
+    put_u8(w, 0);  // Length, patched in bench_wire_seal_frame()
+    put_u8(w, 0);
+}
+
+/**
+ * @brief Check that the CRC fits, then patch the length and append the CRC.
+ *
+ * @return Total frame length, or 0 on overflow.
+ */
+static size_t finish_frame(writer_t* w, uint8_t* out) {
+    size_t payload_len = (size_t)(w->p - out) - BENCH_WIRE_HEADER_SIZE;
+    if (w->overflow || (size_t)(w->end - w->p) < BENCH_WIRE_CRC_SIZE) {
+        return 0;
+    }
+    return bench_wire_seal_frame(out, (bench_wire_type_t)out[3], payload_len);
+}
+
+size_t bench_wire_seal_frame(uint8_t* out, bench_wire_type_t type, size_t payload_len) {
+    if (payload_len > BENCH_WIRE_MAX_PAYLOAD) {
+        return 0;
+    }
+    out[0] = BENCH_WIRE_MAGIC0;
+    out[1] = BENCH_WIRE_MAGIC1;
+    out[2] = BENCH_WIRE_VERSION;
+    out[3] = (uint8_t)type;
+    out[4] = (uint8_t)(payload_len & 0xFF);
+    out[5] = (uint8_t)(payload_len >> 8);
+
+    size_t end = BENCH_WIRE_HEADER_SIZE + payload_len;
+    uint16_t crc = bench_wire_crc16(out + 2, end - 2);
+    out[end] = (uint8_t)(crc & 0xFF);
+    out[end + 1] = (uint8_t)(crc >> 8);
+    return end + BENCH_WIRE_CRC_SIZE;
+}
+
+size_t bench_wire_encode_result(uint8_t* out, size_t cap, const bench_wire_result_t* result) {
+    writer_t w;
+    begin_frame(&w, out, cap, BENCH_WIRE_RESULT);
+
+    put_string(&w, result->task);
+    put_string(&w, result->method);
+    put_string(&w, result->param_name);
+
+    uint8_t num_params = result->num_params;
+    if (num_params > BENCH_WIRE_MAX_PARAMS) num_params = BENCH_WIRE_MAX_PARAMS;
+    put_uv(&w, num_params);
+    for (uint8_t i = 0; i < num_params; i++) {
+        put_sv(&w, result->params[i]);
+    }
+
+    put_uv(&w, result->timer_hz);
+    put_uv(&w, result->overhead);
+    put_uv(&w, result->raw_median);
+    put_u8(&w, result->flags);
+
+    put_uv(&w, result->num_samples);
+    uint32_t prev = 0;
+    for (uint32_t i = 0; i < result->num_samples; i++) {
+        uint32_t s = result->samples[i];
+        if (i == 0) {
+            put_uv(&w, s);
+        } else {
+            put_sv(&w, (int64_t)s - (int64_t)prev);
+        }
+        prev = s;
+    }
+
+    return finish_frame(&w, out);
+}
+
+size_t bench_wire_encode_edges(uint8_t* out, size_t cap, const bench_wire_edges_t* edges) {
+    writer_t w;
+    begin_frame(&w, out, cap, BENCH_WIRE_EDGES);
+
+    put_u8(&w, edges->pin);
+    put_u8(&w, edges->first_state);
+    put_uv(&w, edges->timer_hz);
+
+    put_uv(&w, edges->num_edges);
+    for (uint32_t i = 0; i < edges->num_edges; i++) {
+        // Unsigned 32-bit difference handles timer wrap
+        put_uv(&w, i == 0 ? edges->timestamps[0]
+                          : edges->timestamps[i] - edges->timestamps[i - 1]);
+    }
+
+    return finish_frame(&w, out);
+}
+
+// ----------------------------------------------------
+// Decoding
+// ----------------------------------------------------
+
+static uint8_t get_u8(reader_t* r) {
+    if (r->p < r->end) {
+        return *r->p++;
+    }
+    r->error = true;
+    return 0;
+}
+
+static uint64_t get_uv(reader_t* r) {
+    uint64_t v = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        uint8_t b = get_u8(r);
+        v |= (uint64_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            return v;
+        }
+    }
+    r->error = true;  // Over-long varint
+    return 0;
+}
+
+static int64_t get_sv(reader_t* r) {
+    uint64_t v = get_uv(r);
+    return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+static void get_string(reader_t* r, char* out) {
+    uint64_t len = get_uv(r);
+    if (len >= BENCH_WIRE_MAX_NAME || len > (uint64_t)(r->end - r->p)) {
+        r->error = true;
+        out[0] = '\0';
+        return;
+    }
+    memcpy(out, r->p, (size_t)len);
+    out[len] = '\0';
+    r->p += len;
+}
+
+bench_wire_frame_status_t bench_wire_parse_frame(const uint8_t* data, size_t len,
+                                                 bench_wire_type_t* type,
+                                                 const uint8_t** payload, size_t* payload_len,
+                                                 size_t* frame_len) {
+    if (len >= 1 && data[0] != BENCH_WIRE_MAGIC0) return BENCH_WIRE_FRAME_BAD;
+    if (len >= 2 && data[1] != BENCH_WIRE_MAGIC1) return BENCH_WIRE_FRAME_BAD;
+    if (len >= 3 && data[2] != BENCH_WIRE_VERSION) return BENCH_WIRE_FRAME_BAD;
+    if (len < BENCH_WIRE_HEADER_SIZE) {
+        return BENCH_WIRE_FRAME_INCOMPLETE;
+    }
+
+    size_t plen = (size_t)data[4] | ((size_t)data[5] << 8);
+    size_t total = BENCH_WIRE_HEADER_SIZE + plen + BENCH_WIRE_CRC_SIZE;
+    if (len < total) {
+        return BENCH_WIRE_FRAME_INCOMPLETE;
+    }
+
+    uint16_t crc = (uint16_t)(data[total - 2] | (data[total - 1] << 8));
+    if (crc != bench_wire_crc16(data + 2, total - 2 - BENCH_WIRE_CRC_SIZE)) {
+        return BENCH_WIRE_FRAME_BAD;
+    }
+
+    *type = (bench_wire_type_t)data[3];
+    *payload = data + BENCH_WIRE_HEADER_SIZE;
+    *payload_len = plen;
+    *frame_len = total;
+    return BENCH_WIRE_FRAME_OK;
+}
+
+bool bench_wire_decode_result(const uint8_t* payload, size_t len, bench_wire_result_t* result,
+                              uint32_t* samples, uint32_t max_samples) {
+    reader_t r = { payload, payload + len, false };
+
+    get_string(&r, result->task);
+    get_string(&r, result->method);
+    get_string(&r, result->param_name);
+
+    uint64_t num_params = get_uv(&r);
+    if (num_params > BENCH_WIRE_MAX_PARAMS) {
+        return false;
+    }
+    result->num_params = (uint8_t)num_params;
+    for (uint8_t i = 0; i < result->num_params; i++) {
+        result->params[i] = (int32_t)get_sv(&r);
+    }
+
+    result->timer_hz = (uint32_t)get_uv(&r);
+    result->overhead = (uint32_t)get_uv(&r);
+    result->raw_median = (uint32_t)get_uv(&r);
+    result->flags = get_u8(&r);
+
+    uint64_t n = get_uv(&r);
+    if (r.error || n > max_samples) {
+        return false;
+    }
+    result->num_samples = (uint32_t)n;
+    result->samples = samples;
+
+    int64_t value = 0;
+    for (uint32_t i = 0; i < result->num_samples; i++) {
+        value = i == 0 ? (int64_t)get_uv(&r) : value + get_sv(&r);
+        samples[i] = (uint32_t)value;
+    }
+
+    return !r.error && r.p == r.end;
+}
+
+bool bench_wire_decode_edges(const uint8_t* payload, size_t len, bench_wire_edges_t* edges,
+                             uint32_t* timestamps, uint32_t max_edges) {
+    reader_t r = { payload, payload + len, false };
+
+    edges->pin = get_u8(&r);
+    edges->first_state = get_u8(&r);
+    edges->timer_hz = (uint32_t)get_uv(&r);
+
+    uint64_t n = get_uv(&r);
+    if (r.error || n > max_edges) {
+        return false;
+    }
+    edges->num_edges = (uint32_t)n;
+    edges->timestamps = timestamps;
+
+    uint32_t t = 0;
+    for (uint32_t i = 0; i < edges->num_edges; i++) {
+        t = i == 0 ? (uint32_t)get_uv(&r) : t + (uint32_t)get_uv(&r);
+        timestamps[i] = t;
+    }
+
+    return !r.error && r.p == r.end;
+}
+
+void bench_wire_write(const uint8_t* frame, size_t len) {
+#if BENCH_HOST
+    fwrite(frame, 1, len, stdout);
+    fflush(stdout);
+#else
+    fflush(stdout);  // Keep any pending text ahead of the frame
+    stdio_put_string((const char*)frame, (int)len, false, false);  // No CR/LF translation
+#endif
+}
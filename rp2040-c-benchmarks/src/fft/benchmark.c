@@ -2,15 +2,30 @@
  * @file benchmark.c
  * @brief FFT Benchmark for RP2040 (Radix-2, Cooley–Tukey algorithm).
  *
- * This benchmark evaluates the execution time of a radix-2 Fast Fourier Transform
- * using the Cooley–Tukey algorithm. It operates on a 128-point sine wave and
- * prints the execution duration in CSV format for analysis.
+ * This benchmark evaluates the execution time of a radix-2 Fast Fourier
+ * Transform using the Cooley–Tukey algorithm, in single-precision float
+ * (soft-float on the M0+) and in Q15 and Q31 fixed point (fixed_point.c) with
+ * per-stage or block-floating-point scaling. The `plan_*` variants run the
+ * C++17 compile-time plans (fft_plan.hpp): precomputed bit-reversal swaps and
+ * twiddles, radix-4, and a real-input transform. `q15_parallel` splits the
+ * bit reversal and every stage of `q15` between the two cores, with a barrier
+ * after each (bench_parallel.h); `fft.speedup` reports its speedup over
+ * `q15`. Every variant transforms the same two-tone test signal at
+ * N = 64..4096, repeated by the shared statistics engine (bench_stats.h),
+ * with its buffers allocated from the benchmark arena (bench_arena.h) for
+ * each size, and prints the execution duration statistics in CSV format for
+ * analysis.
+ *
+ * After timing, the output is compared with the analytic transform of the
+ * input and its signal-to-noise ratio must reach a per-variant threshold.
+ * `fft.accuracy` prints that SNR for every variant and size:
+ *   task,method,size,snr_db,scale_shift
  *
  * Source (algorithmic reference):
  * https://en.wikipedia.org/wiki/Cooley%E2%80%93Tukey_FFT_algorithm
  *
  * Output format:
- *   task,method,size,time_us
+ *   task,method,size,time_us,...(see bench_stats.h),valid
  *
  * @author Samuel Ivuerah
  */
@@ -19,7 +34,12 @@
 #include <math.h>
 #include "pico/stdlib.h"
 #include "pico/time.h"
-#include "benchmarks.h"
+#include "bench_arena.h"
+#include "bench_parallel.h"
+#include "bench_registry.h"
+#include "bench_sink.h"
+#include "fft_fixed.h"
+#include "fft_plan.h"
 
 #define PI 3.14159265358979323846f
 
@@ -68,7 +88,8 @@ static void bit_reverse(float* real, float* imag, int n) {
 static void fft_radix2(float* real, float* imag, int n) {
     bit_reverse(real, imag, n);
 
-    for (int s = 1; s <= log2f(n); s++) {
+    // Integer stage bound: log2f(n) in the condition cost a soft-float call per stage
+    for (int s = 1; (1 << s) <= n; s++) {
         int m = 1 << s;
         float angle = -2.0f * PI / m;
         float w_m_real = cosf(angle);
@@ -98,33 +119,475 @@ static void fft_radix2(float* real, float* imag, int n) {
     }
 }
 
+#define FFT_MAX_N 4096  ///< Largest size the twiddle tables and plans support
+#define FFT_MIN_N 16    ///< Smallest size whose two test tones fall in distinct bins
+
+#define TWO_PI 6.28318530717958647692  ///< Double precision, for the test signal
+
+#define Q15_ONE 32768.0       ///< Full scale of a Q15 value
+#define Q31_ONE 2147483648.0  ///< Full scale of a Q31 value
+
+/**
+ * @brief Data format of an FFT variant.
+ */
+typedef enum {
+    FFT_FLOAT,
+    FFT_FLOAT_REAL,  ///< Bins 0..n/2 only, the rest by conjugate symmetry
+    FFT_Q15,
+    FFT_Q31,
+} fft_format_t;
+
 /**
- * @brief Run FFT benchmark on a 128-point sine wave.
+ * @brief Kernel context for the FFT benchmarks (one per variant).
+ */
+typedef struct {
+    fft_format_t format;
+    fft_scale_t scale;   ///< Fixed-point scaling policy
+    double min_snr_db;   ///< Lowest SNR fft_verify() accepts
+    int n;
+    int shift;           ///< Stages halved by the last fixed-point run
+    double snr_db;       ///< SNR of the last run, set by fft_verify()
+} fft_ctx_t;
+
+/// Working buffers of the current variant and size (benchmark arena)
+static union {
+    struct {
+        float* real;
+        float* imag;
+    } f32;
+    struct {
+        int16_t* real;
+        int16_t* imag;
+    } q15;
+    struct {
+        int32_t* real;
+        int32_t* imag;
+    } q31;
+} fft_buf;
+
+/// Test signal in Q31, computed in setup so prepare() stays cheap
+static int32_t* fft_input;
+
+/// Same default sizes in every variant and in the TinyGo suite
+static const int fft_sizes[] = {64, 128, 256, 512, 1024, 2048, 4096};
+
+/**
+ * @brief Test signal: 0.5·sin(2πi/n) + 0.25·cos(2π(n/8)i/n).
  *
- * Generates a synthetic sine wave, computes its FFT using the
- * Cooley-Tukey radix-2 algorithm, and prints execution time.
- * Results are logged in CSV format.
+ * The 0.75 peak leaves fixed-point headroom. Its transform is -j·n/4 in
+ * bin 1, +j·n/4 in bin n-1 and n/8 in bins n/8 and 7n/8 (fft_reference()).
+ */
+static double fft_signal(int i, int n) {
+    return 0.5 * sin(TWO_PI * i / n) + 0.25 * cos(TWO_PI * (n / 8) * i / n);
+}
+
+static void fft_reference(int k, int n, double* real, double* imag) {
+    *real = 0.0;
+    *imag = 0.0;
+    if (k == 1) {
+        *imag = -0.25 * n;
+    } else if (k == n - 1) {
+        *imag = 0.25 * n;
+    } else if (k == n / 8 || k == n - n / 8) {
+        *real = 0.125 * n;
+    }
+}
+
+/**
+ * @brief Allocate the input and the variant's real and imaginary arrays.
+ */
+static bool fft_setup(void* ctx, int n) {
+    fft_ctx_t* c = ctx;
+    if (n < FFT_MIN_N || n > FFT_MAX_N || (n & (n - 1)) != 0) {
+        return false;  // Must be a power of 2 within the tables
+    }
+    size_t elem = c->format == FFT_Q15 ? sizeof(int16_t) : sizeof(int32_t);  // float is 4 bytes
+    fft_input = bench_arena_alloc((size_t)n * sizeof(int32_t));
+    void* real = bench_arena_alloc((size_t)n * elem);
+    void* imag = bench_arena_alloc((size_t)n * elem);
+    if (!fft_input || !real || !imag) {
+        return false;
+    }
+    fft_buf.q31.real = real;  // The other views alias the same pointers
+    fft_buf.q31.imag = imag;
+
+    for (int i = 0; i < n; i++) {
+        fft_input[i] = (int32_t)lround(fft_signal(i, n) * Q31_ONE);
+    }
+    c->n = n;
+    c->shift = 0;
+    return true;
+}
+
+/**
+ * @brief Regenerate the input in the variant's format (the FFT works in place).
+ */
+static void fill_float(void* ctx) {
+    fft_ctx_t* c = ctx;
+    for (int i = 0; i < c->n; i++) {
+        fft_buf.f32.real[i] = fft_input[i] * (float)(1.0 / Q31_ONE);
+        fft_buf.f32.imag[i] = 0.0f;
+    }
+}
+
+static void fill_q15(void* ctx) {
+    fft_ctx_t* c = ctx;
+    for (int i = 0; i < c->n; i++) {
+        fft_buf.q15.real[i] = (int16_t)((fft_input[i] + (1 << 15)) >> 16);
+        fft_buf.q15.imag[i] = 0;
+    }
+}
+
+static void fill_q31(void* ctx) {
+    fft_ctx_t* c = ctx;
+    for (int i = 0; i < c->n; i++) {
+        fft_buf.q31.real[i] = fft_input[i];
+        fft_buf.q31.imag[i] = 0;
+    }
+}
+
+static void run_fft(void* ctx) {
+    fft_ctx_t* c = ctx;
+    fft_radix2(fft_buf.f32.real, fft_buf.f32.imag, c->n);
+    bench_sink_ptr(fft_buf.f32.real);
+    bench_sink_ptr(fft_buf.f32.imag);
+}
+
+static void run_fft_plan_radix2(void* ctx) {
+    fft_ctx_t* c = ctx;
+    fft_plan_radix2_f32(fft_buf.f32.real, fft_buf.f32.imag, c->n);
+    bench_sink_ptr(fft_buf.f32.real);
+    bench_sink_ptr(fft_buf.f32.imag);
+}
+
+static void run_fft_plan_radix4(void* ctx) {
+    fft_ctx_t* c = ctx;
+    fft_plan_radix4_f32(fft_buf.f32.real, fft_buf.f32.imag, c->n);
+    bench_sink_ptr(fft_buf.f32.real);
+    bench_sink_ptr(fft_buf.f32.imag);
+}
+
+static void run_fft_plan_real(void* ctx) {
+    fft_ctx_t* c = ctx;
+    fft_plan_real_f32(fft_buf.f32.real, fft_buf.f32.imag, c->n);
+    bench_sink_ptr(fft_buf.f32.real);
+    bench_sink_ptr(fft_buf.f32.imag);
+}
+
+static void run_fft_q15(void* ctx) {
+    fft_ctx_t* c = ctx;
+    c->shift = fft_q15(fft_buf.q15.real, fft_buf.q15.imag, c->n, c->scale);
+    bench_sink_ptr(fft_buf.q15.real);
+    bench_sink_ptr(fft_buf.q15.imag);
+}
+
+static void run_fft_q31(void* ctx) {
+    fft_ctx_t* c = ctx;
+    c->shift = fft_q31(fft_buf.q31.real, fft_buf.q31.imag, c->n, c->scale);
+    bench_sink_ptr(fft_buf.q31.real);
+    bench_sink_ptr(fft_buf.q31.imag);
+}
+
+/**
+ * @brief One worker's share of the Q15 FFT, every stage halved.
+ *
+ * Each worker permutes its share of the indices and then runs its half of
+ * the n/2 butterflies of every stage. A stage reads the previous stage's
+ * outputs from both halves, hence the barrier between stages.
+ */
+static void fft_q15_worker(void* ctx, int worker) {
+    fft_ctx_t* c = ctx;
+    int n = c->n;
+    int butterflies = n / 2;
+
+    fft_q15_bit_reverse_range(fft_buf.q15.real, fft_buf.q15.imag, n,
+                              n * worker / BENCH_PARALLEL_WORKERS,
+                              n * (worker + 1) / BENCH_PARALLEL_WORKERS);
+    for (int m = 2; m <= n; m <<= 1) {
+        bench_parallel_barrier();
+        fft_q15_stage_range(fft_buf.q15.real, fft_buf.q15.imag, m,
+                            butterflies * worker / BENCH_PARALLEL_WORKERS,
+                            butterflies * (worker + 1) / BENCH_PARALLEL_WORKERS);
+    }
+}
+
+static void run_fft_q15_parallel(void* ctx) {
+    fft_ctx_t* c = ctx;
+    bench_parallel_run(fft_q15_worker, c);
+    c->shift = 0;
+    for (int m = 2; m <= c->n; m <<= 1) {
+        c->shift++;
+    }
+    bench_sink_ptr(fft_buf.q15.real);
+    bench_sink_ptr(fft_buf.q15.imag);
+}
+
+/**
+ * @brief Compare the spectrum with the analytic transform.
  *
- * @note This benchmark uses a fixed size of 128 samples for consistency
- *       across language comparisons.
- */
-void benchmark_fft(void) {
-    const int N = 128;
-    float real[N];
-    float imag[N];
-
-    // Generate synthetic sine wave input (real) with 0-valued imaginary parts
-    for (int i = 0; i < N; i++) {
-        real[i] = sinf(2 * PI * i / N);
-        imag[i] = 0.0f;
+ * The output is rescaled to float units (undoing the stage halvings), then
+ * SNR = 10·log10(Σ|X_ref|² / Σ|X - X_ref|²) over all bins. The noise
+ * includes the quantisation of the input itself.
+ */
+static bool fft_verify(void* ctx) {
+    fft_ctx_t* c = ctx;
+    double gain = ldexp(1.0, c->shift);
+    if (c->format == FFT_Q15) {
+        gain /= Q15_ONE;
+    } else if (c->format == FFT_Q31) {
+        gain /= Q31_ONE;
     }
 
-    // Time the FFT computation
-    absolute_time_t start = get_absolute_time();
-    fft_radix2(real, imag, N);
-    int64_t elapsed = absolute_time_diff_us(start, get_absolute_time());
+    double signal = 0.0;
+    double noise = 0.0;
+    for (int k = 0; k < c->n; k++) {
+        double real;
+        double imag;
+        if (c->format == FFT_Q15) {
+            real = fft_buf.q15.real[k] * gain;
+            imag = fft_buf.q15.imag[k] * gain;
+        } else if (c->format == FFT_Q31) {
+            real = fft_buf.q31.real[k] * gain;
+            imag = fft_buf.q31.imag[k] * gain;
+        } else if (c->format == FFT_FLOAT_REAL && k > c->n / 2) {
+            real = fft_buf.f32.real[c->n - k];
+            imag = -fft_buf.f32.imag[c->n - k];
+        } else {
+            real = fft_buf.f32.real[k];
+            imag = fft_buf.f32.imag[k];
+        }
+
+        double ref_real;
+        double ref_imag;
+        fft_reference(k, c->n, &ref_real, &ref_imag);
+        signal += ref_real * ref_real + ref_imag * ref_imag;
+        noise += (real - ref_real) * (real - ref_real) + (imag - ref_imag) * (imag - ref_imag);
+    }
 
-    // Output results in CSV format
-    printf("task,method,size,time_us\n");
-    printf("fft,radix2,%d,%lld\n", N, elapsed);
+    c->snr_db = 10.0 * log10(signal / (noise + 1e-30));
+    return c->snr_db >= c->min_snr_db;
 }
+
+// SNR thresholds leave at least 8 dB of margin at the worst size (N = 4096) on the host build
+static fft_ctx_t fft_float_ctx = {.format = FFT_FLOAT, .min_snr_db = 80.0};
+static fft_ctx_t fft_plan_radix2_ctx = {.format = FFT_FLOAT, .min_snr_db = 120.0};
+static fft_ctx_t fft_plan_radix4_ctx = {.format = FFT_FLOAT, .min_snr_db = 120.0};
+static fft_ctx_t fft_plan_real_ctx = {.format = FFT_FLOAT_REAL, .min_snr_db = 120.0};
+static fft_ctx_t fft_q15_ctx = {.format = FFT_Q15, .scale = FFT_SCALE_STAGE, .min_snr_db = 40.0};
+static fft_ctx_t fft_q15_bfp_ctx = {.format = FFT_Q15, .scale = FFT_SCALE_BLOCK, .min_snr_db = 40.0};
+static fft_ctx_t fft_q15_parallel_ctx = {.format = FFT_Q15, .scale = FFT_SCALE_STAGE, .min_snr_db = 40.0};
+static fft_ctx_t fft_q31_ctx = {.format = FFT_Q31, .scale = FFT_SCALE_STAGE, .min_snr_db = 130.0};
+static fft_ctx_t fft_q31_bfp_ctx = {.format = FFT_Q31, .scale = FFT_SCALE_BLOCK, .min_snr_db = 130.0};
+
+/**
+ * @brief Radix-2 FFT in single-precision float, input regenerated per run.
+ */
+const bench_desc_t bench_fft_radix2 = {
+    .task = "fft",
+    .method = "radix2",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = fft_sizes,
+    .num_params = sizeof(fft_sizes) / sizeof(fft_sizes[0]),
+    .sweep_max = FFT_MAX_N,
+    .ctx = &fft_float_ctx,
+    .setup = fft_setup,
+    .prepare = fill_float,
+    .run = run_fft,
+    .verify = fft_verify,
+};
+
+/**
+ * @brief Radix-2 FFT through the compile-time plan (precomputed swaps and twiddles).
+ */
+const bench_desc_t bench_fft_plan_radix2 = {
+    .task = "fft",
+    .method = "plan_radix2",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = fft_sizes,
+    .num_params = sizeof(fft_sizes) / sizeof(fft_sizes[0]),
+    .sweep_max = FFT_MAX_N,
+    .ctx = &fft_plan_radix2_ctx,
+    .setup = fft_setup,
+    .prepare = fill_float,
+    .run = run_fft_plan_radix2,
+    .verify = fft_verify,
+};
+
+/**
+ * @brief Radix-4 FFT through the compile-time plan.
+ */
+const bench_desc_t bench_fft_plan_radix4 = {
+    .task = "fft",
+    .method = "plan_radix4",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = fft_sizes,
+    .num_params = sizeof(fft_sizes) / sizeof(fft_sizes[0]),
+    .sweep_max = FFT_MAX_N,
+    .ctx = &fft_plan_radix4_ctx,
+    .setup = fft_setup,
+    .prepare = fill_float,
+    .run = run_fft_plan_radix4,
+    .verify = fft_verify,
+};
+
+/**
+ * @brief Real-input FFT through the compile-time plan (n/2-point complex FFT + split).
+ */
+const bench_desc_t bench_fft_plan_real = {
+    .task = "fft",
+    .method = "plan_real",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = fft_sizes,
+    .num_params = sizeof(fft_sizes) / sizeof(fft_sizes[0]),
+    .sweep_max = FFT_MAX_N,
+    .ctx = &fft_plan_real_ctx,
+    .setup = fft_setup,
+    .prepare = fill_float,
+    .run = run_fft_plan_real,
+    .verify = fft_verify,
+};
+
+/**
+ * @brief Q15 FFT, every stage halved (output X/n).
+ */
+const bench_desc_t bench_fft_q15 = {
+    .task = "fft",
+    .method = "q15",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = fft_sizes,
+    .num_params = sizeof(fft_sizes) / sizeof(fft_sizes[0]),
+    .sweep_max = FFT_MAX_N,
+    .ctx = &fft_q15_ctx,
+    .setup = fft_setup,
+    .prepare = fill_q15,
+    .run = run_fft_q15,
+    .verify = fft_verify,
+};
+
+/**
+ * @brief Q15 FFT with block floating point (stages halved only when needed).
+ */
+const bench_desc_t bench_fft_q15_bfp = {
+    .task = "fft",
+    .method = "q15_bfp",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = fft_sizes,
+    .num_params = sizeof(fft_sizes) / sizeof(fft_sizes[0]),
+    .sweep_max = FFT_MAX_N,
+    .ctx = &fft_q15_bfp_ctx,
+    .setup = fft_setup,
+    .prepare = fill_q15,
+    .run = run_fft_q15,
+    .verify = fft_verify,
+};
+
+/**
+ * @brief `q15` split between both cores (bit-identical output).
+ */
+const bench_desc_t bench_fft_q15_parallel = {
+    .task = "fft",
+    .method = "q15_parallel",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = fft_sizes,
+    .num_params = sizeof(fft_sizes) / sizeof(fft_sizes[0]),
+    .sweep_max = FFT_MAX_N,
+    .ctx = &fft_q15_parallel_ctx,
+    .setup = fft_setup,
+    .prepare = fill_q15,
+    .run = run_fft_q15_parallel,
+    .verify = fft_verify,
+};
+
+/**
+ * @brief Q31 FFT, every stage halved (output X/n).
+ */
+const bench_desc_t bench_fft_q31 = {
+    .task = "fft",
+    .method = "q31",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = fft_sizes,
+    .num_params = sizeof(fft_sizes) / sizeof(fft_sizes[0]),
+    .sweep_max = FFT_MAX_N,
+    .ctx = &fft_q31_ctx,
+    .setup = fft_setup,
+    .prepare = fill_q31,
+    .run = run_fft_q31,
+    .verify = fft_verify,
+};
+
+/**
+ * @brief Q31 FFT with block floating point (stages halved only when needed).
+ */
+const bench_desc_t bench_fft_q31_bfp = {
+    .task = "fft",
+    .method = "q31_bfp",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = fft_sizes,
+    .num_params = sizeof(fft_sizes) / sizeof(fft_sizes[0]),
+    .sweep_max = FFT_MAX_N,
+    .ctx = &fft_q31_bfp_ctx,
+    .setup = fft_setup,
+    .prepare = fill_q31,
+    .run = run_fft_q31,
+    .verify = fft_verify,
+};
+
+/**
+ * @brief Print the SNR of every FFT variant at every size (untimed).
+ */
+static void benchmark_fft_accuracy(void) {
+    static const bench_desc_t* const variants[] = {
+        &bench_fft_radix2,      &bench_fft_plan_radix2, &bench_fft_plan_radix4, &bench_fft_plan_real,
+        &bench_fft_q15,         &bench_fft_q15_bfp,     &bench_fft_q15_parallel, &bench_fft_q31,
+        &bench_fft_q31_bfp,
+    };
+
+    printf("task,method,size,snr_db,scale_shift\n");
+    for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); v++) {
+        const bench_desc_t* d = variants[v];
+        fft_ctx_t* c = d->ctx;
+        for (size_t i = 0; i < d->num_params; i++) {
+            bench_arena_reset();
+            if (!d->setup(c, d->params[i])) {
+                continue;
+            }
+            d->prepare(c);
+            d->run(c);
+            d->verify(c);
+            printf("fft,%s,%d,%.1f,%d\n", d->method, c->n, c->snr_db, c->shift);
+        }
+    }
+}
+
+/**
+ * @brief Output SNR of every FFT variant against the analytic spectrum.
+ */
+const bench_desc_t bench_fft_accuracy = {
+    .task = "fft",
+    .method = "accuracy",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .standalone = benchmark_fft_accuracy,
+};
+
+static void benchmark_fft_speedup(void) {
+    bench_parallel_report(&bench_fft_q15, &bench_fft_q15_parallel);
+}
+
+/**
+ * @brief Speedup and efficiency of `q15_parallel` over single-core `q15`.
+ */
+const bench_desc_t bench_fft_speedup = {
+    .task = "fft",
+    .method = "speedup",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .standalone = benchmark_fft_speedup,
+};
@@ -0,0 +1,72 @@
+/**
+ * @file fft_fixed.h
+ * @brief Fixed-point (Q15/Q31) radix-2 FFTs for the FFT benchmark.
+ *
+ * The RP2040's Cortex-M0+ has no FPU, so the float FFT spends most of its
+ * time in soft-float calls. These kernels run the same decimation-in-time
+ * algorithm on integer data:
+ *
+ *   - Twiddles come from a precomputed ROM table (twiddle_table.h), indexed
+ *     with a stride, instead of the float version's per-stage cosf()/sinf()
+ *     and per-butterfly recurrence.
+ *   - Butterflies round every product and saturate every output, so an
+ *     overflow clips instead of wrapping.
+ *   - Each stage can halve its outputs (see fft_scale_t). The return value
+ *     is the total number of halvings: the result is X[k] / 2^shift.
+ *
+ * Q15 products fit in 32 bits; Q31 products need 64-bit multiplies, which
+ * the M0+ builds from four 16x16 multiplies.
+ *
+ * Internal to src/fft/.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef FFT_FIXED_H
+#define FFT_FIXED_H
+
+#include <stdint.h>
+
+/**
+ * @brief Per-stage scaling policy.
+ */
+typedef enum {
+    FFT_SCALE_NONE,   ///< Never scale; large inputs saturate
+    FFT_SCALE_STAGE,  ///< Halve every stage: result is X[k] / n, cannot overflow
+    FFT_SCALE_BLOCK,  ///< Block floating point: halve a stage only when the
+                      ///< data lacks two guard bits (any |x| >= 1/4 full scale)
+} fft_scale_t;
+
+/**
+ * @brief In-place Q15 FFT of n points (power of two, n <= FFT_TWIDDLE_N).
+ *
+ * @return Number of stages that were halved.
+ */
+int fft_q15(int16_t* real, int16_t* imag, int n, fft_scale_t scale);
+
+/**
+ * @brief Bit-reversal permutation of the elements [first, last) (see fft_q15()).
+ *
+ * Disjoint ranges covering 0..n-1 can run concurrently and together give
+ * the full permutation.
+ */
+void fft_q15_bit_reverse_range(int16_t* real, int16_t* imag, int n, int first, int last);
+
+/**
+ * @brief Butterflies [first, last) of the stage of span m, halved (FFT_SCALE_STAGE).
+ *
+ * A stage of an n-point FFT has n/2 butterflies, none sharing an element,
+ * so disjoint ranges can run concurrently; the results are bit-identical to
+ * fft_q15(). Run the bit reversal and then the stages m = 2, 4, ..., n in
+ * order, with a barrier between them.
+ */
+void fft_q15_stage_range(int16_t* real, int16_t* imag, int m, int first, int last);
+
+/**
+ * @brief In-place Q31 FFT of n points (power of two, n <= FFT_TWIDDLE_N).
+ *
+ * @return Number of stages that were halved.
+ */
+int fft_q31(int32_t* real, int32_t* imag, int n, fft_scale_t scale);
+
+#endif  // FFT_FIXED_H
@@ -0,0 +1,72 @@
+/**
+ * @file fft_plan.cpp
+ * @brief Instantiates the FFT plans behind the C entry points in fft_plan.h.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include "fft_plan.h"
+#include "fft_plan.hpp"
+
+#ifndef FFT_PLAN_IN_SRAM
+#define FFT_PLAN_IN_SRAM 0
+#endif
+
+namespace {
+
+constexpr fft_storage plan_storage = FFT_PLAN_IN_SRAM ? fft_storage::sram : fft_storage::flash;
+
+template <std::size_t N>
+using plan = fft_plan<N, float, plan_storage>;
+
+/**
+ * @brief Call `Run::template apply<plan<n>>` for the plan matching n.
+ */
+template <typename Run>
+bool dispatch(int n, float* real, float* imag) {
+    switch (n) {
+        case 64: Run::template apply<plan<64>>(real, imag); return true;
+        case 128: Run::template apply<plan<128>>(real, imag); return true;
+        case 256: Run::template apply<plan<256>>(real, imag); return true;
+        case 512: Run::template apply<plan<512>>(real, imag); return true;
+        case 1024: Run::template apply<plan<1024>>(real, imag); return true;
+        case 2048: Run::template apply<plan<2048>>(real, imag); return true;
+        case 4096: Run::template apply<plan<4096>>(real, imag); return true;
+        default: return false;
+    }
+}
+
+struct radix2 {
+    template <typename Plan>
+    static void apply(float* real, float* imag) {
+        Plan::forward(real, imag);
+    }
+};
+
+struct radix4 {
+    template <typename Plan>
+    static void apply(float* real, float* imag) {
+        Plan::forward_radix4(real, imag);
+    }
+};
+
+struct real_input {
+    template <typename Plan>
+    static void apply(float* real, float* imag) {
+        Plan::forward_real(real, imag);
+    }
+};
+
+}  // namespace
+
+extern "C" bool fft_plan_radix2_f32(float* real, float* imag, int n) {
+    return dispatch<radix2>(n, real, imag);
+}
+
+extern "C" bool fft_plan_radix4_f32(float* real, float* imag, int n) {
+    return dispatch<radix4>(n, real, imag);
+}
+
+extern "C" bool fft_plan_real_f32(float* real, float* imag, int n) {
+    return dispatch<real_input>(n, real, imag);
+}
@@ -0,0 +1,53 @@
+/**
+ * @file fft_plan.h
+ * @brief C entry points for the compile-time FFT plans (fft_plan.hpp).
+ *
+ * The plans are C++ templates specialised on the transform size, so C code
+ * selects one at run time by size. Each entry point dispatches to
+ * fft_plan<n, float> for n = 64, 128, ..., 4096 and returns false for any
+ * other size, leaving the data untouched.
+ *
+ * The plan tables are placed in flash; build with FFT_PLAN_IN_SRAM=1 to
+ * copy them to SRAM instead (about 64 KB for all seven sizes).
+ *
+ * Internal to src/fft/.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef FFT_PLAN_H
+#define FFT_PLAN_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FFT_PLAN_MIN_N 64    ///< Smallest size with an instantiated plan
+#define FFT_PLAN_MAX_N 4096  ///< Largest size with an instantiated plan
+
+/**
+ * @brief In-place radix-2 FFT of n complex points.
+ */
+bool fft_plan_radix2_f32(float* real, float* imag, int n);
+
+/**
+ * @brief In-place radix-4 FFT of n complex points (radix-2 first stage when
+ * log2(n) is odd).
+ */
+bool fft_plan_radix4_f32(float* real, float* imag, int n);
+
+/**
+ * @brief FFT of n real samples in real[0..n) via an n/2-point complex FFT.
+ *
+ * Writes bins 0..n/2 to real[] and imag[]; bin n-k is the complex
+ * conjugate of bin k. Both arrays need n entries.
+ */
+bool fft_plan_real_f32(float* real, float* imag, int n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // FFT_PLAN_H
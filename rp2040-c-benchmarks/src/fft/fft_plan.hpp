@@ -0,0 +1,377 @@
+/**
+ * @file fft_plan.hpp
+ * @brief Compile-time FFT plans: constexpr bit-reversal and twiddle tables.
+ *
+ * fft_plan<N, T> specialises the radix-2 FFT on its size. Everything that
+ * fft_radix2() in benchmark.c recomputes on every call is built once by the
+ * compiler instead:
+ *
+ *   - The bit-reversal permutation becomes a list of (i, j) swap pairs, so
+ *     the data-dependent `while` loop of bit_reverse() disappears.
+ *   - The twiddles W_N^k = cos(2πk/N) - j·sin(2πk/N) come from a table
+ *     computed in double precision (by a constexpr series, as std::sin is
+ *     not constexpr) and rounded once to T, instead of the per-stage
+ *     cosf()/sinf() and the per-butterfly recurrence, whose rounding error
+ *     accumulates along each stage.
+ *
+ * Three transforms share the tables:
+ *
+ *   - forward()        radix-2 decimation in time, twiddle-first loops.
+ *   - forward_radix4() radix-4 decimation in time on the same bit-reversed
+ *                      input: three complex multiplies per four points
+ *                      instead of four. Odd log2(N) starts with one
+ *                      multiply-free radix-2 stage.
+ *   - forward_real()   N real samples through an N/2-point complex FFT
+ *                      plus a split step; writes bins 0..N/2 only (the rest
+ *                      are their complex conjugates).
+ *
+ * With fft_storage::flash the tables are `static constexpr` members and
+ * end up in .rodata (XIP flash on the RP2040). With fft_storage::sram a
+ * mutable copy is placed in .data, which the C runtime copies to SRAM at
+ * boot, so lookups avoid XIP cache misses at the cost of RAM.
+ *
+ * C code reaches the plans through the entry points in fft_plan.h.
+ *
+ * Internal to src/fft/.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef FFT_PLAN_HPP
+#define FFT_PLAN_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief Where a plan's tables live.
+ */
+enum class fft_storage {
+    flash,  ///< .rodata, read through the XIP cache on the device
+    sram,   ///< .data, copied to SRAM at boot
+};
+
+namespace fft_detail {
+
+constexpr double half_pi = 1.57079632679489661923;
+
+/// sin(x) for |x| <= π/4 by Taylor series (terms beyond x^25 are negligible)
+constexpr double sin_series(double x) {
+    double term = x;
+    double sum = x;
+    for (int i = 1; i <= 12; i++) {
+        term *= -x * x / ((2.0 * i) * (2.0 * i + 1.0));
+        sum += term;
+    }
+    return sum;
+}
+
+/// cos(x) for |x| <= π/4 by Taylor series
+constexpr double cos_series(double x) {
+    double term = 1.0;
+    double sum = 1.0;
+    for (int i = 1; i <= 12; i++) {
+        term *= -x * x / ((2.0 * i - 1.0) * (2.0 * i));
+        sum += term;
+    }
+    return sum;
+}
+
+/**
+ * @brief cos and sin of 2πk/n, reduced exactly to the first octant.
+ *
+ * The reduction works on the integers k and n, so no error enters before
+ * the series.
+ */
+constexpr void unit_root(std::size_t k, std::size_t n, double& c, double& s) {
+    std::size_t k4 = 4 * (k % n);
+    std::size_t quadrant = k4 / n;
+    std::size_t rem = k4 % n;  // Angle within the quadrant: (π/2)·rem/n
+
+    double qc = 0.0;
+    double qs = 0.0;
+    if (2 * rem <= n) {
+        double x = half_pi * static_cast<double>(rem) / static_cast<double>(n);
+        qc = cos_series(x);
+        qs = sin_series(x);
+    } else {
+        double x = half_pi * static_cast<double>(n - rem) / static_cast<double>(n);
+        qc = sin_series(x);
+        qs = cos_series(x);
+    }
+
+    switch (quadrant) {
+        case 0: c = qc; s = qs; break;
+        case 1: c = -qs; s = qc; break;
+        case 2: c = -qc; s = -qs; break;
+        default: c = qs; s = -qc; break;
+    }
+}
+
+constexpr std::size_t log2_exact(std::size_t n) {
+    std::size_t bits = 0;
+    while ((std::size_t{1} << bits) < n) {
+        bits++;
+    }
+    return bits;
+}
+
+constexpr std::size_t reverse_bits(std::size_t i, std::size_t bits) {
+    std::size_t r = 0;
+    for (std::size_t b = 0; b < bits; b++) {
+        r = (r << 1) | ((i >> b) & 1u);
+    }
+    return r;
+}
+
+/// Number of pairs i < rev(i), i.e. swaps the permutation needs
+constexpr std::size_t swap_count(std::size_t n) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        if (i < reverse_bits(i, log2_exact(n))) {
+            count++;
+        }
+    }
+    return count;
+}
+
+}  // namespace fft_detail
+
+/**
+ * @brief FFT of a fixed power-of-two size N on floating-point data T.
+ */
+template <std::size_t N, typename T = float, fft_storage Storage = fft_storage::flash>
+class fft_plan {
+    static_assert(N >= 8 && (N & (N - 1)) == 0, "fft_plan size must be a power of two >= 8");
+    static_assert(N <= 65536, "fft_plan swap indices are 16-bit");
+    static_assert(std::is_floating_point<T>::value, "fft_plan works on float or double data");
+
+public:
+    static constexpr std::size_t size = N;
+    static constexpr std::size_t log2_size = fft_detail::log2_exact(N);
+
+    /// W_N^k = cos - j·sin
+    struct twiddle {
+        T cos;
+        T sin;
+    };
+
+    /// Radix-4 indexes up to 3(N/4 - 1); radix-2 and the split step use k < N/2
+    static constexpr std::size_t num_twiddles = 3 * N / 4;
+    static constexpr std::size_t num_swaps = fft_detail::swap_count(N);
+
+    using twiddle_table = std::array<twiddle, num_twiddles>;
+    using swap_table = std::array<std::array<std::uint16_t, 2>, num_swaps>;
+
+    static constexpr twiddle_table rom_twiddles = [] {
+        twiddle_table table{};
+        for (std::size_t k = 0; k < num_twiddles; k++) {
+            double c = 0.0;
+            double s = 0.0;
+            fft_detail::unit_root(k, N, c, s);
+            table[k] = {static_cast<T>(c), static_cast<T>(s)};
+        }
+        return table;
+    }();
+
+    static constexpr swap_table rom_swaps = [] {
+        swap_table table{};
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < N; i++) {
+            std::size_t j = fft_detail::reverse_bits(i, log2_size);
+            if (i < j) {
+                table[count++] = {static_cast<std::uint16_t>(i), static_cast<std::uint16_t>(j)};
+            }
+        }
+        return table;
+    }();
+
+    /**
+     * @brief In-place radix-2 FFT of N complex points.
+     */
+    static void forward(T* real, T* imag) {
+        permute(real, imag);
+        const twiddle* tw = twiddles();
+
+        for (std::size_t m = 2; m <= N; m <<= 1) {
+            std::size_t half = m >> 1;
+            std::size_t step = N / m;
+
+            for (std::size_t j = 0; j < half; j++) {
+                T w_cos = tw[j * step].cos;
+                T w_sin = tw[j * step].sin;
+
+                for (std::size_t t = j; t < N; t += m) {
+                    std::size_t u = t + half;
+
+                    T t_real = w_cos * real[u] + w_sin * imag[u];
+                    T t_imag = w_cos * imag[u] - w_sin * real[u];
+
+                    real[u] = real[t] - t_real;
+                    imag[u] = imag[t] - t_imag;
+                    real[t] += t_real;
+                    imag[t] += t_imag;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief In-place radix-4 FFT of N complex points.
+     *
+     * After bit reversal, the quarters of each group hold the sub-DFTs of
+     * the input decimated by 4 in the order S0, S2, S1, S3 (offsets 0, L,
+     * 2L, 3L), and the butterfly is
+     *   Y[j + qL] = Σ_r (-j)^(rq) · W_m^(rj) · S_r[j]   for q, r = 0..3.
+     */
+    static void forward_radix4(T* real, T* imag) {
+        permute(real, imag);
+        const twiddle* tw = twiddles();
+
+        std::size_t m = 4;
+        if (log2_size % 2 != 0) {
+            // One radix-2 stage (all twiddles are 1) leaves an even number of stages
+            for (std::size_t t = 0; t < N; t += 2) {
+                T u_real = real[t];
+                T u_imag = imag[t];
+                real[t] = u_real + real[t + 1];
+                imag[t] = u_imag + imag[t + 1];
+                real[t + 1] = u_real - real[t + 1];
+                imag[t + 1] = u_imag - imag[t + 1];
+            }
+            m = 8;
+        }
+
+        for (; m <= N; m <<= 2) {
+            std::size_t quarter = m >> 2;
+            std::size_t step = N / m;
+
+            for (std::size_t j = 0; j < quarter; j++) {
+                const twiddle& w1 = tw[j * step];
+                const twiddle& w2 = tw[2 * j * step];
+                const twiddle& w3 = tw[3 * j * step];
+
+                for (std::size_t t = j; t < N; t += m) {
+                    std::size_t i0 = t;
+                    std::size_t i2 = t + quarter;  // S2
+                    std::size_t i1 = i2 + quarter; // S1
+                    std::size_t i3 = i1 + quarter; // S3
+
+                    T a_real = real[i0];
+                    T a_imag = imag[i0];
+                    T b_real = w1.cos * real[i1] + w1.sin * imag[i1];
+                    T b_imag = w1.cos * imag[i1] - w1.sin * real[i1];
+                    T c_real = w2.cos * real[i2] + w2.sin * imag[i2];
+                    T c_imag = w2.cos * imag[i2] - w2.sin * real[i2];
+                    T d_real = w3.cos * real[i3] + w3.sin * imag[i3];
+                    T d_imag = w3.cos * imag[i3] - w3.sin * real[i3];
+
+                    T t0_real = a_real + c_real;
+                    T t0_imag = a_imag + c_imag;
+                    T t1_real = a_real - c_real;
+                    T t1_imag = a_imag - c_imag;
+                    T t2_real = b_real + d_real;
+                    T t2_imag = b_imag + d_imag;
+                    T t3_real = b_real - d_real;
+                    T t3_imag = b_imag - d_imag;
+
+                    // Y1 = t1 - j·t3, Y3 = t1 + j·t3
+                    real[t] = t0_real + t2_real;
+                    imag[t] = t0_imag + t2_imag;
+                    real[t + quarter] = t1_real + t3_imag;
+                    imag[t + quarter] = t1_imag - t3_real;
+                    real[t + 2 * quarter] = t0_real - t2_real;
+                    imag[t + 2 * quarter] = t0_imag - t2_imag;
+                    real[t + 3 * quarter] = t1_real - t3_imag;
+                    imag[t + 3 * quarter] = t1_imag + t3_real;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief FFT of N real samples, in place.
+     *
+     * Input: real[0..N). Output: bins 0..N/2 in real[] and imag[] (both
+     * arrays need N entries; the input of imag[] is ignored). The even and
+     * odd samples are packed as z = x_even + j·x_odd and transformed with
+     * the N/2-point plan; then, with A = Z[k] and B = conj(Z[N/2-k]),
+     *   E = (A + B) / 2,  O = -j·(A - B) / 2,
+     *   X[k] = E + W_N^k·O,  X[N/2-k] = conj(E - W_N^k·O).
+     */
+    static void forward_real(T* real, T* imag) {
+        constexpr std::size_t half = N / 2;
+
+        for (std::size_t n = 0; n < half; n++) {
+            imag[n] = real[2 * n + 1];
+            real[n] = real[2 * n];  // 2n >= n, so nothing is overwritten early
+        }
+        fft_plan<half, T, Storage>::forward(real, imag);
+
+        const twiddle* tw = twiddles();
+        T z0_real = real[0];
+        T z0_imag = imag[0];
+        real[0] = z0_real + z0_imag;
+        imag[0] = 0;
+        real[half] = z0_real - z0_imag;
+        imag[half] = 0;
+
+        for (std::size_t k = 1; k <= half / 2; k++) {
+            std::size_t l = half - k;
+            T a_real = real[k];
+            T a_imag = imag[k];
+            T b_real = real[l];
+            T b_imag = -imag[l];
+
+            T e_real = (a_real + b_real) / 2;
+            T e_imag = (a_imag + b_imag) / 2;
+            T o_real = (a_imag - b_imag) / 2;
+            T o_imag = -(a_real - b_real) / 2;
+
+            // W·O with W = cos - j·sin
+            T wo_real = tw[k].cos * o_real + tw[k].sin * o_imag;
+            T wo_imag = tw[k].cos * o_imag - tw[k].sin * o_real;
+
+            real[k] = e_real + wo_real;
+            imag[k] = e_imag + wo_imag;
+            real[l] = e_real - wo_real;
+            imag[l] = -(e_imag - wo_imag);
+        }
+    }
+
+private:
+    static inline twiddle_table ram_twiddles = rom_twiddles;
+    static inline swap_table ram_swaps = rom_swaps;
+
+    static const twiddle* twiddles() {
+        if constexpr (Storage == fft_storage::sram) {
+            return ram_twiddles.data();
+        } else {
+            return rom_twiddles.data();
+        }
+    }
+
+    static const swap_table& swaps() {
+        if constexpr (Storage == fft_storage::sram) {
+            return ram_swaps;
+        } else {
+            return rom_swaps;
+        }
+    }
+
+    static void permute(T* real, T* imag) {
+        for (const auto& pair : swaps()) {
+            T temp = real[pair[0]];
+            real[pair[0]] = real[pair[1]];
+            real[pair[1]] = temp;
+
+            temp = imag[pair[0]];
+            imag[pair[0]] = imag[pair[1]];
+            imag[pair[1]] = temp;
+        }
+    }
+};
+
+#endif  // FFT_PLAN_HPP
@@ -0,0 +1,212 @@
+/**
+ * @file fixed_point.c
+ * @brief Q15 and Q31 radix-2 FFT kernels (see fft_fixed.h).
+ *
+ * Same Cooley–Tukey decimation-in-time structure as fft_radix2() in
+ * benchmark.c, with the butterfly loops ordered twiddle-first: each twiddle
+ * is loaded from the ROM table once per stage and applied to every group,
+ * so there is no twiddle recurrence and no trigonometry at run time.
+ *
+ * With W = cos(θ) - j·sin(θ), the butterfly on (x[t], x[u]) is
+ *   T    = W · x[u]
+ *   x[t] = (x[t] + T) >> shift
+ *   x[u] = (x[t] - T) >> shift
+ * where shift is 0 or 1 for the stage, both rounded to nearest.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <stdbool.h>
+#include "fft_fixed.h"
+#include "twiddle_table.h"
+
+/// Block floating point: scale a stage once any magnitude reaches this
+#define Q15_GUARD_LIMIT (1 << 13)
+#define Q31_GUARD_LIMIT (1 << 29)
+
+static inline int16_t sat_q15(int32_t v) {
+    if (v > INT16_MAX) {
+        return INT16_MAX;
+    }
+    if (v < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return (int16_t)v;
+}
+
+static inline int32_t sat_q31(int64_t v) {
+    if (v > INT32_MAX) {
+        return INT32_MAX;
+    }
+    if (v < INT32_MIN) {
+        return INT32_MIN;
+    }
+    return (int32_t)v;
+}
+
+/**
+ * @brief Q15 butterfly on (x[t], x[u]) with twiddle (w_cos, w_sin).
+ */
+static inline void butterfly_q15(int16_t* real, int16_t* imag, int t, int u, int32_t w_cos,
+                                 int32_t w_sin, int shift) {
+    // |w| <= 32767, so neither sum of products can overflow
+    int32_t t_real = (w_cos * real[u] + w_sin * imag[u] + (1 << 14)) >> 15;
+    int32_t t_imag = (w_cos * imag[u] - w_sin * real[u] + (1 << 14)) >> 15;
+
+    int32_t u_real = real[t];
+    int32_t u_imag = imag[t];
+
+    real[t] = sat_q15((u_real + t_real + shift) >> shift);
+    imag[t] = sat_q15((u_imag + t_imag + shift) >> shift);
+    real[u] = sat_q15((u_real - t_real + shift) >> shift);
+    imag[u] = sat_q15((u_imag - t_imag + shift) >> shift);
+}
+
+/**
+ * @brief Swap x[i] with x[rev(i)] for i in [first, last) where i < rev(i).
+ *
+ * Each swapped pair belongs to the range holding its smaller index, so
+ * disjoint ranges touch disjoint elements.
+ */
+void fft_q15_bit_reverse_range(int16_t* real, int16_t* imag, int n, int first, int last) {
+    // j = rev(first), then the same reversed increment as the full loop
+    int j = 0;
+    for (int bit = 1, rbit = n >> 1; bit < n; bit <<= 1, rbit >>= 1) {
+        if (first & bit) {
+            j |= rbit;
+        }
+    }
+    for (int i = first; i < last; i++) {
+        if (i < j) {
+            int16_t temp = real[i];
+            real[i] = real[j];
+            real[j] = temp;
+
+            temp = imag[i];
+            imag[i] = imag[j];
+            imag[j] = temp;
+        }
+        int m = n >> 1;
+        while (j >= m && m > 0) {
+            j -= m;
+            m >>= 1;
+        }
+        j += m;
+    }
+}
+
+static void bit_reverse_q31(int32_t* real, int32_t* imag, int n) {
+    int j = 0;
+    for (int i = 0; i < n; i++) {
+        if (i < j) {
+            int32_t temp = real[i];
+            real[i] = real[j];
+            real[j] = temp;
+
+            temp = imag[i];
+            imag[i] = imag[j];
+            imag[j] = temp;
+        }
+        int m = n >> 1;
+        while (j >= m && m > 0) {
+            j -= m;
+            m >>= 1;
+        }
+        j += m;
+    }
+}
+
+/**
+ * @brief Whether the data lacks two guard bits (OR of the magnitudes).
+ */
+static bool q15_needs_scaling(const int16_t* real, const int16_t* imag, int n) {
+    int32_t bits = 0;
+    for (int i = 0; i < n; i++) {
+        bits |= real[i] ^ (real[i] >> 15);
+        bits |= imag[i] ^ (imag[i] >> 15);
+    }
+    return bits >= Q15_GUARD_LIMIT;
+}
+
+static bool q31_needs_scaling(const int32_t* real, const int32_t* imag, int n) {
+    int32_t bits = 0;
+    for (int i = 0; i < n; i++) {
+        bits |= real[i] ^ (real[i] >> 31);
+        bits |= imag[i] ^ (imag[i] >> 31);
+    }
+    return bits >= Q31_GUARD_LIMIT;
+}
+
+int fft_q15(int16_t* real, int16_t* imag, int n, fft_scale_t scale) {
+    fft_q15_bit_reverse_range(real, imag, n, 0, n);
+
+    int total_shift = 0;
+    for (int m = 2; m <= n; m <<= 1) {
+        int half = m >> 1;
+        int step = FFT_TWIDDLE_N / m;
+        int shift = scale == FFT_SCALE_STAGE ||
+                    (scale == FFT_SCALE_BLOCK && q15_needs_scaling(real, imag, n));
+        total_shift += shift;
+
+        for (int j = 0; j < half; j++) {
+            int32_t w_cos = fft_twiddle_q15[j * step][0];
+            int32_t w_sin = fft_twiddle_q15[j * step][1];
+
+            for (int t = j; t < n; t += m) {
+                butterfly_q15(real, imag, t, t + half, w_cos, w_sin, shift);
+            }
+        }
+    }
+    return total_shift;
+}
+
+void fft_q15_stage_range(int16_t* real, int16_t* imag, int m, int first, int last) {
+    int half = m >> 1;
+    int log2_half = 0;
+    while ((1 << log2_half) < half) {
+        log2_half++;
+    }
+    int step = FFT_TWIDDLE_N / m;
+
+    // Butterfly b is pair j = b mod half of group b / half
+    for (int b = first; b < last; b++) {
+        int j = b & (half - 1);
+        int t = ((b >> log2_half) << (log2_half + 1)) + j;
+        butterfly_q15(real, imag, t, t + half, fft_twiddle_q15[j * step][0],
+                      fft_twiddle_q15[j * step][1], 1);
+    }
+}
+
+int fft_q31(int32_t* real, int32_t* imag, int n, fft_scale_t scale) {
+    bit_reverse_q31(real, imag, n);
+
+    int total_shift = 0;
+    for (int m = 2; m <= n; m <<= 1) {
+        int half = m >> 1;
+        int step = FFT_TWIDDLE_N / m;
+        int shift = scale == FFT_SCALE_STAGE ||
+                    (scale == FFT_SCALE_BLOCK && q31_needs_scaling(real, imag, n));
+        total_shift += shift;
+
+        for (int j = 0; j < half; j++) {
+            int64_t w_cos = fft_twiddle_q31[j * step][0];
+            int64_t w_sin = fft_twiddle_q31[j * step][1];
+
+            for (int t = j; t < n; t += m) {
+                int u = t + half;
+
+                int64_t t_real = (w_cos * real[u] + w_sin * imag[u] + (1LL << 30)) >> 31;
+                int64_t t_imag = (w_cos * imag[u] - w_sin * real[u] + (1LL << 30)) >> 31;
+
+                int64_t u_real = real[t];
+                int64_t u_imag = imag[t];
+
+                real[t] = sat_q31((u_real + t_real + shift) >> shift);
+                imag[t] = sat_q31((u_imag + t_imag + shift) >> shift);
+                real[u] = sat_q31((u_real - t_real + shift) >> shift);
+                imag[u] = sat_q31((u_imag - t_imag + shift) >> shift);
+            }
+        }
+    }
+    return total_shift;
+}
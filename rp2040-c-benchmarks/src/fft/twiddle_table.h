@@ -0,0 +1,1050 @@
+/**
+ * @file twiddle_table.h
+ * @brief Twiddle ROM tables for the fixed-point FFTs (generated).
+ *
+ * Generated by scripts/gen_fft_twiddles.py; do not edit. Entry k holds
+ * {cos, sin} of 2*pi*k/FFT_TWIDDLE_N, rounded and saturated.
+ *
+ * Included by src/fft/fixed_point.c only.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef FFT_TWIDDLE_TABLE_H
+#define FFT_TWIDDLE_TABLE_H
+
+#include <stdint.h>
+
+#define FFT_TWIDDLE_N 4096  ///< Largest transform the tables support
+
+static const int16_t fft_twiddle_q15[FFT_TWIDDLE_N / 2][2] = {
+    {32767, 0}, {32767, 50}, {32767, 101}, {32767, 151},
+    {32767, 201}, {32767, 251}, {32767, 302}, {32766, 352},
+    {32766, 402}, {32765, 452}, {32764, 503}, {32763, 553},
+    {32762, 603}, {32761, 653}, {32760, 704}, {32759, 754},
+    {32758, 804}, {32757, 854}, {32756, 905}, {32754, 955},
+    {32753, 1005}, {32751, 1055}, {32749, 1106}, {32748, 1156},
+    {32746, 1206}, {32744, 1256}, {32742, 1307}, {32740, 1357},
+    {32738, 1407}, {32736, 1457}, {32733, 1507}, {32731, 1558},
+    {32729, 1608}, {32726, 1658}, {32723, 1708}, {32721, 1758},
+    {32718, 1809}, {32715, 1859}, {32712, 1909}, {32709, 1959},
+    {32706, 2009}, {32703, 2060}, {32700, 2110}, {32697, 2160},
+    {32693, 2210}, {32690, 2260}, {32686, 2310}, {32683, 2360},
+    {32679, 2411}, {32675, 2461}, {32672, 2511}, {32668, 2561},
+    {32664, 2611}, {32660, 2661}, {32656, 2711}, {32651, 2761},
+    {32647, 2811}, {32643, 2861}, {32638, 2912}, {32634, 2962},
+    {32629, 3012}, {32625, 3062}, {32620, 3112}, {32615, 3162},
+    {32610, 3212}, {32605, 3262}, {32600, 3312}, {32595, 3362},
+    {32590, 3412}, {32585, 3462}, {32579, 3512}, {32574, 3562},
+    {32568, 3612}, {32563, 3662}, {32557, 3712}, {32551, 3762},
+    {32546, 3812}, {32540, 3861}, {32534, 3911}, {32528, 3961},
+    {32522, 4011}, {32515, 4061}, {32509, 4111}, {32503, 4161},
+    {32496, 4211}, {32490, 4260}, {32483, 4310}, {32477, 4360},
+    {32470, 4410}, {32463, 4460}, {32456, 4510}, {32449, 4559},
+    {32442, 4609}, {32435, 4659}, {32428, 4709}, {32421, 4758},
+    {32413, 4808}, {32406, 4858}, {32398, 4907}, {32391, 4957},
+    {32383, 5007}, {32376, 5057}, {32368, 5106}, {32360, 5156},
+    {32352, 5205}, {32344, 5255}, {32336, 5305}, {32328, 5354},
+    {32319, 5404}, {32311, 5453}, {32303, 5503}, {32294, 5553},
+    {32286, 5602}, {32277, 5652}, {32268, 5701}, {32259, 5751},
+    {32251, 5800}, {32242, 5850}, {32233, 5899}, {32224, 5948},
+    {32214, 5998}, {32205, 6047}, {32196, 6097}, {32186, 6146},
+    {32177, 6195}, {32167, 6245}, {32158, 6294}, {32148, 6343},
+    {32138, 6393}, {32129, 6442}, {32119, 6491}, {32109, 6541},
+    {32099, 6590}, {32088, 6639}, {32078, 6688}, {32068, 6737},
+    {32058, 6787}, {32047, 6836}, {32037, 6885}, {32026, 6934},
+    {32015, 6983}, {32005, 7032}, {31994, 7081}, {31983, 7130},
+    {31972, 7180}, {31961, 7229}, {31950, 7278}, {31938, 7327},
+    {31927, 7376}, {31916, 7425}, {31904, 7473}, {31893, 7522},
+    {31881, 7571}, {31870, 7620}, {31858, 7669}, {31846, 7718},
+    {31834, 7767}, {31822, 7816}, {31810, 7864}, {31798, 7913},
+    {31786, 7962}, {31774, 8011}, {31761, 8059}, {31749, 8108},
+    {31737, 8157}, {31724, 8206}, {31711, 8254}, {31699, 8303},
+    {31686, 8351}, {31673, 8400}, {31660, 8449}, {31647, 8497},
+    {31634, 8546}, {31621, 8594}, {31608, 8643}, {31594, 8691},
+    {31581, 8740}, {31568, 8788}, {31554, 8836}, {31540, 8885},
+    {31527, 8933}, {31513, 8982}, {31499, 9030}, {31485, 9078},
+    {31471, 9127}, {31457, 9175}, {31443, 9223}, {31429, 9271},
+    {31415, 9319}, {31400, 9368}, {31386, 9416}, {31372, 9464},
+    {31357, 9512}, {31342, 9560}, {31328, 9608}, {31313, 9656},
+    {31298, 9704}, {31283, 9752}, {31268, 9800}, {31253, 9848},
+    {31238, 9896}, {31223, 9944}, {31207, 9992}, {31192, 10040},
+    {31177, 10088}, {31161, 10135}, {31146, 10183}, {31130, 10231},
+    {31114, 10279}, {31098, 10326}, {31082, 10374}, {31067, 10422},
+    {31050, 10469}, {31034, 10517}, {31018, 10565}, {31002, 10612},
+    {30986, 10660}, {30969, 10707}, {30953, 10755}, {30936, 10802},
+    {30920, 10850}, {30903, 10897}, {30886, 10945}, {30869, 10992},
+    {30853, 11039}, {30836, 11087}, {30819, 11134}, {30801, 11181},
+    {30784, 11228}, {30767, 11276}, {30750, 11323}, {30732, 11370},
+    {30715, 11417}, {30697, 11464}, {30680, 11511}, {30662, 11558},
+    {30644, 11605}, {30626, 11652}, {30608, 11699}, {30590, 11746},
+    {30572, 11793}, {30554, 11840}, {30536, 11887}, {30518, 11934},
+    {30499, 11980}, {30481, 12027}, {30462, 12074}, {30444, 12121},
+    {30425, 12167}, {30407, 12214}, {30388, 12261}, {30369, 12307},
+    {30350, 12354}, {30331, 12400}, {30312, 12447}, {30293, 12493},
+    {30274, 12540}, {30254, 12586}, {30235, 12633}, {30216, 12679},
+    {30196, 12725}, {30177, 12772}, {30157, 12818}, {30137, 12864},
+    {30118, 12910}, {30098, 12957}, {30078, 13003}, {30058, 13049},
+    {30038, 13095}, {30018, 13141}, {29997, 13187}, {29977, 13233},
+    {29957, 13279}, {29936, 13325}, {29916, 13371}, {29895, 13417},
+    {29875, 13463}, {29854, 13508}, {29833, 13554}, {29813, 13600},
+    {29792, 13646}, {29771, 13691}, {29750, 13737}, {29729, 13783},
+    {29707, 13828}, {29686, 13874}, {29665, 13919}, {29643, 13965},
+    {29622, 14010}, {29600, 14056}, {29579, 14101}, {29557, 14146},
+    {29535, 14192}, {29514, 14237}, {29492, 14282}, {29470, 14327},
+    {29448, 14373}, {29426, 14418}, {29404, 14463}, {29381, 14508},
+    {29359, 14553}, {29337, 14598}, {29314, 14643}, {29292, 14688},
+    {29269, 14733}, {29247, 14778}, {29224, 14823}, {29201, 14867},
+    {29178, 14912}, {29155, 14957}, {29132, 15002}, {29109, 15046},
+    {29086, 15091}, {29063, 15136}, {29040, 15180}, {29016, 15225},
+    {28993, 15269}, {28970, 15314}, {28946, 15358}, {28922, 15402},
+    {28899, 15447}, {28875, 15491}, {28851, 15535}, {28827, 15580},
+    {28803, 15624}, {28779, 15668}, {28755, 15712}, {28731, 15756},
+    {28707, 15800}, {28683, 15844}, {28658, 15888}, {28634, 15932},
+    {28610, 15976}, {28585, 16020}, {28560, 16064}, {28536, 16108},
+    {28511, 16151}, {28486, 16195}, {28461, 16239}, {28436, 16282},
+    {28411, 16326}, {28386, 16369}, {28361, 16413}, {28336, 16456},
+    {28311, 16500}, {28285, 16543}, {28260, 16587}, {28234, 16630},
+    {28209, 16673}, {28183, 16717}, {28158, 16760}, {28132, 16803},
+    {28106, 16846}, {28080, 16889}, {28054, 16932}, {28028, 16975},
+    {28002, 17018}, {27976, 17061}, {27950, 17104}, {27924, 17147},
+    {27897, 17190}, {27871, 17233}, {27844, 17275}, {27818, 17318},
+    {27791, 17361}, {27765, 17403}, {27738, 17446}, {27711, 17488},
+    {27684, 17531}, {27657, 17573}, {27630, 17616}, {27603, 17658},
+    {27576, 17700}, {27549, 17743}, {27522, 17785}, {27494, 17827},
+    {27467, 17869}, {27440, 17911}, {27412, 17953}, {27384, 17995},
+    {27357, 18037}, {27329, 18079}, {27301, 18121}, {27273, 18163},
+    {27246, 18205}, {27218, 18247}, {27190, 18288}, {27162, 18330},
+    {27133, 18372}, {27105, 18413}, {27077, 18455}, {27049, 18496},
+    {27020, 18538}, {26992, 18579}, {26963, 18621}, {26935, 18662},
+    {26906, 18703}, {26877, 18745}, {26848, 18786}, {26820, 18827},
+    {26791, 18868}, {26762, 18909}, {26733, 18950}, {26704, 18991},
+    {26674, 19032}, {26645, 19073}, {26616, 19114}, {26586, 19155},
+    {26557, 19195}, {26528, 19236}, {26498, 19277}, {26468, 19317},
+    {26439, 19358}, {26409, 19399}, {26379, 19439}, {26349, 19479},
+    {26320, 19520}, {26290, 19560}, {26259, 19601}, {26229, 19641},
+    {26199, 19681}, {26169, 19721}, {26139, 19761}, {26108, 19801},
+    {26078, 19841}, {26048, 19881}, {26017, 19921}, {25986, 19961},
+    {25956, 20001}, {25925, 20041}, {25894, 20081}, {25863, 20120},
+    {25833, 20160}, {25802, 20200}, {25771, 20239}, {25739, 20279},
+    {25708, 20318}, {25677, 20357}, {25646, 20397}, {25615, 20436},
+    {25583, 20475}, {25552, 20515}, {25520, 20554}, {25489, 20593},
+    {25457, 20632}, {25425, 20671}, {25394, 20710}, {25362, 20749},
+    {25330, 20788}, {25298, 20827}, {25266, 20865}, {25234, 20904},
+    {25202, 20943}, {25170, 20981}, {25138, 21020}, {25105, 21059},
+    {25073, 21097}, {25041, 21136}, {25008, 21174}, {24976, 21212},
+    {24943, 21251}, {24910, 21289}, {24878, 21327}, {24845, 21365},
+    {24812, 21403}, {24779, 21441}, {24746, 21479}, {24713, 21517},
+    {24680, 21555}, {24647, 21593}, {24614, 21631}, {24581, 21668},
+    {24548, 21706}, {24514, 21744}, {24481, 21781}, {24448, 21819},
+    {24414, 21856}, {24380, 21894}, {24347, 21931}, {24313, 21968},
+    {24279, 22006}, {24246, 22043}, {24212, 22080}, {24178, 22117},
+    {24144, 22154}, {24110, 22191}, {24076, 22228}, {24042, 22265},
+    {24008, 22302}, {23973, 22339}, {23939, 22375}, {23905, 22412},
+    {23870, 22449}, {23836, 22485}, {23801, 22522}, {23767, 22558},
+    {23732, 22595}, {23697, 22631}, {23663, 22668}, {23628, 22704},
+    {23593, 22740}, {23558, 22776}, {23523, 22812}, {23488, 22848},
+    {23453, 22884}, {23418, 22920}, {23383, 22956}, {23348, 22992},
+    {23312, 23028}, {23277, 23064}, {23241, 23099}, {23206, 23135},
+    {23170, 23170}, {23135, 23206}, {23099, 23241}, {23064, 23277},
+    {23028, 23312}, {22992, 23348}, {22956, 23383}, {22920, 23418},
+    {22884, 23453}, {22848, 23488}, {22812, 23523}, {22776, 23558},
+    {22740, 23593}, {22704, 23628}, {22668, 23663}, {22631, 23697},
+    {22595, 23732}, {22558, 23767}, {22522, 23801}, {22485, 23836},
+    {22449, 23870}, {22412, 23905}, {22375, 23939}, {22339, 23973},
+    {22302, 24008}, {22265, 24042}, {22228, 24076}, {22191, 24110},
+    {22154, 24144}, {22117, 24178}, {22080, 24212}, {22043, 24246},
+    {22006, 24279}, {21968, 24313}, {21931, 24347}, {21894, 24380},
+    {21856, 24414}, {21819, 24448}, {21781, 24481}, {21744, 24514},
+    {21706, 24548}, {21668, 24581}, {21631, 24614}, {21593, 24647},
+    {21555, 24680}, {21517, 24713}, {21479, 24746}, {21441, 24779},
+    {21403, 24812}, {21365, 24845}, {21327, 24878}, {21289, 24910},
+    {21251, 24943}, {21212, 24976}, {21174, 25008}, {21136, 25041},
+    {21097, 25073}, {21059, 25105}, {21020, 25138}, {20981, 25170},
+    {20943, 25202}, {20904, 25234}, {20865, 25266}, {20827, 25298},
+    {20788, 25330}, {20749, 25362}, {20710, 25394}, {20671, 25425},
+    {20632, 25457}, {20593, 25489}, {20554, 25520}, {20515, 25552},
+    {20475, 25583}, {20436, 25615}, {20397, 25646}, {20357, 25677},
+    {20318, 25708}, {20279, 25739}, {20239, 25771}, {20200, 25802},
+    {20160, 25833}, {20120, 25863}, {20081, 25894}, {20041, 25925},
+    {20001, 25956}, {19961, 25986}, {19921, 26017}, {19881, 26048},
+    {19841, 26078}, {19801, 26108}, {19761, 26139}, {19721, 26169},
+    {19681, 26199}, {19641, 26229}, {19601, 26259}, {19560, 26290},
+    {19520, 26320}, {19479, 26349}, {19439, 26379}, {19399, 26409},
+    {19358, 26439}, {19317, 26468}, {19277, 26498}, {19236, 26528},
+    {19195, 26557}, {19155, 26586}, {19114, 26616}, {19073, 26645},
+    {19032, 26674}, {18991, 26704}, {18950, 26733}, {18909, 26762},
+    {18868, 26791}, {18827, 26820}, {18786, 26848}, {18745, 26877},
+    {18703, 26906}, {18662, 26935}, {18621, 26963}, {18579, 26992},
+    {18538, 27020}, {18496, 27049}, {18455, 27077}, {18413, 27105},
+    {18372, 27133}, {18330, 27162}, {18288, 27190}, {18247, 27218},
+    {18205, 27246}, {18163, 27273}, {18121, 27301}, {18079, 27329},
+    {18037, 27357}, {17995, 27384}, {17953, 27412}, {17911, 27440},
+    {17869, 27467}, {17827, 27494}, {17785, 27522}, {17743, 27549},
+    {17700, 27576}, {17658, 27603}, {17616, 27630}, {17573, 27657},
+    {17531, 27684}, {17488, 27711}, {17446, 27738}, {17403, 27765},
+    {17361, 27791}, {17318, 27818}, {17275, 27844}, {17233, 27871},
+    {17190, 27897}, {17147, 27924}, {17104, 27950}, {17061, 27976},
+    {17018, 28002}, {16975, 28028}, {16932, 28054}, {16889, 28080},
+    {16846, 28106}, {16803, 28132}, {16760, 28158}, {16717, 28183},
+    {16673, 28209}, {16630, 28234}, {16587, 28260}, {16543, 28285},
+    {16500, 28311}, {16456, 28336}, {16413, 28361}, {16369, 28386},
+    {16326, 28411}, {16282, 28436}, {16239, 28461}, {16195, 28486},
+    {16151, 28511}, {16108, 28536}, {16064, 28560}, {16020, 28585},
+    {15976, 28610}, {15932, 28634}, {15888, 28658}, {15844, 28683},
+    {15800, 28707}, {15756, 28731}, {15712, 28755}, {15668, 28779},
+    {15624, 28803}, {15580, 28827}, {15535, 28851}, {15491, 28875},
+    {15447, 28899}, {15402, 28922}, {15358, 28946}, {15314, 28970},
+    {15269, 28993}, {15225, 29016}, {15180, 29040}, {15136, 29063},
+    {15091, 29086}, {15046, 29109}, {15002, 29132}, {14957, 29155},
+    {14912, 29178}, {14867, 29201}, {14823, 29224}, {14778, 29247},
+    {14733, 29269}, {14688, 29292}, {14643, 29314}, {14598, 29337},
+    {14553, 29359}, {14508, 29381}, {14463, 29404}, {14418, 29426},
+    {14373, 29448}, {14327, 29470}, {14282, 29492}, {14237, 29514},
+    {14192, 29535}, {14146, 29557}, {14101, 29579}, {14056, 29600},
+    {14010, 29622}, {13965, 29643}, {13919, 29665}, {13874, 29686},
+    {13828, 29707}, {13783, 29729}, {13737, 29750}, {13691, 29771},
+    {13646, 29792}, {13600, 29813}, {13554, 29833}, {13508, 29854},
+    {13463, 29875}, {13417, 29895}, {13371, 29916}, {13325, 29936},
+    {13279, 29957}, {13233, 29977}, {13187, 29997}, {13141, 30018},
+    {13095, 30038}, {13049, 30058}, {13003, 30078}, {12957, 30098},
+    {12910, 30118}, {12864, 30137}, {12818, 30157}, {12772, 30177},
+    {12725, 30196}, {12679, 30216}, {12633, 30235}, {12586, 30254},
+    {12540, 30274}, {12493, 30293}, {12447, 30312}, {12400, 30331},
+    {12354, 30350}, {12307, 30369}, {12261, 30388}, {12214, 30407},
+    {12167, 30425}, {12121, 30444}, {12074, 30462}, {12027, 30481},
+    {11980, 30499}, {11934, 30518}, {11887, 30536}, {11840, 30554},
+    {11793, 30572}, {11746, 30590}, {11699, 30608}, {11652, 30626},
+    {11605, 30644}, {11558, 30662}, {11511, 30680}, {11464, 30697},
+    {11417, 30715}, {11370, 30732}, {11323, 30750}, {11276, 30767},
+    {11228, 30784}, {11181, 30801}, {11134, 30819}, {11087, 30836},
+    {11039, 30853}, {10992, 30869}, {10945, 30886}, {10897, 30903},
+    {10850, 30920}, {10802, 30936}, {10755, 30953}, {10707, 30969},
+    {10660, 30986}, {10612, 31002}, {10565, 31018}, {10517, 31034},
+    {10469, 31050}, {10422, 31067}, {10374, 31082}, {10326, 31098},
+    {10279, 31114}, {10231, 31130}, {10183, 31146}, {10135, 31161},
+    {10088, 31177}, {10040, 31192}, {9992, 31207}, {9944, 31223},
+    {9896, 31238}, {9848, 31253}, {9800, 31268}, {9752, 31283},
+    {9704, 31298}, {9656, 31313}, {9608, 31328}, {9560, 31342},
+    {9512, 31357}, {9464, 31372}, {9416, 31386}, {9368, 31400},
+    {9319, 31415}, {9271, 31429}, {9223, 31443}, {9175, 31457},
+    {9127, 31471}, {9078, 31485}, {9030, 31499}, {8982, 31513},
+    {8933, 31527}, {8885, 31540}, {8836, 31554}, {8788, 31568},
+    {8740, 31581}, {8691, 31594}, {8643, 31608}, {8594, 31621},
+    {8546, 31634}, {8497, 31647}, {8449, 31660}, {8400, 31673},
+    {8351, 31686}, {8303, 31699}, {8254, 31711}, {8206, 31724},
+    {8157, 31737}, {8108, 31749}, {8059, 31761}, {8011, 31774},
+    {7962, 31786}, {7913, 31798}, {7864, 31810}, {7816, 31822},
+    {7767, 31834}, {7718, 31846}, {7669, 31858}, {7620, 31870},
+    {7571, 31881}, {7522, 31893}, {7473, 31904}, {7425, 31916},
+    {7376, 31927}, {7327, 31938}, {7278, 31950}, {7229, 31961},
+    {7180, 31972}, {7130, 31983}, {7081, 31994}, {7032, 32005},
+    {6983, 32015}, {6934, 32026}, {6885, 32037}, {6836, 32047},
+    {6787, 32058}, {6737, 32068}, {6688, 32078}, {6639, 32088},
+    {6590, 32099}, {6541, 32109}, {6491, 32119}, {6442, 32129},
+    {6393, 32138}, {6343, 32148}, {6294, 32158}, {6245, 32167},
+    {6195, 32177}, {6146, 32186}, {6097, 32196}, {6047, 32205},
+    {5998, 32214}, {5948, 32224}, {5899, 32233}, {5850, 32242},
+    {5800, 32251}, {5751, 32259}, {5701, 32268}, {5652, 32277},
+    {5602, 32286}, {5553, 32294}, {5503, 32303}, {5453, 32311},
+    {5404, 32319}, {5354, 32328}, {5305, 32336}, {5255, 32344},
+    {5205, 32352}, {5156, 32360}, {5106, 32368}, {5057, 32376},
+    {5007, 32383}, {4957, 32391}, {4907, 32398}, {4858, 32406},
+    {4808, 32413}, {4758, 32421}, {4709, 32428}, {4659, 32435},
+    {4609, 32442}, {4559, 32449}, {4510, 32456}, {4460, 32463},
+    {4410, 32470}, {4360, 32477}, {4310, 32483}, {4260, 32490},
+    {4211, 32496}, {4161, 32503}, {4111, 32509}, {4061, 32515},
+    {4011, 32522}, {3961, 32528}, {3911, 32534}, {3861, 32540},
+    {3812, 32546}, {3762, 32551}, {3712, 32557}, {3662, 32563},
+    {3612, 32568}, {3562, 32574}, {3512, 32579}, {3462, 32585},
+    {3412, 32590}, {3362, 32595}, {3312, 32600}, {3262, 32605},
+    {3212, 32610}, {3162, 32615}, {3112, 32620}, {3062, 32625},
+    {3012, 32629}, {2962, 32634}, {2912, 32638}, {2861, 32643},
+    {2811, 32647}, {2761, 32651}, {2711, 32656}, {2661, 32660},
+    {2611, 32664}, {2561, 32668}, {2511, 32672}, {2461, 32675},
+    {2411, 32679}, {2360, 32683}, {2310, 32686}, {2260, 32690},
+    {2210, 32693}, {2160, 32697}, {2110, 32700}, {2060, 32703},
+    {2009, 32706}, {1959, 32709}, {1909, 32712}, {1859, 32715},
+    {1809, 32718}, {1758, 32721}, {1708, 32723}, {1658, 32726},
+    {1608, 32729}, {1558, 32731}, {1507, 32733}, {1457, 32736},
+    {1407, 32738}, {1357, 32740}, {1307, 32742}, {1256, 32744},
+    {1206, 32746}, {1156, 32748}, {1106, 32749}, {1055, 32751},
+    {1005, 32753}, {955, 32754}, {905, 32756}, {854, 32757},
+    {804, 32758}, {754, 32759}, {704, 32760}, {653, 32761},
+    {603, 32762}, {553, 32763}, {503, 32764}, {452, 32765},
+    {402, 32766}, {352, 32766}, {302, 32767}, {251, 32767},
+    {201, 32767}, {151, 32767}, {101, 32767}, {50, 32767},
+    {0, 32767}, {-50, 32767}, {-101, 32767}, {-151, 32767},
+    {-201, 32767}, {-251, 32767}, {-302, 32767}, {-352, 32766},
+    {-402, 32766}, {-452, 32765}, {-503, 32764}, {-553, 32763},
+    {-603, 32762}, {-653, 32761}, {-704, 32760}, {-754, 32759},
+    {-804, 32758}, {-854, 32757}, {-905, 32756}, {-955, 32754},
+    {-1005, 32753}, {-1055, 32751}, {-1106, 32749}, {-1156, 32748},
+    {-1206, 32746}, {-1256, 32744}, {-1307, 32742}, {-1357, 32740},
+    {-1407, 32738}, {-1457, 32736}, {-1507, 32733}, {-1558, 32731},
+    {-1608, 32729}, {-1658, 32726}, {-1708, 32723}, {-1758, 32721},
+    {-1809, 32718}, {-1859, 32715}, {-1909, 32712}, {-1959, 32709},
+    {-2009, 32706}, {-2060, 32703}, {-2110, 32700}, {-2160, 32697},
+    {-2210, 32693}, {-2260, 32690}, {-2310, 32686}, {-2360, 32683},
+    {-2411, 32679}, {-2461, 32675}, {-2511, 32672}, {-2561, 32668},
+    {-2611, 32664}, {-2661, 32660}, {-2711, 32656}, {-2761, 32651},
+    {-2811, 32647}, {-2861, 32643}, {-2912, 32638}, {-2962, 32634},
+    {-3012, 32629}, {-3062, 32625}, {-3112, 32620}, {-3162, 32615},
+    {-3212, 32610}, {-3262, 32605}, {-3312, 32600}, {-3362, 32595},
+    {-3412, 32590}, {-3462, 32585}, {-3512, 32579}, {-3562, 32574},
+    {-3612, 32568}, {-3662, 32563}, {-3712, 32557}, {-3762, 32551},
+    {-3812, 32546}, {-3861, 32540}, {-3911, 32534}, {-3961, 32528},
+    {-4011, 32522}, {-4061, 32515}, {-4111, 32509}, {-4161, 32503},
+    {-4211, 32496}, {-4260, 32490}, {-4310, 32483}, {-4360, 32477},
+    {-4410, 32470}, {-4460, 32463}, {-4510, 32456}, {-4559, 32449},
+    {-4609, 32442}, {-4659, 32435}, {-4709, 32428}, {-4758, 32421},
+    {-4808, 32413}, {-4858, 32406}, {-4907, 32398}, {-4957, 32391},
+    {-5007, 32383}, {-5057, 32376}, {-5106, 32368}, {-5156, 32360},
+    {-5205, 32352}, {-5255, 32344}, {-5305, 32336}, {-5354, 32328},
+    {-5404, 32319}, {-5453, 32311}, {-5503, 32303}, {-5553, 32294},
+    {-5602, 32286}, {-5652, 32277}, {-5701, 32268}, {-5751, 32259},
+    {-5800, 32251}, {-5850, 32242}, {-5899, 32233}, {-5948, 32224},
+    {-5998, 32214}, {-6047, 32205}, {-6097, 32196}, {-6146, 32186},
+    {-6195, 32177}, {-6245, 32167}, {-6294, 32158}, {-6343, 32148},
+    {-6393, 32138}, {-6442, 32129}, {-6491, 32119}, {-6541, 32109},
+    {-6590, 32099}, {-6639, 32088}, {-6688, 32078}, {-6737, 32068},
+    {-6787, 32058}, {-6836, 32047}, {-6885, 32037}, {-6934, 32026},
+    {-6983, 32015}, {-7032, 32005}, {-7081, 31994}, {-7130, 31983},
+    {-7180, 31972}, {-7229, 31961}, {-7278, 31950}, {-7327, 31938},
+    {-7376, 31927}, {-7425, 31916}, {-7473, 31904}, {-7522, 31893},
+    {-7571, 31881}, {-7620, 31870}, {-7669, 31858}, {-7718, 31846},
+    {-7767, 31834}, {-7816, 31822}, {-7864, 31810}, {-7913, 31798},
+    {-7962, 31786}, {-8011, 31774}, {-8059, 31761}, {-8108, 31749},
+    {-8157, 31737}, {-8206, 31724}, {-8254, 31711}, {-8303, 31699},
+    {-8351, 31686}, {-8400, 31673}, {-8449, 31660}, {-8497, 31647},
+    {-8546, 31634}, {-8594, 31621}, {-8643, 31608}, {-8691, 31594},
+    {-8740, 31581}, {-8788, 31568}, {-8836, 31554}, {-8885, 31540},
+    {-8933, 31527}, {-8982, 31513}, {-9030, 31499}, {-9078, 31485},
+    {-9127, 31471}, {-9175, 31457}, {-9223, 31443}, {-9271, 31429},
+    {-9319, 31415}, {-9368, 31400}, {-9416, 31386}, {-9464, 31372},
+    {-9512, 31357}, {-9560, 31342}, {-9608, 31328}, {-9656, 31313},
+    {-9704, 31298}, {-9752, 31283}, {-9800, 31268}, {-9848, 31253},
+    {-9896, 31238}, {-9944, 31223}, {-9992, 31207}, {-10040, 31192},
+    {-10088, 31177}, {-10135, 31161}, {-10183, 31146}, {-10231, 31130},
+    {-10279, 31114}, {-10326, 31098}, {-10374, 31082}, {-10422, 31067},
+    {-10469, 31050}, {-10517, 31034}, {-10565, 31018}, {-10612, 31002},
+    {-10660, 30986}, {-10707, 30969}, {-10755, 30953}, {-10802, 30936},
+    {-10850, 30920}, {-10897, 30903}, {-10945, 30886}, {-10992, 30869},
+    {-11039, 30853}, {-11087, 30836}, {-11134, 30819}, {-11181, 30801},
+    {-11228, 30784}, {-11276, 30767}, {-11323, 30750}, {-11370, 30732},
+    {-11417, 30715}, {-11464, 30697}, {-11511, 30680}, {-11558, 30662},
+    {-11605, 30644}, {-11652, 30626}, {-11699, 30608}, {-11746, 30590},
+    {-11793, 30572}, {-11840, 30554}, {-11887, 30536}, {-11934, 30518},
+    {-11980, 30499}, {-12027, 30481}, {-12074, 30462}, {-12121, 30444},
+    {-12167, 30425}, {-12214, 30407}, {-12261, 30388}, {-12307, 30369},
+    {-12354, 30350}, {-12400, 30331}, {-12447, 30312}, {-12493, 30293},
+    {-12540, 30274}, {-12586, 30254}, {-12633, 30235}, {-12679, 30216},
+    {-12725, 30196}, {-12772, 30177}, {-12818, 30157}, {-12864, 30137},
+    {-12910, 30118}, {-12957, 30098}, {-13003, 30078}, {-13049, 30058},
+    {-13095, 30038}, {-13141, 30018}, {-13187, 29997}, {-13233, 29977},
+    {-13279, 29957}, {-13325, 29936}, {-13371, 29916}, {-13417, 29895},
+    {-13463, 29875}, {-13508, 29854}, {-13554, 29833}, {-13600, 29813},
+    {-13646, 29792}, {-13691, 29771}, {-13737, 29750}, {-13783, 29729},
+    {-13828, 29707}, {-13874, 29686}, {-13919, 29665}, {-13965, 29643},
+    {-14010, 29622}, {-14056, 29600}, {-14101, 29579}, {-14146, 29557},
+    {-14192, 29535}, {-14237, 29514}, {-14282, 29492}, {-14327, 29470},
+    {-14373, 29448}, {-14418, 29426}, {-14463, 29404}, {-14508, 29381},
+    {-14553, 29359}, {-14598, 29337}, {-14643, 29314}, {-14688, 29292},
+    {-14733, 29269}, {-14778, 29247}, {-14823, 29224}, {-14867, 29201},
+    {-14912, 29178}, {-14957, 29155}, {-15002, 29132}, {-15046, 29109},
+    {-15091, 29086}, {-15136, 29063}, {-15180, 29040}, {-15225, 29016},
+    {-15269, 28993}, {-15314, 28970}, {-15358, 28946}, {-15402, 28922},
+    {-15447, 28899}, {-15491, 28875}, {-15535, 28851}, {-15580, 28827},
+    {-15624, 28803}, {-15668, 28779}, {-15712, 28755}, {-15756, 28731},
+    {-15800, 28707}, {-15844, 28683}, {-15888, 28658}, {-15932, 28634},
+    {-15976, 28610}, {-16020, 28585}, {-16064, 28560}, {-16108, 28536},
+    {-16151, 28511}, {-16195, 28486}, {-16239, 28461}, {-16282, 28436},
+    {-16326, 28411}, {-16369, 28386}, {-16413, 28361}, {-16456, 28336},
+    {-16500, 28311}, {-16543, 28285}, {-16587, 28260}, {-16630, 28234},
+    {-16673, 28209}, {-16717, 28183}, {-16760, 28158}, {-16803, 28132},
+    {-16846, 28106}, {-16889, 28080}, {-16932, 28054}, {-16975, 28028},
+    {-17018, 28002}, {-17061, 27976}, {-17104, 27950}, {-17147, 27924},
+    {-17190, 27897}, {-17233, 27871}, {-17275, 27844}, {-17318, 27818},
+    {-17361, 27791}, {-17403, 27765}, {-17446, 27738}, {-17488, 27711},
+    {-17531, 27684}, {-17573, 27657}, {-17616, 27630}, {-17658, 27603},
+    {-17700, 27576}, {-17743, 27549}, {-17785, 27522}, {-17827, 27494},
+    {-17869, 27467}, {-17911, 27440}, {-17953, 27412}, {-17995, 27384},
+    {-18037, 27357}, {-18079, 27329}, {-18121, 27301}, {-18163, 27273},
+    {-18205, 27246}, {-18247, 27218}, {-18288, 27190}, {-18330, 27162},
+    {-18372, 27133}, {-18413, 27105}, {-18455, 27077}, {-18496, 27049},
+    {-18538, 27020}, {-18579, 26992}, {-18621, 26963}, {-18662, 26935},
+    {-18703, 26906}, {-18745, 26877}, {-18786, 26848}, {-18827, 26820},
+    {-18868, 26791}, {-18909, 26762}, {-18950, 26733}, {-18991, 26704},
+    {-19032, 26674}, {-19073, 26645}, {-19114, 26616}, {-19155, 26586},
+    {-19195, 26557}, {-19236, 26528}, {-19277, 26498}, {-19317, 26468},
+    {-19358, 26439}, {-19399, 26409}, {-19439, 26379}, {-19479, 26349},
+    {-19520, 26320}, {-19560, 26290}, {-19601, 26259}, {-19641, 26229},
+    {-19681, 26199}, {-19721, 26169}, {-19761, 26139}, {-19801, 26108},
+    {-19841, 26078}, {-19881, 26048}, {-19921, 26017}, {-19961, 25986},
+    {-20001, 25956}, {-20041, 25925}, {-20081, 25894}, {-20120, 25863},
+    {-20160, 25833}, {-20200, 25802}, {-20239, 25771}, {-20279, 25739},
+    {-20318, 25708}, {-20357, 25677}, {-20397, 25646}, {-20436, 25615},
+    {-20475, 25583}, {-20515, 25552}, {-20554, 25520}, {-20593, 25489},
+    {-20632, 25457}, {-20671, 25425}, {-20710, 25394}, {-20749, 25362},
+    {-20788, 25330}, {-20827, 25298}, {-20865, 25266}, {-20904, 25234},
+    {-20943, 25202}, {-20981, 25170}, {-21020, 25138}, {-21059, 25105},
+    {-21097, 25073}, {-21136, 25041}, {-21174, 25008}, {-21212, 24976},
+    {-21251, 24943}, {-21289, 24910}, {-21327, 24878}, {-21365, 24845},
+    {-21403, 24812}, {-21441, 24779}, {-21479, 24746}, {-21517, 24713},
+    {-21555, 24680}, {-21593, 24647}, {-21631, 24614}, {-21668, 24581},
+    {-21706, 24548}, {-21744, 24514}, {-21781, 24481}, {-21819, 24448},
+    {-21856, 24414}, {-21894, 24380}, {-21931, 24347}, {-21968, 24313},
+    {-22006, 24279}, {-22043, 24246}, {-22080, 24212}, {-22117, 24178},
+    {-22154, 24144}, {-22191, 24110}, {-22228, 24076}, {-22265, 24042},
+    {-22302, 24008}, {-22339, 23973}, {-22375, 23939}, {-22412, 23905},
+    {-22449, 23870}, {-22485, 23836}, {-22522, 23801}, {-22558, 23767},
+    {-22595, 23732}, {-22631, 23697}, {-22668, 23663}, {-22704, 23628},
+    {-22740, 23593}, {-22776, 23558}, {-22812, 23523}, {-22848, 23488},
+    {-22884, 23453}, {-22920, 23418}, {-22956, 23383}, {-22992, 23348},
+    {-23028, 23312}, {-23064, 23277}, {-23099, 23241}, {-23135, 23206},
+    {-23170, 23170}, {-23206, 23135}, {-23241, 23099}, {-23277, 23064},
+    {-23312, 23028}, {-23348, 22992}, {-23383, 22956}, {-23418, 22920},
+    {-23453, 22884}, {-23488, 22848}, {-23523, 22812}, {-23558, 22776},
+    {-23593, 22740}, {-23628, 22704}, {-23663, 22668}, {-23697, 22631},
+    {-23732, 22595}, {-23767, 22558}, {-23801, 22522}, {-23836, 22485},
+    {-23870, 22449}, {-23905, 22412}, {-23939, 22375}, {-23973, 22339},
+    {-24008, 22302}, {-24042, 22265}, {-24076, 22228}, {-24110, 22191},
+    {-24144, 22154}, {-24178, 22117}, {-24212, 22080}, {-24246, 22043},
+    {-24279, 22006}, {-24313, 21968}, {-24347, 21931}, {-24380, 21894},
+    {-24414, 21856}, {-24448, 21819}, {-24481, 21781}, {-24514, 21744},
+    {-24548, 21706}, {-24581, 21668}, {-24614, 21631}, {-24647, 21593},
+    {-24680, 21555}, {-24713, 21517}, {-24746, 21479}, {-24779, 21441},
+    {-24812, 21403}, {-24845, 21365}, {-24878, 21327}, {-24910, 21289},
+    {-24943, 21251}, {-24976, 21212}, {-25008, 21174}, {-25041, 21136},
+    {-25073, 21097}, {-25105, 21059}, {-25138, 21020}, {-25170, 20981},
+    {-25202, 20943}, {-25234, 20904}, {-25266, 20865}, {-25298, 20827},
+    {-25330, 20788}, {-25362, 20749}, {-25394, 20710}, {-25425, 20671},
+    {-25457, 20632}, {-25489, 20593}, {-25520, 20554}, {-25552, 20515},
+    {-25583, 20475}, {-25615, 20436}, {-25646, 20397}, {-25677, 20357},
+    {-25708, 20318}, {-25739, 20279}, {-25771, 20239}, {-25802, 20200},
+    {-25833, 20160}, {-25863, 20120}, {-25894, 20081}, {-25925, 20041},
+    {-25956, 20001}, {-25986, 19961}, {-26017, 19921}, {-26048, 19881},
+    {-26078, 19841}, {-26108, 19801}, {-26139, 19761}, {-26169, 19721},
+    {-26199, 19681}, {-26229, 19641}, {-26259, 19601}, {-26290, 19560},
+    {-26320, 19520}, {-26349, 19479}, {-26379, 19439}, {-26409, 19399},
+    {-26439, 19358}, {-26468, 19317}, {-26498, 19277}, {-26528, 19236},
+    {-26557, 19195}, {-26586, 19155}, {-26616, 19114}, {-26645, 19073},
+    {-26674, 19032}, {-26704, 18991}, {-26733, 18950}, {-26762, 18909},
+    {-26791, 18868}, {-26820, 18827}, {-26848, 18786}, {-26877, 18745},
+    {-26906, 18703}, {-26935, 18662}, {-26963, 18621}, {-26992, 18579},
+    {-27020, 18538}, {-27049, 18496}, {-27077, 18455}, {-27105, 18413},
+    {-27133, 18372}, {-27162, 18330}, {-27190, 18288}, {-27218, 18247},
+    {-27246, 18205}, {-27273, 18163}, {-27301, 18121}, {-27329, 18079},
+    {-27357, 18037}, {-27384, 17995}, {-27412, 17953}, {-27440, 17911},
+    {-27467, 17869}, {-27494, 17827}, {-27522, 17785}, {-27549, 17743},
+    {-27576, 17700}, {-27603, 17658}, {-27630, 17616}, {-27657, 17573},
+    {-27684, 17531}, {-27711, 17488}, {-27738, 17446}, {-27765, 17403},
+    {-27791, 17361}, {-27818, 17318}, {-27844, 17275}, {-27871, 17233},
+    {-27897, 17190}, {-27924, 17147}, {-27950, 17104}, {-27976, 17061},
+    {-28002, 17018}, {-28028, 16975}, {-28054, 16932}, {-28080, 16889},
+    {-28106, 16846}, {-28132, 16803}, {-28158, 16760}, {-28183, 16717},
+    {-28209, 16673}, {-28234, 16630}, {-28260, 16587}, {-28285, 16543},
+    {-28311, 16500}, {-28336, 16456}, {-28361, 16413}, {-28386, 16369},
+    {-28411, 16326}, {-28436, 16282}, {-28461, 16239}, {-28486, 16195},
+    {-28511, 16151}, {-28536, 16108}, {-28560, 16064}, {-28585, 16020},
+    {-28610, 15976}, {-28634, 15932}, {-28658, 15888}, {-28683, 15844},
+    {-28707, 15800}, {-28731, 15756}, {-28755, 15712}, {-28779, 15668},
+    {-28803, 15624}, {-28827, 15580}, {-28851, 15535}, {-28875, 15491},
+    {-28899, 15447}, {-28922, 15402}, {-28946, 15358}, {-28970, 15314},
+    {-28993, 15269}, {-29016, 15225}, {-29040, 15180}, {-29063, 15136},
+    {-29086, 15091}, {-29109, 15046}, {-29132, 15002}, {-29155, 14957},
+    {-29178, 14912}, {-29201, 14867}, {-29224, 14823}, {-29247, 14778},
+    {-29269, 14733}, {-29292, 14688}, {-29314, 14643}, {-29337, 14598},
+    {-29359, 14553}, {-29381, 14508}, {-29404, 14463}, {-29426, 14418},
+    {-29448, 14373}, {-29470, 14327}, {-29492, 14282}, {-29514, 14237},
+    {-29535, 14192}, {-29557, 14146}, {-29579, 14101}, {-29600, 14056},
+    {-29622, 14010}, {-29643, 13965}, {-29665, 13919}, {-29686, 13874},
+    {-29707, 13828}, {-29729, 13783}, {-29750, 13737}, {-29771, 13691},
+    {-29792, 13646}, {-29813, 13600}, {-29833, 13554}, {-29854, 13508},
+    {-29875, 13463}, {-29895, 13417}, {-29916, 13371}, {-29936, 13325},
+    {-29957, 13279}, {-29977, 13233}, {-29997, 13187}, {-30018, 13141},
+    {-30038, 13095}, {-30058, 13049}, {-30078, 13003}, {-30098, 12957},
+    {-30118, 12910}, {-30137, 12864}, {-30157, 12818}, {-30177, 12772},
+    {-30196, 12725}, {-30216, 12679}, {-30235, 12633}, {-30254, 12586},
+    {-30274, 12540}, {-30293, 12493}, {-30312, 12447}, {-30331, 12400},
+    {-30350, 12354}, {-30369, 12307}, {-30388, 12261}, {-30407, 12214},
+    {-30425, 12167}, {-30444, 12121}, {-30462, 12074}, {-30481, 12027},
+    {-30499, 11980}, {-30518, 11934}, {-30536, 11887}, {-30554, 11840},
+    {-30572, 11793}, {-30590, 11746}, {-30608, 11699}, {-30626, 11652},
+    {-30644, 11605}, {-30662, 11558}, {-30680, 11511}, {-30697, 11464},
+    {-30715, 11417}, {-30732, 11370}, {-30750, 11323}, {-30767, 11276},
+    {-30784, 11228}, {-30801, 11181}, {-30819, 11134}, {-30836, 11087},
+    {-30853, 11039}, {-30869, 10992}, {-30886, 10945}, {-30903, 10897},
+    {-30920, 10850}, {-30936, 10802}, {-30953, 10755}, {-30969, 10707},
+    {-30986, 10660}, {-31002, 10612}, {-31018, 10565}, {-31034, 10517},
+    {-31050, 10469}, {-31067, 10422}, {-31082, 10374}, {-31098, 10326},
+    {-31114, 10279}, {-31130, 10231}, {-31146, 10183}, {-31161, 10135},
+    {-31177, 10088}, {-31192, 10040}, {-31207, 9992}, {-31223, 9944},
+    {-31238, 9896}, {-31253, 9848}, {-31268, 9800}, {-31283, 9752},
+    {-31298, 9704}, {-31313, 9656}, {-31328, 9608}, {-31342, 9560},
+    {-31357, 9512}, {-31372, 9464}, {-31386, 9416}, {-31400, 9368},
+    {-31415, 9319}, {-31429, 9271}, {-31443, 9223}, {-31457, 9175},
+    {-31471, 9127}, {-31485, 9078}, {-31499, 9030}, {-31513, 8982},
+    {-31527, 8933}, {-31540, 8885}, {-31554, 8836}, {-31568, 8788},
+    {-31581, 8740}, {-31594, 8691}, {-31608, 8643}, {-31621, 8594},
+    {-31634, 8546}, {-31647, 8497}, {-31660, 8449}, {-31673, 8400},
+    {-31686, 8351}, {-31699, 8303}, {-31711, 8254}, {-31724, 8206},
+    {-31737, 8157}, {-31749, 8108}, {-31761, 8059}, {-31774, 8011},
+    {-31786, 7962}, {-31798, 7913}, {-31810, 7864}, {-31822, 7816},
+    {-31834, 7767}, {-31846, 7718}, {-31858, 7669}, {-31870, 7620},
+    {-31881, 7571}, {-31893, 7522}, {-31904, 7473}, {-31916, 7425},
+    {-31927, 7376}, {-31938, 7327}, {-31950, 7278}, {-31961, 7229},
+    {-31972, 7180}, {-31983, 7130}, {-31994, 7081}, {-32005, 7032},
+    {-32015, 6983}, {-32026, 6934}, {-32037, 6885}, {-32047, 6836},
+    {-32058, 6787}, {-32068, 6737}, {-32078, 6688}, {-32088, 6639},
+    {-32099, 6590}, {-32109, 6541}, {-32119, 6491}, {-32129, 6442},
+    {-32138, 6393}, {-32148, 6343}, {-32158, 6294}, {-32167, 6245},
+    {-32177, 6195}, {-32186, 6146}, {-32196, 6097}, {-32205, 6047},
+    {-32214, 5998}, {-32224, 5948}, {-32233, 5899}, {-32242, 5850},
+    {-32251, 5800}, {-32259, 5751}, {-32268, 5701}, {-32277, 5652},
+    {-32286, 5602}, {-32294, 5553}, {-32303, 5503}, {-32311, 5453},
+    {-32319, 5404}, {-32328, 5354}, {-32336, 5305}, {-32344, 5255},
+    {-32352, 5205}, {-32360, 5156}, {-32368, 5106}, {-32376, 5057},
+    {-32383, 5007}, {-32391, 4957}, {-32398, 4907}, {-32406, 4858},
+    {-32413, 4808}, {-32421, 4758}, {-32428, 4709}, {-32435, 4659},
+    {-32442, 4609}, {-32449, 4559}, {-32456, 4510}, {-32463, 4460},
+    {-32470, 4410}, {-32477, 4360}, {-32483, 4310}, {-32490, 4260},
+    {-32496, 4211}, {-32503, 4161}, {-32509, 4111}, {-32515, 4061},
+    {-32522, 4011}, {-32528, 3961}, {-32534, 3911}, {-32540, 3861},
+    {-32546, 3812}, {-32551, 3762}, {-32557, 3712}, {-32563, 3662},
+    {-32568, 3612}, {-32574, 3562}, {-32579, 3512}, {-32585, 3462},
+    {-32590, 3412}, {-32595, 3362}, {-32600, 3312}, {-32605, 3262},
+    {-32610, 3212}, {-32615, 3162}, {-32620, 3112}, {-32625, 3062},
+    {-32629, 3012}, {-32634, 2962}, {-32638, 2912}, {-32643, 2861},
+    {-32647, 2811}, {-32651, 2761}, {-32656, 2711}, {-32660, 2661},
+    {-32664, 2611}, {-32668, 2561}, {-32672, 2511}, {-32675, 2461},
+    {-32679, 2411}, {-32683, 2360}, {-32686, 2310}, {-32690, 2260},
+    {-32693, 2210}, {-32697, 2160}, {-32700, 2110}, {-32703, 2060},
+    {-32706, 2009}, {-32709, 1959}, {-32712, 1909}, {-32715, 1859},
+    {-32718, 1809}, {-32721, 1758}, {-32723, 1708}, {-32726, 1658},
+    {-32729, 1608}, {-32731, 1558}, {-32733, 1507}, {-32736, 1457},
+    {-32738, 1407}, {-32740, 1357}, {-32742, 1307}, {-32744, 1256},
+    {-32746, 1206}, {-32748, 1156}, {-32749, 1106}, {-32751, 1055},
+    {-32753, 1005}, {-32754, 955}, {-32756, 905}, {-32757, 854},
+    {-32758, 804}, {-32759, 754}, {-32760, 704}, {-32761, 653},
+    {-32762, 603}, {-32763, 553}, {-32764, 503}, {-32765, 452},
+    {-32766, 402}, {-32766, 352}, {-32767, 302}, {-32767, 251},
+    {-32767, 201}, {-32768, 151}, {-32768, 101}, {-32768, 50},
+};
+
+static const int32_t fft_twiddle_q31[FFT_TWIDDLE_N / 2][2] = {
+    {2147483647, 0}, {2147481121, 3294197}, {2147473542, 6588387}, {2147460908, 9882561},
+    {2147443222, 13176712}, {2147420483, 16470832}, {2147392690, 19764913}, {2147359845, 23058947},
+    {2147321946, 26352928}, {2147278995, 29646846}, {2147230991, 32940695}, {2147177934, 36234466},
+    {2147119825, 39528151}, {2147056664, 42821744}, {2146988450, 46115236}, {2146915184, 49408620},
+    {2146836866, 52701887}, {2146753497, 55995030}, {2146665076, 59288042}, {2146571603, 62580914},
+    {2146473080, 65873638}, {2146369505, 69166208}, {2146260881, 72458615}, {2146147205, 75750851},
+    {2146028480, 79042909}, {2145904705, 82334782}, {2145775880, 85626460}, {2145642006, 88917937},
+    {2145503083, 92209205}, {2145359112, 95500255}, {2145210092, 98791081}, {2145056025, 102081675},
+    {2144896910, 105372028}, {2144732748, 108662134}, {2144563539, 111951983}, {2144389283, 115241570},
+    {2144209982, 118530885}, {2144025635, 121819921}, {2143836244, 125108670}, {2143641807, 128397125},
+    {2143442326, 131685278}, {2143237802, 134973122}, {2143028234, 138260647}, {2142813624, 141547847},
+    {2142593971, 144834714}, {2142369276, 148121241}, {2142139541, 151407418}, {2141904764, 154693240},
+    {2141664948, 157978697}, {2141420092, 161263783}, {2141170197, 164548489}, {2140915264, 167832808},
+    {2140655293, 171116733}, {2140390284, 174400254}, {2140120240, 177683365}, {2139845159, 180966058},
+    {2139565043, 184248325}, {2139279892, 187530159}, {2138989708, 190811551}, {2138694490, 194092495},
+    {2138394240, 197372981}, {2138088958, 200653003}, {2137778644, 203932553}, {2137463301, 207211624},
+    {2137142927, 210490206}, {2136817525, 213768293}, {2136487095, 217045878}, {2136151637, 220322951},
+    {2135811153, 223599506}, {2135465642, 226875535}, {2135115107, 230151030}, {2134759548, 233425984},
+    {2134398966, 236700388}, {2134033361, 239974235}, {2133662734, 243247518}, {2133287087, 246520228},
+    {2132906420, 249792358}, {2132520734, 253063900}, {2132130030, 256334847}, {2131734309, 259605191},
+    {2131333572, 262874923}, {2130927819, 266144038}, {2130517052, 269412525}, {2130101272, 272680379},
+    {2129680480, 275947592}, {2129254676, 279214155}, {2128823862, 282480061}, {2128388038, 285745302},
+    {2127947206, 289009871}, {2127501367, 292273760}, {2127050522, 295536961}, {2126594672, 298799466},
+    {2126133817, 302061269}, {2125667960, 305322361}, {2125197100, 308582734}, {2124721240, 311842381},
+    {2124240380, 315101295}, {2123754522, 318359466}, {2123263666, 321616889}, {2122767814, 324873555},
+    {2122266967, 328129457}, {2121761126, 331384586}, {2121250292, 334638936}, {2120734467, 337892498},
+    {2120213651, 341145265}, {2119687847, 344397230}, {2119157054, 347648383}, {2118621275, 350898719},
+    {2118080511, 354148230}, {2117534762, 357396906}, {2116984031, 360644742}, {2116428319, 363891730},
+    {2115867626, 367137861}, {2115301954, 370383128}, {2114731305, 373627523}, {2114155680, 376871039},
+    {2113575080, 380113669}, {2112989506, 383355404}, {2112398960, 386596237}, {2111803444, 389836160},
+    {2111202959, 393075166}, {2110597505, 396313247}, {2109987085, 399550396}, {2109371700, 402786604},
+    {2108751352, 406021865}, {2108126041, 409256170}, {2107495770, 412489512}, {2106860540, 415721883},
+    {2106220352, 418953276}, {2105575208, 422183684}, {2104925109, 425413098}, {2104270057, 428641511},
+    {2103610054, 431868915}, {2102945101, 435095303}, {2102275199, 438320667}, {2101600350, 441545000},
+    {2100920556, 444768294}, {2100235819, 447990541}, {2099546139, 451211734}, {2098851519, 454431865},
+    {2098151960, 457650927}, {2097447464, 460868912}, {2096738032, 464085813}, {2096023667, 467301622},
+    {2095304370, 470516330}, {2094580142, 473729932}, {2093850985, 476942419}, {2093116901, 480153784},
+    {2092377892, 483364019}, {2091633960, 486573117}, {2090885105, 489781069}, {2090131331, 492987869},
+    {2089372638, 496193509}, {2088609029, 499397982}, {2087840505, 502601279}, {2087067068, 505803394},
+    {2086288720, 509004318}, {2085505463, 512204045}, {2084717298, 515402566}, {2083924228, 518599875},
+    {2083126254, 521795963}, {2082323379, 524990824}, {2081515603, 528184449}, {2080702930, 531376831},
+    {2079885360, 534567963}, {2079062896, 537757837}, {2078235540, 540946445}, {2077403294, 544133781},
+    {2076566160, 547319836}, {2075724139, 550504604}, {2074877233, 553688076}, {2074025446, 556870245},
+    {2073168777, 560051104}, {2072307231, 563230645}, {2071440808, 566408860}, {2070569511, 569585743},
+    {2069693342, 572761285}, {2068812302, 575935480}, {2067926394, 579108320}, {2067035621, 582279796},
+    {2066139983, 585449903}, {2065239484, 588618632}, {2064334124, 591785976}, {2063423908, 594951927},
+    {2062508835, 598116479}, {2061588910, 601279623}, {2060664133, 604441352}, {2059734508, 607601658},
+    {2058800036, 610760536}, {2057860719, 613917975}, {2056916560, 617073971}, {2055967560, 620228514},
+    {2055013723, 623381598}, {2054055050, 626533215}, {2053091544, 629683357}, {2052123207, 632832018},
+    {2051150040, 635979190}, {2050172048, 639124865}, {2049189231, 642269036}, {2048201592, 645411696},
+    {2047209133, 648552838}, {2046211857, 651692453}, {2045209767, 654830535}, {2044202863, 657967075},
+    {2043191150, 661102068}, {2042174628, 664235505}, {2041153301, 667367379}, {2040127172, 670497682},
+    {2039096241, 673626408}, {2038060512, 676753549}, {2037019988, 679879097}, {2035974670, 683003045},
+    {2034924562, 686125387}, {2033869665, 689246113}, {2032809982, 692365218}, {2031745516, 695482694},
+    {2030676269, 698598533}, {2029602243, 701712728}, {2028523442, 704825272}, {2027439867, 707936158},
+    {2026351522, 711045377}, {2025258408, 714152924}, {2024160529, 717258790}, {2023057887, 720362968},
+    {2021950484, 723465451}, {2020838323, 726566232}, {2019721407, 729665303}, {2018599739, 732762657},
+    {2017473321, 735858287}, {2016342155, 738952186}, {2015206245, 742044345}, {2014065592, 745134758},
+    {2012920201, 748223418}, {2011770073, 751310318}, {2010615210, 754395449}, {2009455617, 757478806},
+    {2008291295, 760560380}, {2007122248, 763640164}, {2005948478, 766718151}, {2004769987, 769794334},
+    {2003586779, 772868706}, {2002398857, 775941259}, {2001206222, 779011986}, {2000008879, 782080880},
+    {1998806829, 785147934}, {1997600076, 788213141}, {1996388622, 791276492}, {1995172471, 794337982},
+    {1993951625, 797397602}, {1992726087, 800455346}, {1991495860, 803511207}, {1990260946, 806565177},
+    {1989021350, 809617249}, {1987777073, 812667415}, {1986528118, 815715670}, {1985274489, 818762005},
+    {1984016189, 821806413}, {1982753220, 824848888}, {1981485585, 827889422}, {1980213288, 830928007},
+    {1978936331, 833964638}, {1977654717, 836999305}, {1976368450, 840032004}, {1975077532, 843062726},
+    {1973781967, 846091463}, {1972481757, 849118210}, {1971176906, 852142959}, {1969867417, 855165703},
+    {1968553292, 858186435}, {1967234535, 861205147}, {1965911148, 864221832}, {1964583136, 867236484},
+    {1963250501, 870249095}, {1961913246, 873259659}, {1960571375, 876268167}, {1959224890, 879274614},
+    {1957873796, 882278992}, {1956518093, 885281293}, {1955157788, 888281512}, {1953792881, 891279640},
+    {1952423377, 894275671}, {1951049279, 897269597}, {1949670589, 900261413}, {1948287312, 903251110},
+    {1946899451, 906238681}, {1945507008, 909224120}, {1944109987, 912207419}, {1942708392, 915188572},
+    {1941302225, 918167572}, {1939891490, 921144411}, {1938476190, 924119082}, {1937056329, 927091579},
+    {1935631910, 930061894}, {1934202936, 933030021}, {1932769411, 935995952}, {1931331338, 938959681},
+    {1929888720, 941921200}, {1928441561, 944880503}, {1926989864, 947837582}, {1925533633, 950792431},
+    {1924072871, 953745043}, {1922607581, 956695411}, {1921137767, 959643527}, {1919663432, 962589385},
+    {1918184581, 965532978}, {1916701216, 968474300}, {1915213340, 971413342}, {1913720958, 974350098},
+    {1912224073, 977284562}, {1910722688, 980216726}, {1909216806, 983146583}, {1907706433, 986074127},
+    {1906191570, 988999351}, {1904672222, 991922248}, {1903148392, 994842810}, {1901620084, 997761031},
+    {1900087301, 1000676905}, {1898550047, 1003590424}, {1897008325, 1006501581}, {1895462140, 1009410370},
+    {1893911494, 1012316784}, {1892356392, 1015220816}, {1890796837, 1018122458}, {1889232832, 1021021705},
+    {1887664383, 1023918550}, {1886091491, 1026812985}, {1884514161, 1029705004}, {1882932397, 1032594600},
+    {1881346202, 1035481766}, {1879755580, 1038366495}, {1878160535, 1041248781}, {1876561070, 1044128617},
+    {1874957189, 1047005996}, {1873348897, 1049880912}, {1871736196, 1052753357}, {1870119091, 1055623324},
+    {1868497586, 1058490808}, {1866871683, 1061355801}, {1865241388, 1064218296}, {1863606704, 1067078288},
+    {1861967634, 1069935768}, {1860324183, 1072790730}, {1858676355, 1075643169}, {1857024153, 1078493076},
+    {1855367581, 1081340445}, {1853706643, 1084185270}, {1852041343, 1087027544}, {1850371686, 1089867259},
+    {1848697674, 1092704411}, {1847019312, 1095538991}, {1845336604, 1098370993}, {1843649553, 1101200410},
+    {1841958164, 1104027237}, {1840262441, 1106851465}, {1838562388, 1109673089}, {1836858008, 1112492101},
+    {1835149306, 1115308496}, {1833436286, 1118122267}, {1831718951, 1120933406}, {1829997307, 1123741908},
+    {1828271356, 1126547765}, {1826541103, 1129350972}, {1824806552, 1132151521}, {1823067707, 1134949406},
+    {1821324572, 1137744621}, {1819577151, 1140537158}, {1817825449, 1143327011}, {1816069469, 1146114174},
+    {1814309216, 1148898640}, {1812544694, 1151680403}, {1810775906, 1154459456}, {1809002858, 1157235792},
+    {1807225553, 1160009405}, {1805443995, 1162780288}, {1803658189, 1165548435}, {1801868139, 1168313840},
+    {1800073849, 1171076495}, {1798275323, 1173836395}, {1796472565, 1176593533}, {1794665580, 1179347902},
+    {1792854372, 1182099496}, {1791038946, 1184848308}, {1789219305, 1187594332}, {1787395453, 1190337562},
+    {1785567396, 1193077991}, {1783735137, 1195815612}, {1781898681, 1198550419}, {1780058032, 1201282407},
+    {1778213194, 1204011567}, {1776364172, 1206737894}, {1774510970, 1209461382}, {1772653593, 1212182024},
+    {1770792044, 1214899813}, {1768926328, 1217614743}, {1767056450, 1220326809}, {1765182414, 1223036002},
+    {1763304224, 1225742318}, {1761421885, 1228445750}, {1759535401, 1231146291}, {1757644777, 1233843935},
+    {1755750017, 1236538675}, {1753851126, 1239230506}, {1751948107, 1241919421}, {1750040966, 1244605414},
+    {1748129707, 1247288478}, {1746214334, 1249968606}, {1744294853, 1252645794}, {1742371267, 1255320034},
+    {1740443581, 1257991320}, {1738511799, 1260659646}, {1736575927, 1263325005}, {1734635968, 1265987392},
+    {1732691928, 1268646800}, {1730743810, 1271303222}, {1728791620, 1273956653}, {1726835361, 1276607086},
+    {1724875040, 1279254516}, {1722910659, 1281898935}, {1720942225, 1284540337}, {1718969740, 1287178717},
+    {1716993211, 1289814068}, {1715012642, 1292446384}, {1713028037, 1295075659}, {1711039401, 1297701886},
+    {1709046739, 1300325060}, {1707050055, 1302945174}, {1705049355, 1305562222}, {1703044642, 1308176198},
+    {1701035922, 1310787095}, {1699023199, 1313394909}, {1697006479, 1315999631}, {1694985765, 1318601257},
+    {1692961062, 1321199781}, {1690932376, 1323795195}, {1688899711, 1326387494}, {1686863072, 1328976672},
+    {1684822463, 1331562723}, {1682777890, 1334145641}, {1680729357, 1336725419}, {1678676870, 1339302052},
+    {1676620432, 1341875533}, {1674560049, 1344445857}, {1672495725, 1347013017}, {1670427466, 1349577007},
+    {1668355276, 1352137822}, {1666279161, 1354695455}, {1664199124, 1357249901}, {1662115172, 1359801152},
+    {1660027308, 1362349204}, {1657935539, 1364894050}, {1655839867, 1367435685}, {1653740300, 1369974101},
+    {1651636841, 1372509294}, {1649529496, 1375041258}, {1647418269, 1377569986}, {1645303166, 1380095472},
+    {1643184191, 1382617710}, {1641061349, 1385136696}, {1638934646, 1387652422}, {1636804087, 1390164882},
+    {1634669676, 1392674072}, {1632531418, 1395179984}, {1630389319, 1397682613}, {1628243383, 1400181954},
+    {1626093616, 1402678000}, {1623940023, 1405170745}, {1621782608, 1407660183}, {1619621377, 1410146309},
+    {1617456335, 1412629117}, {1615287487, 1415108601}, {1613114838, 1417584755}, {1610938393, 1420057574},
+    {1608758157, 1422527051}, {1606574136, 1424993180}, {1604386335, 1427455956}, {1602194758, 1429915374},
+    {1599999411, 1432371426}, {1597800299, 1434824109}, {1595597428, 1437273414}, {1593390801, 1439719338},
+    {1591180426, 1442161874}, {1588966306, 1444601017}, {1586748447, 1447036760}, {1584526854, 1449469098},
+    {1582301533, 1451898025}, {1580072489, 1454323536}, {1577839726, 1456745625}, {1575603251, 1459164286},
+    {1573363068, 1461579514}, {1571119183, 1463991302}, {1568871601, 1466399645}, {1566620327, 1468804538},
+    {1564365367, 1471205974}, {1562106725, 1473603949}, {1559844408, 1475998456}, {1557578421, 1478389489},
+    {1555308768, 1480777044}, {1553035455, 1483161115}, {1550758488, 1485541696}, {1548477872, 1487918781},
+    {1546193612, 1490292364}, {1543905714, 1492662441}, {1541614183, 1495029006}, {1539319024, 1497392053},
+    {1537020244, 1499751576}, {1534717846, 1502107570}, {1532411837, 1504460029}, {1530102222, 1506808949},
+    {1527789007, 1509154322}, {1525472197, 1511496145}, {1523151797, 1513834411}, {1520827813, 1516169114},
+    {1518500250, 1518500250}, {1516169114, 1520827813}, {1513834411, 1523151797}, {1511496145, 1525472197},
+    {1509154322, 1527789007}, {1506808949, 1530102222}, {1504460029, 1532411837}, {1502107570, 1534717846},
+    {1499751576, 1537020244}, {1497392053, 1539319024}, {1495029006, 1541614183}, {1492662441, 1543905714},
+    {1490292364, 1546193612}, {1487918781, 1548477872}, {1485541696, 1550758488}, {1483161115, 1553035455},
+    {1480777044, 1555308768}, {1478389489, 1557578421}, {1475998456, 1559844408}, {1473603949, 1562106725},
+    {1471205974, 1564365367}, {1468804538, 1566620327}, {1466399645, 1568871601}, {1463991302, 1571119183},
+    {1461579514, 1573363068}, {1459164286, 1575603251}, {1456745625, 1577839726}, {1454323536, 1580072489},
+    {1451898025, 1582301533}, {1449469098, 1584526854}, {1447036760, 1586748447}, {1444601017, 1588966306},
+    {1442161874, 1591180426}, {1439719338, 1593390801}, {1437273414, 1595597428}, {1434824109, 1597800299},
+    {1432371426, 1599999411}, {1429915374, 1602194758}, {1427455956, 1604386335}, {1424993180, 1606574136},
+    {1422527051, 1608758157}, {1420057574, 1610938393}, {1417584755, 1613114838}, {1415108601, 1615287487},
+    {1412629117, 1617456335}, {1410146309, 1619621377}, {1407660183, 1621782608}, {1405170745, 1623940023},
+    {1402678000, 1626093616}, {1400181954, 1628243383}, {1397682613, 1630389319}, {1395179984, 1632531418},
+    {1392674072, 1634669676}, {1390164882, 1636804087}, {1387652422, 1638934646}, {1385136696, 1641061349},
+    {1382617710, 1643184191}, {1380095472, 1645303166}, {1377569986, 1647418269}, {1375041258, 1649529496},
+    {1372509294, 1651636841}, {1369974101, 1653740300}, {1367435685, 1655839867}, {1364894050, 1657935539},
+    {1362349204, 1660027308}, {1359801152, 1662115172}, {1357249901, 1664199124}, {1354695455, 1666279161},
+    {1352137822, 1668355276}, {1349577007, 1670427466}, {1347013017, 1672495725}, {1344445857, 1674560049},
+    {1341875533, 1676620432}, {1339302052, 1678676870}, {1336725419, 1680729357}, {1334145641, 1682777890},
+    {1331562723, 1684822463}, {1328976672, 1686863072}, {1326387494, 1688899711}, {1323795195, 1690932376},
+    {1321199781, 1692961062}, {1318601257, 1694985765}, {1315999631, 1697006479}, {1313394909, 1699023199},
+    {1310787095, 1701035922}, {1308176198, 1703044642}, {1305562222, 1705049355}, {1302945174, 1707050055},
+    {1300325060, 1709046739}, {1297701886, 1711039401}, {1295075659, 1713028037}, {1292446384, 1715012642},
+    {1289814068, 1716993211}, {1287178717, 1718969740}, {1284540337, 1720942225}, {1281898935, 1722910659},
+    {1279254516, 1724875040}, {1276607086, 1726835361}, {1273956653, 1728791620}, {1271303222, 1730743810},
+    {1268646800, 1732691928}, {1265987392, 1734635968}, {1263325005, 1736575927}, {1260659646, 1738511799},
+    {1257991320, 1740443581}, {1255320034, 1742371267}, {1252645794, 1744294853}, {1249968606, 1746214334},
+    {1247288478, 1748129707}, {1244605414, 1750040966}, {1241919421, 1751948107}, {1239230506, 1753851126},
+    {1236538675, 1755750017}, {1233843935, 1757644777}, {1231146291, 1759535401}, {1228445750, 1761421885},
+    {1225742318, 1763304224}, {1223036002, 1765182414}, {1220326809, 1767056450}, {1217614743, 1768926328},
+    {1214899813, 1770792044}, {1212182024, 1772653593}, {1209461382, 1774510970}, {1206737894, 1776364172},
+    {1204011567, 1778213194}, {1201282407, 1780058032}, {1198550419, 1781898681}, {1195815612, 1783735137},
+    {1193077991, 1785567396}, {1190337562, 1787395453}, {1187594332, 1789219305}, {1184848308, 1791038946},
+    {1182099496, 1792854372}, {1179347902, 1794665580}, {1176593533, 1796472565}, {1173836395, 1798275323},
+    {1171076495, 1800073849}, {1168313840, 1801868139}, {1165548435, 1803658189}, {1162780288, 1805443995},
+    {1160009405, 1807225553}, {1157235792, 1809002858}, {1154459456, 1810775906}, {1151680403, 1812544694},
+    {1148898640, 1814309216}, {1146114174, 1816069469}, {1143327011, 1817825449}, {1140537158, 1819577151},
+    {1137744621, 1821324572}, {1134949406, 1823067707}, {1132151521, 1824806552}, {1129350972, 1826541103},
+    {1126547765, 1828271356}, {1123741908, 1829997307}, {1120933406, 1831718951}, {1118122267, 1833436286},
+    {1115308496, 1835149306}, {1112492101, 1836858008}, {1109673089, 1838562388}, {1106851465, 1840262441},
+    {1104027237, 1841958164}, {1101200410, 1843649553}, {1098370993, 1845336604}, {1095538991, 1847019312},
+    {1092704411, 1848697674}, {1089867259, 1850371686}, {1087027544, 1852041343}, {1084185270, 1853706643},
+    {1081340445, 1855367581}, {1078493076, 1857024153}, {1075643169, 1858676355}, {1072790730, 1860324183},
+    {1069935768, 1861967634}, {1067078288, 1863606704}, {1064218296, 1865241388}, {1061355801, 1866871683},
+    {1058490808, 1868497586}, {1055623324, 1870119091}, {1052753357, 1871736196}, {1049880912, 1873348897},
+    {1047005996, 1874957189}, {1044128617, 1876561070}, {1041248781, 1878160535}, {1038366495, 1879755580},
+    {1035481766, 1881346202}, {1032594600, 1882932397}, {1029705004, 1884514161}, {1026812985, 1886091491},
+    {1023918550, 1887664383}, {1021021705, 1889232832}, {1018122458, 1890796837}, {1015220816, 1892356392},
+    {1012316784, 1893911494}, {1009410370, 1895462140}, {1006501581, 1897008325}, {1003590424, 1898550047},
+    {1000676905, 1900087301}, {997761031, 1901620084}, {994842810, 1903148392}, {991922248, 1904672222},
+    {988999351, 1906191570}, {986074127, 1907706433}, {983146583, 1909216806}, {980216726, 1910722688},
+    {977284562, 1912224073}, {974350098, 1913720958}, {971413342, 1915213340}, {968474300, 1916701216},
+    {965532978, 1918184581}, {962589385, 1919663432}, {959643527, 1921137767}, {956695411, 1922607581},
+    {953745043, 1924072871}, {950792431, 1925533633}, {947837582, 1926989864}, {944880503, 1928441561},
+    {941921200, 1929888720}, {938959681, 1931331338}, {935995952, 1932769411}, {933030021, 1934202936},
+    {930061894, 1935631910}, {927091579, 1937056329}, {924119082, 1938476190}, {921144411, 1939891490},
+    {918167572, 1941302225}, {915188572, 1942708392}, {912207419, 1944109987}, {909224120, 1945507008},
+    {906238681, 1946899451}, {903251110, 1948287312}, {900261413, 1949670589}, {897269597, 1951049279},
+    {894275671, 1952423377}, {891279640, 1953792881}, {888281512, 1955157788}, {885281293, 1956518093},
+    {882278992, 1957873796}, {879274614, 1959224890}, {876268167, 1960571375}, {873259659, 1961913246},
+    {870249095, 1963250501}, {867236484, 1964583136}, {864221832, 1965911148}, {861205147, 1967234535},
+    {858186435, 1968553292}, {855165703, 1969867417}, {852142959, 1971176906}, {849118210, 1972481757},
+    {846091463, 1973781967}, {843062726, 1975077532}, {840032004, 1976368450}, {836999305, 1977654717},
+    {833964638, 1978936331}, {830928007, 1980213288}, {827889422, 1981485585}, {824848888, 1982753220},
+    {821806413, 1984016189}, {818762005, 1985274489}, {815715670, 1986528118}, {812667415, 1987777073},
+    {809617249, 1989021350}, {806565177, 1990260946}, {803511207, 1991495860}, {800455346, 1992726087},
+    {797397602, 1993951625}, {794337982, 1995172471}, {791276492, 1996388622}, {788213141, 1997600076},
+    {785147934, 1998806829}, {782080880, 2000008879}, {779011986, 2001206222}, {775941259, 2002398857},
+    {772868706, 2003586779}, {769794334, 2004769987}, {766718151, 2005948478}, {763640164, 2007122248},
+    {760560380, 2008291295}, {757478806, 2009455617}, {754395449, 2010615210}, {751310318, 2011770073},
+    {748223418, 2012920201}, {745134758, 2014065592}, {742044345, 2015206245}, {738952186, 2016342155},
+    {735858287, 2017473321}, {732762657, 2018599739}, {729665303, 2019721407}, {726566232, 2020838323},
+    {723465451, 2021950484}, {720362968, 2023057887}, {717258790, 2024160529}, {714152924, 2025258408},
+    {711045377, 2026351522}, {707936158, 2027439867}, {704825272, 2028523442}, {701712728, 2029602243},
+    {698598533, 2030676269}, {695482694, 2031745516}, {692365218, 2032809982}, {689246113, 2033869665},
+    {686125387, 2034924562}, {683003045, 2035974670}, {679879097, 2037019988}, {676753549, 2038060512},
+    {673626408, 2039096241}, {670497682, 2040127172}, {667367379, 2041153301}, {664235505, 2042174628},
+    {661102068, 2043191150}, {657967075, 2044202863}, {654830535, 2045209767}, {651692453, 2046211857},
+    {648552838, 2047209133}, {645411696, 2048201592}, {642269036, 2049189231}, {639124865, 2050172048},
+    {635979190, 2051150040}, {632832018, 2052123207}, {629683357, 2053091544}, {626533215, 2054055050},
+    {623381598, 2055013723}, {620228514, 2055967560}, {617073971, 2056916560}, {613917975, 2057860719},
+    {610760536, 2058800036}, {607601658, 2059734508}, {604441352, 2060664133}, {601279623, 2061588910},
+    {598116479, 2062508835}, {594951927, 2063423908}, {591785976, 2064334124}, {588618632, 2065239484},
+    {585449903, 2066139983}, {582279796, 2067035621}, {579108320, 2067926394}, {575935480, 2068812302},
+    {572761285, 2069693342}, {569585743, 2070569511}, {566408860, 2071440808}, {563230645, 2072307231},
+    {560051104, 2073168777}, {556870245, 2074025446}, {553688076, 2074877233}, {550504604, 2075724139},
+    {547319836, 2076566160}, {544133781, 2077403294}, {540946445, 2078235540}, {537757837, 2079062896},
+    {534567963, 2079885360}, {531376831, 2080702930}, {528184449, 2081515603}, {524990824, 2082323379},
+    {521795963, 2083126254}, {518599875, 2083924228}, {515402566, 2084717298}, {512204045, 2085505463},
+    {509004318, 2086288720}, {505803394, 2087067068}, {502601279, 2087840505}, {499397982, 2088609029},
+    {496193509, 2089372638}, {492987869, 2090131331}, {489781069, 2090885105}, {486573117, 2091633960},
+    {483364019, 2092377892}, {480153784, 2093116901}, {476942419, 2093850985}, {473729932, 2094580142},
+    {470516330, 2095304370}, {467301622, 2096023667}, {464085813, 2096738032}, {460868912, 2097447464},
+    {457650927, 2098151960}, {454431865, 2098851519}, {451211734, 2099546139}, {447990541, 2100235819},
+    {444768294, 2100920556}, {441545000, 2101600350}, {438320667, 2102275199}, {435095303, 2102945101},
+    {431868915, 2103610054}, {428641511, 2104270057}, {425413098, 2104925109}, {422183684, 2105575208},
+    {418953276, 2106220352}, {415721883, 2106860540}, {412489512, 2107495770}, {409256170, 2108126041},
+    {406021865, 2108751352}, {402786604, 2109371700}, {399550396, 2109987085}, {396313247, 2110597505},
+    {393075166, 2111202959}, {389836160, 2111803444}, {386596237, 2112398960}, {383355404, 2112989506},
+    {380113669, 2113575080}, {376871039, 2114155680}, {373627523, 2114731305}, {370383128, 2115301954},
+    {367137861, 2115867626}, {363891730, 2116428319}, {360644742, 2116984031}, {357396906, 2117534762},
+    {354148230, 2118080511}, {350898719, 2118621275}, {347648383, 2119157054}, {344397230, 2119687847},
+    {341145265, 2120213651}, {337892498, 2120734467}, {334638936, 2121250292}, {331384586, 2121761126},
+    {328129457, 2122266967}, {324873555, 2122767814}, {321616889, 2123263666}, {318359466, 2123754522},
+    {315101295, 2124240380}, {311842381, 2124721240}, {308582734, 2125197100}, {305322361, 2125667960},
+    {302061269, 2126133817}, {298799466, 2126594672}, {295536961, 2127050522}, {292273760, 2127501367},
+    {289009871, 2127947206}, {285745302, 2128388038}, {282480061, 2128823862}, {279214155, 2129254676},
+    {275947592, 2129680480}, {272680379, 2130101272}, {269412525, 2130517052}, {266144038, 2130927819},
+    {262874923, 2131333572}, {259605191, 2131734309}, {256334847, 2132130030}, {253063900, 2132520734},
+    {249792358, 2132906420}, {246520228, 2133287087}, {243247518, 2133662734}, {239974235, 2134033361},
+    {236700388, 2134398966}, {233425984, 2134759548}, {230151030, 2135115107}, {226875535, 2135465642},
+    {223599506, 2135811153}, {220322951, 2136151637}, {217045878, 2136487095}, {213768293, 2136817525},
+    {210490206, 2137142927}, {207211624, 2137463301}, {203932553, 2137778644}, {200653003, 2138088958},
+    {197372981, 2138394240}, {194092495, 2138694490}, {190811551, 2138989708}, {187530159, 2139279892},
+    {184248325, 2139565043}, {180966058, 2139845159}, {177683365, 2140120240}, {174400254, 2140390284},
+    {171116733, 2140655293}, {167832808, 2140915264}, {164548489, 2141170197}, {161263783, 2141420092},
+    {157978697, 2141664948}, {154693240, 2141904764}, {151407418, 2142139541}, {148121241, 2142369276},
+    {144834714, 2142593971}, {141547847, 2142813624}, {138260647, 2143028234}, {134973122, 2143237802},
+    {131685278, 2143442326}, {128397125, 2143641807}, {125108670, 2143836244}, {121819921, 2144025635},
+    {118530885, 2144209982}, {115241570, 2144389283}, {111951983, 2144563539}, {108662134, 2144732748},
+    {105372028, 2144896910}, {102081675, 2145056025}, {98791081, 2145210092}, {95500255, 2145359112},
+    {92209205, 2145503083}, {88917937, 2145642006}, {85626460, 2145775880}, {82334782, 2145904705},
+    {79042909, 2146028480}, {75750851, 2146147205}, {72458615, 2146260881}, {69166208, 2146369505},
+    {65873638, 2146473080}, {62580914, 2146571603}, {59288042, 2146665076}, {55995030, 2146753497},
+    {52701887, 2146836866}, {49408620, 2146915184}, {46115236, 2146988450}, {42821744, 2147056664},
+    {39528151, 2147119825}, {36234466, 2147177934}, {32940695, 2147230991}, {29646846, 2147278995},
+    {26352928, 2147321946}, {23058947, 2147359845}, {19764913, 2147392690}, {16470832, 2147420483},
+    {13176712, 2147443222}, {9882561, 2147460908}, {6588387, 2147473542}, {3294197, 2147481121},
+    {0, 2147483647}, {-3294197, 2147481121}, {-6588387, 2147473542}, {-9882561, 2147460908},
+    {-13176712, 2147443222}, {-16470832, 2147420483}, {-19764913, 2147392690}, {-23058947, 2147359845},
+    {-26352928, 2147321946}, {-29646846, 2147278995}, {-32940695, 2147230991}, {-36234466, 2147177934},
+    {-39528151, 2147119825}, {-42821744, 2147056664}, {-46115236, 2146988450}, {-49408620, 2146915184},
+    {-52701887, 2146836866}, {-55995030, 2146753497}, {-59288042, 2146665076}, {-62580914, 2146571603},
+    {-65873638, 2146473080}, {-69166208, 2146369505}, {-72458615, 2146260881}, {-75750851, 2146147205},
+    {-79042909, 2146028480}, {-82334782, 2145904705}, {-85626460, 2145775880}, {-88917937, 2145642006},
+    {-92209205, 2145503083}, {-95500255, 2145359112}, {-98791081, 2145210092}, {-102081675, 2145056025},
+    {-105372028, 2144896910}, {-108662134, 2144732748}, {-111951983, 2144563539}, {-115241570, 2144389283},
+    {-118530885, 2144209982}, {-121819921, 2144025635}, {-125108670, 2143836244}, {-128397125, 2143641807},
+    {-131685278, 2143442326}, {-134973122, 2143237802}, {-138260647, 2143028234}, {-141547847, 2142813624},
+    {-144834714, 2142593971}, {-148121241, 2142369276}, {-151407418, 2142139541}, {-154693240, 2141904764},
+    {-157978697, 2141664948}, {-161263783, 2141420092}, {-164548489, 2141170197}, {-167832808, 2140915264},
+    {-171116733, 2140655293}, {-174400254, 2140390284}, {-177683365, 2140120240}, {-180966058, 2139845159},
+    {-184248325, 2139565043}, {-187530159, 2139279892}, {-190811551, 2138989708}, {-194092495, 2138694490},
+    {-197372981, 2138394240}, {-200653003, 2138088958}, {-203932553, 2137778644}, {-207211624, 2137463301},
+    {-210490206, 2137142927}, {-213768293, 2136817525}, {-217045878, 2136487095}, {-220322951, 2136151637},
+    {-223599506, 2135811153}, {-226875535, 2135465642}, {-230151030, 2135115107}, {-233425984, 2134759548},
+    {-236700388, 2134398966}, {-239974235, 2134033361}, {-243247518, 2133662734}, {-246520228, 2133287087},
+    {-249792358, 2132906420}, {-253063900, 2132520734}, {-256334847, 2132130030}, {-259605191, 2131734309},
+    {-262874923, 2131333572}, {-266144038, 2130927819}, {-269412525, 2130517052}, {-272680379, 2130101272},
+    {-275947592, 2129680480}, {-279214155, 2129254676}, {-282480061, 2128823862}, {-285745302, 2128388038},
+    {-289009871, 2127947206}, {-292273760, 2127501367}, {-295536961, 2127050522}, {-298799466, 2126594672},
+    {-302061269, 2126133817}, {-305322361, 2125667960}, {-308582734, 2125197100}, {-311842381, 2124721240},
+    {-315101295, 2124240380}, {-318359466, 2123754522}, {-321616889, 2123263666}, {-324873555, 2122767814},
+    {-328129457, 2122266967}, {-331384586, 2121761126}, {-334638936, 2121250292}, {-337892498, 2120734467},
+    {-341145265, 2120213651}, {-344397230, 2119687847}, {-347648383, 2119157054}, {-350898719, 2118621275},
+    {-354148230, 2118080511}, {-357396906, 2117534762}, {-360644742, 2116984031}, {-363891730, 2116428319},
+    {-367137861, 2115867626}, {-370383128, 2115301954}, {-373627523, 2114731305}, {-376871039, 2114155680},
+    {-380113669, 2113575080}, {-383355404, 2112989506}, {-386596237, 2112398960}, {-389836160, 2111803444},
+    {-393075166, 2111202959}, {-396313247, 2110597505}, {-399550396, 2109987085}, {-402786604, 2109371700},
+    {-406021865, 2108751352}, {-409256170, 2108126041}, {-412489512, 2107495770}, {-415721883, 2106860540},
+    {-418953276, 2106220352}, {-422183684, 2105575208}, {-425413098, 2104925109}, {-428641511, 2104270057},
+    {-431868915, 2103610054}, {-435095303, 2102945101}, {-438320667, 2102275199}, {-441545000, 2101600350},
+    {-444768294, 2100920556}, {-447990541, 2100235819}, {-451211734, 2099546139}, {-454431865, 2098851519},
+    {-457650927, 2098151960}, {-460868912, 2097447464}, {-464085813, 2096738032}, {-467301622, 2096023667},
+    {-470516330, 2095304370}, {-473729932, 2094580142}, {-476942419, 2093850985}, {-480153784, 2093116901},
+    {-483364019, 2092377892}, {-486573117, 2091633960}, {-489781069, 2090885105}, {-492987869, 2090131331},
+    {-496193509, 2089372638}, {-499397982, 2088609029}, {-502601279, 2087840505}, {-505803394, 2087067068},
+    {-509004318, 2086288720}, {-512204045, 2085505463}, {-515402566, 2084717298}, {-518599875, 2083924228},
+    {-521795963, 2083126254}, {-524990824, 2082323379}, {-528184449, 2081515603}, {-531376831, 2080702930},
+    {-534567963, 2079885360}, {-537757837, 2079062896}, {-540946445, 2078235540}, {-544133781, 2077403294},
+    {-547319836, 2076566160}, {-550504604, 2075724139}, {-553688076, 2074877233}, {-556870245, 2074025446},
+    {-560051104, 2073168777}, {-563230645, 2072307231}, {-566408860, 2071440808}, {-569585743, 2070569511},
+    {-572761285, 2069693342}, {-575935480, 2068812302}, {-579108320, 2067926394}, {-582279796, 2067035621},
+    {-585449903, 2066139983}, {-588618632, 2065239484}, {-591785976, 2064334124}, {-594951927, 2063423908},
+    {-598116479, 2062508835}, {-601279623, 2061588910}, {-604441352, 2060664133}, {-607601658, 2059734508},
+    {-610760536, 2058800036}, {-613917975, 2057860719}, {-617073971, 2056916560}, {-620228514, 2055967560},
+    {-623381598, 2055013723}, {-626533215, 2054055050}, {-629683357, 2053091544}, {-632832018, 2052123207},
+    {-635979190, 2051150040}, {-639124865, 2050172048}, {-642269036, 2049189231}, {-645411696, 2048201592},
+    {-648552838, 2047209133}, {-651692453, 2046211857}, {-654830535, 2045209767}, {-657967075, 2044202863},
+    {-661102068, 2043191150}, {-664235505, 2042174628}, {-667367379, 2041153301}, {-670497682, 2040127172},
+    {-673626408, 2039096241}, {-676753549, 2038060512}, {-679879097, 2037019988}, {-683003045, 2035974670},
+    {-686125387, 2034924562}, {-689246113, 2033869665}, {-692365218, 2032809982}, {-695482694, 2031745516},
+    {-698598533, 2030676269}, {-701712728, 2029602243}, {-704825272, 2028523442}, {-707936158, 2027439867},
+    {-711045377, 2026351522}, {-714152924, 2025258408}, {-717258790, 2024160529}, {-720362968, 2023057887},
+    {-723465451, 2021950484}, {-726566232, 2020838323}, {-729665303, 2019721407}, {-732762657, 2018599739},
+    {-735858287, 2017473321}, {-738952186, 2016342155}, {-742044345, 2015206245}, {-745134758, 2014065592},
+    {-748223418, 2012920201}, {-751310318, 2011770073}, {-754395449, 2010615210}, {-757478806, 2009455617},
+    {-760560380, 2008291295}, {-763640164, 2007122248}, {-766718151, 2005948478}, {-769794334, 2004769987},
+    {-772868706, 2003586779}, {-775941259, 2002398857}, {-779011986, 2001206222}, {-782080880, 2000008879},
+    {-785147934, 1998806829}, {-788213141, 1997600076}, {-791276492, 1996388622}, {-794337982, 1995172471},
+    {-797397602, 1993951625}, {-800455346, 1992726087}, {-803511207, 1991495860}, {-806565177, 1990260946},
+    {-809617249, 1989021350}, {-812667415, 1987777073}, {-815715670, 1986528118}, {-818762005, 1985274489},
+    {-821806413, 1984016189}, {-824848888, 1982753220}, {-827889422, 1981485585}, {-830928007, 1980213288},
+    {-833964638, 1978936331}, {-836999305, 1977654717}, {-840032004, 1976368450}, {-843062726, 1975077532},
+    {-846091463, 1973781967}, {-849118210, 1972481757}, {-852142959, 1971176906}, {-855165703, 1969867417},
+    {-858186435, 1968553292}, {-861205147, 1967234535}, {-864221832, 1965911148}, {-867236484, 1964583136},
+    {-870249095, 1963250501}, {-873259659, 1961913246}, {-876268167, 1960571375}, {-879274614, 1959224890},
+    {-882278992, 1957873796}, {-885281293, 1956518093}, {-888281512, 1955157788}, {-891279640, 1953792881},
+    {-894275671, 1952423377}, {-897269597, 1951049279}, {-900261413, 1949670589}, {-903251110, 1948287312},
+    {-906238681, 1946899451}, {-909224120, 1945507008}, {-912207419, 1944109987}, {-915188572, 1942708392},
+    {-918167572, 1941302225}, {-921144411, 1939891490}, {-924119082, 1938476190}, {-927091579, 1937056329},
+    {-930061894, 1935631910}, {-933030021, 1934202936}, {-935995952, 1932769411}, {-938959681, 1931331338},
+    {-941921200, 1929888720}, {-944880503, 1928441561}, {-947837582, 1926989864}, {-950792431, 1925533633},
+    {-953745043, 1924072871}, {-956695411, 1922607581}, {-959643527, 1921137767}, {-962589385, 1919663432},
+    {-965532978, 1918184581}, {-968474300, 1916701216}, {-971413342, 1915213340}, {-974350098, 1913720958},
+    {-977284562, 1912224073}, {-980216726, 1910722688}, {-983146583, 1909216806}, {-986074127, 1907706433},
+    {-988999351, 1906191570}, {-991922248, 1904672222}, {-994842810, 1903148392}, {-997761031, 1901620084},
+    {-1000676905, 1900087301}, {-1003590424, 1898550047}, {-1006501581, 1897008325}, {-1009410370, 1895462140},
+    {-1012316784, 1893911494}, {-1015220816, 1892356392}, {-1018122458, 1890796837}, {-1021021705, 1889232832},
+    {-1023918550, 1887664383}, {-1026812985, 1886091491}, {-1029705004, 1884514161}, {-1032594600, 1882932397},
+    {-1035481766, 1881346202}, {-1038366495, 1879755580}, {-1041248781, 1878160535}, {-1044128617, 1876561070},
+    {-1047005996, 1874957189}, {-1049880912, 1873348897}, {-1052753357, 1871736196}, {-1055623324, 1870119091},
+    {-1058490808, 1868497586}, {-1061355801, 1866871683}, {-1064218296, 1865241388}, {-1067078288, 1863606704},
+    {-1069935768, 1861967634}, {-1072790730, 1860324183}, {-1075643169, 1858676355}, {-1078493076, 1857024153},
+    {-1081340445, 1855367581}, {-1084185270, 1853706643}, {-1087027544, 1852041343}, {-1089867259, 1850371686},
+    {-1092704411, 1848697674}, {-1095538991, 1847019312}, {-1098370993, 1845336604}, {-1101200410, 1843649553},
+    {-1104027237, 1841958164}, {-1106851465, 1840262441}, {-1109673089, 1838562388}, {-1112492101, 1836858008},
+    {-1115308496, 1835149306}, {-1118122267, 1833436286}, {-1120933406, 1831718951}, {-1123741908, 1829997307},
+    {-1126547765, 1828271356}, {-1129350972, 1826541103}, {-1132151521, 1824806552}, {-1134949406, 1823067707},
+    {-1137744621, 1821324572}, {-1140537158, 1819577151}, {-1143327011, 1817825449}, {-1146114174, 1816069469},
+    {-1148898640, 1814309216}, {-1151680403, 1812544694}, {-1154459456, 1810775906}, {-1157235792, 1809002858},
+    {-1160009405, 1807225553}, {-1162780288, 1805443995}, {-1165548435, 1803658189}, {-1168313840, 1801868139},
+    {-1171076495, 1800073849}, {-1173836395, 1798275323}, {-1176593533, 1796472565}, {-1179347902, 1794665580},
+    {-1182099496, 1792854372}, {-1184848308, 1791038946}, {-1187594332, 1789219305}, {-1190337562, 1787395453},
+    {-1193077991, 1785567396}, {-1195815612, 1783735137}, {-1198550419, 1781898681}, {-1201282407, 1780058032},
+    {-1204011567, 1778213194}, {-1206737894, 1776364172}, {-1209461382, 1774510970}, {-1212182024, 1772653593},
+    {-1214899813, 1770792044}, {-1217614743, 1768926328}, {-1220326809, 1767056450}, {-1223036002, 1765182414},
+    {-1225742318, 1763304224}, {-1228445750, 1761421885}, {-1231146291, 1759535401}, {-1233843935, 1757644777},
+    {-1236538675, 1755750017}, {-1239230506, 1753851126}, {-1241919421, 1751948107}, {-1244605414, 1750040966},
+    {-1247288478, 1748129707}, {-1249968606, 1746214334}, {-1252645794, 1744294853}, {-1255320034, 1742371267},
+    {-1257991320, 1740443581}, {-1260659646, 1738511799}, {-1263325005, 1736575927}, {-1265987392, 1734635968},
+    {-1268646800, 1732691928}, {-1271303222, 1730743810}, {-1273956653, 1728791620}, {-1276607086, 1726835361},
+    {-1279254516, 1724875040}, {-1281898935, 1722910659}, {-1284540337, 1720942225}, {-1287178717, 1718969740},
+    {-1289814068, 1716993211}, {-1292446384, 1715012642}, {-1295075659, 1713028037}, {-1297701886, 1711039401},
+    {-1300325060, 1709046739}, {-1302945174, 1707050055}, {-1305562222, 1705049355}, {-1308176198, 1703044642},
+    {-1310787095, 1701035922}, {-1313394909, 1699023199}, {-1315999631, 1697006479}, {-1318601257, 1694985765},
+    {-1321199781, 1692961062}, {-1323795195, 1690932376}, {-1326387494, 1688899711}, {-1328976672, 1686863072},
+    {-1331562723, 1684822463}, {-1334145641, 1682777890}, {-1336725419, 1680729357}, {-1339302052, 1678676870},
+    {-1341875533, 1676620432}, {-1344445857, 1674560049}, {-1347013017, 1672495725}, {-1349577007, 1670427466},
+    {-1352137822, 1668355276}, {-1354695455, 1666279161}, {-1357249901, 1664199124}, {-1359801152, 1662115172},
+    {-1362349204, 1660027308}, {-1364894050, 1657935539}, {-1367435685, 1655839867}, {-1369974101, 1653740300},
+    {-1372509294, 1651636841}, {-1375041258, 1649529496}, {-1377569986, 1647418269}, {-1380095472, 1645303166},
+    {-1382617710, 1643184191}, {-1385136696, 1641061349}, {-1387652422, 1638934646}, {-1390164882, 1636804087},
+    {-1392674072, 1634669676}, {-1395179984, 1632531418}, {-1397682613, 1630389319}, {-1400181954, 1628243383},
+    {-1402678000, 1626093616}, {-1405170745, 1623940023}, {-1407660183, 1621782608}, {-1410146309, 1619621377},
+    {-1412629117, 1617456335}, {-1415108601, 1615287487}, {-1417584755, 1613114838}, {-1420057574, 1610938393},
+    {-1422527051, 1608758157}, {-1424993180, 1606574136}, {-1427455956, 1604386335}, {-1429915374, 1602194758},
+    {-1432371426, 1599999411}, {-1434824109, 1597800299}, {-1437273414, 1595597428}, {-1439719338, 1593390801},
+    {-1442161874, 1591180426}, {-1444601017, 1588966306}, {-1447036760, 1586748447}, {-1449469098, 1584526854},
+    {-1451898025, 1582301533}, {-1454323536, 1580072489}, {-1456745625, 1577839726}, {-1459164286, 1575603251},
+    {-1461579514, 1573363068}, {-1463991302, 1571119183}, {-1466399645, 1568871601}, {-1468804538, 1566620327},
+    {-1471205974, 1564365367}, {-1473603949, 1562106725}, {-1475998456, 1559844408}, {-1478389489, 1557578421},
+    {-1480777044, 1555308768}, {-1483161115, 1553035455}, {-1485541696, 1550758488}, {-1487918781, 1548477872},
+    {-1490292364, 1546193612}, {-1492662441, 1543905714}, {-1495029006, 1541614183}, {-1497392053, 1539319024},
+    {-1499751576, 1537020244}, {-1502107570, 1534717846}, {-1504460029, 1532411837}, {-1506808949, 1530102222},
+    {-1509154322, 1527789007}, {-1511496145, 1525472197}, {-1513834411, 1523151797}, {-1516169114, 1520827813},
+    {-1518500250, 1518500250}, {-1520827813, 1516169114}, {-1523151797, 1513834411}, {-1525472197, 1511496145},
+    {-1527789007, 1509154322}, {-1530102222, 1506808949}, {-1532411837, 1504460029}, {-1534717846, 1502107570},
+    {-1537020244, 1499751576}, {-1539319024, 1497392053}, {-1541614183, 1495029006}, {-1543905714, 1492662441},
+    {-1546193612, 1490292364}, {-1548477872, 1487918781}, {-1550758488, 1485541696}, {-1553035455, 1483161115},
+    {-1555308768, 1480777044}, {-1557578421, 1478389489}, {-1559844408, 1475998456}, {-1562106725, 1473603949},
+    {-1564365367, 1471205974}, {-1566620327, 1468804538}, {-1568871601, 1466399645}, {-1571119183, 1463991302},
+    {-1573363068, 1461579514}, {-1575603251, 1459164286}, {-1577839726, 1456745625}, {-1580072489, 1454323536},
+    {-1582301533, 1451898025}, {-1584526854, 1449469098}, {-1586748447, 1447036760}, {-1588966306, 1444601017},
+    {-1591180426, 1442161874}, {-1593390801, 1439719338}, {-1595597428, 1437273414}, {-1597800299, 1434824109},
+    {-1599999411, 1432371426}, {-1602194758, 1429915374}, {-1604386335, 1427455956}, {-1606574136, 1424993180},
+    {-1608758157, 1422527051}, {-1610938393, 1420057574}, {-1613114838, 1417584755}, {-1615287487, 1415108601},
+    {-1617456335, 1412629117}, {-1619621377, 1410146309}, {-1621782608, 1407660183}, {-1623940023, 1405170745},
+    {-1626093616, 1402678000}, {-1628243383, 1400181954}, {-1630389319, 1397682613}, {-1632531418, 1395179984},
+    {-1634669676, 1392674072}, {-1636804087, 1390164882}, {-1638934646, 1387652422}, {-1641061349, 1385136696},
+    {-1643184191, 1382617710}, {-1645303166, 1380095472}, {-1647418269, 1377569986}, {-1649529496, 1375041258},
+    {-1651636841, 1372509294}, {-1653740300, 1369974101}, {-1655839867, 1367435685}, {-1657935539, 1364894050},
+    {-1660027308, 1362349204}, {-1662115172, 1359801152}, {-1664199124, 1357249901}, {-1666279161, 1354695455},
+    {-1668355276, 1352137822}, {-1670427466, 1349577007}, {-1672495725, 1347013017}, {-1674560049, 1344445857},
+    {-1676620432, 1341875533}, {-1678676870, 1339302052}, {-1680729357, 1336725419}, {-1682777890, 1334145641},
+    {-1684822463, 1331562723}, {-1686863072, 1328976672}, {-1688899711, 1326387494}, {-1690932376, 1323795195},
+    {-1692961062, 1321199781}, {-1694985765, 1318601257}, {-1697006479, 1315999631}, {-1699023199, 1313394909},
+    {-1701035922, 1310787095}, {-1703044642, 1308176198}, {-1705049355, 1305562222}, {-1707050055, 1302945174},
+    {-1709046739, 1300325060}, {-1711039401, 1297701886}, {-1713028037, 1295075659}, {-1715012642, 1292446384},
+    {-1716993211, 1289814068}, {-1718969740, 1287178717}, {-1720942225, 1284540337}, {-1722910659, 1281898935},
+    {-1724875040, 1279254516}, {-1726835361, 1276607086}, {-1728791620, 1273956653}, {-1730743810, 1271303222},
+    {-1732691928, 1268646800}, {-1734635968, 1265987392}, {-1736575927, 1263325005}, {-1738511799, 1260659646},
+    {-1740443581, 1257991320}, {-1742371267, 1255320034}, {-1744294853, 1252645794}, {-1746214334, 1249968606},
+    {-1748129707, 1247288478}, {-1750040966, 1244605414}, {-1751948107, 1241919421}, {-1753851126, 1239230506},
+    {-1755750017, 1236538675}, {-1757644777, 1233843935}, {-1759535401, 1231146291}, {-1761421885, 1228445750},
+    {-1763304224, 1225742318}, {-1765182414, 1223036002}, {-1767056450, 1220326809}, {-1768926328, 1217614743},
+    {-1770792044, 1214899813}, {-1772653593, 1212182024}, {-1774510970, 1209461382}, {-1776364172, 1206737894},
+    {-1778213194, 1204011567}, {-1780058032, 1201282407}, {-1781898681, 1198550419}, {-1783735137, 1195815612},
+    {-1785567396, 1193077991}, {-1787395453, 1190337562}, {-1789219305, 1187594332}, {-1791038946, 1184848308},
+    {-1792854372, 1182099496}, {-1794665580, 1179347902}, {-1796472565, 1176593533}, {-1798275323, 1173836395},
+    {-1800073849, 1171076495}, {-1801868139, 1168313840}, {-1803658189, 1165548435}, {-1805443995, 1162780288},
+    {-1807225553, 1160009405}, {-1809002858, 1157235792}, {-1810775906, 1154459456}, {-1812544694, 1151680403},
+    {-1814309216, 1148898640}, {-1816069469, 1146114174}, {-1817825449, 1143327011}, {-1819577151, 1140537158},
+    {-1821324572, 1137744621}, {-1823067707, 1134949406}, {-1824806552, 1132151521}, {-1826541103, 1129350972},
+    {-1828271356, 1126547765}, {-1829997307, 1123741908}, {-1831718951, 1120933406}, {-1833436286, 1118122267},
+    {-1835149306, 1115308496}, {-1836858008, 1112492101}, {-1838562388, 1109673089}, {-1840262441, 1106851465},
+    {-1841958164, 1104027237}, {-1843649553, 1101200410}, {-1845336604, 1098370993}, {-1847019312, 1095538991},
+    {-1848697674, 1092704411}, {-1850371686, 1089867259}, {-1852041343, 1087027544}, {-1853706643, 1084185270},
+    {-1855367581, 1081340445}, {-1857024153, 1078493076}, {-1858676355, 1075643169}, {-1860324183, 1072790730},
+    {-1861967634, 1069935768}, {-1863606704, 1067078288}, {-1865241388, 1064218296}, {-1866871683, 1061355801},
+    {-1868497586, 1058490808}, {-1870119091, 1055623324}, {-1871736196, 1052753357}, {-1873348897, 1049880912},
+    {-1874957189, 1047005996}, {-1876561070, 1044128617}, {-1878160535, 1041248781}, {-1879755580, 1038366495},
+    {-1881346202, 1035481766}, {-1882932397, 1032594600}, {-1884514161, 1029705004}, {-1886091491, 1026812985},
+    {-1887664383, 1023918550}, {-1889232832, 1021021705}, {-1890796837, 1018122458}, {-1892356392, 1015220816},
+    {-1893911494, 1012316784}, {-1895462140, 1009410370}, {-1897008325, 1006501581}, {-1898550047, 1003590424},
+    {-1900087301, 1000676905}, {-1901620084, 997761031}, {-1903148392, 994842810}, {-1904672222, 991922248},
+    {-1906191570, 988999351}, {-1907706433, 986074127}, {-1909216806, 983146583}, {-1910722688, 980216726},
+    {-1912224073, 977284562}, {-1913720958, 974350098}, {-1915213340, 971413342}, {-1916701216, 968474300},
+    {-1918184581, 965532978}, {-1919663432, 962589385}, {-1921137767, 959643527}, {-1922607581, 956695411},
+    {-1924072871, 953745043}, {-1925533633, 950792431}, {-1926989864, 947837582}, {-1928441561, 944880503},
+    {-1929888720, 941921200}, {-1931331338, 938959681}, {-1932769411, 935995952}, {-1934202936, 933030021},
+    {-1935631910, 930061894}, {-1937056329, 927091579}, {-1938476190, 924119082}, {-1939891490, 921144411},
+    {-1941302225, 918167572}, {-1942708392, 915188572}, {-1944109987, 912207419}, {-1945507008, 909224120},
+    {-1946899451, 906238681}, {-1948287312, 903251110}, {-1949670589, 900261413}, {-1951049279, 897269597},
+    {-1952423377, 894275671}, {-1953792881, 891279640}, {-1955157788, 888281512}, {-1956518093, 885281293},
+    {-1957873796, 882278992}, {-1959224890, 879274614}, {-1960571375, 876268167}, {-1961913246, 873259659},
+    {-1963250501, 870249095}, {-1964583136, 867236484}, {-1965911148, 864221832}, {-1967234535, 861205147},
+    {-1968553292, 858186435}, {-1969867417, 855165703}, {-1971176906, 852142959}, {-1972481757, 849118210},
+    {-1973781967, 846091463}, {-1975077532, 843062726}, {-1976368450, 840032004}, {-1977654717, 836999305},
+    {-1978936331, 833964638}, {-1980213288, 830928007}, {-1981485585, 827889422}, {-1982753220, 824848888},
+    {-1984016189, 821806413}, {-1985274489, 818762005}, {-1986528118, 815715670}, {-1987777073, 812667415},
+    {-1989021350, 809617249}, {-1990260946, 806565177}, {-1991495860, 803511207}, {-1992726087, 800455346},
+    {-1993951625, 797397602}, {-1995172471, 794337982}, {-1996388622, 791276492}, {-1997600076, 788213141},
+    {-1998806829, 785147934}, {-2000008879, 782080880}, {-2001206222, 779011986}, {-2002398857, 775941259},
+    {-2003586779, 772868706}, {-2004769987, 769794334}, {-2005948478, 766718151}, {-2007122248, 763640164},
+    {-2008291295, 760560380}, {-2009455617, 757478806}, {-2010615210, 754395449}, {-2011770073, 751310318},
+    {-2012920201, 748223418}, {-2014065592, 745134758}, {-2015206245, 742044345}, {-2016342155, 738952186},
+    {-2017473321, 735858287}, {-2018599739, 732762657}, {-2019721407, 729665303}, {-2020838323, 726566232},
+    {-2021950484, 723465451}, {-2023057887, 720362968}, {-2024160529, 717258790}, {-2025258408, 714152924},
+    {-2026351522, 711045377}, {-2027439867, 707936158}, {-2028523442, 704825272}, {-2029602243, 701712728},
+    {-2030676269, 698598533}, {-2031745516, 695482694}, {-2032809982, 692365218}, {-2033869665, 689246113},
+    {-2034924562, 686125387}, {-2035974670, 683003045}, {-2037019988, 679879097}, {-2038060512, 676753549},
+    {-2039096241, 673626408}, {-2040127172, 670497682}, {-2041153301, 667367379}, {-2042174628, 664235505},
+    {-2043191150, 661102068}, {-2044202863, 657967075}, {-2045209767, 654830535}, {-2046211857, 651692453},
+    {-2047209133, 648552838}, {-2048201592, 645411696}, {-2049189231, 642269036}, {-2050172048, 639124865},
+    {-2051150040, 635979190}, {-2052123207, 632832018}, {-2053091544, 629683357}, {-2054055050, 626533215},
+    {-2055013723, 623381598}, {-2055967560, 620228514}, {-2056916560, 617073971}, {-2057860719, 613917975},
+    {-2058800036, 610760536}, {-2059734508, 607601658}, {-2060664133, 604441352}, {-2061588910, 601279623},
+    {-2062508835, 598116479}, {-2063423908, 594951927}, {-2064334124, 591785976}, {-2065239484, 588618632},
+    {-2066139983, 585449903}, {-2067035621, 582279796}, {-2067926394, 579108320}, {-2068812302, 575935480},
+    {-2069693342, 572761285}, {-2070569511, 569585743}, {-2071440808, 566408860}, {-2072307231, 563230645},
+    {-2073168777, 560051104}, {-2074025446, 556870245}, {-2074877233, 553688076}, {-2075724139, 550504604},
+    {-2076566160, 547319836}, {-2077403294, 544133781}, {-2078235540, 540946445}, {-2079062896, 537757837},
+    {-2079885360, 534567963}, {-2080702930, 531376831}, {-2081515603, 528184449}, {-2082323379, 524990824},
+    {-2083126254, 521795963}, {-2083924228, 518599875}, {-2084717298, 515402566}, {-2085505463, 512204045},
+    {-2086288720, 509004318}, {-2087067068, 505803394}, {-2087840505, 502601279}, {-2088609029, 499397982},
+    {-2089372638, 496193509}, {-2090131331, 492987869}, {-2090885105, 489781069}, {-2091633960, 486573117},
+    {-2092377892, 483364019}, {-2093116901, 480153784}, {-2093850985, 476942419}, {-2094580142, 473729932},
+    {-2095304370, 470516330}, {-2096023667, 467301622}, {-2096738032, 464085813}, {-2097447464, 460868912},
+    {-2098151960, 457650927}, {-2098851519, 454431865}, {-2099546139, 451211734}, {-2100235819, 447990541},
+    {-2100920556, 444768294}, {-2101600350, 441545000}, {-2102275199, 438320667}, {-2102945101, 435095303},
+    {-2103610054, 431868915}, {-2104270057, 428641511}, {-2104925109, 425413098}, {-2105575208, 422183684},
+    {-2106220352, 418953276}, {-2106860540, 415721883}, {-2107495770, 412489512}, {-2108126041, 409256170},
+    {-2108751352, 406021865}, {-2109371700, 402786604}, {-2109987085, 399550396}, {-2110597505, 396313247},
+    {-2111202959, 393075166}, {-2111803444, 389836160}, {-2112398960, 386596237}, {-2112989506, 383355404},
+    {-2113575080, 380113669}, {-2114155680, 376871039}, {-2114731305, 373627523}, {-2115301954, 370383128},
+    {-2115867626, 367137861}, {-2116428319, 363891730}, {-2116984031, 360644742}, {-2117534762, 357396906},
+    {-2118080511, 354148230}, {-2118621275, 350898719}, {-2119157054, 347648383}, {-2119687847, 344397230},
+    {-2120213651, 341145265}, {-2120734467, 337892498}, {-2121250292, 334638936}, {-2121761126, 331384586},
+    {-2122266967, 328129457}, {-2122767814, 324873555}, {-2123263666, 321616889}, {-2123754522, 318359466},
+    {-2124240380, 315101295}, {-2124721240, 311842381}, {-2125197100, 308582734}, {-2125667960, 305322361},
+    {-2126133817, 302061269}, {-2126594672, 298799466}, {-2127050522, 295536961}, {-2127501367, 292273760},
+    {-2127947206, 289009871}, {-2128388038, 285745302}, {-2128823862, 282480061}, {-2129254676, 279214155},
+    {-2129680480, 275947592}, {-2130101272, 272680379}, {-2130517052, 269412525}, {-2130927819, 266144038},
+    {-2131333572, 262874923}, {-2131734309, 259605191}, {-2132130030, 256334847}, {-2132520734, 253063900},
+    {-2132906420, 249792358}, {-2133287087, 246520228}, {-2133662734, 243247518}, {-2134033361, 239974235},
+    {-2134398966, 236700388}, {-2134759548, 233425984}, {-2135115107, 230151030}, {-2135465642, 226875535},
+    {-2135811153, 223599506}, {-2136151637, 220322951}, {-2136487095, 217045878}, {-2136817525, 213768293},
+    {-2137142927, 210490206}, {-2137463301, 207211624}, {-2137778644, 203932553}, {-2138088958, 200653003},
+    {-2138394240, 197372981}, {-2138694490, 194092495}, {-2138989708, 190811551}, {-2139279892, 187530159},
+    {-2139565043, 184248325}, {-2139845159, 180966058}, {-2140120240, 177683365}, {-2140390284, 174400254},
+    {-2140655293, 171116733}, {-2140915264, 167832808}, {-2141170197, 164548489}, {-2141420092, 161263783},
+    {-2141664948, 157978697}, {-2141904764, 154693240}, {-2142139541, 151407418}, {-2142369276, 148121241},
+    {-2142593971, 144834714}, {-2142813624, 141547847}, {-2143028234, 138260647}, {-2143237802, 134973122},
+    {-2143442326, 131685278}, {-2143641807, 128397125}, {-2143836244, 125108670}, {-2144025635, 121819921},
+    {-2144209982, 118530885}, {-2144389283, 115241570}, {-2144563539, 111951983}, {-2144732748, 108662134},
+    {-2144896910, 105372028}, {-2145056025, 102081675}, {-2145210092, 98791081}, {-2145359112, 95500255},
+    {-2145503083, 92209205}, {-2145642006, 88917937}, {-2145775880, 85626460}, {-2145904705, 82334782},
+    {-2146028480, 79042909}, {-2146147205, 75750851}, {-2146260881, 72458615}, {-2146369505, 69166208},
+    {-2146473080, 65873638}, {-2146571603, 62580914}, {-2146665076, 59288042}, {-2146753497, 55995030},
+    {-2146836866, 52701887}, {-2146915184, 49408620}, {-2146988450, 46115236}, {-2147056664, 42821744},
+    {-2147119825, 39528151}, {-2147177934, 36234466}, {-2147230991, 32940695}, {-2147278995, 29646846},
+    {-2147321946, 26352928}, {-2147359845, 23058947}, {-2147392690, 19764913}, {-2147420483, 16470832},
+    {-2147443222, 13176712}, {-2147460908, 9882561}, {-2147473542, 6588387}, {-2147481121, 3294197},
+};
+
+#endif  // FFT_TWIDDLE_TABLE_H
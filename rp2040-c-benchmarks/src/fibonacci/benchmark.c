@@ -10,9 +10,11 @@
  * https://en.wikipedia.org/wiki/Fibonacci_number
  *
  * Output format:
- *   task,method,n,result,time_us
+ *   task,method,n,time_us,...(see bench_stats.h),valid
  *
- * Timing uses the Pico SDK and results are printed via USB serial in CSV format.
+ * Each variant is registered as a descriptor (bench_registry.h) and repeated
+ * by the shared statistics engine; `time_us` is the median. Results are
+ * printed via USB serial in CSV format.
  *
  * @author Samuel Ivuerah
  */
@@ -20,7 +22,8 @@
 #include <stdio.h>
 #include "pico/stdlib.h"
 #include "pico/time.h"
-#include "benchmarks.h"
+#include "bench_registry.h"
+#include "bench_sink.h"
 
 /**
  * @brief Recursive Fibonacci implementation.
@@ -59,37 +62,85 @@ static int fib_iterative(int n) {
 }
 
 /**
- * @brief Run Fibonacci benchmarks on multiple input sizes.
- *
- * Times both iterative and recursive implementations for input values
- * 10, 20, 30, and 35. Results include calculated values and execution
- * time in microseconds.
- *
- * @note CSV format: task,method,n,result,time_us
+ * @brief Kernel context shared by the Fibonacci run callbacks.
  */
-void benchmark_fibonacci(void) {
-    const int test_values[] = {10, 20, 30, 35};
-    int result;
-    absolute_time_t start, end;
-    int64_t elapsed_us;
+typedef struct {
+    int n;          ///< Sequence index to compute
+    int result;     ///< Value produced by the last run
+    int reference;  ///< Expected value, computed untimed in setup
+} fib_ctx_t;
 
-    printf("task,method,n,result,time_us\n");
+#define FIB_MAX_N 46  ///< Largest index whose value fits in a 32-bit int
 
-    for (int i = 0; i < sizeof(test_values) / sizeof(test_values[0]); ++i) {
-        int n = test_values[i];
+static fib_ctx_t fib_ctx;
 
-        // Iterative variant
-        start = get_absolute_time();
-        result = fib_iterative(n);
-        end = get_absolute_time();
-        elapsed_us = absolute_time_diff_us(start, end);
-        printf("fibonacci,iterative,%d,%d,%lld\n", n, result, elapsed_us);
+/// Tested values: 10, 20, 30, 35
+static const int fib_params[] = {10, 20, 30, 35};
+
+static bool fib_setup(void* ctx, int n) {
+    fib_ctx_t* c = ctx;
+    if (n < 0 || n > FIB_MAX_N) {
+        return false;
+    }
+    c->n = n;
 
-        // Recursive variant
-        start = get_absolute_time();
-        result = fib_recursive(n);
-        end = get_absolute_time();
-        elapsed_us = absolute_time_diff_us(start, end);
-        printf("fibonacci,recursive,%d,%d,%lld\n", n, result, elapsed_us);
+    // Reference by straightforward summation, independent of both kernels
+    unsigned long long a = 0, b = 1;
+    for (int i = 0; i < n; i++) {
+        unsigned long long next = a + b;
+        a = b;
+        b = next;
     }
+    c->reference = (int)a;
+    c->result = -1;
+    return true;
+}
+
+static void run_iterative(void* ctx) {
+    fib_ctx_t* c = ctx;
+    c->result = fib_iterative(c->n);
+    bench_sink_u32((uint32_t)c->result);
+}
+
+static void run_recursive(void* ctx) {
+    fib_ctx_t* c = ctx;
+    c->result = fib_recursive(c->n);
+    bench_sink_u32((uint32_t)c->result);
 }
+
+static bool fib_verify(void* ctx) {
+    fib_ctx_t* c = ctx;
+    return c->result == c->reference;
+}
+
+/**
+ * @brief Iterative Fibonacci at n = 10, 20, 30, 35.
+ */
+const bench_desc_t bench_fibonacci_iterative = {
+    .task = "fibonacci",
+    .method = "iterative",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "n",
+    .params = fib_params,
+    .num_params = sizeof(fib_params) / sizeof(fib_params[0]),
+    .ctx = &fib_ctx,
+    .setup = fib_setup,
+    .run = run_iterative,
+    .verify = fib_verify,
+};
+
+/**
+ * @brief Recursive Fibonacci at n = 10, 20, 30, 35.
+ */
+const bench_desc_t bench_fibonacci_recursive = {
+    .task = "fibonacci",
+    .method = "recursive",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "n",
+    .params = fib_params,
+    .num_params = sizeof(fib_params) / sizeof(fib_params[0]),
+    .ctx = &fib_ctx,
+    .setup = fib_setup,
+    .run = run_recursive,
+    .verify = fib_verify,
+};
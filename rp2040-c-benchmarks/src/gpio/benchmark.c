@@ -22,7 +22,11 @@
  * is not defined in the final build.
  *
  * Output format:
- *   toggles,total_time_us,avg_toggle_us
+ *   toggles,total_time_us,avg_toggle_us,total_cycles,avg_toggle_cycles
+ *
+ * With clock sync running (bench_sync.h), the start of the loop is also
+ * printed as `sync_mark,gpio.toggle,<main_us>`, so the probe's first edge
+ * can be lined up with it.
  *
  * @author Samuel Ivuerah
  */
@@ -30,6 +34,9 @@
 #include "pico/stdlib.h"
 #include "hardware/gpio.h"
 #include <stdio.h>
+#include "bench_registry.h"
+#include "bench_sync.h"
+#include "bench_timer.h"
 
 #define TOGGLE_PIN 2
 #define TOGGLE_COUNT 1000
@@ -37,7 +44,7 @@
 // Uncomment for probe/buzzer verification
 //#define SLOW_TOGGLE
 
-void benchmark_gpio_toggle(void) {
+static void benchmark_gpio_toggle(void) {
     gpio_init(TOGGLE_PIN);
     gpio_set_dir(TOGGLE_PIN, GPIO_OUT);
 
@@ -45,9 +52,9 @@ void benchmark_gpio_toggle(void) {
     sleep_ms(3000);
 
     printf("Benchmark: GPIO Toggle\n");
-    printf("toggles,total_time_us,avg_toggle_us\n");
+    printf("toggles,total_time_us,avg_toggle_us,total_cycles,avg_toggle_cycles\n");
 
-    uint32_t start = time_us_32();
+    bench_timestamp_t start = bench_timer_now();
 
     for (int i = 0; i < TOGGLE_COUNT; i++) {
         gpio_put(TOGGLE_PIN, 1);
@@ -60,15 +67,22 @@ void benchmark_gpio_toggle(void) {
     #endif
     }
 
-    uint32_t end = time_us_32();
-    uint32_t duration = end - start;
-    float avg = (float)duration / TOGGLE_COUNT;
+    uint64_t cycles = bench_timer_elapsed_cycles(start, bench_timer_now());
+    double duration = bench_cycles_to_us(cycles);
 
     // Output benchmark results
-    printf("%d,%lu,%.2f\n", TOGGLE_COUNT, duration, avg);
-
-    // Keep the USB serial active after benchmarking
-    while (true) {
-        sleep_ms(1000);
-    }
+    printf("%d,%.3f,%.4f,%llu,%.2f\n", TOGGLE_COUNT, duration,
+           duration / TOGGLE_COUNT, (unsigned long long)cycles,
+           (double)cycles / TOGGLE_COUNT);
+    bench_sync_mark("gpio.toggle", start);
 }
+
+/**
+ * @brief GPIO toggle timing on GPIO2 (self-timed, needs external wiring).
+ */
+const bench_desc_t bench_gpio_toggle = {
+    .task = "gpio",
+    .method = "toggle",
+    .category = BENCH_CATEGORY_HARDWARE,
+    .standalone = benchmark_gpio_toggle,
+};
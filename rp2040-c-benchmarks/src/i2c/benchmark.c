@@ -15,7 +15,7 @@
  * Results are printed in CSV format via USB serial.
  *
  * Output format:
- *   task,method,iterations,total_time_us,avg_time_us
+ *   task,method,iterations,total_time_us,avg_time_us,total_cycles,avg_cycles
  *
  * @author Samuel Ivuerah
  */
@@ -23,6 +23,8 @@
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
 #include <stdio.h>
+#include "bench_registry.h"
+#include "bench_timer.h"
 
 #define I2C_PORT i2c0
 #define SDA_PIN 8
@@ -40,7 +42,7 @@
  *
  * @return void
  */
-void benchmark_i2c(void) {
+static void benchmark_i2c(void) {
     stdio_init_all();
     sleep_ms(3000);  // Allow USB serial connection
 
@@ -55,22 +57,28 @@ void benchmark_i2c(void) {
     const int loops = 100;
 
     printf("Benchmark: I2C Write\n");
-    printf("task,method,iterations,total_time_us,avg_time_us\n");
+    printf("task,method,iterations,total_time_us,avg_time_us,total_cycles,avg_cycles\n");
 
-    uint32_t start = time_us_32();
+    bench_timestamp_t start = bench_timer_now();
 
     for (int i = 0; i < loops; i++) {
         i2c_write_blocking(I2C_PORT, I2C_ADDR, message, 4, false);
     }
 
-    uint32_t end = time_us_32();
-    uint32_t duration = end - start;
-    float avg = (float)duration / loops;
+    uint64_t cycles = bench_timer_elapsed_cycles(start, bench_timer_now());
+    double duration = bench_cycles_to_us(cycles);
 
     // Print CSV-formatted results
-    printf("i2c,write,%d,%lu,%.2f\n", loops, duration, avg);
-
-    while (true) {
-        sleep_ms(1000);  // Keep USB serial alive
-    }
+    printf("i2c,write,%d,%.3f,%.3f,%llu,%.1f\n", loops, duration, duration / loops,
+           (unsigned long long)cycles, (double)cycles / loops);
 }
+
+/**
+ * @brief I2C master write latency to the responder Pico (self-timed, needs external wiring).
+ */
+const bench_desc_t bench_i2c_write = {
+    .task = "i2c",
+    .method = "write",
+    .category = BENCH_CATEGORY_HARDWARE,
+    .standalone = benchmark_i2c,
+};
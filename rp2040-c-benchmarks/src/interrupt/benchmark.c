@@ -14,7 +14,11 @@
  *   - Buzzer GND → Common GND rail
  *
  * Output format:
- *   task,method,latency_us
+ *   task,method,latency_us,latency_cycles,gpio,events
+ *
+ * The ISR only appends a record to a RAM ring (bench_results.h); all rows are
+ * printed after the last event, so USB serial activity never runs inside the
+ * ISR or between the timestamp and the interrupt being measured.
  *
  * The button is connected to GPIO14 (input), and the buzzer is connected to GPIO15 (output).
  *
@@ -23,41 +27,62 @@
 
 #include "pico/stdlib.h"
 #include "hardware/gpio.h"
+#include "hardware/sync.h"
 #include <stdio.h>
 #include <stdbool.h>
+#include "bench_registry.h"
+#include "bench_results.h"
+#include "bench_timer.h"
 
 #define BUTTON_GPIO 14      // GPIO14 = pin 19 (input from button)
 #define BUZZER_GPIO 15      // GPIO15 = pin 20 (output to buzzer)
+#define INTERRUPT_EVENTS 20 // Edges to record before returning
 
-volatile uint32_t irq_start_time = 0;
-volatile uint32_t irq_latency = 0;
+/// Written by the main loop with interrupts off: the two words of a
+/// timestamp cannot be stored atomically, and the ISR must not see half of one
+volatile bench_timestamp_t irq_start_time;
+volatile uint64_t irq_latency = 0;  ///< Latency of the last interrupt in cycles
 volatile bool trigger_buzz = false;
+volatile uint32_t irq_count = 0;
+
+BENCH_RING_DEFINE(latency_ring, 32);  ///< Must hold INTERRUPT_EVENTS records
 
 /**
  * @brief GPIO interrupt callback function.
  *
  * This ISR is triggered on both rising and falling edges on BUTTON_GPIO.
- * It records the interrupt latency, prints the result, and activates
- * the buzzer in the main loop.
+ * It records the interrupt latency in the result ring and activates the
+ * buzzer in the main loop. Nothing is printed here.
  *
  * @param gpio The GPIO pin that triggered the interrupt.
  * @param events The type of edge event (rise or fall).
  */
 void gpio_irq_callback(uint gpio, uint32_t events) {
-    printf("ISR triggered on GPIO %d! Event: %lu\n", gpio, events);
-
-    irq_latency = time_us_32() - irq_start_time;
-    printf("interrupt,triggered,%lu\n", irq_latency);
+    bench_timestamp_t now = bench_timer_now();
+    irq_latency = bench_timer_elapsed_cycles(irq_start_time, now);
+    bench_ring_push(&latency_ring, gpio, events, irq_latency);
 
+    irq_count++;
     trigger_buzz = true;
 }
 
+/**
+ * @brief Print one latency record as a CSV row.
+ */
+static void print_latency(const bench_record_t* rec, void* user) {
+    (void)user;
+    printf("interrupt,triggered,%.3f,%llu,%lu,%lu\n",
+           bench_cycles_to_us(rec->cycles), (unsigned long long)rec->cycles,
+           (unsigned long)rec->tag, (unsigned long)rec->value);
+}
+
 /**
  * @brief Run the interrupt latency benchmark using a button press.
  *
  * Waits for an external GPIO interrupt and measures the time between the
  * polling loop and ISR execution. Activates a buzzer for visual confirmation.
- * Outputs timing data in CSV format for each event.
+ * Collects INTERRUPT_EVENTS edges, then prints one CSV row per event and
+ * returns so the rest of the suite can continue.
  *
  * Wiring:
  *   - Button: GPIO14 (input, pulled down)
@@ -65,7 +90,7 @@ void gpio_irq_callback(uint gpio, uint32_t events) {
  *
  * @return void
  */
-void benchmark_interrupt(void) {
+static void benchmark_interrupt(void) {
     stdio_init_all();
     sleep_ms(3000);  // Give USB time to connect
 
@@ -77,6 +102,14 @@ void benchmark_interrupt(void) {
     gpio_set_dir(BUZZER_GPIO, GPIO_OUT);
     gpio_put(BUZZER_GPIO, 0);
 
+    printf("Benchmark: Interrupt Latency\n");
+    printf("task,method,latency_us,latency_cycles,gpio,events\n");
+    printf("Press the button %d times to trigger interrupts...\n", INTERRUPT_EVENTS);
+    bench_output_settle();
+
+    bench_ring_reset(&latency_ring);
+    irq_count = 0;
+
     gpio_set_irq_enabled_with_callback(
         BUTTON_GPIO,
         GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL,
@@ -84,13 +117,12 @@ void benchmark_interrupt(void) {
         &gpio_irq_callback
     );
 
-    printf("Benchmark: Interrupt Latency\n");
-    printf("task,method,latency_us\n");
-    printf("Press the button to trigger interrupt...\n");
-
-    while (true) {
-        // Capture timestamp before polling for event
-        irq_start_time = time_us_32();
+    while (irq_count < INTERRUPT_EVENTS) {
+        // Capture timestamp before polling for event (a pending edge is taken
+        // on restore, and its latency still counts from this timestamp)
+        uint32_t irq_state = save_and_disable_interrupts();
+        irq_start_time = bench_timer_now();
+        restore_interrupts(irq_state);
 
         // If ISR was triggered, activate buzzer briefly
         if (trigger_buzz) {
@@ -102,4 +134,20 @@ void benchmark_interrupt(void) {
 
         tight_loop_contents();  // Hint to compiler that we're intentionally spinning
     }
+
+    gpio_set_irq_enabled(BUTTON_GPIO, GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, false);
+    gpio_put(BUZZER_GPIO, 0);
+
+    // Measurement finished: now it is safe to format and print
+    bench_ring_drain(&latency_ring, print_latency, NULL);
 }
+
+/**
+ * @brief Interrupt latency from a button press on GPIO14 (self-timed).
+ */
+const bench_desc_t bench_interrupt_triggered = {
+    .task = "interrupt",
+    .method = "triggered",
+    .category = BENCH_CATEGORY_HARDWARE,
+    .standalone = benchmark_interrupt,
+};
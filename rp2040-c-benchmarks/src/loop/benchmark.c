@@ -7,10 +7,11 @@
  * loop control overhead in a bare-metal environment using the RP2040.
  *
  * A `volatile` counter is used to prevent the compiler from optimising
- * the loop body away, ensuring accurate timing measurements.
+ * the loop body away, ensuring accurate timing measurements. The counter is
+ * checked after every run to have advanced by exactly the iteration count.
  *
  * Output format:
- *   task,method,iterations,time_us
+ *   task,method,iterations,time_us,...(see bench_stats.h),valid
  *
  * @author Samuel Ivuerah
  */
@@ -18,7 +19,7 @@
 #include <stdio.h>
 #include "pico/stdlib.h"
 #include "pico/time.h"
-#include "benchmarks.h"
+#include "bench_registry.h"
 
 /**
  * @brief Increment a volatile counter N times.
@@ -37,29 +38,59 @@ static void loop_counter(volatile int* sink, int iterations) {
 }
 
 /**
- * @brief Run loop overhead benchmark with various iteration sizes.
- *
- * Tests increment loop overhead using four common scales: 1k, 10k, 100k, and 1M.
- * Outputs results in CSV format for external analysis or plotting.
- *
- * CSV format:
- *   task,method,iterations,time_us
- *
- * @return void
+ * @brief Kernel context for one iteration count.
  */
-void benchmark_loop_overhead(void) {
-    int iterations[] = {1000, 10000, 100000, 1000000};
-    volatile int sink = 0;
+typedef struct {
+    volatile int* sink;  ///< Counter incremented by the loop
+    int iterations;      ///< Loop trip count
+} loop_ctx_t;
 
-    printf("task,method,iterations,time_us\n");
+static volatile int loop_sink = 0;
+static loop_ctx_t loop_ctx = { .sink = &loop_sink };
 
-    for (int i = 0; i < sizeof(iterations) / sizeof(int); i++) {
-        int n = iterations[i];
+/// Default scales: 1k, 10k, 100k, 1M
+static const int loop_iterations[] = {1000, 10000, 100000, 1000000};
 
-        absolute_time_t start = get_absolute_time();
-        loop_counter(&sink, n);
-        int64_t elapsed = absolute_time_diff_us(start, get_absolute_time());
+#define LOOP_SWEEP_MAX 1024000  ///< Sweeps run 1000, 2000, ... 1024000
 
-        printf("loop,for_loop,%d,%lld\n", n, elapsed);
-    }
+static bool loop_setup(void* ctx, int iterations) {
+    loop_ctx_t* c = ctx;
+    c->iterations = iterations;
+    return true;
+}
+
+/**
+ * @brief Reset the counter before each run (untimed) so it can be verified.
+ */
+static void loop_prepare(void* ctx) {
+    loop_ctx_t* c = ctx;
+    *c->sink = 0;
 }
+
+static void run_loop(void* ctx) {
+    loop_ctx_t* c = ctx;
+    loop_counter(c->sink, c->iterations);
+}
+
+static bool loop_verify(void* ctx) {
+    loop_ctx_t* c = ctx;
+    return *c->sink == c->iterations;
+}
+
+/**
+ * @brief Loop overhead at 1k, 10k, 100k and 1M iterations.
+ */
+const bench_desc_t bench_loop_for_loop = {
+    .task = "loop",
+    .method = "for_loop",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "iterations",
+    .params = loop_iterations,
+    .num_params = sizeof(loop_iterations) / sizeof(loop_iterations[0]),
+    .sweep_max = LOOP_SWEEP_MAX,
+    .ctx = &loop_ctx,
+    .setup = loop_setup,
+    .prepare = loop_prepare,
+    .run = run_loop,
+    .verify = loop_verify,
+};
@@ -3,14 +3,29 @@
  * @brief Matrix Multiplication Benchmark for RP2040.
  *
  * This benchmark evaluates the performance of a square matrix multiplication
- * algorithm using fixed-size 2D integer arrays. It multiplies two NxN matrices
- * for N = 10 and 20, and measures the time taken using the RP2040's internal timer.
+ * algorithm using 2D integer arrays. It multiplies two NxN matrices for
+ * N = 10 and 20 by default, and measures the time taken using the RP2040's
+ * internal timer.
+ *
+ * The remaining variants use the kernels in matrix_kernels.c: contiguous
+ * row-major storage (10, 20, 32 and 64 by default), B stored transposed, 2×2
+ * register blocking, and int16, int8 and float element types. Comparing them
+ * with `multiply` separates the cost of the data layout from the cost of the
+ * arithmetic.
+ *
+ * `parallel` splits the rows of `blocked` between the two cores
+ * (bench_parallel.h); `matrix.speedup` reports its speedup over `blocked`.
+ *
+ * Every variant allocates its matrices from the benchmark arena
+ * (bench_arena.h) for the requested size, so sweeps run up to
+ * MATRIX_SWEEP_MAX and print `skip` where the arena runs out.
  *
  * This test is designed to capture loop nesting depth and memory access patterns.
+ * The product is checked against a closed-form reference after timing.
  * Results are printed in CSV format over USB serial.
  *
  * Output format:
- *   task,method,size,time_us
+ *   task,method,size,time_us,...(see bench_stats.h),valid
  *
  * @author Samuel Ivuerah
  */
@@ -18,21 +33,27 @@
 #include <stdio.h>
 #include "pico/stdlib.h"
 #include "pico/time.h"
-#include "benchmarks.h"
+#include "bench_arena.h"
+#include "bench_parallel.h"
+#include "bench_registry.h"
+#include "bench_sink.h"
+#include "matrix_kernels.h"
+
+#define MATRIX_SWEEP_MAX 160  ///< Sweeps run 10, 20, 40, 80, 160
 
 /**
  * @brief Multiply two square integer matrices (A × B = C).
  *
  * Standard matrix multiplication algorithm. Operates in-place on
- * 2D integer arrays using triple-nested loops. Max matrix size is
- * constrained to 20x20 for simplicity and static memory allocation.
+ * 2D integer arrays using triple-nested loops. The arrays are
+ * variably modified, so the row stride is the runtime size.
  *
  * @param size Size of the matrix (NxN).
  * @param A Left-hand input matrix.
  * @param B Right-hand input matrix.
  * @param C Output matrix to store the result.
  */
-static void matrix_multiply(int size, int A[][20], int B[][20], int C[][20]) {
+static void matrix_multiply(int size, int A[size][size], int B[size][size], int C[size][size]) {
     for (int i = 0; i < size; i++) {
         for (int j = 0; j < size; j++) {
             C[i][j] = 0;
@@ -44,43 +65,402 @@ static void matrix_multiply(int size, int A[][20], int B[][20], int C[][20]) {
 }
 
 /**
- * @brief Run matrix multiplication benchmark for 10×10 and 20×20 inputs.
- *
- * Initialises matrices A and B with predefined integer values. Measures the
- * execution time of multiplying A × B into output matrix C. Each test result
- * is printed in CSV format, showing matrix size and timing in microseconds.
+ * @brief Kernel context for one matrix size.
+ */
+typedef struct {
+    int n;
+    int* A;  ///< n×n, row-major (benchmark arena)
+    int* B;
+    int* C;
+} matrix_ctx_t;
+
+static matrix_ctx_t matrix_ctx;
+
+/// Default sizes: 10x10, 20x20
+static const int matrix_sizes[] = {10, 20};
+
+/**
+ * @brief Allocate the matrices and populate them with sample data.
+ */
+static bool matrix_setup(void* ctx, int n) {
+    matrix_ctx_t* c = ctx;
+    if (n < 1) {
+        return false;
+    }
+    size_t bytes = (size_t)n * n * sizeof(int);
+    c->A = bench_arena_alloc(bytes);
+    c->B = bench_arena_alloc(bytes);
+    c->C = bench_arena_alloc(bytes);
+    if (!c->A || !c->B || !c->C) {
+        return false;
+    }
+    c->n = n;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            c->A[i * n + j] = i + j;
+            c->B[i * n + j] = i - j;
+        }
+    }
+    return true;
+}
+
+static void run_multiply(void* ctx) {
+    matrix_ctx_t* c = ctx;
+    int n = c->n;
+    matrix_multiply(n, (int (*)[n])c->A, (int (*)[n])c->B, (int (*)[n])c->C);
+    bench_sink_ptr(c->C);
+}
+
+/**
+ * @brief Check C against the closed form of the product of the test inputs.
  *
- * CSV format:
- *   task,method,size,time_us
+ * With A[i][k] = i + k and B[k][j] = k - j, summing over k gives
+ * C[i][j] = (i - j)·S1 - n·i·j + S2, where S1 = Σk and S2 = Σk².
+ */
+static bool matrix_verify(void* ctx) {
+    matrix_ctx_t* c = ctx;
+    int n = c->n;
+    int s1 = n * (n - 1) / 2;
+    int s2 = (n - 1) * n * (2 * n - 1) / 6;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            if (c->C[i * n + j] != (i - j) * s1 - n * i * j + s2) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Matrix multiplication for 10×10 and 20×20 inputs.
+ */
+const bench_desc_t bench_matrix_multiply = {
+    .task = "matrix",
+    .method = "multiply",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = matrix_sizes,
+    .num_params = sizeof(matrix_sizes) / sizeof(matrix_sizes[0]),
+    .sweep_max = MATRIX_SWEEP_MAX,
+    .ctx = &matrix_ctx,
+    .setup = matrix_setup,
+    .run = run_multiply,
+    .verify = matrix_verify,
+};
+
+#define MATRIX_I8_MAX_N 64    ///< A[i][p] = i + p must fit in int8
+#define MATRIX_F32_MAX_N 200  ///< Partial sums (below 2n³) must stay exact in float
+
+/**
+ * @brief Element type of a contiguous variant.
+ */
+typedef enum {
+    MATRIX_I32,
+    MATRIX_I16,
+    MATRIX_I8,
+    MATRIX_F32,
+} matrix_type_t;
+
+/**
+ * @brief One contiguous storage buffer, viewed as the variant's element type.
+ */
+typedef union {
+    void* any;
+    int32_t* i32;
+    int16_t* i16;
+    int8_t* i8;
+    float* f32;
+} matrix_buf_t;
+
+/// Operands and product of the current variant and size (benchmark arena)
+static matrix_buf_t matrix_a;
+static matrix_buf_t matrix_b;
+static matrix_buf_t matrix_c;
+
+/**
+ * @brief Kernel context for a contiguous variant.
+ */
+typedef struct {
+    matrix_type_t type;
+    bool transposed;  ///< B stored as B^T (n×k)
+    int n;
+} matrix_kernel_ctx_t;
+
+/// Default sizes for the contiguous variants
+static const int matrix_kernel_sizes[] = {10, 20, 32, 64};
+
+/**
+ * @brief Bytes per element of the operands (the product is always 4 bytes).
+ */
+static size_t matrix_elem_size(matrix_type_t type) {
+    switch (type) {
+        case MATRIX_I16: return sizeof(int16_t);
+        case MATRIX_I8: return sizeof(int8_t);
+        default: return sizeof(int32_t);
+    }
+}
+
+/**
+ * @brief Store v at flat index idx of buf, in the variant's element type.
+ */
+static void matrix_store(matrix_buf_t* buf, matrix_type_t type, int idx, int v) {
+    switch (type) {
+        case MATRIX_I32: buf->i32[idx] = v; break;
+        case MATRIX_I16: buf->i16[idx] = (int16_t)v; break;
+        case MATRIX_I8: buf->i8[idx] = (int8_t)v; break;
+        case MATRIX_F32: buf->f32[idx] = (float)v; break;
+    }
+}
+
+/**
+ * @brief Allocate A, B (or B^T) and C, and fill A and B with the same test
+ *        data as `multiply`.
+ */
+static bool matrix_kernel_setup(void* ctx, int n) {
+    matrix_kernel_ctx_t* c = ctx;
+    if (n < 1 || (c->type == MATRIX_I8 && n > MATRIX_I8_MAX_N) ||
+        (c->type == MATRIX_F32 && n > MATRIX_F32_MAX_N)) {
+        return false;
+    }
+    size_t elems = (size_t)n * n;
+    matrix_a.any = bench_arena_alloc(elems * matrix_elem_size(c->type));
+    matrix_b.any = bench_arena_alloc(elems * matrix_elem_size(c->type));
+    matrix_c.any = bench_arena_alloc(elems * sizeof(int32_t));
+    if (!matrix_a.any || !matrix_b.any || !matrix_c.any) {
+        return false;
+    }
+    c->n = n;
+    for (int r = 0; r < n; r++) {
+        for (int q = 0; q < n; q++) {
+            matrix_store(&matrix_a, c->type, r * n + q, r + q);    // A[r][q]
+            int b_rq = r - q;                                       // B[r][q]
+            int idx = c->transposed ? q * n + r : r * n + q;
+            matrix_store(&matrix_b, c->type, idx, b_rq);
+        }
+    }
+    return true;
+}
+
+static void run_naive(void* ctx) {
+    matrix_kernel_ctx_t* c = ctx;
+    mat_mul_i32(matrix_a.i32, matrix_b.i32, matrix_c.i32, c->n, c->n, c->n);
+    bench_sink_ptr(matrix_c.i32);
+}
+
+static void run_transposed(void* ctx) {
+    matrix_kernel_ctx_t* c = ctx;
+    mat_mul_i32_bt(matrix_a.i32, matrix_b.i32, matrix_c.i32, c->n, c->n, c->n);
+    bench_sink_ptr(matrix_c.i32);
+}
+
+static void run_blocked(void* ctx) {
+    matrix_kernel_ctx_t* c = ctx;
+    mat_mul_i32_bt_blocked(matrix_a.i32, matrix_b.i32, matrix_c.i32, c->n, c->n, c->n);
+    bench_sink_ptr(matrix_c.i32);
+}
+
+/**
+ * @brief One worker's share of `blocked`: an even-aligned band of rows of C.
  *
- * @return void
+ * Both bands read all of B^T; they write disjoint rows, so the workers
+ * never synchronise before the join.
  */
-void benchmark_matrix_multiplication(void) {
-    int sizes[] = {10, 20};
+static void blocked_rows_worker(void* ctx, int worker) {
+    matrix_kernel_ctx_t* c = ctx;
+    int n = c->n;
+    int first = (n * worker / BENCH_PARALLEL_WORKERS) & ~1;
+    int last = worker + 1 == BENCH_PARALLEL_WORKERS
+                   ? n
+                   : (n * (worker + 1) / BENCH_PARALLEL_WORKERS) & ~1;
+    mat_mul_i32_bt_blocked(matrix_a.i32 + first * n, matrix_b.i32, matrix_c.i32 + first * n,
+                           last - first, n, n);
+}
 
-    int A[20][20];
-    int B[20][20];
-    int C[20][20];
+static void run_parallel(void* ctx) {
+    bench_parallel_run(blocked_rows_worker, ctx);
+    bench_sink_ptr(matrix_c.i32);
+}
 
-    printf("task,method,size,time_us\n");
+static void run_i16(void* ctx) {
+    matrix_kernel_ctx_t* c = ctx;
+    mat_mul_i16_bt(matrix_a.i16, matrix_b.i16, matrix_c.i32, c->n, c->n, c->n);
+    bench_sink_ptr(matrix_c.i32);
+}
 
-    for (int s = 0; s < sizeof(sizes) / sizeof(int); s++) {
-        int n = sizes[s];
+static void run_i8(void* ctx) {
+    matrix_kernel_ctx_t* c = ctx;
+    mat_mul_i8_bt(matrix_a.i8, matrix_b.i8, matrix_c.i32, c->n, c->n, c->n);
+    bench_sink_ptr(matrix_c.i32);
+}
 
-        // Populate test matrices with sample data
-        for (int i = 0; i < n; i++) {
-            for (int j = 0; j < n; j++) {
-                A[i][j] = i + j;
-                B[i][j] = i - j;
+static void run_f32(void* ctx) {
+    matrix_kernel_ctx_t* c = ctx;
+    mat_mul_f32_bt(matrix_a.f32, matrix_b.f32, matrix_c.f32, c->n, c->n, c->n);
+    bench_sink_ptr(matrix_c.f32);
+}
+
+/**
+ * @brief Check C against the same closed form as matrix_verify().
+ *
+ * The float products are exact: every partial sum is an integer below 2^24
+ * (MATRIX_F32_MAX_N).
+ */
+static bool matrix_kernel_verify(void* ctx) {
+    matrix_kernel_ctx_t* c = ctx;
+    int n = c->n;
+    int s1 = n * (n - 1) / 2;
+    int s2 = (n - 1) * n * (2 * n - 1) / 6;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            int expected = (i - j) * s1 - n * i * j + s2;
+            bool ok = c->type == MATRIX_F32 ? matrix_c.f32[i * n + j] == (float)expected
+                                            : matrix_c.i32[i * n + j] == expected;
+            if (!ok) {
+                return false;
             }
         }
+    }
+    return true;
+}
 
-        // Time the matrix multiplication
-        absolute_time_t start = get_absolute_time();
-        matrix_multiply(n, A, B, C);
-        int64_t elapsed = absolute_time_diff_us(start, get_absolute_time());
+static matrix_kernel_ctx_t naive_ctx = {.type = MATRIX_I32};
+static matrix_kernel_ctx_t transposed_ctx = {.type = MATRIX_I32, .transposed = true};
+static matrix_kernel_ctx_t blocked_ctx = {.type = MATRIX_I32, .transposed = true};
+static matrix_kernel_ctx_t parallel_ctx = {.type = MATRIX_I32, .transposed = true};
+static matrix_kernel_ctx_t i16_ctx = {.type = MATRIX_I16, .transposed = true};
+static matrix_kernel_ctx_t i8_ctx = {.type = MATRIX_I8, .transposed = true};
+static matrix_kernel_ctx_t f32_ctx = {.type = MATRIX_F32, .transposed = true};
 
-        // Print result in CSV format
-        printf("matrix,multiply,%d,%lld\n", n, elapsed);
-    }
+/**
+ * @brief int32 ijk multiply on contiguous storage (B read column-wise).
+ */
+const bench_desc_t bench_matrix_naive = {
+    .task = "matrix",
+    .method = "naive",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = matrix_kernel_sizes,
+    .num_params = sizeof(matrix_kernel_sizes) / sizeof(matrix_kernel_sizes[0]),
+    .sweep_max = MATRIX_SWEEP_MAX,
+    .ctx = &naive_ctx,
+    .setup = matrix_kernel_setup,
+    .run = run_naive,
+    .verify = matrix_kernel_verify,
+};
+
+/**
+ * @brief int32 multiply with B stored transposed (sequential dot products).
+ */
+const bench_desc_t bench_matrix_transposed = {
+    .task = "matrix",
+    .method = "transposed",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = matrix_kernel_sizes,
+    .num_params = sizeof(matrix_kernel_sizes) / sizeof(matrix_kernel_sizes[0]),
+    .sweep_max = MATRIX_SWEEP_MAX,
+    .ctx = &transposed_ctx,
+    .setup = matrix_kernel_setup,
+    .run = run_transposed,
+    .verify = matrix_kernel_verify,
+};
+
+/**
+ * @brief int32 multiply, B transposed, 2×2 register-blocked.
+ */
+const bench_desc_t bench_matrix_blocked = {
+    .task = "matrix",
+    .method = "blocked",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = matrix_kernel_sizes,
+    .num_params = sizeof(matrix_kernel_sizes) / sizeof(matrix_kernel_sizes[0]),
+    .sweep_max = MATRIX_SWEEP_MAX,
+    .ctx = &blocked_ctx,
+    .setup = matrix_kernel_setup,
+    .run = run_blocked,
+    .verify = matrix_kernel_verify,
+};
+
+/**
+ * @brief `blocked` with its rows split between both cores.
+ */
+const bench_desc_t bench_matrix_parallel = {
+    .task = "matrix",
+    .method = "parallel",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = matrix_kernel_sizes,
+    .num_params = sizeof(matrix_kernel_sizes) / sizeof(matrix_kernel_sizes[0]),
+    .sweep_max = MATRIX_SWEEP_MAX,
+    .ctx = &parallel_ctx,
+    .setup = matrix_kernel_setup,
+    .run = run_parallel,
+    .verify = matrix_kernel_verify,
+};
+
+/**
+ * @brief int16 × int16 → int32 multiply-accumulate, B transposed.
+ */
+const bench_desc_t bench_matrix_i16 = {
+    .task = "matrix",
+    .method = "i16",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = matrix_kernel_sizes,
+    .num_params = sizeof(matrix_kernel_sizes) / sizeof(matrix_kernel_sizes[0]),
+    .sweep_max = MATRIX_SWEEP_MAX,
+    .ctx = &i16_ctx,
+    .setup = matrix_kernel_setup,
+    .run = run_i16,
+    .verify = matrix_kernel_verify,
+};
+
+/**
+ * @brief int8 × int8 → int32 multiply-accumulate, B transposed.
+ */
+const bench_desc_t bench_matrix_i8 = {
+    .task = "matrix",
+    .method = "i8",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = matrix_kernel_sizes,
+    .num_params = sizeof(matrix_kernel_sizes) / sizeof(matrix_kernel_sizes[0]),
+    .sweep_max = MATRIX_SWEEP_MAX,
+    .ctx = &i8_ctx,
+    .setup = matrix_kernel_setup,
+    .run = run_i8,
+    .verify = matrix_kernel_verify,
+};
+
+/**
+ * @brief Single-precision multiply (soft-float), B transposed.
+ */
+const bench_desc_t bench_matrix_f32 = {
+    .task = "matrix",
+    .method = "f32",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = matrix_kernel_sizes,
+    .num_params = sizeof(matrix_kernel_sizes) / sizeof(matrix_kernel_sizes[0]),
+    .sweep_max = MATRIX_SWEEP_MAX,
+    .ctx = &f32_ctx,
+    .setup = matrix_kernel_setup,
+    .run = run_f32,
+    .verify = matrix_kernel_verify,
+};
+
+static void benchmark_matrix_speedup(void) {
+    bench_parallel_report(&bench_matrix_blocked, &bench_matrix_parallel);
 }
+
+/**
+ * @brief Speedup and efficiency of `parallel` over single-core `blocked`.
+ */
+const bench_desc_t bench_matrix_speedup = {
+    .task = "matrix",
+    .method = "speedup",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .standalone = benchmark_matrix_speedup,
+};
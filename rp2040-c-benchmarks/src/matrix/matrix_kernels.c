@@ -0,0 +1,125 @@
+/**
+ * @file matrix_kernels.c
+ * @brief Row-major matrix multiplication kernels (see matrix_kernels.h).
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include "matrix_kernels.h"
+
+void mat_mul_i32(const int32_t* a, const int32_t* b, int32_t* c, int m, int k, int n) {
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) {
+            int32_t sum = 0;
+            for (int p = 0; p < k; p++) {
+                sum += a[i * k + p] * b[p * n + j];
+            }
+            c[i * n + j] = sum;
+        }
+    }
+}
+
+/**
+ * @brief Dot product of two sequential int32 rows.
+ */
+static inline int32_t dot_i32(const int32_t* x, const int32_t* y, int k) {
+    int32_t sum = 0;
+    for (int p = 0; p < k; p++) {
+        sum += x[p] * y[p];
+    }
+    return sum;
+}
+
+void mat_mul_i32_bt(const int32_t* a, const int32_t* bt, int32_t* c, int m, int k, int n) {
+    for (int i = 0; i < m; i++) {
+        const int32_t* row = a + i * k;
+        for (int j = 0; j < n; j++) {
+            c[i * n + j] = dot_i32(row, bt + j * k, k);
+        }
+    }
+}
+
+void mat_mul_i32_bt_blocked(const int32_t* a, const int32_t* bt, int32_t* c, int m, int k, int n) {
+    int i = 0;
+    for (; i + 1 < m; i += 2) {
+        const int32_t* a0 = a + i * k;
+        const int32_t* a1 = a0 + k;
+
+        int j = 0;
+        for (; j + 1 < n; j += 2) {
+            const int32_t* b0 = bt + j * k;
+            const int32_t* b1 = b0 + k;
+            int32_t c00 = 0;
+            int32_t c01 = 0;
+            int32_t c10 = 0;
+            int32_t c11 = 0;
+
+            for (int p = 0; p < k; p++) {
+                int32_t x0 = a0[p];
+                int32_t x1 = a1[p];
+                int32_t y0 = b0[p];
+                int32_t y1 = b1[p];
+                c00 += x0 * y0;
+                c01 += x0 * y1;
+                c10 += x1 * y0;
+                c11 += x1 * y1;
+            }
+
+            c[i * n + j] = c00;
+            c[i * n + j + 1] = c01;
+            c[(i + 1) * n + j] = c10;
+            c[(i + 1) * n + j + 1] = c11;
+        }
+        if (j < n) {  // Odd n: last column
+            c[i * n + j] = dot_i32(a0, bt + j * k, k);
+            c[(i + 1) * n + j] = dot_i32(a1, bt + j * k, k);
+        }
+    }
+    if (i < m) {  // Odd m: last row
+        for (int j = 0; j < n; j++) {
+            c[i * n + j] = dot_i32(a + i * k, bt + j * k, k);
+        }
+    }
+}
+
+void mat_mul_i16_bt(const int16_t* a, const int16_t* bt, int32_t* c, int m, int k, int n) {
+    for (int i = 0; i < m; i++) {
+        const int16_t* row = a + i * k;
+        for (int j = 0; j < n; j++) {
+            const int16_t* col = bt + j * k;
+            int32_t sum = 0;
+            for (int p = 0; p < k; p++) {
+                sum += (int32_t)row[p] * col[p];
+            }
+            c[i * n + j] = sum;
+        }
+    }
+}
+
+void mat_mul_i8_bt(const int8_t* a, const int8_t* bt, int32_t* c, int m, int k, int n) {
+    for (int i = 0; i < m; i++) {
+        const int8_t* row = a + i * k;
+        for (int j = 0; j < n; j++) {
+            const int8_t* col = bt + j * k;
+            int32_t sum = 0;
+            for (int p = 0; p < k; p++) {
+                sum += (int32_t)row[p] * col[p];
+            }
+            c[i * n + j] = sum;
+        }
+    }
+}
+
+void mat_mul_f32_bt(const float* a, const float* bt, float* c, int m, int k, int n) {
+    for (int i = 0; i < m; i++) {
+        const float* row = a + i * k;
+        for (int j = 0; j < n; j++) {
+            const float* col = bt + j * k;
+            float sum = 0.0f;
+            for (int p = 0; p < k; p++) {
+                sum += row[p] * col[p];
+            }
+            c[i * n + j] = sum;
+        }
+    }
+}
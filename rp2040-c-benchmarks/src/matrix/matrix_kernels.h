@@ -0,0 +1,63 @@
+/**
+ * @file matrix_kernels.h
+ * @brief Matrix multiplication kernels on contiguous row-major storage.
+ *
+ * Every kernel computes C = A × B for an m×k matrix A and a k×n matrix B,
+ * with runtime dimensions and flat row-major arrays (element (r, c) of an
+ * R×C matrix is at index r·C + c), so a row is one pointer plus an offset
+ * rather than the `int A[][20]` of the original kernel.
+ *
+ * Kernels named `_bt` take B transposed (`bt` is n×k, bt[j·k + p] = B[p][j]),
+ * so both operands of every dot product are read sequentially. The
+ * transpose is a storage layout, done once when the data is prepared, not
+ * part of the multiplication.
+ *
+ * The narrow integer kernels accumulate in int32: int16×int16 and int8×int8
+ * products use the M0+'s single-cycle 32-bit multiply, and the operands
+ * take half or a quarter of the SRAM of int32 data.
+ *
+ * Internal to src/matrix/.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef MATRIX_KERNELS_H
+#define MATRIX_KERNELS_H
+
+#include <stdint.h>
+
+/**
+ * @brief Reference ijk multiply; walks B column-wise (stride n).
+ */
+void mat_mul_i32(const int32_t* a, const int32_t* b, int32_t* c, int m, int k, int n);
+
+/**
+ * @brief ijk multiply with B transposed: every dot product is sequential.
+ */
+void mat_mul_i32_bt(const int32_t* a, const int32_t* bt, int32_t* c, int m, int k, int n);
+
+/**
+ * @brief B-transposed multiply, 2×2 register-blocked.
+ *
+ * Each pass over k produces four outputs from two rows of A and two rows of
+ * B^T, so every loaded element feeds two multiply-accumulates. Odd m or n
+ * finish with single dot products.
+ */
+void mat_mul_i32_bt_blocked(const int32_t* a, const int32_t* bt, int32_t* c, int m, int k, int n);
+
+/**
+ * @brief int16 × int16 → int32 multiply-accumulate, B transposed.
+ */
+void mat_mul_i16_bt(const int16_t* a, const int16_t* bt, int32_t* c, int m, int k, int n);
+
+/**
+ * @brief int8 × int8 → int32 multiply-accumulate, B transposed.
+ */
+void mat_mul_i8_bt(const int8_t* a, const int8_t* bt, int32_t* c, int m, int k, int n);
+
+/**
+ * @brief Single-precision multiply (soft-float on the M0+), B transposed.
+ */
+void mat_mul_f32_bt(const float* a, const float* bt, float* c, int m, int k, int n);
+
+#endif  // MATRIX_KERNELS_H
@@ -13,7 +13,10 @@
  * and activation. The signal can be verified using a buzzer or a second Pico logic probe.
  *
  * Output format:
- *   task,method,setup_time_us
+ *   task,method,setup_time_us,setup_cycles,raw_setup_time_us
+ *
+ * The calibrated timer-read overhead is subtracted; the uncorrected time is
+ * reported as raw_setup_time_us.
  *
  * @author Samuel Ivuerah
  */
@@ -21,6 +24,8 @@
 #include "pico/stdlib.h"
 #include "hardware/pwm.h"
 #include <stdio.h>
+#include "bench_registry.h"
+#include "bench_timer.h"
 
 #define PWM_GPIO 15  // GPIO15 = physical pin 20
 
@@ -33,16 +38,16 @@
  *
  * @return void
  */
-void benchmark_pwm(void) {
+static void benchmark_pwm(void) {
     gpio_set_function(PWM_GPIO, GPIO_FUNC_PWM);
     uint slice_num = pwm_gpio_to_slice_num(PWM_GPIO);
 
     sleep_ms(3000);  // Allow USB serial monitor to connect
 
     printf("Benchmark: PWM Setup\n");
-    printf("task,method,setup_time_us\n");
+    printf("task,method,setup_time_us,setup_cycles,raw_setup_time_us\n");
 
-    uint32_t start = time_us_32();
+    bench_timestamp_t start = bench_timer_now();
 
     // Configure PWM peripheral
     pwm_config config = pwm_get_default_config();
@@ -52,14 +57,22 @@ void benchmark_pwm(void) {
     pwm_set_gpio_level(PWM_GPIO, 128);         // 50% duty cycle (range: 0–255)
     pwm_set_enabled(slice_num, true);          // Activate PWM
 
-    uint32_t end = time_us_32();
-    uint32_t duration = end - start;
+    uint64_t raw = bench_timer_elapsed_cycles(start, bench_timer_now());
+    uint64_t cycles = bench_timer_subtract_overhead(raw);
 
     // Output result
-    printf("pwm,setup,%lu\n", duration);
+    printf("pwm,setup,%.3f,%llu,%.3f\n", bench_cycles_to_us(cycles),
+           (unsigned long long)cycles, bench_cycles_to_us(raw));
 
-    // Keep PWM running and serial active
-    while (true) {
-        sleep_ms(1000);
-    }
+    // PWM keeps running after return for probe/buzzer verification
 }
+
+/**
+ * @brief PWM configuration and activation on GPIO15 (self-timed, needs external wiring).
+ */
+const bench_desc_t bench_pwm_setup = {
+    .task = "pwm",
+    .method = "setup",
+    .category = BENCH_CATEGORY_HARDWARE,
+    .standalone = benchmark_pwm,
+};
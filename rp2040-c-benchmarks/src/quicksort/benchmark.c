@@ -6,14 +6,16 @@
  * using recursive calls and the Lomuto partition scheme. Arrays are populated
  * in descending order to simulate a worst-case scenario for sorting performance.
  *
- * The test compares execution time across different input sizes, printing the results
- * in CSV format via USB serial.
+ * The test compares execution time across different input sizes. It is
+ * registered as a descriptor (bench_registry.h); each size is repeated by the
+ * shared statistics engine and the results are printed in CSV format via USB
+ * serial.
  *
  * Source (algorithmic reference):
  * https://en.wikipedia.org/wiki/Quicksort
  *
  * Output format:
- *   task,method,size,time_us
+ *   task,method,size,time_us,...(see bench_stats.h),valid
  *
  * @author Samuel Ivuerah
  */
@@ -21,7 +23,10 @@
 #include <stdio.h>
 #include "pico/stdlib.h"
 #include "pico/time.h"
-#include "benchmarks.h"
+#include "bench_arena.h"
+#include "bench_memory.h"
+#include "bench_registry.h"
+#include "bench_sink.h"
 
 /**
  * @brief Partition the array using the Lomuto partition scheme.
@@ -56,52 +61,129 @@ static int partition(int* arr, int low, int high) {
  * @brief Recursive Quick Sort implementation (in-place).
  *
  * Sorts an array using the divide-and-conquer approach. This implementation
- * uses the Lomuto partitioning method and is sensitive to input order.
+ * uses the Lomuto partitioning method and is sensitive to input order. It
+ * recurses into the smaller partition and loops on the larger, so the call
+ * depth stays below log2(n) + 1 whether or not the compiler turns the second
+ * call into a loop itself.
  *
  * @param arr  Pointer to the array.
  * @param low  Start index.
  * @param high End index.
  */
 static void quick_sort(int* arr, int low, int high) {
-    if (low < high) {
+    while (low < high) {
         int pi = partition(arr, low, high);
-        quick_sort(arr, low, pi - 1);
-        quick_sort(arr, pi + 1, high);
+        if (pi - low < high - pi) {
+            quick_sort(arr, low, pi - 1);
+            low = pi + 1;
+        } else {
+            quick_sort(arr, pi + 1, high);
+            high = pi - 1;
+        }
     }
 }
 
 /**
- * @brief Run Quick Sort benchmark using descending inputs.
- *
- * Benchmarks Quick Sort execution time across three input sizes (10, 50, 100).
- * Each array is filled in reverse order to simulate a worst-case scenario.
- * Results are printed in CSV format.
- *
- * CSV format:
- *   task,method,size,time_us
- *
- * @return void
+ * @brief Kernel context for one array size.
  */
-void benchmark_quick_sort(void) {
-    int sizes[] = {10, 50, 100};
-    int test[100];
+typedef struct {
+    int* data;  ///< Sorting buffer (benchmark arena)
+    int n;      ///< Number of elements
+} sort_ctx_t;
 
-    printf("task,method,size,time_us\n");
+static sort_ctx_t sort_ctx;
 
-    for (int s = 0; s < sizeof(sizes) / sizeof(int); s++) {
-        int n = sizes[s];
+/// Default sizes: 10, 50, 100
+static const int sort_sizes[] = {10, 50, 100};
 
-        // Fill array in descending order (worst-case input)
-        for (int i = 0; i < n; i++) {
-            test[i] = n - i;
-        }
+#define SORT_SWEEP_MAX 5120  ///< Sweeps run 10, 20, 40, ... 5120 (O(n²): seconds per run at the top)
 
-        // Time the sort
-        absolute_time_t start = get_absolute_time();
-        quick_sort(test, 0, n - 1);
-        int64_t elapsed = absolute_time_diff_us(start, get_absolute_time());
+/**
+ * Stack bytes per recursion level, with room to spare for the worst build
+ * profile: about 90 were measured on the RP2040 at -Og (the Og profile of the build matrix),
+ * where partition() is not inlined, and fewer at -O2.
+ */
+#define QUICK_FRAME_BYTES 128u
+#define QUICK_STACK_MARGIN 256u  ///< Runner and interrupt frames below setup's caller
 
-        // Output results in CSV
-        printf("quicksort,quick,%d,%lld\n", n, elapsed);
+/**
+ * @brief Recursion levels of quick_sort() on n elements: floor(log2(n)) + 1.
+ */
+static size_t quick_depth(int n) {
+    size_t depth = 1;
+    while (n > 1) {
+        n >>= 1;
+        depth++;
     }
+    return depth;
 }
+
+/**
+ * @brief Allocate the array, if its recursion depth fits the stack.
+ *
+ * quick_sort() recurses only into the smaller partition, so its depth is
+ * logarithmic in n; sizes whose depth would still overflow the stack are
+ * skipped rather than run.
+ */
+static bool sort_setup(void* ctx, int n) {
+    sort_ctx_t* c = ctx;
+    if (n < 1 || quick_depth(n) * QUICK_FRAME_BYTES + QUICK_STACK_MARGIN > bench_stack_headroom()) {
+        return false;
+    }
+    c->data = bench_arena_alloc((size_t)n * sizeof(int));
+    c->n = n;
+    return c->data != NULL;
+}
+
+/**
+ * @brief Fill the array in descending order (worst-case input).
+ */
+static void fill_descending(void* ctx) {
+    sort_ctx_t* c = ctx;
+    for (int i = 0; i < c->n; i++) {
+        c->data[i] = c->n - i;
+    }
+}
+
+static void run_quick_sort(void* ctx) {
+    sort_ctx_t* c = ctx;
+    quick_sort(c->data, 0, c->n - 1);
+    bench_sink_ptr(c->data);
+}
+
+/**
+ * @brief Check the array holds exactly 1..n in ascending order.
+ *
+ * Comparing against the known sorted permutation (not just adjacent order)
+ * also catches a kernel that loses or duplicates elements.
+ */
+static bool verify_sorted(void* ctx) {
+    sort_ctx_t* c = ctx;
+    for (int i = 0; i < c->n; i++) {
+        if (c->data[i] != i + 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Quick Sort on reverse-ordered arrays of size 10, 50, 100.
+ *
+ * The array is allocated from the benchmark arena and refilled before every
+ * repetition.
+ */
+const bench_desc_t bench_quicksort_quick = {
+    .task = "quicksort",
+    .method = "quick",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .param_name = "size",
+    .params = sort_sizes,
+    .num_params = sizeof(sort_sizes) / sizeof(sort_sizes[0]),
+    .sweep_max = SORT_SWEEP_MAX,
+    .ctx = &sort_ctx,
+    .setup = sort_setup,
+    .prepare = fill_descending,
+    .run = run_quick_sort,
+    .verify = verify_sorted,
+};
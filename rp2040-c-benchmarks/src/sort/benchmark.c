@@ -0,0 +1,304 @@
+/**
+ * @file benchmark.c
+ * @brief Sorting Benchmark for RP2040 (Quicksort Variants, Introsort, Merge
+ *        and Radix Sort on Five Input Distributions).
+ *
+ * Where `bubblesort` and `quicksort` time one naive kernel on its worst
+ * case, this task compares the kernels one would actually use to sort a
+ * batch of samples on-device (sort_kernels.h):
+ *
+ *   median3    recursive quicksort, median-of-three pivot, insertion cutoff
+ *   ninther    as median3, with Tukey's ninther pivot on large ranges
+ *   iterative  quicksort on an explicit stack of at most log2(n) ranges
+ *   introsort  iterative quicksort falling back to heapsort past 2·log2(n)
+ *   merge      bottom-up merge sort (n-element scratch buffer)
+ *   radix      LSD radix sort, 8 bits per pass (n-element scratch buffer)
+ *
+ * on each of five inputs of int32 keys:
+ *
+ *   sorted      0, 1, 2, ...
+ *   reversed    n, n-1, ..., 1
+ *   random      full-range values from a fixed seed (bench_data.h)
+ *   few_unique  random values in 0..7
+ *   organ_pipe  ascending to the middle, then descending
+ *
+ * Each (kernel, input) pair is one descriptor, `sort.<kernel>_<input>`,
+ * timed at sizes 100, 1000 and 10000 by default or swept from 100 up to
+ * what the benchmark arena holds (bench_arena.h). The input is regenerated from the
+ * same seed before every repetition. Verification checks the output is
+ * ascending and holds the same multiset of keys as the input (an
+ * order-independent hash of the keys is taken while filling).
+ *
+ * `merge_parallel_random` sorts each half of the array on its own core and
+ * then merges the halves on both cores at once: core 0 merges from the
+ * front and writes the smaller n/2 elements, core 1 merges from the back
+ * and writes the rest (bench_parallel.h). `sort.speedup` reports its
+ * speedup over `merge_random`.
+ *
+ * Output format:
+ *   task,method,size,time_us,...(see bench_stats.h),valid
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/time.h"
+#include "bench_arena.h"
+#include "bench_data.h"
+#include "bench_parallel.h"
+#include "bench_registry.h"
+#include "bench_sink.h"
+#include "sort_kernels.h"
+
+#define SORT_SWEEP_MAX 102400         ///< Sweeps run 100, 200, ... 102400 (as far as the arena allows)
+#define SORT_RANDOM_SEED 0x2545F491u  ///< bench_data.h seed of the random inputs
+#define SORT_FEW_UNIQUE_KEYS 8        ///< Distinct keys of the few_unique input
+
+/**
+ * @brief Input distributions.
+ */
+typedef enum {
+    SORT_INPUT_SORTED,
+    SORT_INPUT_REVERSED,
+    SORT_INPUT_RANDOM,
+    SORT_INPUT_FEW_UNIQUE,
+    SORT_INPUT_ORGAN_PIPE,
+} sort_input_t;
+
+/**
+ * @brief Kernel context: one (kernel, input) pair.
+ *
+ * Exactly one of `sort` (in-place kernels) and `sort_buffered` (kernels
+ * that return the buffer holding the result) is set.
+ */
+typedef struct {
+    void (*sort)(int32_t* a, int n);
+    int32_t* (*sort_buffered)(int32_t* a, int32_t* tmp, int n);
+    sort_input_t input;
+    int n;                 ///< Number of elements in use
+    int32_t* result;       ///< Buffer holding the output of the last run
+    uint32_t fingerprint;  ///< Order-independent hash of the input keys
+} sort_ctx_t;
+
+/// Array and scratch buffer of the current size, from the benchmark arena
+static int32_t* sort_data;
+static int32_t* sort_tmp;
+
+/// Default sizes: 100, 1000, 10000
+static const int sort_sizes[] = {100, 1000, 10000};
+
+/**
+ * @brief Allocate the array, plus the scratch buffer if the kernel needs one.
+ *
+ * In-place kernels therefore reach twice the size of merge and radix sort
+ * before the arena runs out.
+ */
+static bool sort_setup(void* ctx, int n) {
+    sort_ctx_t* c = ctx;
+    if (n < 1) {
+        return false;
+    }
+    sort_data = bench_arena_alloc((size_t)n * sizeof(int32_t));
+    sort_tmp = c->sort_buffered ? bench_arena_alloc((size_t)n * sizeof(int32_t)) : NULL;
+    c->n = n;
+    return sort_data != NULL && (sort_tmp != NULL || c->sort_buffered == NULL);
+}
+
+/**
+ * @brief Per-key term of the fingerprint; summing makes it order-independent.
+ */
+static inline uint32_t key_hash(int32_t v) {
+    uint32_t h = (uint32_t)v * 0x9E3779B1u;
+    return h ^ (h >> 16);
+}
+
+/**
+ * @brief Fill the array with the context's input and record its fingerprint.
+ *
+ * The random inputs come from bench_data.h, so the TinyGo suite sorts the
+ * same keys.
+ */
+static void fill_input(void* ctx) {
+    sort_ctx_t* c = ctx;
+    bench_rng_t rng;
+    bench_rng_seed(&rng, SORT_RANDOM_SEED, 0);
+
+    switch (c->input) {
+        case SORT_INPUT_RANDOM:
+            bench_data_uniform_i32(sort_data, c->n, &rng, INT32_MIN, INT32_MAX);
+            break;
+        case SORT_INPUT_FEW_UNIQUE:
+            bench_data_uniform_i32(sort_data, c->n, &rng, 0, SORT_FEW_UNIQUE_KEYS - 1);
+            break;
+        case SORT_INPUT_SORTED:
+            for (int i = 0; i < c->n; i++) {
+                sort_data[i] = i;
+            }
+            break;
+        case SORT_INPUT_REVERSED:
+            for (int i = 0; i < c->n; i++) {
+                sort_data[i] = c->n - i;
+            }
+            break;
+        case SORT_INPUT_ORGAN_PIPE:
+        default:
+            for (int i = 0; i < c->n; i++) {
+                sort_data[i] = i < c->n / 2 ? i : c->n - 1 - i;
+            }
+            break;
+    }
+
+    uint32_t fingerprint = 0;
+    for (int i = 0; i < c->n; i++) {
+        fingerprint += key_hash(sort_data[i]);
+    }
+    c->fingerprint = fingerprint;
+}
+
+static void run_sort(void* ctx) {
+    sort_ctx_t* c = ctx;
+    c->sort(sort_data, c->n);
+    c->result = sort_data;
+    bench_sink_ptr(c->result);
+}
+
+static void run_sort_buffered(void* ctx) {
+    sort_ctx_t* c = ctx;
+    c->result = c->sort_buffered(sort_data, sort_tmp, c->n);
+    bench_sink_ptr(c->result);
+}
+
+/**
+ * @brief One worker's share of the dual-core merge sort.
+ *
+ * Phase 1 sorts the worker's half into sort_data (copying back if its last
+ * pass wrote the scratch buffer). Phase 2, after the barrier, merges the
+ * two halves into sort_tmp: worker 0 takes the smallest element of either
+ * run until it has written n/2, worker 1 takes the largest from the back
+ * until it has written the rest. Ties go to the left run at the front and
+ * to the right run at the back, so the two halves of the output meet
+ * exactly.
+ */
+static void merge_worker(void* ctx, int worker) {
+    sort_ctx_t* c = ctx;
+    int n = c->n;
+    int mid = n / 2;
+    int lo = worker == 0 ? 0 : mid;
+    int hi = worker == 0 ? mid : n;
+
+    int32_t* sorted = c->sort_buffered(sort_data + lo, sort_tmp + lo, hi - lo);
+    if (sorted != sort_data + lo) {
+        memcpy(sort_data + lo, sorted, (size_t)(hi - lo) * sizeof(int32_t));
+    }
+
+    bench_parallel_barrier();
+
+    const int32_t* a = sort_data;
+    if (worker == 0) {
+        int i = 0;
+        int j = mid;
+        for (int k = 0; k < mid; k++) {
+            if (j >= n || (i < mid && a[i] <= a[j])) {
+                sort_tmp[k] = a[i++];
+            } else {
+                sort_tmp[k] = a[j++];
+            }
+        }
+    } else {
+        int i = mid - 1;
+        int j = n - 1;
+        for (int k = n - 1; k >= mid; k--) {
+            if (i < 0 || (j >= mid && a[j] >= a[i])) {
+                sort_tmp[k] = a[j--];
+            } else {
+                sort_tmp[k] = a[i--];
+            }
+        }
+    }
+}
+
+static void run_merge_parallel(void* ctx) {
+    sort_ctx_t* c = ctx;
+    bench_parallel_run(merge_worker, c);
+    c->result = sort_tmp;
+    bench_sink_ptr(c->result);
+}
+
+/**
+ * @brief Check the result is ascending and holds the input's keys.
+ */
+static bool verify_sorted(void* ctx) {
+    sort_ctx_t* c = ctx;
+    uint32_t fingerprint = key_hash(c->result[0]);
+    for (int i = 1; i < c->n; i++) {
+        if (c->result[i - 1] > c->result[i]) {
+            return false;
+        }
+        fingerprint += key_hash(c->result[i]);
+    }
+    return fingerprint == c->fingerprint;
+}
+
+/**
+ * @brief Define the context and descriptor `bench_sort_<name>`.
+ *
+ * @param name   Method name (kernel_input).
+ * @param run_fn Run function for the kernel's calling convention.
+ * @param kernel Designated initialiser selecting the kernel.
+ * @param in     Input distribution.
+ */
+#define SORT_DESC(name, run_fn, kernel, in)                          \
+    static sort_ctx_t sort_ctx_##name = {kernel, .input = (in)};     \
+    const bench_desc_t bench_sort_##name = {                         \
+        .task = "sort",                                              \
+        .method = #name,                                             \
+        .category = BENCH_CATEGORY_SOFTWARE,                         \
+        .param_name = "size",                                        \
+        .params = sort_sizes,                                        \
+        .num_params = sizeof(sort_sizes) / sizeof(sort_sizes[0]),    \
+        .sweep_max = SORT_SWEEP_MAX,                                 \
+        .ctx = &sort_ctx_##name,                                     \
+        .setup = sort_setup,                                         \
+        .prepare = fill_input,                                       \
+        .run = run_fn,                                               \
+        .verify = verify_sorted,                                     \
+    }
+
+/**
+ * @brief One descriptor per input distribution for a kernel.
+ */
+#define SORT_DESC_ALL_INPUTS(algo, run_fn, kernel)                          \
+    SORT_DESC(algo##_sorted, run_fn, kernel, SORT_INPUT_SORTED);            \
+    SORT_DESC(algo##_reversed, run_fn, kernel, SORT_INPUT_REVERSED);        \
+    SORT_DESC(algo##_random, run_fn, kernel, SORT_INPUT_RANDOM);            \
+    SORT_DESC(algo##_few_unique, run_fn, kernel, SORT_INPUT_FEW_UNIQUE);    \
+    SORT_DESC(algo##_organ_pipe, run_fn, kernel, SORT_INPUT_ORGAN_PIPE)
+
+SORT_DESC_ALL_INPUTS(median3, run_sort, .sort = sort_quick_median3);
+SORT_DESC_ALL_INPUTS(ninther, run_sort, .sort = sort_quick_ninther);
+SORT_DESC_ALL_INPUTS(iterative, run_sort, .sort = sort_quick_iterative);
+SORT_DESC_ALL_INPUTS(introsort, run_sort, .sort = sort_introsort);
+SORT_DESC_ALL_INPUTS(merge, run_sort_buffered, .sort_buffered = sort_merge);
+SORT_DESC_ALL_INPUTS(radix, run_sort_buffered, .sort_buffered = sort_radix);
+
+/**
+ * @brief Merge sort with both halves and the final merge split between the cores.
+ */
+SORT_DESC(merge_parallel_random, run_merge_parallel, .sort_buffered = sort_merge, SORT_INPUT_RANDOM);
+
+static void benchmark_sort_speedup(void) {
+    bench_parallel_report(&bench_sort_merge_random, &bench_sort_merge_parallel_random);
+}
+
+/**
+ * @brief Speedup and efficiency of `merge_parallel_random` over single-core
+ *        `merge_random`.
+ */
+const bench_desc_t bench_sort_speedup = {
+    .task = "sort",
+    .method = "speedup",
+    .category = BENCH_CATEGORY_SOFTWARE,
+    .standalone = benchmark_sort_speedup,
+};
@@ -0,0 +1,304 @@
+/**
+ * @file sort_kernels.c
+ * @brief Sorting kernels (see sort_kernels.h).
+ *
+ * Sources (algorithmic reference):
+ * https://en.wikipedia.org/wiki/Quicksort#Hoare_partition_scheme
+ * https://en.wikipedia.org/wiki/Introsort
+ * https://en.wikipedia.org/wiki/Merge_sort#Bottom-up_implementation
+ * https://en.wikipedia.org/wiki/Radix_sort#Least_significant_digit
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <stdbool.h>
+#include <string.h>
+#include "sort_kernels.h"
+
+static inline void swap(int32_t* a, int i, int j) {
+    int32_t t = a[i];
+    a[i] = a[j];
+    a[j] = t;
+}
+
+void sort_insertion(int32_t* a, int n) {
+    for (int i = 1; i < n; i++) {
+        int32_t v = a[i];
+        int j = i - 1;
+        while (j >= 0 && a[j] > v) {
+            a[j + 1] = a[j];
+            j--;
+        }
+        a[j + 1] = v;
+    }
+}
+
+/**
+ * @brief Index of the median of a[i], a[j], a[k].
+ */
+static inline int median3(const int32_t* a, int i, int j, int k) {
+    if (a[i] < a[j]) {
+        if (a[j] < a[k]) {
+            return j;
+        }
+        return a[i] < a[k] ? k : i;
+    }
+    if (a[i] < a[k]) {
+        return i;
+    }
+    return a[j] < a[k] ? k : j;
+}
+
+/**
+ * @brief Index of Tukey's ninther of a[lo, hi]: the median of the medians
+ *        of three samples taken at each end and in the middle.
+ */
+static int ninther(const int32_t* a, int lo, int hi) {
+    int step = (hi - lo + 1) / 8;
+    int mid = lo + (hi - lo) / 2;
+    return median3(a, median3(a, lo, lo + step, lo + 2 * step),
+                   median3(a, mid - step, mid, mid + step),
+                   median3(a, hi - 2 * step, hi - step, hi));
+}
+
+/**
+ * @brief Hoare partition of a[lo, hi] around the value at index p.
+ *
+ * The pivot is moved to a[lo] first, which keeps the returned split j in
+ * [lo, hi - 1]: afterwards every element of a[lo, j] is <= every element of
+ * a[j + 1, hi]. Elements equal to the pivot stop both scans, so they are
+ * spread over both sides.
+ */
+static int partition(int32_t* a, int lo, int hi, int p) {
+    swap(a, lo, p);
+    int32_t pivot = a[lo];
+    int i = lo - 1;
+    int j = hi + 1;
+    for (;;) {
+        do {
+            i++;
+        } while (a[i] < pivot);
+        do {
+            j--;
+        } while (a[j] > pivot);
+        if (i >= j) {
+            return j;
+        }
+        swap(a, i, j);
+    }
+}
+
+/**
+ * @brief Quicksort of a[lo, hi]: recurses into the smaller partition and
+ *        loops on the larger, so the call depth stays below log2(n).
+ */
+static void quick_recursive(int32_t* a, int lo, int hi, bool use_ninther) {
+    while (hi - lo + 1 > SORT_INSERTION_CUTOFF) {
+        int p = use_ninther && hi - lo + 1 >= SORT_NINTHER_MIN
+                    ? ninther(a, lo, hi)
+                    : median3(a, lo, lo + (hi - lo) / 2, hi);
+        int j = partition(a, lo, hi, p);
+        if (j - lo < hi - j) {
+            quick_recursive(a, lo, j, use_ninther);
+            lo = j + 1;
+        } else {
+            quick_recursive(a, j + 1, hi, use_ninther);
+            hi = j;
+        }
+    }
+    sort_insertion(a + lo, hi - lo + 1);
+}
+
+void sort_quick_median3(int32_t* a, int n) {
+    if (n > 1) {
+        quick_recursive(a, 0, n - 1, false);
+    }
+}
+
+void sort_quick_ninther(int32_t* a, int n) {
+    if (n > 1) {
+        quick_recursive(a, 0, n - 1, true);
+    }
+}
+
+void sort_quick_iterative(int32_t* a, int n) {
+    int stack_lo[SORT_STACK_DEPTH];
+    int stack_hi[SORT_STACK_DEPTH];
+    int top = 0;
+    int lo = 0;
+    int hi = n - 1;
+
+    for (;;) {
+        while (hi - lo + 1 > SORT_INSERTION_CUTOFF) {
+            int j = partition(a, lo, hi, median3(a, lo, lo + (hi - lo) / 2, hi));
+            // Defer the larger side: the pending ranges at least halve in
+            // size from the bottom of the stack up
+            if (j - lo < hi - j) {
+                stack_lo[top] = j + 1;
+                stack_hi[top] = hi;
+                hi = j;
+            } else {
+                stack_lo[top] = lo;
+                stack_hi[top] = j;
+                lo = j + 1;
+            }
+            top++;
+        }
+        if (hi > lo) {
+            sort_insertion(a + lo, hi - lo + 1);
+        }
+        if (top == 0) {
+            return;
+        }
+        top--;
+        lo = stack_lo[top];
+        hi = stack_hi[top];
+    }
+}
+
+static void sift_down(int32_t* a, int root, int n) {
+    int32_t v = a[root];
+    for (;;) {
+        int child = 2 * root + 1;
+        if (child >= n) {
+            break;
+        }
+        if (child + 1 < n && a[child + 1] > a[child]) {
+            child++;
+        }
+        if (a[child] <= v) {
+            break;
+        }
+        a[root] = a[child];
+        root = child;
+    }
+    a[root] = v;
+}
+
+static void heap_sort(int32_t* a, int n) {
+    for (int i = n / 2 - 1; i >= 0; i--) {
+        sift_down(a, i, n);
+    }
+    for (int end = n - 1; end > 0; end--) {
+        swap(a, 0, end);
+        sift_down(a, 0, end);
+    }
+}
+
+void sort_introsort(int32_t* a, int n) {
+    int stack_lo[SORT_STACK_DEPTH];
+    int stack_hi[SORT_STACK_DEPTH];
+    int stack_depth[SORT_STACK_DEPTH];
+    int top = 0;
+    int lo = 0;
+    int hi = n - 1;
+
+    int depth = 0;
+    for (int m = n; m > 1; m >>= 1) {
+        depth += 2;
+    }
+
+    for (;;) {
+        while (hi - lo + 1 > SORT_INSERTION_CUTOFF) {
+            if (depth == 0) {
+                heap_sort(a + lo, hi - lo + 1);
+                break;
+            }
+            depth--;
+            int j = partition(a, lo, hi, median3(a, lo, lo + (hi - lo) / 2, hi));
+            if (j - lo < hi - j) {
+                stack_lo[top] = j + 1;
+                stack_hi[top] = hi;
+                hi = j;
+            } else {
+                stack_lo[top] = lo;
+                stack_hi[top] = j;
+                lo = j + 1;
+            }
+            stack_depth[top] = depth;
+            top++;
+        }
+        if (top == 0) {
+            break;
+        }
+        top--;
+        lo = stack_lo[top];
+        hi = stack_hi[top];
+        depth = stack_depth[top];
+    }
+
+    // Every element is already within SORT_INSERTION_CUTOFF of its place
+    sort_insertion(a, n);
+}
+
+/**
+ * @brief Merge the sorted runs src[lo, mid) and src[mid, hi) into dst[lo, hi).
+ *
+ * Ties take the left run first, so the sort is stable.
+ */
+static void merge(const int32_t* src, int32_t* dst, int lo, int mid, int hi) {
+    int i = lo;
+    int j = mid;
+    for (int k = lo; k < hi; k++) {
+        if (i < mid && (j >= hi || src[i] <= src[j])) {
+            dst[k] = src[i++];
+        } else {
+            dst[k] = src[j++];
+        }
+    }
+}
+
+int32_t* sort_merge(int32_t* a, int32_t* tmp, int n) {
+    int32_t* src = a;
+    int32_t* dst = tmp;
+    for (int width = 1; width < n; width *= 2) {
+        for (int lo = 0; lo < n; lo += 2 * width) {
+            int mid = lo + width < n ? lo + width : n;
+            int hi = lo + 2 * width < n ? lo + 2 * width : n;
+            merge(src, dst, lo, mid, hi);
+        }
+        int32_t* t = src;
+        src = dst;
+        dst = t;
+    }
+    return src;
+}
+
+int32_t* sort_radix(int32_t* a, int32_t* tmp, int n) {
+    static uint32_t offset[256];  // 1 KB: kept off the 2 KB core 0 stack
+    int32_t* src = a;
+    int32_t* dst = tmp;
+
+    for (int shift = 0; shift < 32; shift += 8) {
+        memset(offset, 0, sizeof(offset));
+        for (int i = 0; i < n; i++) {
+            offset[(((uint32_t)src[i] ^ 0x80000000u) >> shift) & 0xFFu]++;
+        }
+
+        // Counts become start offsets; a single non-empty bucket means the
+        // pass would not move anything
+        uint32_t total = 0;
+        bool trivial = false;
+        for (int d = 0; d < 256; d++) {
+            uint32_t count = offset[d];
+            if (count == (uint32_t)n) {
+                trivial = true;
+                break;
+            }
+            offset[d] = total;
+            total += count;
+        }
+        if (trivial) {
+            continue;
+        }
+
+        for (int i = 0; i < n; i++) {
+            uint32_t digit = (((uint32_t)src[i] ^ 0x80000000u) >> shift) & 0xFFu;
+            dst[offset[digit]++] = src[i];
+        }
+        int32_t* t = src;
+        src = dst;
+        dst = t;
+    }
+    return src;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file sort_kernels.h
+ * @brief Sorting kernels on int32 arrays: quicksort variants, introsort,
+ *        bottom-up merge sort and LSD radix sort.
+ *
+ * All kernels sort ascending and in place, except merge and radix sort,
+ * which alternate between the array and a scratch buffer of the same size
+ * and return whichever of the two holds the result.
+ *
+ * The quicksort family partitions with Hoare's scheme around a pivot moved
+ * to the front of the range, so runs of equal keys split evenly instead of
+ * degrading to O(n²) as Lomuto partitioning does. Ranges of at most
+ * SORT_INSERTION_CUTOFF elements are finished by insertion sort.
+ *
+ * Internal to src/sort/.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef SORT_KERNELS_H
+#define SORT_KERNELS_H
+
+#include <stdint.h>
+
+#define SORT_INSERTION_CUTOFF 16  ///< Ranges this small are insertion-sorted
+#define SORT_NINTHER_MIN 128      ///< Smallest range that takes a ninther pivot
+#define SORT_STACK_DEPTH 32       ///< Explicit stack entries; enough for any 32-bit n
+
+/**
+ * @brief Insertion sort of a[0, n).
+ */
+void sort_insertion(int32_t* a, int n);
+
+/**
+ * @brief Recursive quicksort, median-of-three pivot, insertion cutoff.
+ *
+ * Recurses into the smaller partition and loops on the larger, so the
+ * call depth is at most log2(n) on any input (the core 0 stack is 2 KB).
+ */
+void sort_quick_median3(int32_t* a, int n);
+
+/**
+ * @brief Recursive quicksort, Tukey's ninther pivot on large ranges.
+ *
+ * The ninther (median of three medians of three, spread over the range)
+ * replaces median-of-three from SORT_NINTHER_MIN elements up.
+ */
+void sort_quick_ninther(int32_t* a, int n);
+
+/**
+ * @brief Non-recursive quicksort with an explicit, bounded stack.
+ *
+ * The larger partition is pushed and the smaller one is sorted next, so at
+ * most log2(n) ranges are ever pending (SORT_STACK_DEPTH), whatever the
+ * input. Median-of-three pivot, insertion cutoff.
+ */
+void sort_quick_iterative(int32_t* a, int n);
+
+/**
+ * @brief Introsort: the iterative quicksort with a depth limit of 2·log2(n).
+ *
+ * A range that exceeds the limit is heapsorted, which bounds the worst case
+ * at O(n log n). Small ranges are left for one insertion-sort pass over the
+ * whole array at the end.
+ */
+void sort_introsort(int32_t* a, int n);
+
+/**
+ * @brief Bottom-up merge sort of a[0, n), using tmp as scratch.
+ *
+ * Runs of width 1, 2, 4, ... are merged pairwise, alternating between the
+ * two buffers. Stable.
+ *
+ * @return The buffer holding the sorted result (a or tmp).
+ */
+int32_t* sort_merge(int32_t* a, int32_t* tmp, int n);
+
+/**
+ * @brief LSD radix sort of a[0, n), one byte per pass, using tmp as scratch.
+ *
+ * Four counting passes from the least significant byte; the sign bit is
+ * flipped in the keys so negative values order first. A pass in which
+ * every key has the same digit is skipped.
+ *
+ * @return The buffer holding the sorted result (a or tmp).
+ */
+int32_t* sort_radix(int32_t* a, int32_t* tmp, int n);
+
+#endif  // SORT_KERNELS_H
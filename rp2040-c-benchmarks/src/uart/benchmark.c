@@ -13,7 +13,7 @@
  * Each character is transmitted using `uart_putc()` to reflect actual byte-wise performance.
  *
  * Output format:
- *   task,method,iterations,total_time_us,avg_time_us
+ *   task,method,iterations,total_time_us,avg_time_us,total_cycles,avg_cycles
  *
  * @author Samuel Ivuerah
  */
@@ -21,6 +21,8 @@
 #include "pico/stdlib.h"
 #include "hardware/uart.h"
 #include <stdio.h>
+#include "bench_registry.h"
+#include "bench_timer.h"
 
 #define UART_ID uart0
 #define UART_TX_PIN 0   // GPIO0 = physical pin 1
@@ -37,7 +39,7 @@
  *
  * @return void
  */
-void benchmark_uart(void) {
+static void benchmark_uart(void) {
     stdio_init_all();
     sleep_ms(3000);  // Allow USB serial to connect
 
@@ -48,9 +50,9 @@ void benchmark_uart(void) {
     const int loops = 100;
 
     printf("Benchmark: UART Send\n");
-    printf("task,method,iterations,total_time_us,avg_time_us\n");
+    printf("task,method,iterations,total_time_us,avg_time_us,total_cycles,avg_cycles\n");
 
-    uint32_t start = time_us_32();
+    bench_timestamp_t start = bench_timer_now();
 
     for (int i = 0; i < loops; i++) {
         const char *ptr = msg;
@@ -59,14 +61,19 @@ void benchmark_uart(void) {
         }
     }
 
-    uint32_t end = time_us_32();
-    uint32_t duration = end - start;
-    float avg = (float)duration / loops;
+    uint64_t cycles = bench_timer_elapsed_cycles(start, bench_timer_now());
+    double duration = bench_cycles_to_us(cycles);
 
-    printf("uart,send,%d,%lu,%.2f\n", loops, duration, avg);
-
-    // Keep USB serial active
-    while (true) {
-        sleep_ms(1000);
-    }
+    printf("uart,send,%d,%.3f,%.3f,%llu,%.1f\n", loops, duration, duration / loops,
+           (unsigned long long)cycles, (double)cycles / loops);
 }
+
+/**
+ * @brief UART transmission to the logger Pico (self-timed, needs external wiring).
+ */
+const bench_desc_t bench_uart_send = {
+    .task = "uart",
+    .method = "send",
+    .category = BENCH_CATEGORY_HARDWARE,
+    .standalone = benchmark_uart,
+};
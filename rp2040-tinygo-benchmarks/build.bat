@@ -18,6 +18,7 @@ echo   9. uart
 echo  10. interrupt
 echo  11. pwm
 echo  12. i2c
+echo  13. sort
 echo.
 
 set /p benchChoice="Enter number of benchmark to build: "
@@ -35,6 +36,7 @@ if "%benchChoice%"=="9" set src=uart
 if "%benchChoice%"=="10" set src=interrupt
 if "%benchChoice%"=="11" set src=pwm
 if "%benchChoice%"=="12" set src=i2c
+if "%benchChoice%"=="13" set src=sort
 
 if not defined src (
     echo Invalid choice. Exiting.
@@ -42,14 +44,23 @@ if not defined src (
 )
 
 echo.
-echo Building TinyGo benchmark: %src%
+echo Optimisation level (TinyGo -opt): 0, 1, 2, s, z
+echo   Matching C profiles: 2 = O2 / O3_lto, s = Os, 1 = Og
+set "opt=z"
+set /p opt="Enter optimisation level [z]: "
+
+set "out=build\%src%.uf2"
+if not "%opt%"=="z" set "out=build\%src%_opt%opt%.uf2"
+
+echo.
+echo Building TinyGo benchmark: %src% (-opt=%opt%)
 echo ----------------------------
 
 mkdir build 2>nul
-tinygo build -target pico -o build\%src%.uf2 .\src\%src%
+tinygo build -target pico -opt=%opt% -o %out% .\src\%src%
 
-if exist build\%src%.uf2 (
-    echo Build successful! File saved to build\%src%.uf2
+if exist %out% (
+    echo Build successful! File saved to %out%
 ) else (
     echo Build failed. Please check for errors.
 )
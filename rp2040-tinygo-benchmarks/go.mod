@@ -0,0 +1,3 @@
+module rp2040-tinygo-benchmarks
+
+go 1.21
@@ -2,14 +2,23 @@ package main
 
 import (
 	"machine"
+	"strconv"
 	"time"
+
+	"rp2040-tinygo-benchmarks/src/common"
+)
+
+var (
+	sampleRecords [8]common.Record // every 250th of 1000 reads
+	sampleRing    = common.NewRing(sampleRecords[:])
 )
 
 // benchmarkADC measures the latency of ADC reads on GPIO26 (ADC0).
 //
 // This function performs 1000 ADC reads, measures the time for each read, 
 // and calculates the average read time in microseconds. Selected sample 
-// values are printed for verification purposes.
+// values are recorded during the loop and printed afterwards for
+// verification, so no USB serial output happens between timed reads.
 //
 // Wiring:
 //   - GPIO26 (pin 31) → Wiper (middle pin) of potentiometer
@@ -32,6 +41,7 @@ func benchmarkADC() {
 	println("task,method,reads,avg_time_us")
 
 	var totalTime int64
+	sampleRing.Reset()
 
 	// Perform 1000 ADC reads, timing each operation individually
 	for i := 0; i < samples; i++ {
@@ -40,12 +50,16 @@ func benchmarkADC() {
 		elapsed := time.Since(start).Microseconds()  // Measure the time taken in microseconds
 		totalTime += elapsed
 
-		// Print selected sample values for verification every 250th read
+		// Record selected sample values for verification every 250th read
 		if i%250 == 0 {
-			println("adc,sample,", i, ",", val)
+			sampleRing.Push(uint32(i), uint32(val), elapsed)
 		}
 	}
 
+	sampleRing.Drain(func(r common.Record) {
+		println("adc,sample," + strconv.FormatUint(uint64(r.Tag), 10) + "," + strconv.FormatUint(uint64(r.Value), 10))
+	})
+
 	// Calculate the average time taken for a single read and print it
 	avg := totalTime / int64(samples)
 	println("adc,single_read,", samples, ",", avg)
@@ -2,33 +2,63 @@ package main
 
 import (
 	"machine"
+	"strconv"
 	"time"
+
+	"rp2040-tinygo-benchmarks/src/common"
 )
 
 // benchmarkBubbleSort runs the Bubble Sort benchmark on various array sizes.
 //
 // This function benchmarks the Bubble Sort algorithm by filling a slice
-// with descending values (worst-case scenario) and measuring the time taken
-// to sort it. The results are printed in CSV format via USB serial.
+// with descending values (worst-case scenario) before every repetition and
+// measuring the time taken to sort it. The sorted output is verified after
+// timing. The results are printed in CSV format via USB serial.
 //
 // Test sizes: 10, 50, and 100.
-// Output format: task,method,size,time_us
+// Output format: task,method,size,time_us,...(see common.StatsCSVColumns)
 func benchmarkBubbleSort() {
 	sizes := []int{10, 50, 100}
-	println("task,method,size,time_us")
+	cfg := common.DefaultConfig()
+	println("task,method,size," + common.StatsCSVColumns)
+
+	mems := make([]common.Memory, len(sizes))
 
-	for _, size := range sizes {
-		// Create reverse-ordered array (worst-case input for bubble sort)
+	for i, size := range sizes {
+		probe := common.StartMemory()
 		data := make([]int, size)
-		for i := 0; i < size; i++ {
-			data[i] = size - i
+
+		// Refill with a reverse-ordered array (worst-case input for bubble sort)
+		fill := func() {
+			for i := 0; i < size; i++ {
+				data[i] = size - i
+			}
+		}
+
+		run := func() {
+			BubbleSort(data)
+			common.SinkInts(data)
 		}
 
-		start := time.Now()
-		BubbleSort(data)
-		elapsed := time.Since(start).Microseconds()
+		// Sorted output must be exactly 1..size
+		verify := func() bool {
+			for i := 0; i < size; i++ {
+				if data[i] != i+1 {
+					return false
+				}
+			}
+			return true
+		}
+
+		stats := common.MeasureVerified(cfg, fill, run, verify)
+
+		println("bubblesort,bubble," + strconv.Itoa(size) + "," + stats.CSV())
+		mems[i] = probe.Stop()
+	}
 
-		println("bubblesort,bubble,", size, ",", elapsed)
+	println("task,method,size," + common.MemoryCSVColumns)
+	for i, size := range sizes {
+		println("bubblesort,bubble," + strconv.Itoa(size) + "," + mems[i].CSV())
 	}
 }
 
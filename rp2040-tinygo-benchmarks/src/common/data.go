@@ -0,0 +1,163 @@
+package common
+
+import "math"
+
+// Seeded input-data generators, bit-identical to bench_data.h in the C
+// suite.
+//
+// Benchmarks that need non-trivial input draw it from here rather than
+// building it inline, so both suites time exactly the same data. Every
+// operation mirrors src/common/data.c line for line, on the same integer
+// arithmetic; no floating point is involved. Go and C99 both truncate
+// signed division toward zero, which the C side relies on instead of
+// shifting negative values.
+//
+// The generator is PCG32 (XSH-RR output, 64-bit LCG state). A (seed,
+// stream) pair selects one of 2^63 independent sequences.
+//
+// scripts/check_data_parity.sh diffs the output of src/datagen against the
+// C suite's host/bench_datagen.
+
+const pcg32Multiplier = 6364136223846793005
+
+// RNG is the PCG32 generator state.
+type RNG struct {
+	state uint64
+	inc   uint64
+}
+
+// Tone is one sine component of TonesInt16s.
+type Tone struct {
+	Bin       uint32 // whole cycles over the output samples
+	Amplitude int16  // peak amplitude in Q15
+}
+
+// NewRNG returns a generator seeded as pcg32_srandom_r(seed, stream).
+func NewRNG(seed, stream uint64) RNG {
+	var r RNG
+	r.Seed(seed, stream)
+	return r
+}
+
+// Seed reseeds the generator.
+func (r *RNG) Seed(seed, stream uint64) {
+	r.state = 0
+	r.inc = stream<<1 | 1
+	r.Next()
+	r.state += seed
+	r.Next()
+}
+
+// Next returns the next 32-bit output.
+func (r *RNG) Next() uint32 {
+	old := r.state
+	r.state = old*pcg32Multiplier + r.inc
+	xorshifted := uint32(((old >> 18) ^ old) >> 27)
+	rot := uint32(old >> 59)
+	return xorshifted>>rot | xorshifted<<((32-rot)&31)
+}
+
+// Below returns a value in [0, bound) from one output, by multiply-shift.
+func (r *RNG) Below(bound uint32) uint32 {
+	return uint32((uint64(r.Next()) * uint64(bound)) >> 32)
+}
+
+// UniformInt32s fills out with uniform keys in [lo, hi] (inclusive; the
+// full int32 range is allowed).
+func UniformInt32s(out []int32, r *RNG, lo, hi int32) {
+	span := uint32(hi) - uint32(lo) + 1 // 0: the full 2^32 range
+	for i := range out {
+		var v uint32
+		if span == 0 {
+			v = r.Next()
+		} else {
+			v = r.Below(span)
+		}
+		out[i] = int32(uint32(lo) + v)
+	}
+}
+
+// GaussianInt32s fills out with bell-shaped keys of the given mean and
+// standard deviation: the sum of four 16-bit uniforms, centred and scaled
+// by √3 (as 887/512). Values saturate at the int32 limits.
+func GaussianInt32s(out []int32, r *RNG, mean, stddev int32) {
+	for i := range out {
+		a := r.Next()
+		b := r.Next()
+		sum := int64(a&0xFFFF) + int64(a>>16) + int64(b&0xFFFF) + int64(b>>16)
+
+		v := int64(mean) + (sum-2*65535)*int64(stddev)*887/(65536*512)
+		if v > math.MaxInt32 {
+			v = math.MaxInt32
+		} else if v < math.MinInt32 {
+			v = math.MinInt32
+		}
+		out[i] = int32(v)
+	}
+}
+
+// SortedRunsInt32s fills out with consecutive ascending runs of runLength
+// keys, each starting at a random key in [0, 2^20) and rising by 0..7 per
+// step.
+func SortedRunsInt32s(out []int32, r *RNG, runLength int) {
+	var v int32
+	for i := range out {
+		if i%runLength == 0 {
+			v = int32(r.Below(1 << 20))
+		} else {
+			v += int32(r.Below(8))
+		}
+		out[i] = v
+	}
+}
+
+// SinQ15 returns the sine of a phase in Q15, with 2^32 phase units per
+// turn, from a quarter-wave 5th-order polynomial (error below 2^-11).
+func SinQ15(phase uint32) int16 {
+	// sin(π/2 · x) ≈ x · (A − x² · (B − x² · C)) for x in [0, 1], with
+	// A = π/2, B = 2A − 5/2, C = A − 3/2 (all Q15): exact at x = 0 and 1
+	const (
+		A = 51472
+		B = 21024
+		C = 2320
+	)
+
+	quadrant := phase >> 30
+	x := uint64((phase >> 15) & 0x7FFF) // position in the quadrant, Q15
+	if quadrant&1 != 0 {
+		x = 32768 - x
+	}
+	x2 := (x * x) >> 15
+	y := (x * (A - ((x2 * (B - ((x2 * C) >> 15))) >> 15))) >> 15
+	if y > 32767 {
+		y = 32767
+	}
+	if quadrant&2 != 0 {
+		return int16(-int32(y))
+	}
+	return int16(y)
+}
+
+// TonesInt16s fills out with the sum of whole-cycle sine tones plus
+// uniform noise in [-noise, noise], in Q15. Sample i of a tone is
+// Amplitude · sin(2π · Bin · i / len(out)); no generator output is drawn
+// if noise is 0, and the sum saturates to int16.
+func TonesInt16s(out []int16, tones []Tone, r *RNG, noise int16) {
+	n := uint64(len(out))
+	for i := range out {
+		var sum int32
+		for _, t := range tones {
+			phase := uint32(((uint64(t.Bin) * uint64(i)) % n << 32) / n)
+			sum += int32(t.Amplitude) * int32(SinQ15(phase)) / 32768
+		}
+		if noise > 0 {
+			sum += int32(r.Below(2*uint32(noise)+1)) - int32(noise)
+		}
+		if sum > math.MaxInt16 {
+			sum = math.MaxInt16
+		} else if sum < math.MinInt16 {
+			sum = math.MinInt16
+		}
+		out[i] = int16(sum)
+	}
+}
@@ -0,0 +1,56 @@
+package common
+
+import (
+	"runtime"
+	"strconv"
+)
+
+// MemoryCSVColumns are the column names printed by Memory.CSV, after a
+// benchmark's own leading columns.
+const MemoryCSVColumns = "heap_bytes,mallocs,heap_sys_bytes"
+
+// Memory is the heap usage of a benchmark for one parameter, the TinyGo
+// counterpart of the C suite's memory pass (bench_memory.h).
+//
+// TinyGo has no malloc arena to inspect; the garbage collector's counters
+// are used instead. Stack depth is not measured at run time: use
+// `tinygo build -print-stacks` for the static per-goroutine stack sizes.
+type Memory struct {
+	AllocBytes   uint64 // bytes allocated since StartMemory (TotalAlloc delta)
+	Mallocs      uint64 // number of allocations since StartMemory
+	HeapSysBytes uint64 // heap obtained from the system, read at Stop
+}
+
+// MemoryProbe records the allocator counters at the start of a benchmark.
+type MemoryProbe struct {
+	totalAlloc uint64
+	mallocs    uint64
+}
+
+// StartMemory snapshots the allocator counters. Call it before allocating a
+// benchmark's buffers so they are included in the result.
+func StartMemory() MemoryProbe {
+	var ms runtime.MemStats
+	runtime.ReadMemStats(&ms)
+	return MemoryProbe{totalAlloc: ms.TotalAlloc, mallocs: ms.Mallocs}
+}
+
+// Stop reports the allocations made since StartMemory: the benchmark's
+// buffers and closures, plus any allocation inside the measured loop
+// (which then scales with the repetition count).
+func (p MemoryProbe) Stop() Memory {
+	var ms runtime.MemStats
+	runtime.ReadMemStats(&ms)
+	return Memory{
+		AllocBytes:   ms.TotalAlloc - p.totalAlloc,
+		Mallocs:      ms.Mallocs - p.mallocs,
+		HeapSysBytes: ms.HeapSys,
+	}
+}
+
+// CSV formats the usage as the MemoryCSVColumns fields.
+func (m Memory) CSV() string {
+	return strconv.FormatUint(m.AllocBytes, 10) + "," +
+		strconv.FormatUint(m.Mallocs, 10) + "," +
+		strconv.FormatUint(m.HeapSysBytes, 10)
+}
@@ -0,0 +1,90 @@
+package common
+
+import (
+	"strconv"
+	"sync"
+)
+
+// Fork-join execution on both RP2040 cores, mirroring bench_parallel.h in
+// the C suite.
+//
+// Parallel runs the same function as worker 0 on the calling goroutine and
+// as worker 1 on a long-lived worker goroutine. With TinyGo's `cores`
+// scheduler (`-scheduler=cores`, where the release supports it on the
+// RP2040) the two goroutines run on separate cores. With the default
+// `tasks` scheduler they take turns on core 0, and the speedup shows the
+// cost of the handover instead. Work is split statically by worker index.
+
+// Workers is the number of workers Parallel runs: worker 0 is the caller.
+const Workers = 2
+
+// SpeedupCSVColumns are the column names printed by SpeedupCSV, after a
+// benchmark's own leading columns.
+const SpeedupCSVColumns = "single_us,parallel_us,speedup,efficiency,valid"
+
+var (
+	parallelJobs    = make(chan func(worker int))
+	parallelDone    = make(chan struct{})
+	parallelStarted bool
+
+	barrierMu         sync.Mutex
+	barrierCond       = sync.NewCond(&barrierMu)
+	barrierWaiting    int
+	barrierGeneration uint32
+)
+
+// parallelWorker runs every job as worker 1.
+func parallelWorker() {
+	for fn := range parallelJobs {
+		fn(1)
+		parallelDone <- struct{}{}
+	}
+}
+
+// Parallel calls fn(worker) for every worker concurrently and returns once
+// all of them have returned. It must not be called from inside a worker.
+func Parallel(fn func(worker int)) {
+	if !parallelStarted {
+		go parallelWorker()
+		parallelStarted = true
+	}
+	parallelJobs <- fn
+	fn(0)
+	<-parallelDone
+}
+
+// Barrier blocks until every worker of the current Parallel call has
+// reached it. Every worker must call it the same number of times; writes
+// made before the barrier are visible to every worker after it.
+func Barrier() {
+	barrierMu.Lock()
+	generation := barrierGeneration
+	barrierWaiting++
+	if barrierWaiting == Workers {
+		barrierWaiting = 0
+		barrierGeneration++
+		barrierCond.Broadcast()
+	} else {
+		for generation == barrierGeneration {
+			barrierCond.Wait()
+		}
+	}
+	barrierMu.Unlock()
+}
+
+// SpeedupCSV formats the speedup of a parallel run over a single-core run
+// as the SpeedupCSVColumns fields, from the median times. A failed
+// verification on either side gives "invalid".
+func SpeedupCSV(single, parallel Stats) string {
+	if !single.Valid || !parallel.Valid {
+		return "invalid"
+	}
+	speedup := 0.0
+	if parallel.Median > 0 {
+		speedup = float64(single.Median) / float64(parallel.Median)
+	}
+	return strconv.FormatInt(single.Median, 10) + "," +
+		strconv.FormatInt(parallel.Median, 10) + "," +
+		strconv.FormatFloat(speedup, 'f', 3, 64) + "," +
+		strconv.FormatFloat(speedup/Workers, 'f', 3, 64) + ",1"
+}
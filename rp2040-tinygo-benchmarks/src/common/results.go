@@ -0,0 +1,94 @@
+package common
+
+import (
+	"strconv"
+	"sync/atomic"
+)
+
+// Record is one fixed-size result, mirroring bench_record_t in the C suite.
+// The meaning of Tag and Value is up to the benchmark; Time is a duration in
+// the benchmark's own unit (microseconds for the TinyGo suite).
+type Record struct {
+	Tag   uint32
+	Value uint32
+	Time  int64
+}
+
+// Ring is a deferred result sink: a preallocated single-producer /
+// single-consumer ring of Records.
+//
+// Printing over USB serial inside an interrupt handler or a timed loop
+// perturbs the very latency being measured, so measured code only calls
+// Push, which never allocates, blocks or prints and is safe from an
+// interrupt handler. Records are formatted after the measured phase with
+// Drain. The producer only advances head and the consumer only advances
+// tail; when the ring is full new records are dropped and counted.
+type Ring struct {
+	records []Record
+	mask    uint32
+	head    atomic.Uint32
+	tail    atomic.Uint32
+	dropped atomic.Uint32
+}
+
+// NewRing wraps preallocated storage whose length is a power of two.
+func NewRing(storage []Record) *Ring {
+	n := len(storage)
+	if n == 0 || n&(n-1) != 0 {
+		panic("common: ring capacity must be a power of two")
+	}
+	return &Ring{records: storage, mask: uint32(n - 1)}
+}
+
+// Push appends a record and reports false if the ring was full.
+func (r *Ring) Push(tag, value uint32, t int64) bool {
+	head := r.head.Load()
+	if head-r.tail.Load() > r.mask {
+		r.dropped.Add(1)
+		return false
+	}
+	r.records[head&r.mask] = Record{Tag: tag, Value: value, Time: t}
+	r.head.Store(head + 1) // publishes the record
+	return true
+}
+
+// Pop removes the oldest record.
+func (r *Ring) Pop() (Record, bool) {
+	tail := r.tail.Load()
+	if tail == r.head.Load() {
+		return Record{}, false
+	}
+	rec := r.records[tail&r.mask]
+	r.tail.Store(tail + 1)
+	return rec, true
+}
+
+// Len returns the number of records waiting to be read.
+func (r *Ring) Len() int {
+	return int(r.head.Load() - r.tail.Load())
+}
+
+// Reset discards all records. Only call while the producer is idle.
+func (r *Ring) Reset() {
+	r.head.Store(0)
+	r.tail.Store(0)
+	r.dropped.Store(0)
+}
+
+// Drain pops every record and passes it to fn, then reports any dropped
+// records as a "# dropped,<n>" line. Call once measurement has finished.
+func (r *Ring) Drain(fn func(Record)) int {
+	count := 0
+	for {
+		rec, ok := r.Pop()
+		if !ok {
+			break
+		}
+		fn(rec)
+		count++
+	}
+	if d := r.dropped.Load(); d > 0 {
+		println("# dropped," + strconv.FormatUint(uint64(d), 10))
+	}
+	return count
+}
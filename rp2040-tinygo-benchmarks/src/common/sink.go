@@ -0,0 +1,44 @@
+package common
+
+import (
+	"sync/atomic"
+	"unsafe"
+)
+
+// Optimisation sinks, mirroring bench_sink.h in the C suite.
+//
+// A kernel whose output is never read may be shrunk or removed by LLVM.
+// Benchmarks pass their output through one of these sinks inside the timed
+// closure and verify it afterwards (see MeasureVerified). An atomic store to
+// a package-level variable is never eliminated by LLVM, and storing a
+// pointer makes the buffer reachable from a global, so every write to it
+// before the store must really happen. Neither sink allocates.
+var (
+	sinkWord    uint32
+	sinkPointer unsafe.Pointer
+)
+
+// Sink makes v observable so the computation producing it is kept.
+func Sink(v int) {
+	atomic.StoreUint32(&sinkWord, uint32(v))
+}
+
+// SinkInts makes the contents of s observable.
+func SinkInts(s []int) {
+	atomic.StorePointer(&sinkPointer, unsafe.Pointer(unsafe.SliceData(s)))
+}
+
+// SinkFloat32s makes the contents of s observable.
+func SinkFloat32s(s []float32) {
+	atomic.StorePointer(&sinkPointer, unsafe.Pointer(unsafe.SliceData(s)))
+}
+
+// SinkInt16s makes the contents of s observable.
+func SinkInt16s(s []int16) {
+	atomic.StorePointer(&sinkPointer, unsafe.Pointer(unsafe.SliceData(s)))
+}
+
+// SinkInt32s makes the contents of s observable.
+func SinkInt32s(s []int32) {
+	atomic.StorePointer(&sinkPointer, unsafe.Pointer(unsafe.SliceData(s)))
+}
@@ -0,0 +1,177 @@
+package common
+
+import (
+	"math"
+	"sort"
+	"strconv"
+	"time"
+)
+
+// Repetition defaults, mirroring bench_stats.h in the C suite.
+const (
+	MaxSamples      = 4096    // capacity of the shared sample buffer
+	DefaultWarmup   = 10      // untimed warm-up iterations
+	DefaultReps     = 1000    // measured iterations
+	DefaultBudgetUS = 2000000 // per-phase time budget (2 s)
+)
+
+// StatsCSVColumns are the column names printed after a benchmark's own
+// leading columns. time_us (the median) stays in its original position.
+// A row whose output failed verification prints "invalid" instead.
+const StatsCSVColumns = "time_us,min_us,p90_us,p99_us,max_us,mean_us,stddev_us,reps,valid"
+
+// Config holds the repetition settings for one measurement.
+type Config struct {
+	Warmup   int   // untimed warm-up iterations
+	Reps     int   // measured iterations (capped at MaxSamples)
+	BudgetUS int64 // per-phase time budget in microseconds
+}
+
+// Stats summarises the measured samples in microseconds.
+type Stats struct {
+	Count  int
+	Min    int64
+	Median int64
+	P90    int64
+	P99    int64
+	Max    int64
+	Mean   float64
+	StdDev float64 // sample standard deviation (n - 1)
+	Valid  bool    // output of the last run passed verification
+}
+
+// samples is the statically allocated sample buffer shared by all
+// measurements, so repeated runs never touch the heap.
+var samples [MaxSamples]int64
+
+// sampleSlice sorts a prefix of the sample buffer without reflection.
+type sampleSlice []int64
+
+func (s sampleSlice) Len() int           { return len(s) }
+func (s sampleSlice) Less(i, j int) bool { return s[i] < s[j] }
+func (s sampleSlice) Swap(i, j int)      { s[i], s[j] = s[j], s[i] }
+
+// DefaultConfig returns the default repetition settings.
+func DefaultConfig() Config {
+	return Config{Warmup: DefaultWarmup, Reps: DefaultReps, BudgetUS: DefaultBudgetUS}
+}
+
+// Measure runs fn repeatedly and returns timing statistics.
+//
+// setup (optional, untimed) runs before every iteration. Each measured
+// iteration is timed with MeasureUS. Both the warm-up and measured phases stop
+// early once they exceed cfg.BudgetUS; at least one sample is always taken.
+//
+// Parameters:
+//   - cfg: repetition settings
+//   - setup: per-iteration preparation (may be nil)
+//   - fn: the function to benchmark
+//
+// Returns:
+//   - Summary statistics over the measured samples
+func Measure(cfg Config, setup, fn func()) Stats {
+	reps := cfg.Reps
+	if reps < 1 {
+		reps = 1
+	}
+	if reps > MaxSamples {
+		reps = MaxSamples
+	}
+
+	// Warm-up phase
+	phaseStart := time.Now()
+	for i := 0; i < cfg.Warmup; i++ {
+		if setup != nil {
+			setup()
+		}
+		fn()
+		if time.Since(phaseStart).Microseconds() > cfg.BudgetUS {
+			break
+		}
+	}
+
+	// Measured phase
+	count := 0
+	phaseStart = time.Now()
+	for count < reps {
+		if setup != nil {
+			setup()
+		}
+		samples[count] = MeasureUS(fn)
+		count++
+		if time.Since(phaseStart).Microseconds() > cfg.BudgetUS {
+			break
+		}
+	}
+
+	return computeStats(samples[:count])
+}
+
+// MeasureVerified is Measure followed by a check of the last run's output.
+//
+// verify runs once, untimed, after the measured phase. If it returns false
+// the Stats are marked invalid and CSV prints "invalid" instead of timings,
+// so a broken or optimised-away kernel cannot show up as a speedup.
+func MeasureVerified(cfg Config, setup, fn func(), verify func() bool) Stats {
+	stats := Measure(cfg, setup, fn)
+	stats.Valid = verify()
+	return stats
+}
+
+// percentile returns the nearest-rank percentile of sorted samples.
+func percentile(sorted []int64, pct int) int64 {
+	rank := (pct*len(sorted) + 99) / 100
+	if rank < 1 {
+		rank = 1
+	}
+	return sorted[rank-1]
+}
+
+// computeStats sorts s in place and reduces it to summary statistics.
+func computeStats(s []int64) Stats {
+	sort.Sort(sampleSlice(s))
+
+	n := len(s)
+	sum := 0.0
+	for _, v := range s {
+		sum += float64(v)
+	}
+	mean := sum / float64(n)
+
+	sq := 0.0
+	for _, v := range s {
+		d := float64(v) - mean
+		sq += d * d
+	}
+	stddev := 0.0
+	if n > 1 {
+		stddev = math.Sqrt(sq / float64(n-1))
+	}
+
+	return Stats{
+		Count:  n,
+		Min:    s[0],
+		Median: percentile(s, 50),
+		P90:    percentile(s, 90),
+		P99:    percentile(s, 99),
+		Max:    s[n-1],
+		Mean:   mean,
+		StdDev: stddev,
+		Valid:  true,
+	}
+}
+
+// CSV formats the statistics as the StatsCSVColumns fields, or "invalid".
+func (s Stats) CSV() string {
+	if !s.Valid {
+		return "invalid"
+	}
+	return strconv.FormatInt(s.Median, 10) + "," +
+		strconv.FormatInt(s.Min, 10) + "," +
+		strconv.FormatInt(s.P90, 10) + "," +
+		strconv.FormatInt(s.P99, 10) + "," +
+		strconv.FormatInt(s.Max, 10) + "," +
+		strconv.FormatFloat(s.Mean, 'f', 2, 64) + "," +
+		strconv.FormatFloat(s.StdDev, 'f', 2, 64) + "," +
+		strconv.Itoa(s.Count) + ",1"
+}
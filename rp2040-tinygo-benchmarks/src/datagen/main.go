@@ -0,0 +1,102 @@
+package main
+
+import (
+	"os"
+	"strconv"
+
+	"rp2040-tinygo-benchmarks/src/common"
+)
+
+// Reference sequences of every input-data generator (common/data.go).
+//
+// Prints the same table as the C suite's host/bench_datagen, so
+// scripts/check_data_parity.sh can compare the two byte for byte. It does
+// not import machine, so it runs both on the host (`go run ./src/datagen`)
+// and on the board, where println goes to USB serial. Each generator uses
+// its own stream of the given seed:
+//
+//   stream  generator  parameters
+//   0       pcg32      raw 32-bit outputs
+//   1       below      bound 1000
+//   2       uniform    [-1000000, 1000000]
+//   3       gaussian   mean 0, standard deviation 1000
+//   4       runs       run length 16
+//   5       tones      bins 5 and 37 at 0.5 and 0.25 full scale, noise ±64
+//   -       sin        common.SinQ15 at phase i · (2^32 / count)
+//
+// Output format:
+//   generator,index,value
+//
+// Usage:
+//   datagen [SEED [COUNT]]   (defaults: seed 1, count 1024)
+
+var datagenTones = []common.Tone{{Bin: 5, Amplitude: 16384}, {Bin: 37, Amplitude: 8192}}
+
+func printInt32s(generator string, values []int32) {
+	for i, v := range values {
+		println(generator + "," + strconv.Itoa(i) + "," + strconv.FormatInt(int64(v), 10))
+	}
+}
+
+// datagen prints the reference table for one seed and length.
+func datagen(seed uint64, count int) {
+	values := make([]int32, count)
+	samples := make([]int16, count)
+
+	println("generator,index,value")
+
+	rng := common.NewRNG(seed, 0)
+	for i := 0; i < count; i++ {
+		println("pcg32," + strconv.Itoa(i) + "," + strconv.FormatUint(uint64(rng.Next()), 10))
+	}
+
+	rng.Seed(seed, 1)
+	for i := 0; i < count; i++ {
+		println("below," + strconv.Itoa(i) + "," + strconv.FormatUint(uint64(rng.Below(1000)), 10))
+	}
+
+	rng.Seed(seed, 2)
+	common.UniformInt32s(values, &rng, -1000000, 1000000)
+	printInt32s("uniform", values)
+
+	rng.Seed(seed, 3)
+	common.GaussianInt32s(values, &rng, 0, 1000)
+	printInt32s("gaussian", values)
+
+	rng.Seed(seed, 4)
+	common.SortedRunsInt32s(values, &rng, 16)
+	printInt32s("runs", values)
+
+	rng.Seed(seed, 5)
+	common.TonesInt16s(samples, datagenTones, &rng, 64)
+	for i, s := range samples {
+		println("tones," + strconv.Itoa(i) + "," + strconv.Itoa(int(s)))
+	}
+
+	for i := 0; i < count; i++ {
+		phase := uint32((uint64(i) << 32) / uint64(count))
+		println("sin," + strconv.Itoa(i) + "," + strconv.Itoa(int(common.SinQ15(phase))))
+	}
+}
+
+func main() {
+	seed := uint64(1)
+	count := 1024
+	if len(os.Args) > 1 {
+		v, err := strconv.ParseUint(os.Args[1], 0, 64)
+		if err != nil {
+			println("usage: datagen [SEED [COUNT]]")
+			os.Exit(2)
+		}
+		seed = v
+	}
+	if len(os.Args) > 2 {
+		v, err := strconv.Atoi(os.Args[2])
+		if err != nil || v < 1 {
+			println("usage: datagen [SEED [COUNT]]")
+			os.Exit(2)
+		}
+		count = v
+	}
+	datagen(seed, count)
+}
@@ -0,0 +1,218 @@
+package main
+
+// Fixed-point (Q15/Q31) radix-2 FFTs, ports of src/fft/fixed_point.c in the
+// C suite.
+//
+// Same decimation-in-time structure as fftRadix2, with the butterfly loops
+// ordered twiddle-first: each twiddle is read from the ROM table
+// (twiddle_table.go, generated by scripts/gen_fft_twiddles.py) once per
+// stage, so there is no twiddle recurrence and no trigonometry at run time.
+// Products are rounded and outputs saturated, so an overflow clips instead
+// of wrapping.
+
+// fftScale selects the per-stage scaling policy.
+type fftScale int
+
+const (
+	scaleNone  fftScale = iota // never scale; large inputs saturate
+	scaleStage                 // halve every stage: result is X[k] / n
+	scaleBlock                 // block floating point: halve a stage only when
+	// the data lacks two guard bits (any |x| >= 1/4 full scale)
+)
+
+// Block floating point: scale a stage once any magnitude reaches this.
+const (
+	q15GuardLimit = 1 << 13
+	q31GuardLimit = 1 << 29
+)
+
+func satQ15(v int32) int16 {
+	if v > 32767 {
+		return 32767
+	}
+	if v < -32768 {
+		return -32768
+	}
+	return int16(v)
+}
+
+func satQ31(v int64) int32 {
+	if v > 2147483647 {
+		return 2147483647
+	}
+	if v < -2147483648 {
+		return -2147483648
+	}
+	return int32(v)
+}
+
+// butterflyQ15 is the Q15 butterfly on (x[t], x[u]) with twiddle
+// (wCos, wSin), halving both outputs when shift is 1.
+func butterflyQ15(real, imag []int16, t, u int, wCos, wSin int32, shift uint) {
+	// |w| <= 32767, so neither sum of products can overflow
+	tReal := (wCos*int32(real[u]) + wSin*int32(imag[u]) + 1<<14) >> 15
+	tImag := (wCos*int32(imag[u]) - wSin*int32(real[u]) + 1<<14) >> 15
+
+	uReal := int32(real[t])
+	uImag := int32(imag[t])
+	round := int32(shift)
+
+	real[t] = satQ15((uReal + tReal + round) >> shift)
+	imag[t] = satQ15((uImag + tImag + round) >> shift)
+	real[u] = satQ15((uReal - tReal + round) >> shift)
+	imag[u] = satQ15((uImag - tImag + round) >> shift)
+}
+
+// bitReverseQ15Range swaps x[i] with x[rev(i)] for i in [first, last)
+// where i < rev(i). Each swapped pair belongs to the range holding its
+// smaller index, so disjoint ranges touch disjoint elements.
+func bitReverseQ15Range(real, imag []int16, first, last int) {
+	n := len(real)
+
+	// j = rev(first), then the same reversed increment as the full loop
+	j := 0
+	for bit, rbit := 1, n>>1; bit < n; bit, rbit = bit<<1, rbit>>1 {
+		if first&bit != 0 {
+			j |= rbit
+		}
+	}
+	for i := first; i < last; i++ {
+		if i < j {
+			real[i], real[j] = real[j], real[i]
+			imag[i], imag[j] = imag[j], imag[i]
+		}
+		m := n >> 1
+		for j >= m && m > 0 {
+			j -= m
+			m >>= 1
+		}
+		j += m
+	}
+}
+
+func bitReverseQ31(real, imag []int32) {
+	n := len(real)
+	j := 0
+	for i := 0; i < n; i++ {
+		if i < j {
+			real[i], real[j] = real[j], real[i]
+			imag[i], imag[j] = imag[j], imag[i]
+		}
+		m := n >> 1
+		for j >= m && m > 0 {
+			j -= m
+			m >>= 1
+		}
+		j += m
+	}
+}
+
+// needsScalingQ15 reports whether the data lacks two guard bits, from the
+// OR of all magnitudes.
+func needsScalingQ15(real, imag []int16) bool {
+	var bits int32
+	for i := range real {
+		bits |= int32(real[i] ^ (real[i] >> 15))
+		bits |= int32(imag[i] ^ (imag[i] >> 15))
+	}
+	return bits >= q15GuardLimit
+}
+
+func needsScalingQ31(real, imag []int32) bool {
+	var bits int32
+	for i := range real {
+		bits |= real[i] ^ (real[i] >> 31)
+		bits |= imag[i] ^ (imag[i] >> 31)
+	}
+	return bits >= q31GuardLimit
+}
+
+// fftQ15StageRange runs butterflies [first, last) of the stage of span m,
+// every output halved (scaleStage). A stage's n/2 butterflies share no
+// element, so disjoint ranges can run concurrently, bit-identical to
+// fftQ15. Run bitReverseQ15Range and then the stages m = 2, 4, ..., n in
+// order, with a barrier between them.
+func fftQ15StageRange(real, imag []int16, m, first, last int) {
+	half := m >> 1
+	log2Half := uint(0)
+	for 1<<log2Half < half {
+		log2Half++
+	}
+	step := twiddleN / m
+
+	// Butterfly b is pair j = b mod half of group b / half
+	for b := first; b < last; b++ {
+		j := b & (half - 1)
+		t := (b>>log2Half)<<(log2Half+1) + j
+		butterflyQ15(real, imag, t, t+half, int32(twiddleQ15[j*step][0]),
+			int32(twiddleQ15[j*step][1]), 1)
+	}
+}
+
+// fftQ15 computes an in-place Q15 FFT (len(real) a power of 2, at most
+// twiddleN) and returns the number of stages that were halved.
+func fftQ15(real, imag []int16, scale fftScale) int {
+	n := len(real)
+	bitReverseQ15Range(real, imag, 0, n)
+
+	totalShift := 0
+	for m := 2; m <= n; m <<= 1 {
+		half := m >> 1
+		step := twiddleN / m
+		shift := 0
+		if scale == scaleStage || (scale == scaleBlock && needsScalingQ15(real, imag)) {
+			shift = 1
+		}
+		totalShift += shift
+
+		for j := 0; j < half; j++ {
+			wCos := int32(twiddleQ15[j*step][0])
+			wSin := int32(twiddleQ15[j*step][1])
+
+			for t := j; t < n; t += m {
+				butterflyQ15(real, imag, t, t+half, wCos, wSin, uint(shift))
+			}
+		}
+	}
+	return totalShift
+}
+
+// fftQ31 computes an in-place Q31 FFT (len(real) a power of 2, at most
+// twiddleN) and returns the number of stages that were halved.
+func fftQ31(real, imag []int32, scale fftScale) int {
+	n := len(real)
+	bitReverseQ31(real, imag)
+
+	totalShift := 0
+	for m := 2; m <= n; m <<= 1 {
+		half := m >> 1
+		step := twiddleN / m
+		shift := 0
+		if scale == scaleStage || (scale == scaleBlock && needsScalingQ31(real, imag)) {
+			shift = 1
+		}
+		totalShift += shift
+		round := int64(shift)
+
+		for j := 0; j < half; j++ {
+			wCos := int64(twiddleQ31[j*step][0])
+			wSin := int64(twiddleQ31[j*step][1])
+
+			for t := j; t < n; t += m {
+				u := t + half
+
+				tReal := (wCos*int64(real[u]) + wSin*int64(imag[u]) + 1<<30) >> 31
+				tImag := (wCos*int64(imag[u]) - wSin*int64(real[u]) + 1<<30) >> 31
+
+				uReal := int64(real[t])
+				uImag := int64(imag[t])
+
+				real[t] = satQ31((uReal + tReal + round) >> shift)
+				imag[t] = satQ31((uImag + tImag + round) >> shift)
+				real[u] = satQ31((uReal - tReal + round) >> shift)
+				imag[u] = satQ31((uImag - tImag + round) >> shift)
+			}
+		}
+	}
+	return totalShift
+}
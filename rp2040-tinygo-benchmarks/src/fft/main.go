@@ -3,38 +3,234 @@ package main
 import (
 	"machine"
 	"math"
+	"strconv"
 	"time"
+
+	"rp2040-tinygo-benchmarks/src/common"
 )
 
-// benchmarkFFT runs an FFT benchmark on a fixed-size sine wave input.
+// fftSizes are the transform sizes, the same as the C suite's.
+var fftSizes = []int{64, 128, 256, 512, 1024, 2048, 4096}
+
+const maxN = 4096
+
+// fftVariant is one FFT implementation under test.
+type fftVariant struct {
+	method   string
+	minSNR   float64                        // lowest SNR verify accepts (dB)
+	fill     func()                         // regenerate the input (untimed)
+	run      func()                         // the timed transform
+	spectrum func(k int) (float64, float64) // output bin k in float units
+}
+
+// testSignal is 0.5*sin(2*pi*i/n) + 0.25*cos(2*pi*(n/8)*i/n), as in the C
+// suite. The 0.75 peak leaves fixed-point headroom.
+func testSignal(i, n int) float64 {
+	return 0.5*math.Sin(2*math.Pi*float64(i)/float64(n)) +
+		0.25*math.Cos(2*math.Pi*float64(n/8)*float64(i)/float64(n))
+}
+
+// reference returns bin k of the analytic transform of testSignal: -j*n/4
+// in bin 1, +j*n/4 in bin n-1 and n/8 in bins n/8 and 7n/8.
+func reference(k, n int) (float64, float64) {
+	switch {
+	case k == 1:
+		return 0, -0.25 * float64(n)
+	case k == n-1:
+		return 0, 0.25 * float64(n)
+	case k == n/8 || k == n-n/8:
+		return 0.125 * float64(n), 0
+	}
+	return 0, 0
+}
+
+// benchmarkFFT runs the float and fixed-point FFT benchmarks.
 //
-// This benchmark measures the performance of the radix-2 FFT algorithm
-// using a real-valued sine wave signal. The input is transformed using
-// an in-place FFT implementation. Results are printed in CSV format
-// over USB serial output.
+// Every variant transforms the same two-tone test signal at each size in
+// fftSizes. The input is regenerated and transformed in place on every
+// repetition of common.MeasureVerified, and after timing the spectrum's
+// signal-to-noise ratio against the analytic transform must reach the
+// variant's threshold. Results are printed in CSV format over USB serial.
 //
 // Notes:
-//   - The test array size is fixed at 128 samples.
-//   - Output format: task,method,size,time_us
+//   - Variants: radix2 (float32), q15 and q31 (every stage halved), q15_bfp
+//     and q31_bfp (block floating point), see fixed.go, and q15_parallel
+//     (q15 split between both cores, see common.Parallel).
+//   - Output format: task,method,size,time_us,...(see common.StatsCSVColumns),
+//     then task,method,size,single_us,...(see common.SpeedupCSVColumns) for
+//     q15_parallel over q15, then task,method,size,snr_db,scale_shift for
+//     every variant and size.
 func benchmarkFFT() {
-	const N = 128
-	real := make([]float32, N)
-	imag := make([]float32, N)
+	probe := common.StartMemory()
 
-	// Fill input with a sine wave
-	for i := 0; i < N; i++ {
-		real[i] = float32(math.Sin(2 * math.Pi * float64(i) / float64(N)))
-		imag[i] = 0
+	// Buffers for the largest size, resliced per size. The test signal is
+	// kept in Q31 and converted by each fill, so math.Sin stays out of it.
+	input := make([]int32, maxN)
+	realF32 := make([]float32, maxN)
+	imagF32 := make([]float32, maxN)
+	realQ15 := make([]int16, maxN)
+	imagQ15 := make([]int16, maxN)
+	realQ31 := make([]int32, maxN)
+	imagQ31 := make([]int32, maxN)
+
+	n := 0
+	shift := 0 // stages halved by the last fixed-point run
+
+	fillFloat := func() {
+		for i := 0; i < n; i++ {
+			realF32[i] = float32(input[i]) * (1.0 / q31One)
+			imagF32[i] = 0
+		}
+	}
+	fillQ15 := func() {
+		for i := 0; i < n; i++ {
+			realQ15[i] = int16((input[i] + 1<<15) >> 16)
+			imagQ15[i] = 0
+		}
+	}
+	fillQ31 := func() {
+		copy(realQ31[:n], input[:n])
+		for i := 0; i < n; i++ {
+			imagQ31[i] = 0
+		}
 	}
 
-	start := time.Now()
-	fftRadix2(real, imag)
-	elapsed := time.Since(start).Microseconds()
+	runQ15 := func(scale fftScale) func() {
+		return func() {
+			shift = fftQ15(realQ15[:n], imagQ15[:n], scale)
+			common.SinkInt16s(realQ15)
+			common.SinkInt16s(imagQ15)
+		}
+	}
+	// One worker's share of q15_parallel: its part of the bit reversal and
+	// of every stage, a barrier between stages (the next stage reads both
+	// halves). Built once so the timed run does not allocate a closure.
+	q15Worker := func(worker int) {
+		butterflies := n / 2
+		bitReverseQ15Range(realQ15[:n], imagQ15[:n],
+			n*worker/common.Workers, n*(worker+1)/common.Workers)
+		for m := 2; m <= n; m <<= 1 {
+			common.Barrier()
+			fftQ15StageRange(realQ15[:n], imagQ15[:n], m,
+				butterflies*worker/common.Workers, butterflies*(worker+1)/common.Workers)
+		}
+	}
+	runQ15Parallel := func() {
+		common.Parallel(q15Worker)
+		shift = 0
+		for m := 2; m <= n; m <<= 1 {
+			shift++
+		}
+		common.SinkInt16s(realQ15)
+		common.SinkInt16s(imagQ15)
+	}
+	runQ31 := func(scale fftScale) func() {
+		return func() {
+			shift = fftQ31(realQ31[:n], imagQ31[:n], scale)
+			common.SinkInt32s(realQ31)
+			common.SinkInt32s(imagQ31)
+		}
+	}
 
-	println("task,method,size,time_us")
-	println("fft,radix2,", N, ",", elapsed)
+	// Undo the stage halvings and the fixed-point full scale
+	spectrumQ15 := func(k int) (float64, float64) {
+		gain := math.Ldexp(1, shift) / q15One
+		return float64(realQ15[k]) * gain, float64(imagQ15[k]) * gain
+	}
+	spectrumQ31 := func(k int) (float64, float64) {
+		gain := math.Ldexp(1, shift) / q31One
+		return float64(realQ31[k]) * gain, float64(imagQ31[k]) * gain
+	}
+
+	// SNR thresholds match the C suite's
+	variants := []fftVariant{
+		{"radix2", 80, fillFloat, func() {
+			fftRadix2(realF32[:n], imagF32[:n])
+			common.SinkFloat32s(realF32)
+			common.SinkFloat32s(imagF32)
+		}, func(k int) (float64, float64) {
+			return float64(realF32[k]), float64(imagF32[k])
+		}},
+		{"q15", 40, fillQ15, runQ15(scaleStage), spectrumQ15},
+		{"q15_bfp", 40, fillQ15, runQ15(scaleBlock), spectrumQ15},
+		{"q15_parallel", 40, fillQ15, runQ15Parallel, spectrumQ15},
+		{"q31", 130, fillQ31, runQ31(scaleStage), spectrumQ31},
+		{"q31_bfp", 130, fillQ31, runQ31(scaleBlock), spectrumQ31},
+	}
+
+	setSize := func(size int) {
+		n = size
+		for i := 0; i < n; i++ {
+			input[i] = int32(math.Round(testSignal(i, n) * q31One))
+		}
+	}
+
+	// SNR = 10*log10(sum |X_ref|^2 / sum |X - X_ref|^2) over all bins; the
+	// noise includes the quantisation of the input itself
+	snr := func(v *fftVariant) float64 {
+		var signal, noise float64
+		for k := 0; k < n; k++ {
+			re, im := v.spectrum(k)
+			refRe, refIm := reference(k, n)
+			signal += refRe*refRe + refIm*refIm
+			noise += (re-refRe)*(re-refRe) + (im-refIm)*(im-refIm)
+		}
+		return 10 * math.Log10(signal/(noise+1e-30))
+	}
+
+	// q15 and q15_parallel timings, for the speedup rows
+	singleStats := make([]common.Stats, len(fftSizes))
+	parallelStats := make([]common.Stats, len(fftSizes))
+
+	for i := range variants {
+		v := &variants[i]
+		verify := func() bool { return snr(v) >= v.minSNR }
+
+		println("task,method,size," + common.StatsCSVColumns)
+		for si, size := range fftSizes {
+			setSize(size)
+			stats := common.MeasureVerified(common.DefaultConfig(), v.fill, v.run, verify)
+			println("fft," + v.method + "," + strconv.Itoa(n) + "," + stats.CSV())
+			switch v.method {
+			case "q15":
+				singleStats[si] = stats
+			case "q15_parallel":
+				parallelStats[si] = stats
+			}
+		}
+	}
+
+	println("task,method,size," + common.SpeedupCSVColumns)
+	for si, size := range fftSizes {
+		println("fft,q15_parallel," + strconv.Itoa(size) + "," +
+			common.SpeedupCSV(singleStats[si], parallelStats[si]))
+	}
+
+	println("task,method,size,snr_db,scale_shift")
+	for i := range variants {
+		v := &variants[i]
+		for _, size := range fftSizes {
+			setSize(size)
+			shift = 0
+			v.fill()
+			v.run()
+			println("fft," + v.method + "," + strconv.Itoa(n) + "," +
+				strconv.FormatFloat(snr(v), 'f', 1, 64) + "," + strconv.Itoa(shift))
+		}
+	}
+
+	// The buffers are shared by every variant, so heap use is reported once
+	mem := probe.Stop()
+	println("task,method,size," + common.MemoryCSVColumns)
+	println("fft,all," + strconv.Itoa(maxN) + "," + mem.CSV())
 }
 
+// Full scale of the fixed-point formats.
+const (
+	q15One = 32768.0
+	q31One = 2147483648.0
+)
+
 // main is the entry point for the TinyGo benchmark.
 //
 // It initializes USB serial, prints a start message,
@@ -2,34 +2,65 @@ package main
 
 import (
 	"machine"
+	"strconv"
 	"time"
+
+	"rp2040-tinygo-benchmarks/src/common"
 )
 
 // benchmarkFibonacci runs Fibonacci benchmarks on a predefined set of values.
 //
 // This benchmark tests both iterative and recursive implementations of the
-// Fibonacci sequence. Execution time is measured using high-resolution timers,
-// and the results are printed in CSV format over USB serial.
+// Fibonacci sequence. Each variant is repeated by common.MeasureVerified,
+// which compares the result with a reference value after timing, and the
+// timing statistics are printed in CSV format over USB serial.
 //
 // Tested values: 10, 20, 30, 35
-// Output format: task,method,n,result,time_us
+// Output format: task,method,n,result,time_us,...(see common.StatsCSVColumns)
 func benchmarkFibonacci() {
 	ns := []int{10, 20, 30, 35}
+	cfg := common.DefaultConfig()
+
+	println("task,method,n,result," + common.StatsCSVColumns)
+
+	iterMems := make([]common.Memory, len(ns))
+	recMems := make([]common.Memory, len(ns))
 
-	println("task,method,n,result,time_us")
+	for i, n := range ns {
+		var result int
+
+		// Reference by straightforward summation, independent of both kernels
+		reference := 0
+		for a, b, i := 0, 1, 0; i <= n; i++ {
+			reference = a
+			a, b = b, a+b
+		}
+		verify := func() bool { return result == reference }
 
-	for _, n := range ns {
 		// Iterative
-		start := time.Now()
-		result := FibIterative(n)
-		elapsed := time.Since(start).Microseconds()
-		println("fibonacci,iterative,", n, ",", result, ",", elapsed)
+		probe := common.StartMemory()
+		stats := common.MeasureVerified(cfg, nil, func() {
+			result = FibIterative(n)
+			common.Sink(result)
+		}, verify)
+		iterMems[i] = probe.Stop()
+		println("fibonacci,iterative," + strconv.Itoa(n) + "," + strconv.Itoa(result) + "," + stats.CSV())
 
 		// Recursive
-		start = time.Now()
-		result = FibRecursive(n)
-		elapsed = time.Since(start).Microseconds()
-		println("fibonacci,recursive,", n, ",", result, ",", elapsed)
+		result = -1
+		probe = common.StartMemory()
+		stats = common.MeasureVerified(cfg, nil, func() {
+			result = FibRecursive(n)
+			common.Sink(result)
+		}, verify)
+		recMems[i] = probe.Stop()
+		println("fibonacci,recursive," + strconv.Itoa(n) + "," + strconv.Itoa(result) + "," + stats.CSV())
+	}
+
+	println("task,method,n," + common.MemoryCSVColumns)
+	for i, n := range ns {
+		println("fibonacci,iterative," + strconv.Itoa(n) + "," + iterMems[i].CSV())
+		println("fibonacci,recursive," + strconv.Itoa(n) + "," + recMems[i].CSV())
 	}
 }
 
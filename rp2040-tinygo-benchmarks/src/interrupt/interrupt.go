@@ -2,30 +2,45 @@ package main
 
 import (
 	"machine"
+	"strconv"
 	"time"
+
+	"rp2040-tinygo-benchmarks/src/common"
 )
 
 const (
-	buttonPin = machine.GPIO14 // GPIO14 = pin 19 (input from button)
-	buzzerPin = machine.GPIO15 // GPIO15 = pin 20 (output to buzzer)
+	buttonPin       = machine.GPIO14 // GPIO14 = pin 19 (input from button)
+	buzzerPin       = machine.GPIO15 // GPIO15 = pin 20 (output to buzzer)
+	interruptEvents = 20             // edges to record before printing
 )
 
 var (
 	triggered  = false
-	irqStart   int64
+	irqStart   uint32 // low word of the µs clock: one store, so the ISR never sees half of it
 	irqLatency int64
+	irqCount   uint32
+
+	latencyRecords [32]common.Record // must hold interruptEvents records
+	latencyRing    = common.NewRing(latencyRecords[:])
 )
 
 /*
  * handleInterrupt is the GPIO interrupt callback function.
  *
  * This ISR is triggered on both rising and falling edges on GPIO14.
- * It records the interrupt latency, prints the result, and signals
- * the main loop to activate the buzzer.
+ * It records the interrupt latency in the result ring and signals the
+ * main loop to activate the buzzer. Nothing is printed here.
  */
 func handleInterrupt(pin machine.Pin) {
-	irqLatency = time.Since(time.UnixMicro(irqStart)).Microseconds()
-	println("interrupt,triggered,", irqLatency)
+	irqLatency = int64(uint32(time.Now().UnixMicro()) - irqStart) // wraps like the timer
+
+	level := uint32(0)
+	if pin.Get() {
+		level = 1
+	}
+	latencyRing.Push(uint32(pin), level, irqLatency)
+
+	irqCount++
 	triggered = true
 }
 
@@ -45,12 +60,18 @@ func handleInterrupt(pin machine.Pin) {
  *   - Buzzer GND → Common GND rail
  *
  * Output format:
- *   task,method,latency_us
+ *   task,method,latency_us,gpio,level
+ *
+ * Rows are printed after interruptEvents edges have been recorded, so USB
+ * serial output never runs inside the interrupt handler.
  */
 func benchmarkInterrupt() {
 	println("Benchmark: Interrupt Latency")
-	println("task,method,latency_us")
-	println("Press the button to trigger interrupt...")
+	println("task,method,latency_us,gpio,level")
+	println("Press the button " + strconv.Itoa(interruptEvents) + " times to trigger interrupts...")
+
+	latencyRing.Reset()
+	irqCount = 0
 
 	buttonPin.Configure(machine.PinConfig{Mode: machine.PinInputPulldown})
 	buzzerPin.Configure(machine.PinConfig{Mode: machine.PinOutput})
@@ -58,9 +79,9 @@ func benchmarkInterrupt() {
 
 	buttonPin.SetInterrupt(machine.PinToggle, handleInterrupt)
 
-	for {
+	for irqCount < interruptEvents {
 		// Capture timestamp before polling
-		irqStart = time.Now().UnixMicro()
+		irqStart = uint32(time.Now().UnixMicro())
 
 		// If ISR triggered, activate buzzer briefly
 		if triggered {
@@ -72,4 +93,13 @@ func benchmarkInterrupt() {
 
 		time.Sleep(1 * time.Millisecond)
 	}
+
+	buttonPin.SetInterrupt(0, nil)
+	buzzerPin.Low()
+
+	// Measurement finished: now it is safe to format and print
+	latencyRing.Drain(func(r common.Record) {
+		println("interrupt,triggered," + strconv.FormatInt(r.Time, 10) + "," +
+			strconv.FormatUint(uint64(r.Tag), 10) + "," + strconv.FormatUint(uint64(r.Value), 10))
+	})
 }
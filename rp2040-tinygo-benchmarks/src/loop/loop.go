@@ -1,21 +1,25 @@
 package main
 
+import "runtime/volatile"
+
+// LoopSink is the counter incremented by LoopN.
+var LoopSink uint32
+
 // LoopN runs a simple for-loop N times and increments a global counter.
 //
 // This function is used to benchmark loop overhead in TinyGo by executing
-// a fixed number of loop iterations. The result is stored in a global sink
-// to prevent the compiler from optimizing the loop away.
+// a fixed number of loop iterations. The counter is loaded and stored with
+// volatile accesses on every iteration, like the `volatile int` in the C
+// suite, so LLVM can neither remove the loop nor fold it into a single add.
 //
 // Parameters:
 //   - n: the number of loop iterations to perform
 //
 // Returns:
 //   - The final value of the global LoopSink after execution
-var LoopSink int
-
 func LoopN(n int) int {
 	for i := 0; i < n; i++ {
-		LoopSink++
+		volatile.StoreUint32(&LoopSink, volatile.LoadUint32(&LoopSink)+1)
 	}
-	return LoopSink
+	return int(volatile.LoadUint32(&LoopSink))
 }
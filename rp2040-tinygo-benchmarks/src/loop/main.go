@@ -2,27 +2,49 @@ package main
 
 import (
 	"machine"
+	"strconv"
 	"time"
+
+	"rp2040-tinygo-benchmarks/src/common"
 )
 
 // benchmarkLoopOverhead runs a benchmark to measure basic loop iteration overhead.
 //
 // This benchmark uses a global counter and executes for-loops with a fixed number
-// of iterations (1K to 1M). Results are printed in CSV format to evaluate the
-// raw overhead of loop control logic in TinyGo.
+// of iterations (1K to 1M). The counter is reset before every repetition and
+// checked afterwards to have advanced by exactly the iteration count. The
+// results are printed in CSV format to evaluate the raw overhead of loop
+// control logic in TinyGo.
 //
 // Output format:
-//   task,method,iterations,time_us[,result]
+//   task,method,iterations,time_us,...(see common.StatsCSVColumns)
 func benchmarkLoopOverhead() {
 	iterations := []int{1000, 10000, 100000, 1000000}
-	println("task,method,iterations,time_us")
+	cfg := common.DefaultConfig()
+	println("task,method,iterations," + common.StatsCSVColumns)
+
+	reset := func() { LoopSink = 0 }
+
+	mems := make([]common.Memory, len(iterations))
 
-	for _, n := range iterations {
-		start := time.Now()
-		result := LoopN(n) // use the result to prevent optimisation
-		elapsed := time.Since(start).Microseconds()
+	for i, n := range iterations {
+		probe := common.StartMemory()
+		var result int
+		run := func() {
+			result = LoopN(n)
+			common.Sink(result)
+		}
+		verify := func() bool { return result == n }
+
+		stats := common.MeasureVerified(cfg, reset, run, verify)
+
+		println("loop,for_loop," + strconv.Itoa(n) + "," + stats.CSV())
+		mems[i] = probe.Stop()
+	}
 
-		println("loop,for_loop,", n, ",", elapsed, ",", "result:", result)
+	println("task,method,iterations," + common.MemoryCSVColumns)
+	for i, n := range iterations {
+		println("loop,for_loop," + strconv.Itoa(n) + "," + mems[i].CSV())
 	}
 }
 
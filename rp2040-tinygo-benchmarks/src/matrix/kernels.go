@@ -0,0 +1,132 @@
+package main
+
+// Matrix multiplication kernels on contiguous row-major storage, ports of
+// src/matrix/matrix_kernels.c in the C suite.
+//
+// Every kernel computes C = A x B for an m x k matrix A and a k x n matrix
+// B held in flat slices (element (r, c) of an R x C matrix is at index
+// r*C + c), so a row is an offset into one slice instead of a separate
+// slice header as in MatrixMultiply's [][]int.
+//
+// Kernels named BT take B transposed (bt is n x k, bt[j*k+p] = B[p][j]), so
+// both operands of every dot product are read sequentially. The narrow
+// integer kernels accumulate in int32.
+
+// MatMulI32 is the reference ijk multiply; it walks B column-wise.
+func MatMulI32(a, b, c []int32, m, k, n int) {
+	for i := 0; i < m; i++ {
+		for j := 0; j < n; j++ {
+			var sum int32
+			for p := 0; p < k; p++ {
+				sum += a[i*k+p] * b[p*n+j]
+			}
+			c[i*n+j] = sum
+		}
+	}
+}
+
+// dotI32 is the dot product of two sequential int32 rows of equal length.
+func dotI32(x, y []int32) int32 {
+	var sum int32
+	y = y[:len(x)]
+	for p := range x {
+		sum += x[p] * y[p]
+	}
+	return sum
+}
+
+// MatMulI32BT multiplies with B transposed: every dot product is sequential.
+func MatMulI32BT(a, bt, c []int32, m, k, n int) {
+	for i := 0; i < m; i++ {
+		row := a[i*k : i*k+k]
+		for j := 0; j < n; j++ {
+			c[i*n+j] = dotI32(row, bt[j*k:j*k+k])
+		}
+	}
+}
+
+// MatMulI32BTBlocked multiplies with B transposed, 2x2 register-blocked:
+// each pass over k produces four outputs, so every loaded element feeds two
+// multiply-accumulates. Odd m or n finish with single dot products.
+func MatMulI32BTBlocked(a, bt, c []int32, m, k, n int) {
+	i := 0
+	for ; i+1 < m; i += 2 {
+		a0 := a[i*k : i*k+k]
+		a1 := a[(i+1)*k : (i+1)*k+k]
+
+		j := 0
+		for ; j+1 < n; j += 2 {
+			b0 := bt[j*k : j*k+k]
+			b1 := bt[(j+1)*k : (j+1)*k+k]
+			var c00, c01, c10, c11 int32
+
+			for p := range a0 {
+				x0, x1 := a0[p], a1[p]
+				y0, y1 := b0[p], b1[p]
+				c00 += x0 * y0
+				c01 += x0 * y1
+				c10 += x1 * y0
+				c11 += x1 * y1
+			}
+
+			c[i*n+j] = c00
+			c[i*n+j+1] = c01
+			c[(i+1)*n+j] = c10
+			c[(i+1)*n+j+1] = c11
+		}
+		if j < n { // odd n: last column
+			c[i*n+j] = dotI32(a0, bt[j*k:j*k+k])
+			c[(i+1)*n+j] = dotI32(a1, bt[j*k:j*k+k])
+		}
+	}
+	if i < m { // odd m: last row
+		for j := 0; j < n; j++ {
+			c[i*n+j] = dotI32(a[i*k:i*k+k], bt[j*k:j*k+k])
+		}
+	}
+}
+
+// MatMulI16BT is an int16 x int16 -> int32 multiply-accumulate, B transposed.
+func MatMulI16BT(a, bt []int16, c []int32, m, k, n int) {
+	for i := 0; i < m; i++ {
+		row := a[i*k : i*k+k]
+		for j := 0; j < n; j++ {
+			col := bt[j*k : j*k+k]
+			var sum int32
+			for p := range row {
+				sum += int32(row[p]) * int32(col[p])
+			}
+			c[i*n+j] = sum
+		}
+	}
+}
+
+// MatMulI8BT is an int8 x int8 -> int32 multiply-accumulate, B transposed.
+func MatMulI8BT(a, bt []int8, c []int32, m, k, n int) {
+	for i := 0; i < m; i++ {
+		row := a[i*k : i*k+k]
+		for j := 0; j < n; j++ {
+			col := bt[j*k : j*k+k]
+			var sum int32
+			for p := range row {
+				sum += int32(row[p]) * int32(col[p])
+			}
+			c[i*n+j] = sum
+		}
+	}
+}
+
+// MatMulF32BT is a float32 multiply (soft-float on the M0+), B transposed.
+func MatMulF32BT(a, bt, c []float32, m, k, n int) {
+	for i := 0; i < m; i++ {
+		row := a[i*k : i*k+k]
+		for j := 0; j < n; j++ {
+			col := bt[j*k : j*k+k]
+			var sum float32
+			for p := range row {
+				sum += row[p] * col[p]
+			}
+			c[i*n+j] = sum
+		}
+	}
+}
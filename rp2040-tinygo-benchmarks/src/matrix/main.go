@@ -2,7 +2,10 @@ package main
 
 import (
 	"machine"
+	"strconv"
 	"time"
+
+	"rp2040-tinygo-benchmarks/src/common"
 )
 
 // createMatrix creates a square matrix of size n x n filled using a provided function.
@@ -23,24 +26,233 @@ func createMatrix(n int, fill func(i, j int) int) [][]int {
 //
 // This benchmark multiplies square matrices of size 10 and 20 using a basic
 // triple-nested loop approach. Matrix A is filled with i+j and matrix B with i−j.
-// The result is stored in matrix C, and the execution time is printed in CSV format.
+// The result is stored in matrix C and checked against the closed-form
+// product after timing, and the execution time statistics from
+// common.MeasureVerified are printed in CSV format.
 //
 // Output format:
-//   task,method,size,time_us
+//   task,method,size,time_us,...(see common.StatsCSVColumns)
 func benchmarkMatrixMult() {
 	sizes := []int{10, 20}
-	println("task,method,size,time_us")
+	cfg := common.DefaultConfig()
+	println("task,method,size," + common.StatsCSVColumns)
+
+	mems := make([]common.Memory, len(sizes))
 
-	for _, size := range sizes {
+	for idx, size := range sizes {
+		probe := common.StartMemory()
 		A := createMatrix(size, func(i, j int) int { return i + j })
 		B := createMatrix(size, func(i, j int) int { return i - j })
 		C := createMatrix(size, func(i, j int) int { return 0 })
 
-		start := time.Now()
-		MatrixMultiply(size, A, B, C)
-		elapsed := time.Since(start).Microseconds()
+		run := func() {
+			MatrixMultiply(size, A, B, C)
+			common.SinkInts(C[size-1])
+		}
+
+		// Closed form of the product: C[i][j] = (i-j)*S1 - n*i*j + S2,
+		// with S1 = sum of k and S2 = sum of k^2 over 0..n-1
+		s1 := size * (size - 1) / 2
+		s2 := (size - 1) * size * (2*size - 1) / 6
+		verify := func() bool {
+			for i := 0; i < size; i++ {
+				for j := 0; j < size; j++ {
+					if C[i][j] != (i-j)*s1-size*i*j+s2 {
+						return false
+					}
+				}
+			}
+			return true
+		}
+
+		stats := common.MeasureVerified(cfg, nil, run, verify)
+
+		println("matrix,multiply," + strconv.Itoa(size) + "," + stats.CSV())
+		mems[idx] = probe.Stop()
+	}
+
+	println("task,method,size," + common.MemoryCSVColumns)
+	for idx, size := range sizes {
+		println("matrix,multiply," + strconv.Itoa(size) + "," + mems[idx].CSV())
+	}
+}
+
+// matrixVariant is one contiguous-storage kernel under test.
+type matrixVariant struct {
+	method  string
+	maxN    int                   // largest size the element type holds
+	setup   func(n int)           // allocate and fill the operands (untimed)
+	run     func(n int)           // the timed multiply
+	product func(idx int) float64 // element idx of C (exact for these inputs)
+}
+
+// benchmarkMatrixKernels runs the contiguous row-major kernels in kernels.go.
+//
+// Every variant multiplies the same test matrices as benchmarkMatrixMult
+// (A[i][j] = i+j, B[i][j] = i-j) at sizes 10, 20, 32 and 64, and checks
+// the product against the same closed form. Variants that take B
+// transposed store it that way during setup. Comparing them with
+// `multiply` ([][]int) separates the cost of the data layout from the
+// cost of the arithmetic. `parallel` splits the rows of `blocked` between
+// both cores (common.Parallel) and is followed by its speedup rows.
+//
+// Output format:
+//   task,method,size,time_us,...(see common.StatsCSVColumns)
+//   task,method,size,single_us,...(see common.SpeedupCSVColumns)
+func benchmarkMatrixKernels() {
+	sizes := []int{10, 20, 32, 64}
+	cfg := common.DefaultConfig()
+
+	var a32, b32, c32 []int32
+	var a16, b16 []int16
+	var a8, b8 []int8
+	var af, bf, cf []float32
+
+	// fillInts fills A and B (B^T when transposed) through set, which
+	// stores into the variant's own element type
+	fillInts := func(n int, transposed bool, setA, setB func(idx, v int)) {
+		for r := 0; r < n; r++ {
+			for q := 0; q < n; q++ {
+				setA(r*n+q, r+q)
+				if transposed {
+					setB(q*n+r, r-q)
+				} else {
+					setB(r*n+q, r-q)
+				}
+			}
+		}
+	}
+	allocI32 := func(n int, transposed bool) {
+		a32, b32, c32 = make([]int32, n*n), make([]int32, n*n), make([]int32, n*n)
+		fillInts(n, transposed,
+			func(idx, v int) { a32[idx] = int32(v) },
+			func(idx, v int) { b32[idx] = int32(v) })
+	}
+	productI32 := func(idx int) float64 { return float64(c32[idx]) }
+
+	// One worker's share of `parallel`: blocked on an even-aligned band of
+	// rows of C (the bands write disjoint rows). Built once so the timed
+	// run does not allocate a closure.
+	parallelN := 0
+	blockedRows := func(worker int) {
+		n := parallelN
+		first := (n * worker / common.Workers) &^ 1
+		last := n
+		if worker+1 < common.Workers {
+			last = (n * (worker + 1) / common.Workers) &^ 1
+		}
+		MatMulI32BTBlocked(a32[first*n:last*n], b32, c32[first*n:last*n], last-first, n, n)
+	}
+
+	variants := []matrixVariant{
+		{"naive", 64, func(n int) { allocI32(n, false) }, func(n int) {
+			MatMulI32(a32, b32, c32, n, n, n)
+			common.SinkInt32s(c32)
+		}, productI32},
+		{"transposed", 64, func(n int) { allocI32(n, true) }, func(n int) {
+			MatMulI32BT(a32, b32, c32, n, n, n)
+			common.SinkInt32s(c32)
+		}, productI32},
+		{"blocked", 64, func(n int) { allocI32(n, true) }, func(n int) {
+			MatMulI32BTBlocked(a32, b32, c32, n, n, n)
+			common.SinkInt32s(c32)
+		}, productI32},
+		// blocked with the rows of C split between the workers
+		{"parallel", 64, func(n int) { allocI32(n, true) }, func(n int) {
+			parallelN = n
+			common.Parallel(blockedRows)
+			common.SinkInt32s(c32)
+		}, productI32},
+		{"i16", 64, func(n int) {
+			a16, b16, c32 = make([]int16, n*n), make([]int16, n*n), make([]int32, n*n)
+			fillInts(n, true,
+				func(idx, v int) { a16[idx] = int16(v) },
+				func(idx, v int) { b16[idx] = int16(v) })
+		}, func(n int) {
+			MatMulI16BT(a16, b16, c32, n, n, n)
+			common.SinkInt32s(c32)
+		}, productI32},
+		// A[i][k] = i + k must fit in int8
+		{"i8", 64, func(n int) {
+			a8, b8, c32 = make([]int8, n*n), make([]int8, n*n), make([]int32, n*n)
+			fillInts(n, true,
+				func(idx, v int) { a8[idx] = int8(v) },
+				func(idx, v int) { b8[idx] = int8(v) })
+		}, func(n int) {
+			MatMulI8BT(a8, b8, c32, n, n, n)
+			common.SinkInt32s(c32)
+		}, productI32},
+		// Every partial sum is an integer below 2^24, so float32 is exact
+		{"f32", 64, func(n int) {
+			af, bf, cf = make([]float32, n*n), make([]float32, n*n), make([]float32, n*n)
+			fillInts(n, true,
+				func(idx, v int) { af[idx] = float32(v) },
+				func(idx, v int) { bf[idx] = float32(v) })
+		}, func(n int) {
+			MatMulF32BT(af, bf, cf, n, n, n)
+			common.SinkFloat32s(cf)
+		}, func(idx int) float64 { return float64(cf[idx]) }},
+	}
+
+	mems := make([]common.Memory, len(variants)*len(sizes))
+	stats := make([]common.Stats, len(variants)*len(sizes))
+
+	for vi := range variants {
+		v := &variants[vi]
+		println("task,method,size," + common.StatsCSVColumns)
+		for si, size := range sizes {
+			if size > v.maxN {
+				println("matrix," + v.method + "," + strconv.Itoa(size) + ",skip")
+				continue
+			}
+			probe := common.StartMemory()
+			v.setup(size)
 
-		println("matrix,multiply,", size, ",", elapsed)
+			n := size
+			s1 := n * (n - 1) / 2
+			s2 := (n - 1) * n * (2*n - 1) / 6
+			verify := func() bool {
+				for i := 0; i < n; i++ {
+					for j := 0; j < n; j++ {
+						if v.product(i*n+j) != float64((i-j)*s1-n*i*j+s2) {
+							return false
+						}
+					}
+				}
+				return true
+			}
+
+			s := common.MeasureVerified(cfg, nil, func() { v.run(n) }, verify)
+			println("matrix," + v.method + "," + strconv.Itoa(n) + "," + s.CSV())
+			stats[vi*len(sizes)+si] = s
+			mems[vi*len(sizes)+si] = probe.Stop()
+		}
+	}
+
+	// parallel over single-core blocked
+	blocked, parallel := 0, 0
+	for vi := range variants {
+		switch variants[vi].method {
+		case "blocked":
+			blocked = vi
+		case "parallel":
+			parallel = vi
+		}
+	}
+	println("task,method,size," + common.SpeedupCSVColumns)
+	for si, size := range sizes {
+		println("matrix,parallel," + strconv.Itoa(size) + "," +
+			common.SpeedupCSV(stats[blocked*len(sizes)+si], stats[parallel*len(sizes)+si]))
+	}
+
+	println("task,method,size," + common.MemoryCSVColumns)
+	for vi := range variants {
+		for si, size := range sizes {
+			if size <= variants[vi].maxN {
+				println("matrix," + variants[vi].method + "," + strconv.Itoa(size) + "," +
+					mems[vi*len(sizes)+si].CSV())
+			}
+		}
 	}
 }
 
@@ -54,6 +266,7 @@ func main() {
 
 	println("TinyGo Matrix Multiplication Benchmark Starting...")
 	benchmarkMatrixMult()
+	benchmarkMatrixKernels()
 
 	for {
 		time.Sleep(time.Second * 10)
@@ -2,32 +2,63 @@ package main
 
 import (
 	"machine"
+	"strconv"
 	"time"
+
+	"rp2040-tinygo-benchmarks/src/common"
 )
 
 // benchmarkQuickSort runs a benchmark for the Quick Sort algorithm.
 //
 // This function benchmarks Quick Sort on reversed arrays of sizes 10, 50, and 100,
-// simulating worst-case scenarios. The execution time is printed in CSV format.
+// simulating worst-case scenarios. Each size is repeated by
+// common.MeasureVerified, which checks the sorted output after timing, and
+// the timing statistics are printed in CSV format.
 //
 // Output format:
-//   task,method,size,time_us
+//   task,method,size,time_us,...(see common.StatsCSVColumns)
 func benchmarkQuickSort() {
 	sizes := []int{10, 50, 100}
-	println("task,method,size,time_us")
+	cfg := common.DefaultConfig()
+	println("task,method,size," + common.StatsCSVColumns)
+
+	mems := make([]common.Memory, len(sizes))
 
-	for _, size := range sizes {
-		// Reversed array = worst case
+	for i, size := range sizes {
+		probe := common.StartMemory()
 		data := make([]int, size)
-		for i := 0; i < size; i++ {
-			data[i] = size - i
+
+		// Reversed array = worst case, refilled before every run
+		fill := func() {
+			for i := 0; i < size; i++ {
+				data[i] = size - i
+			}
+		}
+
+		run := func() {
+			QuickSort(data, 0, size-1)
+			common.SinkInts(data)
 		}
 
-		start := time.Now()
-		QuickSort(data, 0, size-1)
-		elapsed := time.Since(start).Microseconds()
+		// Sorted output must be exactly 1..size
+		verify := func() bool {
+			for i := 0; i < size; i++ {
+				if data[i] != i+1 {
+					return false
+				}
+			}
+			return true
+		}
+
+		stats := common.MeasureVerified(cfg, fill, run, verify)
+
+		println("quicksort,quick," + strconv.Itoa(size) + "," + stats.CSV())
+		mems[i] = probe.Stop()
+	}
 
-		println("quicksort,quick,", size, ",", elapsed)
+	println("task,method,size," + common.MemoryCSVColumns)
+	for i, size := range sizes {
+		println("quicksort,quick," + strconv.Itoa(size) + "," + mems[i].CSV())
 	}
 }
 
@@ -4,16 +4,23 @@ package main
 //
 // This function sorts the sub-array of arr between indices low and high
 // using the recursive divide-and-conquer approach with Lomuto partitioning.
+// It recurses into the smaller partition and loops on the larger, so the
+// call depth stays below log2(n) + 1, as in the C suite.
 //
 // Parameters:
 //   - arr: the array to sort
 //   - low: the starting index
 //   - high: the ending index
 func QuickSort(arr []int, low, high int) {
-	if low < high {
+	for low < high {
 		p := partition(arr, low, high)
-		QuickSort(arr, low, p-1)
-		QuickSort(arr, p+1, high)
+		if p-low < high-p {
+			QuickSort(arr, low, p-1)
+			low = p + 1
+		} else {
+			QuickSort(arr, p+1, high)
+			high = p - 1
+		}
 	}
 }
 
@@ -0,0 +1,203 @@
+package main
+
+import (
+	"machine"
+	"math"
+	"strconv"
+	"time"
+
+	"rp2040-tinygo-benchmarks/src/common"
+)
+
+const (
+	maxSize        = 10000      // length of the shared data and scratch slices
+	randomSeed     = 0x2545F491 // common.NewRNG seed of the random inputs
+	fewUniqueKeys  = 8          // distinct keys of the few_unique input
+	parallelMethod = "merge_parallel_random"
+)
+
+// sortKernel is one sorting kernel. Every kernel is called as sort(data,
+// tmp) and returns the slice holding the result; in-place kernels return
+// data.
+type sortKernel struct {
+	method string
+	sort   func(data, tmp []int32) []int32
+}
+
+// sortInput is one input distribution, filled into a from a generator
+// seeded with randomSeed (common/data.go, identical to the C suite).
+type sortInput struct {
+	name string
+	fill func(a []int32, rng *common.RNG)
+}
+
+// inPlace adapts an in-place kernel to the sortKernel signature.
+func inPlace(sort func(a []int32)) func(data, tmp []int32) []int32 {
+	return func(data, tmp []int32) []int32 {
+		sort(data)
+		return data
+	}
+}
+
+// keyHash is the per-key term of the input fingerprint; summing makes it
+// order-independent.
+func keyHash(v int32) uint32 {
+	h := uint32(v) * 0x9E3779B1
+	return h ^ (h >> 16)
+}
+
+// benchmarkSort runs the sorting benchmarks.
+//
+// Each kernel (median3, ninther, iterative, introsort, merge, radix) sorts
+// each input (sorted, reversed, random, few_unique, organ_pipe) of int32
+// keys at sizes 100, 1000 and 10000, as in the C suite; the method column
+// is kernel_input. The input is regenerated before every run and the
+// output is checked after timing: ascending, with the same keys as the
+// input. The dual-core merge sort (merge_parallel_random) follows, with
+// its speedup over merge_random.
+//
+// Output format:
+//   task,method,size,time_us,...(see common.StatsCSVColumns)
+//   task,method,size,single_us,...(see common.SpeedupCSVColumns)
+func benchmarkSort() {
+	sizes := []int{100, 1000, 10000}
+	kernels := []sortKernel{
+		{"median3", inPlace(QuickSortMedian3)},
+		{"ninther", inPlace(QuickSortNinther)},
+		{"iterative", inPlace(QuickSortIterative)},
+		{"introsort", inPlace(Introsort)},
+		{"merge", MergeSort},
+		{"radix", RadixSort},
+	}
+	inputs := []sortInput{
+		{"sorted", func(a []int32, rng *common.RNG) {
+			for i := range a {
+				a[i] = int32(i)
+			}
+		}},
+		{"reversed", func(a []int32, rng *common.RNG) {
+			for i := range a {
+				a[i] = int32(len(a) - i)
+			}
+		}},
+		{"random", func(a []int32, rng *common.RNG) {
+			common.UniformInt32s(a, rng, math.MinInt32, math.MaxInt32)
+		}},
+		{"few_unique", func(a []int32, rng *common.RNG) {
+			common.UniformInt32s(a, rng, 0, fewUniqueKeys-1)
+		}},
+		{"organ_pipe", func(a []int32, rng *common.RNG) {
+			n := len(a)
+			for i := range a {
+				if i < n/2 {
+					a[i] = int32(i)
+				} else {
+					a[i] = int32(n - 1 - i)
+				}
+			}
+		}},
+	}
+	cfg := common.DefaultConfig()
+
+	var rng common.RNG
+
+	dataBuf := make([]int32, maxSize)
+	tmpBuf := make([]int32, maxSize)
+
+	// measure times one kernel on one input and size
+	measure := func(input sortInput, size int, sort func() []int32) common.Stats {
+		data := dataBuf[:size]
+		var result []int32
+		var fingerprint uint32
+
+		fill := func() {
+			rng.Seed(randomSeed, 0)
+			input.fill(data, &rng)
+			fingerprint = 0
+			for _, v := range data {
+				fingerprint += keyHash(v)
+			}
+		}
+
+		run := func() {
+			result = sort()
+			common.SinkInt32s(result)
+		}
+
+		verify := func() bool {
+			sum := keyHash(result[0])
+			for i := 1; i < size; i++ {
+				if result[i-1] > result[i] {
+					return false
+				}
+				sum += keyHash(result[i])
+			}
+			return sum == fingerprint
+		}
+
+		return common.MeasureVerified(cfg, fill, run, verify)
+	}
+
+	var methods []string
+	var mems []common.Memory
+
+	println("task,method,size," + common.StatsCSVColumns)
+	for _, kernel := range kernels {
+		for _, input := range inputs {
+			method := kernel.method + "_" + input.name
+			methods = append(methods, method)
+			for _, size := range sizes {
+				probe := common.StartMemory()
+				data, tmp := dataBuf[:size], tmpBuf[:size]
+				sort := func() []int32 { return kernel.sort(data, tmp) }
+				s := measure(input, size, sort)
+				println("sort," + method + "," + strconv.Itoa(size) + "," + s.CSV())
+				mems = append(mems, probe.Stop())
+			}
+		}
+	}
+
+	// Dual-core merge sort on the random input, against merge_random
+	random := inputs[2]
+	single := make([]common.Stats, len(sizes))
+	parallel := make([]common.Stats, len(sizes))
+	methods = append(methods, parallelMethod)
+	for si, size := range sizes {
+		data, tmp := dataBuf[:size], tmpBuf[:size]
+		single[si] = measure(random, size, func() []int32 { return MergeSort(data, tmp) })
+
+		probe := common.StartMemory()
+		parallel[si] = measure(random, size, MergeSortParallel(data, tmp))
+		println("sort," + parallelMethod + "," + strconv.Itoa(size) + "," + parallel[si].CSV())
+		mems = append(mems, probe.Stop())
+	}
+
+	println("task,method,size," + common.SpeedupCSVColumns)
+	for si, size := range sizes {
+		println("sort," + parallelMethod + "," + strconv.Itoa(size) + "," +
+			common.SpeedupCSV(single[si], parallel[si]))
+	}
+
+	println("task,method,size," + common.MemoryCSVColumns)
+	for mi, method := range methods {
+		for si, size := range sizes {
+			println("sort," + method + "," + strconv.Itoa(size) + "," + mems[mi*len(sizes)+si].CSV())
+		}
+	}
+}
+
+// main is the entry point for the TinyGo benchmark.
+//
+// It initializes USB serial, prints a start message,
+// and calls the benchmark function defined in this folder.
+func main() {
+	machine.Serial.Configure(machine.UARTConfig{})
+	time.Sleep(time.Second * 10)
+
+	println("TinyGo Sorting Benchmark Starting...")
+	benchmarkSort()
+
+	for {
+		time.Sleep(time.Second * 10)
+	}
+}
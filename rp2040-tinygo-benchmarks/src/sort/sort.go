@@ -0,0 +1,364 @@
+package main
+
+import "rp2040-tinygo-benchmarks/src/common"
+
+// Sorting kernels on int32 keys, mirroring src/sort/sort_kernels.c in the C
+// suite. All sort ascending; MergeSort and RadixSort alternate between data
+// and a scratch slice and return whichever holds the result.
+//
+// The quicksort family partitions with Hoare's scheme around a pivot moved
+// to the front of the range, so runs of equal keys split evenly, and
+// finishes ranges of at most insertionCutoff elements with insertion sort.
+
+const (
+	insertionCutoff = 16  // ranges this small are insertion-sorted
+	nintherMin      = 128 // smallest range that takes a ninther pivot
+	stackDepth      = 32  // explicit stack entries; enough for any 32-bit n
+)
+
+// InsertionSort sorts a in place.
+func InsertionSort(a []int32) {
+	for i := 1; i < len(a); i++ {
+		v := a[i]
+		j := i - 1
+		for j >= 0 && a[j] > v {
+			a[j+1] = a[j]
+			j--
+		}
+		a[j+1] = v
+	}
+}
+
+// median3 returns the index of the median of a[i], a[j] and a[k].
+func median3(a []int32, i, j, k int) int {
+	if a[i] < a[j] {
+		if a[j] < a[k] {
+			return j
+		}
+		if a[i] < a[k] {
+			return k
+		}
+		return i
+	}
+	if a[i] < a[k] {
+		return i
+	}
+	if a[j] < a[k] {
+		return k
+	}
+	return j
+}
+
+// ninther returns the index of Tukey's ninther of a[lo..hi]: the median of
+// the medians of three samples taken at each end and in the middle.
+func ninther(a []int32, lo, hi int) int {
+	step := (hi - lo + 1) / 8
+	mid := lo + (hi-lo)/2
+	return median3(a, median3(a, lo, lo+step, lo+2*step),
+		median3(a, mid-step, mid, mid+step),
+		median3(a, hi-2*step, hi-step, hi))
+}
+
+// partition is a Hoare partition of a[lo..hi] around the value at index p.
+//
+// The pivot is moved to a[lo] first, which keeps the returned split j in
+// [lo, hi-1]: afterwards every element of a[lo..j] is <= every element of
+// a[j+1..hi].
+func partition(a []int32, lo, hi, p int) int {
+	a[lo], a[p] = a[p], a[lo]
+	pivot := a[lo]
+	i, j := lo-1, hi+1
+	for {
+		i++
+		for a[i] < pivot {
+			i++
+		}
+		j--
+		for a[j] > pivot {
+			j--
+		}
+		if i >= j {
+			return j
+		}
+		a[i], a[j] = a[j], a[i]
+	}
+}
+
+// quickRecursive sorts a[lo..hi], recursing into the smaller partition and
+// looping on the larger, so the call depth stays below log2(n).
+func quickRecursive(a []int32, lo, hi int, useNinther bool) {
+	for hi-lo+1 > insertionCutoff {
+		var p int
+		if useNinther && hi-lo+1 >= nintherMin {
+			p = ninther(a, lo, hi)
+		} else {
+			p = median3(a, lo, lo+(hi-lo)/2, hi)
+		}
+		j := partition(a, lo, hi, p)
+		if j-lo < hi-j {
+			quickRecursive(a, lo, j, useNinther)
+			lo = j + 1
+		} else {
+			quickRecursive(a, j+1, hi, useNinther)
+			hi = j
+		}
+	}
+	InsertionSort(a[lo : hi+1])
+}
+
+// QuickSortMedian3 is a recursive quicksort with a median-of-three pivot.
+func QuickSortMedian3(a []int32) {
+	if len(a) > 1 {
+		quickRecursive(a, 0, len(a)-1, false)
+	}
+}
+
+// QuickSortNinther is QuickSortMedian3 with Tukey's ninther pivot on ranges
+// of nintherMin elements and more.
+func QuickSortNinther(a []int32) {
+	if len(a) > 1 {
+		quickRecursive(a, 0, len(a)-1, true)
+	}
+}
+
+// QuickSortIterative is a non-recursive quicksort on an explicit stack.
+//
+// The larger partition is pushed and the smaller one is sorted next, so at
+// most log2(n) ranges are ever pending.
+func QuickSortIterative(a []int32) {
+	var stackLo, stackHi [stackDepth]int
+	top := 0
+	lo, hi := 0, len(a)-1
+	for {
+		for hi-lo+1 > insertionCutoff {
+			j := partition(a, lo, hi, median3(a, lo, lo+(hi-lo)/2, hi))
+			if j-lo < hi-j {
+				stackLo[top], stackHi[top] = j+1, hi
+				hi = j
+			} else {
+				stackLo[top], stackHi[top] = lo, j
+				lo = j + 1
+			}
+			top++
+		}
+		if hi > lo {
+			InsertionSort(a[lo : hi+1])
+		}
+		if top == 0 {
+			return
+		}
+		top--
+		lo, hi = stackLo[top], stackHi[top]
+	}
+}
+
+func siftDown(a []int32, root int) {
+	n := len(a)
+	v := a[root]
+	for {
+		child := 2*root + 1
+		if child >= n {
+			break
+		}
+		if child+1 < n && a[child+1] > a[child] {
+			child++
+		}
+		if a[child] <= v {
+			break
+		}
+		a[root] = a[child]
+		root = child
+	}
+	a[root] = v
+}
+
+func heapSort(a []int32) {
+	for i := len(a)/2 - 1; i >= 0; i-- {
+		siftDown(a, i)
+	}
+	for end := len(a) - 1; end > 0; end-- {
+		a[0], a[end] = a[end], a[0]
+		siftDown(a[:end], 0)
+	}
+}
+
+// Introsort is QuickSortIterative with a depth limit of 2·log2(n): a range
+// that exceeds it is heapsorted. Small ranges are left for one
+// insertion-sort pass over the whole slice at the end.
+func Introsort(a []int32) {
+	var stackLo, stackHi, stackDepthLeft [stackDepth]int
+	top := 0
+	lo, hi := 0, len(a)-1
+
+	depth := 0
+	for m := len(a); m > 1; m >>= 1 {
+		depth += 2
+	}
+
+	for {
+		for hi-lo+1 > insertionCutoff {
+			if depth == 0 {
+				heapSort(a[lo : hi+1])
+				break
+			}
+			depth--
+			j := partition(a, lo, hi, median3(a, lo, lo+(hi-lo)/2, hi))
+			if j-lo < hi-j {
+				stackLo[top], stackHi[top] = j+1, hi
+				hi = j
+			} else {
+				stackLo[top], stackHi[top] = lo, j
+				lo = j + 1
+			}
+			stackDepthLeft[top] = depth
+			top++
+		}
+		if top == 0 {
+			break
+		}
+		top--
+		lo, hi, depth = stackLo[top], stackHi[top], stackDepthLeft[top]
+	}
+
+	// Every element is already within insertionCutoff of its place
+	InsertionSort(a)
+}
+
+// merge merges the sorted runs src[lo:mid] and src[mid:hi] into dst[lo:hi].
+// Ties take the left run first, so the sort is stable.
+func merge(src, dst []int32, lo, mid, hi int) {
+	i, j := lo, mid
+	for k := lo; k < hi; k++ {
+		if i < mid && (j >= hi || src[i] <= src[j]) {
+			dst[k] = src[i]
+			i++
+		} else {
+			dst[k] = src[j]
+			j++
+		}
+	}
+}
+
+// MergeSort sorts data with a bottom-up (iterative) merge sort.
+//
+// Runs of width 1, 2, 4, ... are merged pairwise, alternating between data
+// and tmp (len(tmp) >= len(data)), so no recursion is needed.
+//
+// Returns:
+//   - The slice holding the sorted result: data or tmp[:len(data)]
+func MergeSort(data, tmp []int32) []int32 {
+	n := len(data)
+	src, dst := data, tmp[:n]
+	for width := 1; width < n; width *= 2 {
+		for lo := 0; lo < n; lo += 2 * width {
+			mid := min(lo+width, n)
+			hi := min(lo+2*width, n)
+			merge(src, dst, lo, mid, hi)
+		}
+		src, dst = dst, src
+	}
+	return src
+}
+
+// radixOffsets is RadixSort's digit table, kept off the goroutine stack.
+var radixOffsets [256]uint32
+
+// RadixSort sorts data with an LSD radix sort, one byte per pass.
+//
+// The sign bit is flipped in the keys so negative values order first, and
+// a pass in which every key has the same digit is skipped.
+//
+// Returns:
+//   - The slice holding the sorted result: data or tmp[:len(data)]
+func RadixSort(data, tmp []int32) []int32 {
+	n := len(data)
+	src, dst := data, tmp[:n]
+	for shift := 0; shift < 32; shift += 8 {
+		radixOffsets = [256]uint32{}
+		for _, v := range src {
+			radixOffsets[((uint32(v)^0x80000000)>>shift)&0xFF]++
+		}
+
+		// Counts become start offsets; a single non-empty bucket means the
+		// pass would not move anything
+		total := uint32(0)
+		trivial := false
+		for d, count := range radixOffsets {
+			if count == uint32(n) {
+				trivial = true
+				break
+			}
+			radixOffsets[d] = total
+			total += count
+		}
+		if trivial {
+			continue
+		}
+
+		for _, v := range src {
+			digit := ((uint32(v) ^ 0x80000000) >> shift) & 0xFF
+			dst[radixOffsets[digit]] = v
+			radixOffsets[digit]++
+		}
+		src, dst = dst, src
+	}
+	return src
+}
+
+// MergeSortParallel returns a function that sorts data on both cores
+// (common.Parallel) and returns tmp[:len(data)], which holds the result.
+// The worker closure is built here, once, so the returned function does
+// not allocate.
+//
+// Each worker sorts one half into data. After a barrier, worker 0 merges
+// the halves from the front until it has written the smaller n/2 elements
+// and worker 1 merges from the back until it has written the rest. Ties go
+// to the left run at the front and to the right run at the back, so the
+// two halves of the output meet exactly.
+func MergeSortParallel(data, tmp []int32) func() []int32 {
+	n := len(data)
+	mid := n / 2
+	out := tmp[:n]
+
+	worker := func(worker int) {
+		lo, hi := 0, mid
+		if worker == 1 {
+			lo, hi = mid, n
+		}
+		sorted := MergeSort(data[lo:hi], tmp[lo:hi])
+		if hi > lo && &sorted[0] != &data[lo] {
+			copy(data[lo:hi], sorted)
+		}
+
+		common.Barrier()
+
+		if worker == 0 {
+			i, j := 0, mid
+			for k := 0; k < mid; k++ {
+				if j >= n || (i < mid && data[i] <= data[j]) {
+					out[k] = data[i]
+					i++
+				} else {
+					out[k] = data[j]
+					j++
+				}
+			}
+		} else {
+			i, j := mid-1, n-1
+			for k := n - 1; k >= mid; k-- {
+				if i < 0 || (j >= mid && data[j] >= data[i]) {
+					out[k] = data[j]
+					j--
+				} else {
+					out[k] = data[i]
+					i--
+				}
+			}
+		}
+	}
+
+	return func() []int32 {
+		common.Parallel(worker)
+		return out
+	}
+}
@@ -0,0 +1,191 @@
+#!/usr/bin/env bash
+#
+# build_size_matrix.sh - Build every benchmark at every optimisation profile
+# (C and TinyGo) and collect the .elf sizes into one CSV table.
+#
+# Replaces the manual isolation procedure used for the original binary-size
+# findings. The C images come from the BENCH_BUILD_MATRIX targets in
+# rp2040-c-benchmarks/CMakeLists.txt (c_bench_<task>_<profile>); the TinyGo
+# images are built with the matching -opt level:
+#
+#   profile   C flags       TinyGo
+#   O2        -O2           -opt=2
+#   Os        -Os           -opt=s
+#   O3_lto    -O3 -flto     -opt=2  (TinyGo has no -O3; it always links
+#                                    the whole program with LTO)
+#   Og        -Og           -opt=1
+#
+# Usage:
+#   scripts/build_size_matrix.sh [-c | -g] [-b BUILD_DIR] [-j JOBS] [-o OUT.csv]
+#
+#   -c            C suite only
+#   -g            TinyGo suite only
+#   -b BUILD_DIR  Build directory (default: build-matrix)
+#   -j JOBS       Parallel C build jobs (default: nproc)
+#   -o OUT.csv    Write the table to a file instead of stdout
+#
+# Environment:
+#   PICO_SDK_PATH  Pico SDK for the C build (required unless -g)
+#   PROFILES       Space-separated subset of "O2 Os O3_lto Og"
+#   SIZE           Berkeley-format size tool (default: arm-none-eabi-size,
+#                  falling back to llvm-size)
+#   FOOTPRINT      bench_footprint binary (rp2040-c-benchmarks/host). When set
+#                  or on PATH, a per-unit breakdown of every image is also
+#                  written to BUILD_DIR/footprint/<language>_<benchmark>_<profile>.csv
+#
+# Output columns:
+#   language,benchmark,profile,text,data,bss,flash_bytes,ram_bytes
+# flash_bytes = text + data (initialised data is stored in flash) and
+# ram_bytes = data + bss, as used for the Flash/RAM comparison in README.md.
+#
+# Author: Samuel Ivuerah
+
+set -u
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+BUILD_DIR=build-matrix
+JOBS=$(nproc 2>/dev/null || echo 4)
+OUT=
+DO_C=1
+DO_GO=1
+PROFILES=${PROFILES:-"O2 Os O3_lto Og"}
+
+C_TASKS="fibonacci bubblesort quicksort sort loop matrix fft adc gpio pwm interrupt uart i2c"
+# TinyGo directory:benchmark name (the name matches the C task for joining)
+GO_TASKS="fibonacci:fibonacci bubble:bubblesort quick:quicksort sort:sort loop:loop matrix:matrix fft:fft
+          adc:adc gpio:gpio pwm:pwm interrupt:interrupt uart:uart i2c:i2c"
+
+usage() {
+    sed -n '/^# Usage:/,/^#   -o/p' "$0" | sed 's/^# \{0,1\}//' >&2
+    exit 2
+}
+
+while getopts "cgb:j:o:h" opt; do
+    case $opt in
+        c) DO_GO=0 ;;
+        g) DO_C=0 ;;
+        b) BUILD_DIR=$OPTARG ;;
+        j) JOBS=$OPTARG ;;
+        o) OUT=$OPTARG ;;
+        *) usage ;;
+    esac
+done
+
+case $BUILD_DIR in
+    /*) ;;
+    *) BUILD_DIR=$ROOT/$BUILD_DIR ;;
+esac
+
+SIZE=${SIZE:-}
+if [ -z "$SIZE" ]; then
+    if command -v arm-none-eabi-size >/dev/null 2>&1; then
+        SIZE=arm-none-eabi-size
+    elif command -v llvm-size >/dev/null 2>&1; then
+        SIZE=llvm-size
+    else
+        echo "build_size_matrix: no size tool found (set SIZE=...)" >&2
+        exit 1
+    fi
+fi
+
+FOOTPRINT=${FOOTPRINT:-$(command -v bench_footprint 2>/dev/null || true)}
+
+tinygo_opt() {
+    case $1 in
+        O2) echo 2 ;;
+        Os) echo s ;;
+        O3_lto) echo 2 ;;
+        Og) echo 1 ;;
+        *) echo "build_size_matrix: unknown profile '$1'" >&2; return 1 ;;
+    esac
+}
+
+# Print one table row from the Berkeley-format size of an ELF
+size_row() {
+    local language=$1 benchmark=$2 profile=$3 elf=$4
+    if [ ! -f "$elf" ]; then
+        echo "build_size_matrix: missing $elf (build failed?)" >&2
+        return
+    fi
+    if [ -n "$FOOTPRINT" ]; then
+        mkdir -p "$BUILD_DIR/footprint"
+        "$FOOTPRINT" -o "$BUILD_DIR/footprint/${language}_${benchmark}_${profile}.csv" "$elf" ||
+            echo "build_size_matrix: no footprint breakdown for $elf" >&2
+    fi
+    "$SIZE" -B "$elf" | awk -v l="$language" -v b="$benchmark" -v p="$profile" '
+        NR == 2 { printf "%s,%s,%s,%d,%d,%d,%d,%d\n", l, b, p, $1, $2, $3, $1 + $2, $2 + $3 }'
+}
+
+build_c() {
+    if [ -z "${PICO_SDK_PATH:-}" ]; then
+        echo "build_size_matrix: PICO_SDK_PATH is not set (use -g to skip the C suite)" >&2
+        return 1
+    fi
+    local dir=$BUILD_DIR/c
+    cmake -S "$ROOT/rp2040-c-benchmarks" -B "$dir" \
+        -DCMAKE_BUILD_TYPE=Release \
+        -DBENCH_BUILD_MATRIX=ON \
+        -DBENCH_MATRIX_PROFILES="${PROFILES// /;}" \
+        -DBENCH_MATRIX_TASKS="${C_TASKS// /;}" >&2 || return 1
+
+    # Build target by target so one failing profile (e.g. LTO) does not
+    # stop the rest of the matrix
+    for task in $C_TASKS; do
+        for profile in $PROFILES; do
+            cmake --build "$dir" --target "c_bench_${task}_${profile}" -j "$JOBS" >&2 ||
+                echo "build_size_matrix: c_bench_${task}_${profile} failed" >&2
+        done
+    done
+}
+
+build_go() {
+    if ! command -v tinygo >/dev/null 2>&1; then
+        echo "build_size_matrix: tinygo not found (use -c to skip the TinyGo suite)" >&2
+        return 1
+    fi
+    local dir=$BUILD_DIR/tinygo
+    mkdir -p "$dir"
+    for entry in $GO_TASKS; do
+        local src=${entry%%:*}
+        for profile in $PROFILES; do
+            (cd "$ROOT/rp2040-tinygo-benchmarks" &&
+                tinygo build -target pico -opt "$(tinygo_opt "$profile")" \
+                    -o "$dir/${src}_${profile}.elf" "./src/$src") >&2 ||
+                echo "build_size_matrix: tinygo $src ($profile) failed" >&2
+        done
+    done
+}
+
+collect() {
+    echo "language,benchmark,profile,text,data,bss,flash_bytes,ram_bytes"
+    if [ $DO_C -eq 1 ]; then
+        for task in $C_TASKS; do
+            for profile in $PROFILES; do
+                size_row c "$task" "$profile" "$BUILD_DIR/c/c_bench_${task}_${profile}.elf"
+            done
+        done
+    fi
+    if [ $DO_GO -eq 1 ]; then
+        for entry in $GO_TASKS; do
+            for profile in $PROFILES; do
+                size_row tinygo "${entry##*:}" "$profile" "$BUILD_DIR/tinygo/${entry%%:*}_${profile}.elf"
+            done
+        done
+    fi
+}
+
+status=0
+if [ $DO_C -eq 1 ]; then
+    build_c || status=1
+fi
+if [ $DO_GO -eq 1 ]; then
+    build_go || status=1
+fi
+
+if [ -n "$OUT" ]; then
+    collect > "$OUT"
+    echo "build_size_matrix: wrote $OUT" >&2
+else
+    collect
+fi
+exit $status
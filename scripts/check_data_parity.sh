@@ -0,0 +1,71 @@
+#!/usr/bin/env bash
+#
+# check_data_parity.sh - Check that the C and TinyGo input-data generators
+# produce bit-identical data.
+#
+# Both suites draw benchmark inputs from the same generators
+# (rp2040-c-benchmarks/include/bench_data.h and
+# rp2040-tinygo-benchmarks/src/common/data.go). This builds the C reference
+# printer (host/bench_datagen), runs the Go port (src/datagen) with the
+# standard Go toolchain, and compares their output for a set of seeds and
+# lengths. Any difference is shown as a diff and fails the check.
+#
+# Usage:
+#   scripts/check_data_parity.sh [-b BUILD_DIR] [SEED...]
+#
+#   -b BUILD_DIR  Host build directory (default: rp2040-c-benchmarks/build-host)
+#   SEED...       Seeds to check (default: 1 42 3735928559 18446744073709551615)
+#
+# Environment:
+#   COUNTS   Space-separated sequence lengths (default: "1 7 256 4096")
+#   GO       Go toolchain (default: go)
+#
+# Author: Samuel Ivuerah
+
+set -u
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+BUILD_DIR=$ROOT/rp2040-c-benchmarks/build-host
+COUNTS=${COUNTS:-"1 7 256 4096"}
+GO=${GO:-go}
+
+while getopts "b:" opt; do
+    case $opt in
+        b) BUILD_DIR=$OPTARG ;;
+        *) sed -n '/^# Usage:/,/^#   SEED/p' "$0" | sed 's/^# \{0,1\}//' >&2; exit 2 ;;
+    esac
+done
+shift $((OPTIND - 1))
+SEEDS=${*:-"1 42 3735928559 18446744073709551615"}
+
+cmake -S "$ROOT/rp2040-c-benchmarks/host" -B "$BUILD_DIR" > /dev/null &&
+    cmake --build "$BUILD_DIR" --target bench_datagen > /dev/null || {
+    echo "check_data_parity: building bench_datagen failed" >&2
+    exit 1
+}
+
+# Build the Go side once rather than per `go run`
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+(cd "$ROOT/rp2040-tinygo-benchmarks" && "$GO" build -o "$TMP/datagen" ./src/datagen) || {
+    echo "check_data_parity: building src/datagen failed" >&2
+    exit 1
+}
+
+failed=0
+for seed in $SEEDS; do
+    for count in $COUNTS; do
+        "$BUILD_DIR/bench_datagen" "$seed" "$count" > "$TMP/c.csv"
+        # println writes to stderr on the host
+        "$TMP/datagen" "$seed" "$count" 2> "$TMP/go.csv" > /dev/null
+        if cmp -s "$TMP/c.csv" "$TMP/go.csv"; then
+            echo "seed $seed, count $count: identical ($(($(wc -l < "$TMP/c.csv") - 1)) values)"
+        else
+            echo "seed $seed, count $count: MISMATCH" >&2
+            diff "$TMP/c.csv" "$TMP/go.csv" | head -20 >&2
+            failed=1
+        fi
+    done
+done
+
+exit $failed
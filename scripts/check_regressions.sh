@@ -0,0 +1,74 @@
+#!/usr/bin/env bash
+#
+# check_regressions.sh - Run the C software kernels on the Linux host and
+# compare them with a recorded baseline.
+#
+# Builds the host suite (rp2040-c-benchmarks/host), runs the benchmarks that
+# match FILTER in binary mode RUNS times, decodes every raw sample with
+# bench_decode -r and hands them to bench_baseline, which tests the median
+# of each run. Without -r the runs are checked against the baseline and the
+# script fails if any kernel regressed beyond the threshold or failed
+# verification; with -r the baseline is (re)recorded instead.
+#
+# Host timings depend on the machine and its load, so a host baseline is only
+# meaningful on the machine that recorded it, and the threshold should be
+# looser than for the device.
+#
+# Usage:
+#   scripts/check_regressions.sh [-b BUILD_DIR] [-f BASELINE] [-t PCT] [-n RUNS] [-r] [FILTER]
+#
+#   -b BUILD_DIR  Host build directory (default: rp2040-c-benchmarks/build-host)
+#   -f BASELINE   Baseline file (default: rp2040-c-benchmarks/results/baselines/c_host.csv)
+#   -t PCT        Regression threshold in percent (default: 10)
+#   -n RUNS       Runs of the suite to record or check (default: 5, the fewest
+#                 that can reach p < 0.01)
+#   -r            Record the baseline instead of checking against it
+#   FILTER        Registry filter (default: software)
+#
+# Author: Samuel Ivuerah
+
+set -u -o pipefail
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+BUILD_DIR=$ROOT/rp2040-c-benchmarks/build-host
+BASELINE=$ROOT/rp2040-c-benchmarks/results/baselines/c_host.csv
+THRESHOLD=10
+RUNS=5
+MODE=check
+
+while getopts "b:f:t:n:r" opt; do
+    case $opt in
+        b) BUILD_DIR=$OPTARG ;;
+        f) BASELINE=$OPTARG ;;
+        t) THRESHOLD=$OPTARG ;;
+        n) RUNS=$OPTARG ;;
+        r) MODE=record ;;
+        *) sed -n '/^# Usage:/,/^#   FILTER/p' "$0" | sed 's/^# \{0,1\}//' >&2; exit 2 ;;
+    esac
+done
+shift $((OPTIND - 1))
+FILTER=${1:-software}
+
+cmake -S "$ROOT/rp2040-c-benchmarks/host" -B "$BUILD_DIR" > /dev/null &&
+    cmake --build "$BUILD_DIR" --target c_benchmarks_host bench_decode bench_baseline > /dev/null || {
+    echo "check_regressions: building the host tools failed" >&2
+    exit 1
+}
+
+if [ "$MODE" = check ] && [ ! -f "$BASELINE" ]; then
+    echo "check_regressions: no baseline at $BASELINE (record one with -r)" >&2
+    exit 1
+fi
+mkdir -p "$(dirname "$BASELINE")"
+
+# The host build is keyed as its own profile and clock. Its timer counts ns,
+# but a read costs about 40 ns and jitters by as much, so smaller changes of
+# a median are below its resolution.
+for ((run = 1; run <= RUNS; run++)); do
+    "$BUILD_DIR/c_benchmarks_host" -b "$FILTER" | "$BUILD_DIR/bench_decode" -r || exit 1
+done |
+    if [ "$MODE" = record ]; then
+        "$BUILD_DIR/bench_baseline" record -l c -O host -k host "$BASELINE"
+    else
+        "$BUILD_DIR/bench_baseline" check -l c -O host -k host -t "$THRESHOLD" -m 50 "$BASELINE"
+    fi
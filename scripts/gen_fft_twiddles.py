@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+#
+# gen_fft_twiddles.py - Generate the fixed-point FFT twiddle ROM tables for
+# both suites.
+#
+# Writes one table per language, so the C and TinyGo fixed-point FFTs use
+# bit-identical coefficients:
+#
+#   rp2040-c-benchmarks/src/fft/twiddle_table.h
+#   rp2040-tinygo-benchmarks/src/fft/twiddle_table.go
+#
+# Entry k holds (cos, sin) of 2*pi*k/N for k < N/2, in Q15 and Q31,
+# rounded to nearest and saturated (cos(0) = 1.0 is not representable).
+# An FFT of any power-of-two size n <= N uses every (N/n)-th entry.
+#
+# Usage:
+#   scripts/gen_fft_twiddles.py [N]     (default N = 4096)
+
+import math
+import os
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+C_OUT = os.path.join(ROOT, "rp2040-c-benchmarks", "src", "fft", "twiddle_table.h")
+GO_OUT = os.path.join(ROOT, "rp2040-tinygo-benchmarks", "src", "fft", "twiddle_table.go")
+
+PER_LINE = 4  # (cos, sin) pairs per source line
+
+
+def quantise(x, bits):
+    full_scale = 1 << (bits - 1)
+    return max(-full_scale, min(full_scale - 1, round(x * full_scale)))
+
+
+def table(n, bits):
+    return [
+        (quantise(math.cos(2 * math.pi * k / n), bits), quantise(math.sin(2 * math.pi * k / n), bits))
+        for k in range(n // 2)
+    ]
+
+
+def rows(entries, fmt):
+    for i in range(0, len(entries), PER_LINE):
+        yield " ".join(fmt(c, s) for c, s in entries[i : i + PER_LINE])
+
+
+def write_c(n, q15, q31):
+    with open(C_OUT, "w") as f:
+        f.write(
+            "/**\n"
+            " * @file twiddle_table.h\n"
+            " * @brief Twiddle ROM tables for the fixed-point FFTs (generated).\n"
+            " *\n"
+            " * Generated by scripts/gen_fft_twiddles.py; do not edit. Entry k holds\n"
+            " * {cos, sin} of 2*pi*k/FFT_TWIDDLE_N, rounded and saturated.\n"
+            " *\n"
+            " * Included by src/fft/fixed_point.c only.\n"
+            " *\n"
+            " * @author Samuel Ivuerah\n"
+            " */\n\n"
+            "#ifndef FFT_TWIDDLE_TABLE_H\n"
+            "#define FFT_TWIDDLE_TABLE_H\n\n"
+            "#include <stdint.h>\n\n"
+            f"#define FFT_TWIDDLE_N {n}  ///< Largest transform the tables support\n\n"
+        )
+        f.write("static const int16_t fft_twiddle_q15[FFT_TWIDDLE_N / 2][2] = {\n")
+        for line in rows(q15, lambda c, s: f"{{{c}, {s}}},"):
+            f.write(f"    {line}\n")
+        f.write("};\n\n")
+        f.write("static const int32_t fft_twiddle_q31[FFT_TWIDDLE_N / 2][2] = {\n")
+        for line in rows(q31, lambda c, s: f"{{{c}, {s}}},"):
+            f.write(f"    {line}\n")
+        f.write("};\n\n#endif  // FFT_TWIDDLE_TABLE_H\n")
+
+
+def write_go(n, q15, q31):
+    with open(GO_OUT, "w") as f:
+        f.write(
+            "// Code generated by scripts/gen_fft_twiddles.py; DO NOT EDIT.\n\n"
+            "package main\n\n"
+            "// twiddleN is the largest transform the tables support. Entry k holds\n"
+            "// {cos, sin} of 2*pi*k/twiddleN, rounded and saturated.\n"
+            f"const twiddleN = {n}\n\n"
+        )
+        f.write("var twiddleQ15 = [twiddleN / 2][2]int16{\n")
+        for line in rows(q15, lambda c, s: f"{{{c}, {s}}},"):
+            f.write(f"\t{line}\n")
+        f.write("}\n\n")
+        f.write("var twiddleQ31 = [twiddleN / 2][2]int32{\n")
+        for line in rows(q31, lambda c, s: f"{{{c}, {s}}},"):
+            f.write(f"\t{line}\n")
+        f.write("}\n")
+
+
+def main():
+    n = int(sys.argv[1]) if len(sys.argv) > 1 else 4096
+    if n < 4 or n & (n - 1):
+        sys.exit("gen_fft_twiddles: N must be a power of two >= 4")
+    q15 = table(n, 16)
+    q31 = table(n, 32)
+    write_c(n, q15, q31)
+    write_go(n, q15, q31)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,227 @@
+/**
+ * @file capture.c
+ * @brief PIO + DMA edge capture engine for the GPIO probe (see capture.h).
+ *
+ * The ring is split into two halves with one DMA channel each. Channel i
+ * writes half i and chains to the other channel when it is full; its
+ * completion interrupt only rewinds its write address and counts the half,
+ * so the next pass starts at the beginning of the half again. The number of
+ * words written so far is the count of completed halves plus the progress of
+ * the active channel, which lets capture_read() return partial halves.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+#include "capture.h"
+#include "capture_decode.h"
+#include "capture.pio.h"
+
+#define HALF_WORDS (CAPTURE_RING_WORDS / 2)
+
+static uint32_t ring[CAPTURE_RING_WORDS];
+static volatile uint32_t halves_done;   // Halves completed by DMA since the start
+static capture_t* active;               // The capture the interrupt belongs to
+
+// Multi-pin program with the OUT bit count patched to the pin count
+static uint16_t multi_instructions[sizeof(capture_multi_program_instructions) / sizeof(uint16_t)];
+static pio_program_t multi_program;
+
+static void __isr capture_dma_irq(void) {
+    for (int i = 0; i < 2; i++) {
+        uint ch = (uint)active->dma[i];
+        if (dma_channel_get_irq0_status(ch)) {
+            dma_channel_acknowledge_irq0(ch);
+            dma_channel_set_write_addr(ch, &ring[i * HALF_WORDS], false);
+            halves_done++;
+        }
+    }
+}
+
+/**
+ * @brief Words written into the ring since the start (mod 2^32).
+ */
+static uint32_t written_words(const capture_t* cap) {
+    uint32_t done;
+    uint32_t remaining;
+    do {
+        done = halves_done;
+        remaining = dma_channel_hw_addr((uint)cap->dma[done & 1])->transfer_count;
+    } while (done != halves_done);  // a half completed while reading
+    return done * HALF_WORDS + (HALF_WORDS - remaining);
+}
+
+/**
+ * @brief Configure the state machine for the chosen program and set its registers.
+ */
+static void init_state_machine(const capture_t* cap) {
+    pio_sm_config c;
+    uint entry;
+    if (cap->pin_count == 1) {
+        c = capture_single_program_get_default_config(cap->offset);
+        sm_config_set_jmp_pin(&c, cap->pin_base);
+        entry = cap->offset + capture_single_offset_low_dec;
+    } else {
+        c = capture_multi_program_get_default_config(cap->offset);
+        sm_config_set_out_shift(&c, true, false, 32);
+        entry = cap->offset + capture_multi_offset_sample;
+    }
+    sm_config_set_in_pins(&c, cap->pin_base);
+    sm_config_set_in_shift(&c, false, true, 32);  // autopush every counter/state word
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_RX);
+    sm_config_set_clkdiv(&c, 1.0f);
+
+    for (uint i = 0; i < cap->pin_count; i++) {
+        pio_gpio_init(cap->pio, cap->pin_base + i);
+    }
+    pio_sm_set_consecutive_pindirs(cap->pio, cap->sm, cap->pin_base, cap->pin_count, false);
+    pio_sm_init(cap->pio, cap->sm, entry, &c);
+
+    // The counter starts at 0xFFFFFFFF (in X, or parked in the ISR), the previous levels at 0
+    pio_sm_exec(cap->pio, cap->sm, pio_encode_mov_not(pio_x, pio_null));
+    if (cap->pin_count > 1) {
+        pio_sm_exec(cap->pio, cap->sm, pio_encode_mov(pio_isr, pio_x));
+        pio_sm_exec(cap->pio, cap->sm, pio_encode_set(pio_y, 0));
+    }
+}
+
+/**
+ * @brief Configure the two ping-pong channels from the RX FIFO into the ring halves.
+ */
+static void init_dma(const capture_t* cap) {
+    for (int i = 0; i < 2; i++) {
+        uint ch = (uint)cap->dma[i];
+        dma_channel_config d = dma_channel_get_default_config(ch);
+        channel_config_set_transfer_data_size(&d, DMA_SIZE_32);
+        channel_config_set_read_increment(&d, false);
+        channel_config_set_write_increment(&d, true);
+        channel_config_set_dreq(&d, pio_get_dreq(cap->pio, cap->sm, false));
+        channel_config_set_chain_to(&d, (uint)cap->dma[i ^ 1]);
+        dma_channel_configure(ch, &d, &ring[i * HALF_WORDS], &cap->pio->rxf[cap->sm], HALF_WORDS, false);
+        dma_channel_set_irq0_enabled(ch, true);
+    }
+    irq_add_shared_handler(DMA_IRQ_0, capture_dma_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+}
+
+bool capture_start(capture_t* cap, uint8_t pin_base, uint8_t pin_count) {
+    memset(cap, 0, sizeof(*cap));
+    cap->dma[0] = cap->dma[1] = -1;
+    if (active || pin_count < 1 || pin_count > CAPTURE_MAX_PINS) {
+        return false;
+    }
+    cap->pin_base = pin_base;
+    cap->pin_count = pin_count;
+
+    if (pin_count == 1) {
+        cap->program = &capture_single_program;
+    } else {
+        memcpy(multi_instructions, capture_multi_program_instructions, sizeof(multi_instructions));
+        multi_instructions[capture_multi_offset_sample + 1] = (uint16_t)pio_encode_out(pio_x, pin_count);
+        multi_program = capture_multi_program;
+        multi_program.instructions = multi_instructions;
+        cap->program = &multi_program;
+    }
+    if (!pio_claim_free_sm_and_add_program(cap->program, &cap->pio, &cap->sm, &cap->offset)) {
+        return false;
+    }
+    cap->dma[0] = dma_claim_unused_channel(false);
+    cap->dma[1] = dma_claim_unused_channel(false);
+    if (cap->dma[0] < 0 || cap->dma[1] < 0) {
+        capture_stop(cap);
+        return false;
+    }
+
+    active = cap;
+    halves_done = 0;
+    init_state_machine(cap);
+    init_dma(cap);
+    dma_channel_start((uint)cap->dma[0]);
+    cap->pio->fdebug = 1u << (PIO_FDEBUG_RXSTALL_LSB + cap->sm);  // clear the sticky stall flag
+    pio_sm_set_enabled(cap->pio, cap->sm, true);
+    return true;
+}
+
+size_t capture_read(capture_t* cap, uint32_t* out, size_t max) {
+    if (cap->overflow) {
+        return 0;
+    }
+    uint32_t available = written_words(cap) - cap->read_words;
+    if (available > CAPTURE_RING_WORDS) {
+        cap->overflow = true;
+        return 0;
+    }
+
+    size_t n = available < max ? available : max;
+    for (size_t i = 0; i < n; i++) {
+        out[i] = ring[(cap->read_words + i) % CAPTURE_RING_WORDS];
+    }
+
+    // DMA may have lapped the reader while copying
+    if (written_words(cap) - cap->read_words > CAPTURE_RING_WORDS) {
+        cap->overflow = true;
+        return 0;
+    }
+    cap->read_words += (uint32_t)n;
+    return n;
+}
+
+bool capture_overflowed(capture_t* cap) {
+    // A stalled autopush stops the slot counter, so the timestamps are no longer exact
+    if (cap->pio && (cap->pio->fdebug & (1u << (PIO_FDEBUG_RXSTALL_LSB + cap->sm)))) {
+        cap->overflow = true;
+    }
+    return cap->overflow;
+}
+
+uint32_t capture_resync(capture_t* cap) {
+    uint32_t written = written_words(cap);
+    uint32_t target = cap->read_words;  // after a PIO stall alone there is nothing to skip
+    if (written - cap->read_words > HALF_WORDS) {
+        target = written - HALF_WORDS;
+        if (cap->pin_count > 1) {
+            target &= ~1u;  // records are (counter, state) pairs from word 0
+        }
+    }
+    uint32_t skipped = target - cap->read_words;
+    cap->read_words = target;
+    cap->overflow = false;
+    cap->pio->fdebug = 1u << (PIO_FDEBUG_RXSTALL_LSB + cap->sm);
+    return skipped;
+}
+
+void capture_stop(capture_t* cap) {
+    if (cap->pio) {
+        pio_sm_set_enabled(cap->pio, cap->sm, false);
+    }
+    for (int i = 0; i < 2; i++) {
+        if (cap->dma[i] < 0) {
+            continue;
+        }
+        uint ch = (uint)cap->dma[i];
+        dma_channel_set_irq0_enabled(ch, false);
+        // Chain to itself first so aborting one channel cannot start the other
+        hw_write_masked(&dma_hw->ch[ch].al1_ctrl, ch << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB,
+                        DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS);
+    }
+    for (int i = 0; i < 2; i++) {
+        if (cap->dma[i] >= 0) {
+            dma_channel_abort((uint)cap->dma[i]);
+            dma_channel_acknowledge_irq0((uint)cap->dma[i]);
+            dma_channel_unclaim((uint)cap->dma[i]);
+            cap->dma[i] = -1;
+        }
+    }
+    if (active == cap) {
+        irq_remove_handler(DMA_IRQ_0, capture_dma_irq);
+        active = NULL;
+    }
+    if (cap->pio) {
+        pio_remove_program_and_unclaim_sm(cap->program, cap->pio, cap->sm, cap->offset);
+        cap->pio = NULL;
+    }
+}
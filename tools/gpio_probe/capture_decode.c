@@ -0,0 +1,175 @@
+/**
+ * @file capture_decode.c
+ * @brief Decoding, triggering and export of PIO edge captures (see capture_decode.h).
+ *
+ * No Pico SDK dependencies: this file is also built by tools/host.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <inttypes.h>
+#include <string.h>
+#include "capture_decode.h"
+
+void capture_decoder_init(capture_decoder_t* dec, uint8_t pin_count) {
+    memset(dec, 0, sizeof(*dec));
+    dec->pin_count = pin_count;
+    dec->slot_cycles = pin_count > 1 ? CAPTURE_MULTI_SLOT_CYCLES : CAPTURE_SINGLE_SLOT_CYCLES;
+}
+
+/**
+ * @brief Unwrap a counter word into the 64-bit cycle time of its slot.
+ */
+static uint64_t unwrap(capture_decoder_t* dec, uint32_t counter) {
+    uint32_t slot = CAPTURE_COUNTER_START - counter;
+    dec->slots += (uint32_t)(slot - dec->last_slot);  // modular: survives one wrap per gap
+    dec->last_slot = slot;
+    return dec->slots * dec->slot_cycles;
+}
+
+bool capture_decode_word(capture_decoder_t* dec, uint32_t word, capture_edge_t* edge) {
+    if (dec->pin_count <= 1) {
+        // Single pin: every word is an edge and the level alternates
+        edge->cycles = unwrap(dec, word);
+        dec->state ^= 1;
+        edge->state = dec->state;
+        return true;
+    }
+
+    if (!dec->have_counter) {
+        dec->counter = word;
+        dec->have_counter = true;
+        return false;
+    }
+    dec->have_counter = false;
+    edge->cycles = unwrap(dec, dec->counter);
+    dec->state = (uint8_t)(word & ((1u << dec->pin_count) - 1));
+    edge->state = dec->state;
+    return true;
+}
+
+uint32_t capture_decoder_skip(capture_decoder_t* dec, uint32_t words) {
+    if (dec->pin_count <= 1) {
+        dec->state ^= (uint8_t)(words & 1);
+        return words;
+    }
+    uint32_t edges = (words + (dec->have_counter ? 1 : 0)) / 2;
+    dec->have_counter = false;
+    return edges;
+}
+
+void capture_trigger_init(capture_trigger_t* trig, const capture_trigger_config_t* cfg,
+                          capture_edge_t* history) {
+    memset(trig, 0, sizeof(*trig));
+    trig->cfg = *cfg;
+    trig->history = history;
+    if (!history) {
+        trig->cfg.pretrigger = 0;
+    }
+}
+
+/**
+ * @brief Does the edge from `before` to `after` fire the trigger?
+ */
+static bool trigger_fires(const capture_trigger_config_t* cfg, uint8_t before, uint8_t after) {
+    uint8_t bit = (uint8_t)(1u << cfg->pin);
+    switch (cfg->type) {
+        case CAPTURE_TRIGGER_NONE:
+            return true;
+        case CAPTURE_TRIGGER_PATTERN:
+            return (after & cfg->mask) == (cfg->value & cfg->mask);
+        case CAPTURE_TRIGGER_RISING:
+            return !(before & bit) && (after & bit);
+        case CAPTURE_TRIGGER_FALLING:
+            return (before & bit) && !(after & bit);
+        case CAPTURE_TRIGGER_EDGE:
+            return (before ^ after) & bit;
+    }
+    return false;
+}
+
+bool capture_trigger_feed(capture_trigger_t* trig, const capture_edge_t* edge,
+                          capture_edge_fn fn, void* ctx) {
+    if (trig->done) {
+        return true;
+    }
+
+    uint8_t before = trig->state;
+    trig->state = edge->state;
+
+    if (!trig->triggered) {
+        if (!trigger_fires(&trig->cfg, before, edge->state)) {
+            // Keep the newest cfg.pretrigger edges; the oldest one drops out
+            if (trig->cfg.pretrigger == 0) {
+                trig->start_state = edge->state;
+            } else {
+                if (trig->history_count == trig->cfg.pretrigger) {
+                    trig->start_state = trig->history[trig->history_head].state;
+                } else {
+                    trig->history_count++;
+                }
+                trig->history[trig->history_head] = *edge;
+                trig->history_head = (trig->history_head + 1) % trig->cfg.pretrigger;
+            }
+            return false;
+        }
+
+        trig->triggered = true;
+        trig->trigger = *edge;
+        uint32_t first = trig->cfg.pretrigger ? (trig->history_head + trig->cfg.pretrigger -
+                                                 trig->history_count) % trig->cfg.pretrigger : 0;
+        for (uint32_t i = 0; i < trig->history_count; i++) {
+            fn(&trig->history[(first + i) % trig->cfg.pretrigger], ctx);
+        }
+    }
+
+    fn(edge, ctx);
+    trig->emitted++;
+    if (trig->cfg.length && trig->emitted >= trig->cfg.length) {
+        trig->done = true;
+    }
+    return trig->done;
+}
+
+uint64_t capture_cycles_to_ns(uint64_t cycles, uint32_t clk_hz) {
+    return cycles / clk_hz * 1000000000ull + (cycles % clk_hz) * 1000000000ull / clk_hz;
+}
+
+void capture_write_csv_header(FILE* out) {
+    fprintf(out, "timestamp_us,state\n");
+}
+
+void capture_write_csv_edge(FILE* out, const capture_edge_t* edge, uint32_t clk_hz) {
+    uint64_t ns = capture_cycles_to_ns(edge->cycles, clk_hz);
+    fprintf(out, "%" PRIu64 ".%03u,%u\n", ns / 1000, (unsigned)(ns % 1000), edge->state);
+}
+
+void capture_write_vcd_header(FILE* out, uint8_t pin_base, uint8_t pin_count, uint8_t initial_state) {
+    fprintf(out, "$version rp2040_tools gpio_probe $end\n");
+    fprintf(out, "$timescale 1 ns $end\n");
+    fprintf(out, "$scope module probe $end\n");
+    for (uint8_t i = 0; i < pin_count; i++) {
+        fprintf(out, "$var wire 1 %c gpio%u $end\n", '!' + i, pin_base + i);
+    }
+    fprintf(out, "$upscope $end\n");
+    fprintf(out, "$enddefinitions $end\n");
+    fprintf(out, "#0\n$dumpvars\n");
+    for (uint8_t i = 0; i < pin_count; i++) {
+        fprintf(out, "%u%c\n", (initial_state >> i) & 1u, '!' + i);
+    }
+    fprintf(out, "$end\n");
+}
+
+void capture_write_vcd_edge(FILE* out, const capture_edge_t* edge, uint8_t previous_state,
+                            uint8_t pin_count, uint32_t clk_hz) {
+    uint8_t changed = edge->state ^ previous_state;
+    if (!changed) {
+        return;
+    }
+    fprintf(out, "#%" PRIu64 "\n", capture_cycles_to_ns(edge->cycles, clk_hz));
+    for (uint8_t i = 0; i < pin_count; i++) {
+        if (changed & (1u << i)) {
+            fprintf(out, "%u%c\n", (edge->state >> i) & 1u, '!' + i);
+        }
+    }
+}
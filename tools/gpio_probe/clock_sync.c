@@ -0,0 +1,373 @@
+/**
+ * @file clock_sync.c
+ * @brief Clock sync estimator (see clock_sync.h).
+ *
+ * No Pico SDK dependencies: this file is also built by tools/host. The fit
+ * uses doubles but runs once per sync pulse (every 10 ms); per-edge
+ * conversion is integer only.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <inttypes.h>
+#include <math.h>
+#include <string.h>
+#include "clock_sync.h"
+
+#define PERIOD_NS ((uint64_t)BENCH_SYNC_PERIOD_US * 1000u)
+#define FRAME_BITS (BENCH_SYNC_FRAME_PULSES - 1u)
+
+typedef enum { SYMBOL_ZERO, SYMBOL_ONE, SYMBOL_MARKER, SYMBOL_GLITCH } symbol_t;
+
+void clock_sync_init(clock_sync_t* cs, uint32_t tick_hz) {
+    memset(cs, 0, sizeof(*cs));
+    cs->tick_hz = tick_hz;
+    cs->holdover_ticks = (uint64_t)tick_hz * CLOCK_SYNC_HOLDOVER_US / 1000000u;
+    cs->outlier_ticks = (double)tick_hz * CLOCK_SYNC_OUTLIER_NS / 1e9;
+}
+
+/**
+ * @brief Symbol of a pulse from its high time, halfway between the nominal widths.
+ */
+static symbol_t classify(const clock_sync_t* cs, uint64_t width) {
+    uint64_t us = width * 1000000u / cs->tick_hz;
+    if (us < CLOCK_SYNC_MIN_WIDTH_US) {
+        return SYMBOL_GLITCH;
+    }
+    if (us < (BENCH_SYNC_ZERO_US + BENCH_SYNC_ONE_US) / 2) {
+        return SYMBOL_ZERO;
+    }
+    if (us < (BENCH_SYNC_ONE_US + BENCH_SYNC_MARKER_US) / 2) {
+        return SYMBOL_ONE;
+    }
+    if (us < CLOCK_SYNC_MAX_WIDTH_US) {
+        return SYMBOL_MARKER;
+    }
+    return SYMBOL_GLITCH;  // Stuck high, or two pulses merged by a lost edge
+}
+
+/**
+ * @brief Symbol the main board sends for absolute pulse k (bench_sync.h).
+ */
+static symbol_t expected_symbol(int64_t k) {
+    uint32_t j = (uint32_t)(k % BENCH_SYNC_FRAME_PULSES);
+    if (j == 0) {
+        return SYMBOL_MARKER;
+    }
+    return (k / BENCH_SYNC_FRAME_PULSES) >> (j - 1) & 1 ? SYMBOL_ONE : SYMBOL_ZERO;
+}
+
+/**
+ * @brief Forget the chain; the next pulse starts a new one.
+ */
+static clock_sync_event_t break_chain(clock_sync_t* cs) {
+    clock_sync_event_t event = cs->locked ? CLOCK_SYNC_LOST : CLOCK_SYNC_NONE;
+    cs->breaks++;
+    cs->chained = false;
+    cs->numbered = false;
+    cs->locked = false;
+    return event;
+}
+
+/**
+ * @brief Line through the pulses of the window that are not outliers.
+ *
+ * x is probe ticks and y main ns, both relative to the newest pulse, which
+ * keeps the doubles exact.
+ *
+ * @return false with fewer than two points.
+ */
+static bool line_fit(const clock_sync_t* cs, double* slope, double* y0) {
+    double n = 0, sx = 0, sy = 0;
+    for (uint32_t i = 0; i < cs->num_window; i++) {
+        const clock_sync_pulse_t* p = &cs->window[i];
+        if (!p->outlier) {
+            n++;
+            sx += (double)(int64_t)(p->ticks - cs->last.ticks);
+            sy += (double)((int64_t)p->index - (int64_t)cs->last.index) * (double)PERIOD_NS;
+        }
+    }
+    if (n < 2) {
+        return false;
+    }
+    double mx = sx / n;
+    double my = sy / n;
+    double sxx = 0, sxy = 0;
+    for (uint32_t i = 0; i < cs->num_window; i++) {
+        const clock_sync_pulse_t* p = &cs->window[i];
+        if (!p->outlier) {
+            double x = (double)(int64_t)(p->ticks - cs->last.ticks) - mx;
+            double y = (double)((int64_t)p->index - (int64_t)cs->last.index) * (double)PERIOD_NS - my;
+            sxx += x * x;
+            sxy += x * y;
+        }
+    }
+    *slope = sxy / sxx;
+    *y0 = my - *slope * mx;
+    return true;
+}
+
+/**
+ * @brief Ticks by which a pulse misses the line (slope in main ns per tick).
+ */
+static double miss_ticks(const clock_sync_t* cs, const clock_sync_pulse_t* p, double slope, double y0) {
+    double x = (double)(int64_t)(p->ticks - cs->last.ticks);
+    double y = (double)((int64_t)p->index - (int64_t)cs->last.index) * (double)PERIOD_NS;
+    return (y - (y0 + slope * x)) / slope;
+}
+
+/**
+ * @brief Least-squares fit of the window, anchored at the newest pulse.
+ *
+ * The pulse furthest off the line is marked as an outlier and the line
+ * fitted again without it, until all are within CLOCK_SYNC_OUTLIER_NS.
+ *
+ * @return false if too few pulses are left.
+ */
+static bool fit(clock_sync_t* cs) {
+    double slope, y0;
+    for (;;) {
+        if (!line_fit(cs, &slope, &y0)) {
+            return false;
+        }
+        // One far outlier drags the whole line, so only the worst goes per pass
+        clock_sync_pulse_t* worst = NULL;
+        double worst_miss = cs->outlier_ticks;
+        for (uint32_t i = 0; i < cs->num_window; i++) {
+            clock_sync_pulse_t* p = &cs->window[i];
+            double miss = fabs(miss_ticks(cs, p, slope, y0));
+            if (!p->outlier && miss > worst_miss) {
+                worst = p;
+                worst_miss = miss;
+            }
+        }
+        if (!worst) {
+            break;
+        }
+        worst->outlier = true;
+        cs->glitches++;
+    }
+
+    double n = 0, ss = 0;
+    for (uint32_t i = 0; i < cs->num_window; i++) {
+        const clock_sync_pulse_t* p = &cs->window[i];
+        if (!p->outlier) {
+            double r = miss_ticks(cs, p, slope, y0) * slope;
+            n++;
+            ss += r * r;
+        }
+    }
+
+    cs->anchor_ticks = cs->last.ticks;
+    cs->anchor_ns = (cs->base + cs->last.index) * (int64_t)PERIOD_NS + (int64_t)llround(y0);
+    cs->slope_int = (uint64_t)slope;
+    cs->slope_frac = (uint32_t)((slope - (double)cs->slope_int) * 4294967296.0);
+    cs->period_ticks = (double)PERIOD_NS / slope;
+    cs->drift_ppm = (1e9 / (slope * cs->tick_hz) - 1.0) * 1e6;
+    cs->residual_ns = sqrt(ss / n);
+    return true;
+}
+
+/**
+ * @brief Decode frames, check symbols against the numbering and refit.
+ */
+static clock_sync_event_t add_pulse(clock_sync_t* cs, uint64_t rise, uint32_t index, symbol_t symbol) {
+    cs->pulses++;
+    cs->last.ticks = rise;
+    cs->last.index = index;
+    cs->last.outlier = false;
+    cs->window[cs->next] = cs->last;
+    cs->next = (cs->next + 1) % CLOCK_SYNC_WINDOW;
+    if (cs->num_window < CLOCK_SYNC_WINDOW) {
+        cs->num_window++;
+    }
+
+    if (symbol == SYMBOL_MARKER) {
+        cs->have_marker = true;
+        cs->marker_index = index;
+        cs->frame_bits = 0;
+        cs->num_bits = 0;
+    } else if (cs->have_marker && index == cs->marker_index + 1 + cs->num_bits) {
+        cs->frame_bits |= (uint32_t)(symbol == SYMBOL_ONE) << cs->num_bits;
+        if (++cs->num_bits == FRAME_BITS) {
+            cs->have_marker = false;
+            int64_t base = (int64_t)cs->frame_bits * BENCH_SYNC_FRAME_PULSES - cs->marker_index;
+            if (cs->numbered) {
+                if (base == cs->base) {
+                    cs->symbol_errors = 0;
+                }
+            } else if (cs->have_candidate && base == cs->candidate) {
+                cs->numbered = true;
+                cs->base = base;
+                cs->symbol_errors = 0;
+            } else {
+                cs->have_candidate = true;
+                cs->candidate = base;
+            }
+        }
+    } else {
+        cs->have_marker = false;  // A bit went missing: wait for the next marker
+    }
+
+    if (!cs->numbered) {
+        return CLOCK_SYNC_NONE;
+    }
+    if (symbol != expected_symbol(cs->base + index)) {
+        cs->bad_symbols++;
+        if (++cs->symbol_errors >= CLOCK_SYNC_MAX_SYMBOL_ERRORS) {
+            return break_chain(cs);
+        }
+    }
+    if (!fit(cs)) {
+        return CLOCK_SYNC_NONE;
+    }
+    if (!cs->locked) {
+        cs->locked = true;
+        return CLOCK_SYNC_LOCKED;
+    }
+    return CLOCK_SYNC_NONE;
+}
+
+static void start_chain(clock_sync_t* cs) {
+    cs->chained = true;
+    cs->have_held = false;
+    cs->num_window = 0;
+    cs->next = 0;
+    cs->have_marker = false;
+    cs->have_candidate = false;
+    cs->numbered = false;
+    cs->symbol_errors = 0;
+}
+
+/**
+ * @brief Whole number of periods from `from` to `rise`, or 0 if off the grid.
+ */
+static uint32_t grid_periods(const clock_sync_t* cs, uint64_t from, uint64_t rise, double* miss) {
+    uint64_t gap = rise - from;
+    double period = cs->locked ? cs->period_ticks
+                               : (double)cs->tick_hz * BENCH_SYNC_PERIOD_US / 1000000.0;
+    double periods = (double)gap / period;
+    double n = floor(periods + 0.5);
+    *miss = fabs(periods - n) * period;
+    if (n < 1 || fabs(periods - n) > 0.05 || gap > cs->holdover_ticks) {
+        return 0;
+    }
+    return (uint32_t)n;
+}
+
+/**
+ * @brief Place a complete pulse on the period grid of the chain.
+ *
+ * A pulse off the grid is held back. If the next pulse is on the old grid
+ * it was noise; if it is on the grid of the held pulse instead, the main
+ * board restarted its sync (or the chain went silent past the holdover)
+ * and a new chain starts from the held pulse.
+ */
+static clock_sync_event_t pulse(clock_sync_t* cs, uint64_t rise, symbol_t symbol) {
+    if (!cs->chained) {
+        start_chain(cs);
+        return add_pulse(cs, rise, 0, symbol);
+    }
+
+    double miss;
+    uint32_t n = grid_periods(cs, cs->last.ticks, rise, &miss);
+    if (n) {
+        if (cs->have_held) {
+            cs->have_held = false;
+            cs->glitches++;
+        }
+        if (cs->locked && miss > cs->outlier_ticks) {
+            cs->glitches++;  // On the grid but off the fit: a pulse split by a glitch
+            return CLOCK_SYNC_NONE;
+        }
+        return add_pulse(cs, rise, cs->last.index + n, symbol);
+    }
+
+    if (cs->have_held) {
+        n = grid_periods(cs, cs->held.ticks, rise, &miss);
+        if (n) {
+            clock_sync_event_t event = break_chain(cs);
+            start_chain(cs);
+            add_pulse(cs, cs->held.ticks, 0, cs->held_symbol);
+            add_pulse(cs, rise, n, symbol);
+            return event;
+        }
+        cs->glitches++;  // The held pulse fits neither grid
+    }
+    cs->have_held = true;
+    cs->held.ticks = rise;
+    cs->held_symbol = (uint8_t)symbol;
+    return CLOCK_SYNC_NONE;
+}
+
+clock_sync_event_t clock_sync_edge(clock_sync_t* cs, uint64_t ticks, bool level) {
+    if (level == cs->high) {
+        return CLOCK_SYNC_NONE;
+    }
+    cs->high = level;
+    if (level) {
+        cs->rise = ticks;
+        cs->have_rise = true;
+        return CLOCK_SYNC_NONE;
+    }
+    if (!cs->have_rise) {
+        return CLOCK_SYNC_NONE;  // High from before the capture started
+    }
+    cs->have_rise = false;
+    symbol_t symbol = classify(cs, ticks - cs->rise);
+    if (symbol == SYMBOL_GLITCH) {
+        cs->glitches++;
+        return CLOCK_SYNC_NONE;
+    }
+    return pulse(cs, cs->rise, symbol);
+}
+
+clock_sync_event_t clock_sync_capture_edge(clock_sync_t* cs, const capture_edge_t* edge,
+                                           uint8_t previous_state, unsigned pin) {
+    if (!((edge->state ^ previous_state) >> pin & 1u)) {
+        return CLOCK_SYNC_NONE;
+    }
+    return clock_sync_edge(cs, edge->cycles, edge->state >> pin & 1u);
+}
+
+bool clock_sync_to_main(const clock_sync_t* cs, uint64_t ticks, int64_t* main_ns) {
+    if (!cs->locked) {
+        return false;
+    }
+    bool before = ticks < cs->anchor_ticks;
+    uint64_t distance = before ? cs->anchor_ticks - ticks : ticks - cs->anchor_ticks;
+    if (distance > cs->holdover_ticks) {
+        return false;
+    }
+    // distance < 2^32 (holdover at most one second of ticks), so no overflow
+    uint64_t ns = distance * cs->slope_int + (distance * cs->slope_frac >> 32);
+    *main_ns = before ? cs->anchor_ns - (int64_t)ns : cs->anchor_ns + (int64_t)ns;
+    return true;
+}
+
+void clock_sync_write_csv_header(FILE* out) {
+    fprintf(out, "timestamp_us,state,main_us\n");
+}
+
+void clock_sync_write_csv_edge(FILE* out, const clock_sync_t* cs, const capture_edge_t* edge,
+                               uint32_t clk_hz) {
+    uint64_t ns = capture_cycles_to_ns(edge->cycles, clk_hz);
+    fprintf(out, "%" PRIu64 ".%03u,%u,", ns / 1000, (unsigned)(ns % 1000), edge->state);
+    int64_t main_ns;
+    if (clock_sync_to_main(cs, edge->cycles, &main_ns)) {
+        uint64_t m = main_ns < 0 ? (uint64_t)-main_ns : (uint64_t)main_ns;
+        fprintf(out, "%s%" PRIu64 ".%03u", main_ns < 0 ? "-" : "", m / 1000, (unsigned)(m % 1000));
+    }
+    fputc('\n', out);
+}
+
+void clock_sync_write_event(FILE* out, const clock_sync_t* cs, clock_sync_event_t event) {
+    if (event == CLOCK_SYNC_LOCKED) {
+        fprintf(out, "clock sync locked at pulse %" PRId64 ", drift %+.3f ppm, residual %.0f ns rms\n",
+                cs->base + cs->last.index, cs->drift_ppm, cs->residual_ns);
+    } else if (event == CLOCK_SYNC_LOST) {
+        fprintf(out, "clock sync lost (%lu glitches, %lu bad symbols, %lu breaks so far)\n",
+                (unsigned long)cs->glitches, (unsigned long)cs->bad_symbols,
+                (unsigned long)cs->breaks);
+    }
+}
@@ -0,0 +1,231 @@
+/**
+ * @file edge_pack.c
+ * @brief Compressed edge stream encoder and decoder (see edge_pack.h).
+ *
+ * No Pico SDK dependencies: this file is also built by tools/host. The
+ * varint helpers are local rather than bench_wire's: the encoder reserves
+ * room once per edge instead of checking every byte, and the decoder bounds
+ * run lengths so a corrupted frame cannot expand without limit.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <string.h>
+#include "bench_wire.h"
+#include "edge_pack.h"
+
+#define MAX_FRAME (BENCH_WIRE_HEADER_SIZE + BENCH_WIRE_MAX_PAYLOAD + BENCH_WIRE_CRC_SIZE)
+
+// ----------------------------------------------------
+// Encoding
+// ----------------------------------------------------
+
+static inline uint8_t* put_uv(uint8_t* p, uint64_t v) {
+    while (v >= 0x80) {
+        *p++ = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (uint8_t)v;
+    return p;
+}
+
+static inline uint64_t zigzag(int64_t v) {
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+void edge_pack_init(edge_pack_t* enc, uint8_t* frame, size_t cap, uint8_t pin_base,
+                    uint8_t pin_count, uint32_t clk_hz, uint32_t sync_edges,
+                    edge_pack_frame_fn fn, void* ctx) {
+    memset(enc, 0, sizeof(*enc));
+    if (cap > MAX_FRAME) {
+        cap = MAX_FRAME;
+    }
+    enc->frame = frame;
+    enc->limit = frame + cap - BENCH_WIRE_CRC_SIZE - 2 * EDGE_PACK_MAX_TOKEN;
+    enc->pin_base = pin_base;
+    enc->pin_count = pin_count;
+    enc->clk_hz = clk_hz;
+    enc->sync_edges = sync_edges < 1 ? 1
+                    : sync_edges > EDGE_PACK_MAX_FRAME_EDGES ? EDGE_PACK_MAX_FRAME_EDGES : sync_edges;
+    enc->fn = fn;
+    enc->ctx = ctx;
+}
+
+/**
+ * @brief Open a frame with `edge` as its sync point.
+ */
+static void begin_frame(edge_pack_t* enc, const capture_edge_t* edge) {
+    uint8_t* p = enc->frame + BENCH_WIRE_HEADER_SIZE;
+    p = put_uv(p, enc->seq);
+    *p++ = enc->pin_base;
+    *p++ = enc->pin_count;
+    p = put_uv(p, enc->clk_hz);
+    p = put_uv(p, enc->lost);
+    p = put_uv(p, edge->cycles);
+    *p++ = edge->state;
+    enc->p = p;
+
+    enc->edges = 1;
+    enc->run = 0;
+    enc->last = edge->cycles;
+    enc->delta1 = enc->delta2 = 0;
+    enc->state1 = enc->state2 = edge->state;
+}
+
+void edge_pack_flush(edge_pack_t* enc) {
+    if (enc->edges == 0) {
+        return;
+    }
+    if (enc->run) {
+        enc->p = put_uv(enc->p, (uint64_t)(enc->run - 1) << 2 | EDGE_PACK_RUN);
+    }
+    size_t payload_len = (size_t)(enc->p - enc->frame) - BENCH_WIRE_HEADER_SIZE;
+    size_t len = bench_wire_seal_frame(enc->frame, BENCH_WIRE_EDGES_PACKED, payload_len);
+    enc->fn(enc->frame, len, enc->ctx);
+
+    enc->total_edges += enc->edges;
+    enc->total_bytes += len;
+    enc->seq++;
+    enc->lost = 0;
+    enc->edges = 0;
+}
+
+void edge_pack_add(edge_pack_t* enc, const capture_edge_t* edge) {
+    if (enc->edges >= enc->sync_edges || (enc->edges && enc->p > enc->limit)) {
+        edge_pack_flush(enc);
+    }
+    if (enc->edges == 0) {
+        begin_frame(enc, edge);
+        return;
+    }
+
+    uint64_t delta = edge->cycles - enc->last;
+    int64_t residual = (int64_t)(delta - enc->delta2);
+    uint8_t predicted = enc->pin_count == 1 ? (uint8_t)(enc->state1 ^ 1u) : enc->state2;
+
+    if (residual == 0 && edge->state == predicted) {
+        enc->run++;
+    } else {
+        uint8_t* p = enc->p;
+        if (enc->run) {
+            p = put_uv(p, (uint64_t)(enc->run - 1) << 2 | EDGE_PACK_RUN);
+            enc->run = 0;
+        }
+        if (edge->state == predicted) {
+            p = put_uv(p, zigzag(residual) << 2 | EDGE_PACK_EDGE);
+        } else {
+            p = put_uv(p, zigzag(residual) << 2 | EDGE_PACK_EDGE_STATE);
+            *p++ = edge->state;
+        }
+        enc->p = p;
+    }
+
+    enc->edges++;
+    enc->last = edge->cycles;
+    enc->delta2 = enc->delta1;
+    enc->delta1 = delta;
+    enc->state2 = enc->state1;
+    enc->state1 = edge->state;
+}
+
+void edge_pack_lost(edge_pack_t* enc, uint32_t edges) {
+    if (edges == 0) {
+        return;
+    }
+    edge_pack_flush(enc);  // the gap lies between two frames
+    enc->lost += edges;
+}
+
+// ----------------------------------------------------
+// Decoding
+// ----------------------------------------------------
+
+typedef struct {
+    const uint8_t* p;
+    const uint8_t* end;
+    bool error;
+} reader_t;
+
+static uint8_t get_u8(reader_t* r) {
+    if (r->p < r->end) {
+        return *r->p++;
+    }
+    r->error = true;
+    return 0;
+}
+
+static uint64_t get_uv(reader_t* r) {
+    uint64_t v = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        uint8_t b = get_u8(r);
+        v |= (uint64_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            return v;
+        }
+    }
+    r->error = true;  // Over-long varint
+    return 0;
+}
+
+bool edge_pack_decode(const uint8_t* payload, size_t len, edge_pack_frame_t* info,
+                      capture_edge_fn fn, void* ctx) {
+    reader_t r = { payload, payload + len, false };
+
+    info->seq = (uint32_t)get_uv(&r);
+    info->pin_base = get_u8(&r);
+    info->pin_count = get_u8(&r);
+    info->clk_hz = (uint32_t)get_uv(&r);
+    info->lost = (uint32_t)get_uv(&r);
+    info->num_edges = 0;
+
+    capture_edge_t edge;
+    edge.cycles = get_uv(&r);
+    edge.state = get_u8(&r);
+    if (r.error || info->pin_count < 1 || info->pin_count > CAPTURE_MAX_PINS || info->clk_hz == 0) {
+        return false;
+    }
+    fn(&edge, ctx);
+    info->num_edges = 1;
+
+    uint64_t delta1 = 0;
+    uint64_t delta2 = 0;
+    uint8_t state2 = edge.state;
+    while (r.p < r.end) {
+        uint64_t t = get_uv(&r);
+        uint64_t value = t >> 2;
+        uint64_t count = 1;
+        int64_t residual = 0;
+        bool explicit_state = false;
+        switch (t & 3u) {
+            case EDGE_PACK_EDGE:
+                residual = (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+                break;
+            case EDGE_PACK_RUN:
+                count = value + 1;
+                break;
+            case EDGE_PACK_EDGE_STATE:
+                residual = (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+                explicit_state = true;
+                break;
+            default:
+                return false;
+        }
+        uint8_t state = explicit_state ? get_u8(&r) : 0;
+        if (r.error || count > EDGE_PACK_MAX_FRAME_EDGES - info->num_edges) {
+            return false;
+        }
+
+        for (uint64_t i = 0; i < count; i++) {
+            uint64_t delta = delta2 + (uint64_t)residual;
+            uint8_t predicted = info->pin_count == 1 ? (uint8_t)(edge.state ^ 1u) : state2;
+            state2 = edge.state;
+            edge.cycles += delta;
+            edge.state = explicit_state ? state : predicted;
+            delta2 = delta1;
+            delta1 = delta;
+            fn(&edge, ctx);
+        }
+        info->num_edges += (uint32_t)count;
+    }
+    return true;
+}
@@ -1,19 +1,65 @@
 /**
  * @file probe.c
- * @brief GPIO Edge Logger Tool for RP2040 (Tool Mode 1)
+ * @brief GPIO Edge Logger / Logic Analyser Tool for RP2040 (Tool Mode 1)
  *
- * Continuously monitors a digital input pin (GPIO2) and logs transitions
- * (rising and falling edges) with microsecond timestamps via USB serial.
+ * Timestamps every transition on up to 8 consecutive pins (from GPIO2) in
+ * clk_sys cycles, using the PIO + DMA capture engine (capture.h), and prints
+ * the edges via USB serial. With one pin an edge is resolved to 2 cycles
+ * (16 ns at 125 MHz), with several pins to 6 cycles (48 ns), so the ~50 ns
+ * toggles of the GPIO benchmarks are captured edge by edge.
  *
  * Used in conjunction with GPIO/PWM benchmarks to verify timing
  * or detect logic activity.
  *
- * Output format:
- *   timestamp_us,state
+ * Trigger (PROBE_TRIGGER):
+ *   - CAPTURE_TRIGGER_NONE streams every edge as it is captured.
+ *   - Any other trigger works like a logic analyser: the last PROBE_PRETRIGGER
+ *     edges before the trigger and the edges after it are stored, up to
+ *     PROBE_CAPTURE_EDGES in all, then printed in one go and the trigger is
+ *     re-armed. Storing first means printing cannot slow the capture down.
+ *
+ * Output (PROBE_OUTPUT):
+ *   - CSV:    timestamp_us,state   (state is a pin mask, bit 0 = PROBE_PIN_BASE)
+ *   - VCD:    value change dump, opens in PulseView/sigrok-cli and GTKWave
+ *   - BINARY: bench_wire.h edge frames (one pin only), decode on the host
+ *             with bench_decode, which prints the same CSV. A batch is sent
+ *             when it is full or when the input has been idle for
+ *             PROBE_FLUSH_IDLE_US.
+ *   - RAW:    the PIO words in hex, untriggered; tools/host/capture_replay
+ *             decodes, triggers and exports them on the host
+ *   - STATS:  no edges; one summary row per pin every PROBE_STATS_WINDOW_MS
+ *             (period, frequency, duty cycle, pulse widths and their log2
+ *             histograms, dropped edges; see signal_stats.h), untriggered.
+ *             Fast PWM then costs a few lines per second instead of a line
+ *             per edge, and a ring overflow only drops edges (counted)
+ *             instead of restarting the capture.
+ *   - PACKED: edge_pack.h frames, any pin count: cycle deltas predicted
+ *             from two edges back, zigzag varints, runs of exactly periodic
+ *             edges and an absolute sync point per frame, with a CRC. About
+ *             1-2 bytes per edge instead of ~15 for CSV, and a few bytes
+ *             per frame for a steady clock. Frames are sent when full, every
+ *             PROBE_PACK_SYNC_EDGES edges or after PROBE_FLUSH_IDLE_US idle;
+ *             tools/host/edge_unpack restores the exact timestamps as CSV
+ *             or VCD. When streaming, a ring overflow is reported in the
+ *             next frame as dropped edges instead of restarting the capture.
+ *
+ * Clock sync (PROBE_SYNC_PIN): with the benchmark Pico running `sync`
+ * (bench_sync.h) and its sync line on one of the probe's pins, CSV output
+ * gains a main_us column, each edge's time on the benchmark board's
+ * timeline (clock_sync.h), comparable with the `sync_mark` lines it
+ * prints. The column is empty until the estimator locks, under a second
+ * after every capture (re)start; lock and loss are printed as notices.
+ * With the other outputs the sync line is captured like any pin, and
+ * tools/host/sync_timeline does the same on the host.
+ *
+ * When edges arrive faster than they can be printed (streaming) or stored,
+ * the capture ring overflows; the probe then prints a notice and restarts,
+ * and timestamps start again from zero.
  *
  * Wiring:
- *   - GPIO2 (Logger) ← GPIO2 (Main Pico output)
- *   - GND (Logger)   ← GND (Main Pico)
+ *   - GPIO2.. (Logger) ← GPIO under test (Main Pico output)
+ *   - GND (Logger)     ← GND (Main Pico)
+ *   - GPIO2+PROBE_SYNC_PIN ← sync pin (Main Pico), if used
  *
  * Notes:
  *   - Both Picos must share a common ground reference.
@@ -22,36 +68,401 @@
  */
 
 #include "pico/stdlib.h"
+#include "hardware/clocks.h"
 #include <stdio.h>
+#include "bench_wire.h"
+#include "capture.h"
+#include "capture_decode.h"
+#include "clock_sync.h"
+#include "edge_pack.h"
+#include "signal_stats.h"
+
+#define PROBE_PIN_BASE 2       // First GPIO to capture
+#define PROBE_PIN_COUNT 1      // Consecutive pins (1-8); 1 selects the 2-cycle program
+
+#define PROBE_OUTPUT_CSV 0
+#define PROBE_OUTPUT_VCD 1
+#define PROBE_OUTPUT_BINARY 2
+#define PROBE_OUTPUT_RAW 3
+#define PROBE_OUTPUT_STATS 4
+#define PROBE_OUTPUT_PACKED 5
+#define PROBE_OUTPUT PROBE_OUTPUT_CSV
+
+#define PROBE_TRIGGER CAPTURE_TRIGGER_NONE  // See capture_trigger_type_t
+#define PROBE_TRIGGER_PIN 0                 // Edge triggers: pin index (0 = PROBE_PIN_BASE)
+#define PROBE_TRIGGER_MASK 0x01             // Pattern trigger: pins that take part
+#define PROBE_TRIGGER_VALUE 0x01            // Pattern trigger: their levels
+#define PROBE_PRETRIGGER 64                 // Edges kept from before the trigger
+#define PROBE_CAPTURE_EDGES 4096            // Edges stored per triggered capture
+
+#define PROBE_SYNC_PIN -1                   // Pin index of the main board's sync line, or -1
+
+#define PROBE_STATS_WINDOW_MS 1000         // Summary period of the STATS output
+
+#define PROBE_BATCH_EDGES 256        // Edges per binary frame
+#define PROBE_FLUSH_IDLE_US 100000   // Send a partial batch after 100 ms without edges
+
+#define PROBE_PACK_FRAME_BYTES 1024  // Packed frame buffer (at most ~1 ms of USB time)
+#define PROBE_PACK_SYNC_EDGES 4096   // Edges between absolute sync points
+
+#if PROBE_OUTPUT == PROBE_OUTPUT_BINARY && PROBE_PIN_COUNT != 1
+#error "bench_wire.h edge frames carry a single pin"
+#endif
+#if PROBE_SYNC_PIN >= PROBE_PIN_COUNT
+#error "PROBE_SYNC_PIN must be one of the captured pins"
+#endif
+
+#define PROBE_SYNC (PROBE_SYNC_PIN >= 0 && PROBE_OUTPUT == PROBE_OUTPUT_CSV)
+
+static capture_t capture;
+static capture_decoder_t decoder;
+static uint32_t words[256];
+static uint32_t clk_hz;
+static uint8_t output_state;  // Level before the next edge printed
+
+static capture_edge_t edges[PROBE_CAPTURE_EDGES];
+static capture_edge_t history[PROBE_PRETRIGGER > 0 ? PROBE_PRETRIGGER : 1];
+static uint32_t edge_count;
 
-#define PROBE_PIN 2        // GPIO to monitor for logic changes
-#define DEBOUNCE_US 1      // Optional debounce/pacing (in microseconds)
+static signal_stats_t pin_stats[PROBE_PIN_COUNT];
+
+#if PROBE_SYNC
+static clock_sync_t sync;
+static uint8_t sync_state;  // Level before the next edge fed to the estimator
+static bool sync_started;
+#endif
+
+static uint32_t batch[PROBE_BATCH_EDGES];
+static uint32_t batch_count;
+static uint8_t batch_first_state;
+static uint8_t frame[BENCH_WIRE_HEADER_SIZE + BENCH_WIRE_CRC_SIZE + 16 + PROBE_BATCH_EDGES * 5];
+
+static edge_pack_t packer;
+static uint8_t pack_frame[PROBE_PACK_FRAME_BYTES];
+
+/**
+ * @brief Send the buffered edges as one binary frame.
+ */
+static void flush_batch(void) {
+    if (batch_count == 0) {
+        return;
+    }
+    bench_wire_edges_t wire_edges = {
+        .pin = PROBE_PIN_BASE,
+        .first_state = batch_first_state,
+        .timer_hz = clk_hz,  // clk_sys cycles
+        .num_edges = batch_count,
+        .timestamps = batch,
+    };
+    size_t len = bench_wire_encode_edges(frame, sizeof(frame), &wire_edges);
+    if (len) {
+        bench_wire_write(frame, len);
+    }
+    batch_count = 0;
+}
+
+static void send_pack_frame(const uint8_t* data, size_t len, void* ctx) {
+    (void)ctx;
+    bench_wire_write(data, len);
+}
 
 /**
- * @brief Run GPIO edge logger.
+ * @brief Unlock the clock sync estimator; capture timestamps restart at zero.
+ */
+static void sync_begin(void) {
+#if PROBE_SYNC
+    clock_sync_init(&sync, clk_hz);
+    sync_started = false;
+#endif
+}
+
+/**
+ * @brief Feed one decoded edge to the clock sync estimator.
  *
- * Continuously samples the input pin and prints a timestamped CSV line
- * whenever a logic level change (edge) is detected. Suitable for logging
- * PWM or rapid toggling activity.
+ * A record at the first two sample slots holds the initial levels rather
+ * than edges. Lock and loss notices are printed if `report` is set.
+ */
+static void sync_edge(const capture_edge_t* edge, bool report) {
+#if PROBE_SYNC
+    if (!sync_started && edge->cycles <= 2u * decoder.slot_cycles) {
+        sync.high = (edge->state >> PROBE_SYNC_PIN) & 1u;  // A pulse in progress is skipped
+    } else {
+        clock_sync_event_t event = clock_sync_capture_edge(&sync, edge, sync_state, PROBE_SYNC_PIN);
+        if (report && event != CLOCK_SYNC_NONE) {
+            printf("GPIO Probe: ");
+            clock_sync_write_event(stdout, &sync, event);
+        }
+    }
+    sync_started = true;
+    sync_state = edge->state;
+#else
+    (void)edge;
+    (void)report;
+#endif
+}
+
+/**
+ * @brief Start an output block; `initial_state` is the level before its first edge.
+ */
+static void output_begin(uint8_t initial_state) {
+    output_state = initial_state;
+    if (PROBE_OUTPUT == PROBE_OUTPUT_PACKED) {
+        // Frame numbers restart at 0, which starts a new capture on the host
+        edge_pack_init(&packer, pack_frame, sizeof(pack_frame), PROBE_PIN_BASE, PROBE_PIN_COUNT,
+                       clk_hz, PROBE_PACK_SYNC_EDGES, send_pack_frame, NULL);
+    }
+#if PROBE_SYNC
+    clock_sync_write_csv_header(stdout);
+#elif PROBE_OUTPUT == PROBE_OUTPUT_CSV
+    capture_write_csv_header(stdout);
+#elif PROBE_OUTPUT == PROBE_OUTPUT_VCD
+    capture_write_vcd_header(stdout, PROBE_PIN_BASE, PROBE_PIN_COUNT, initial_state);
+#endif
+}
+
+/**
+ * @brief Print (or batch) one edge.
+ */
+static void output_edge(const capture_edge_t* edge, void* ctx) {
+    (void)ctx;
+#if PROBE_SYNC
+    clock_sync_write_csv_edge(stdout, &sync, edge, clk_hz);
+#elif PROBE_OUTPUT == PROBE_OUTPUT_CSV
+    capture_write_csv_edge(stdout, edge, clk_hz);
+#elif PROBE_OUTPUT == PROBE_OUTPUT_VCD
+    capture_write_vcd_edge(stdout, edge, output_state, PROBE_PIN_COUNT, clk_hz);
+#elif PROBE_OUTPUT == PROBE_OUTPUT_BINARY
+    if (batch_count == 0) {
+        batch_first_state = edge->state;
+    }
+    batch[batch_count++] = (uint32_t)edge->cycles;
+    if (batch_count == PROBE_BATCH_EDGES) {
+        flush_batch();
+    }
+#elif PROBE_OUTPUT == PROBE_OUTPUT_PACKED
+    edge_pack_add(&packer, edge);
+#endif
+    output_state = edge->state;
+}
+
+/**
+ * @brief Send a partly filled binary batch or packed frame.
+ */
+static void output_flush(void) {
+    if (PROBE_OUTPUT == PROBE_OUTPUT_BINARY) {
+        flush_batch();
+    } else if (PROBE_OUTPUT == PROBE_OUTPUT_PACKED) {
+        edge_pack_flush(&packer);
+    }
+}
+
+static void output_end(void) {
+    output_flush();
+    fflush(stdout);
+}
+
+/**
+ * @brief Print the PIO words as they arrive, until the ring overflows.
  *
- * @return void
+ * @return true (data was lost)
  */
-void run_gpio_probe(void) {
-    gpio_init(PROBE_PIN);
-    gpio_set_dir(PROBE_PIN, GPIO_IN);
+static bool stream_raw(void) {
+    printf("capture_raw,%d,%d,%lu\n", PROBE_PIN_BASE, PROBE_PIN_COUNT, (unsigned long)clk_hz);
+    while (!capture_overflowed(&capture)) {
+        size_t n = capture_read(&capture, words, sizeof(words) / sizeof(words[0]));
+        for (size_t i = 0; i < n; i++) {
+            printf("%08lx\n", (unsigned long)words[i]);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Print every edge as it is decoded, until the ring overflows.
+ *
+ * Packed frames report dropped edges, so with that output an overflow
+ * skips to recent data instead and this never returns.
+ *
+ * @return true (data was lost)
+ */
+static bool stream_edges(void) {
+    uint32_t last_edge_us = time_us_32();
+    output_begin(0);
+    while (true) {
+        if (capture_overflowed(&capture)) {
+            if (PROBE_OUTPUT != PROBE_OUTPUT_PACKED) {
+                break;
+            }
+            edge_pack_lost(&packer, capture_decoder_skip(&decoder, capture_resync(&capture)));
+        }
+        size_t n = capture_read(&capture, words, sizeof(words) / sizeof(words[0]));
+        capture_edge_t edge;
+        for (size_t i = 0; i < n; i++) {
+            if (capture_decode_word(&decoder, words[i], &edge)) {
+                sync_edge(&edge, true);
+                output_edge(&edge, NULL);
+                last_edge_us = time_us_32();
+            }
+        }
+        if (n == 0 && time_us_32() - last_edge_us > PROBE_FLUSH_IDLE_US) {
+            output_flush();  // nothing to do once sent
+        }
+    }
+    output_end();
+    return true;
+}
+
+/**
+ * @brief Pass the pins that changed in one edge to their statistics.
+ */
+static void stats_edge(const capture_edge_t* edge, uint8_t previous_state) {
+    uint8_t changed = edge->state ^ previous_state;
+    for (uint i = 0; i < PROBE_PIN_COUNT; i++) {
+        if (changed & (1u << i)) {
+            signal_stats_edge(&pin_stats[i], edge->cycles, (edge->state >> i) & 1u);
+        }
+    }
+}
+
+/**
+ * @brief Print a summary of every pin each PROBE_STATS_WINDOW_MS.
+ *
+ * A record at the first two sample slots holds the initial levels rather
+ * than edges. Ring overflows skip to recent data and count as dropped
+ * edges, so this never returns.
+ */
+static void stream_stats(void) {
+    for (uint i = 0; i < PROBE_PIN_COUNT; i++) {
+        signal_stats_init(&pin_stats[i]);
+    }
+    signal_stats_write_header(stdout);
+
+    uint8_t state = 0;
+    bool first = true;
+    uint32_t window_start = time_us_32();
+    while (true) {
+        if (capture_overflowed(&capture)) {
+            uint32_t lost = capture_decoder_skip(&decoder, capture_resync(&capture));
+            for (uint i = 0; i < PROBE_PIN_COUNT; i++) {
+                signal_stats_dropped(&pin_stats[i], lost);
+            }
+        }
 
-    printf("timestamp_us,state\n");
+        size_t n = capture_read(&capture, words, sizeof(words) / sizeof(words[0]));
+        capture_edge_t edge;
+        for (size_t i = 0; i < n; i++) {
+            if (!capture_decode_word(&decoder, words[i], &edge)) {
+                continue;
+            }
+            if (first && edge.cycles <= 2u * decoder.slot_cycles) {
+                for (uint p = 0; p < PROBE_PIN_COUNT; p++) {
+                    signal_stats_set_level(&pin_stats[p], (edge.state >> p) & 1u);
+                }
+            } else {
+                stats_edge(&edge, state);
+            }
+            state = edge.state;
+            first = false;
+        }
+
+        uint32_t now = time_us_32();
+        if (now - window_start >= PROBE_STATS_WINDOW_MS * 1000u) {
+            uint64_t window_cycles = (uint64_t)(now - window_start) * clk_hz / 1000000u;
+            for (uint i = 0; i < PROBE_PIN_COUNT; i++) {
+                signal_stats_write_row(stdout, &pin_stats[i], PROBE_PIN_BASE + i, window_cycles, clk_hz);
+                signal_stats_next_window(&pin_stats[i]);
+            }
+            fflush(stdout);
+            window_start = now;
+        }
+    }
+}
+
+static void store_edge(const capture_edge_t* edge, void* ctx) {
+    (void)ctx;
+    if (edge_count < PROBE_CAPTURE_EDGES) {
+        edges[edge_count++] = *edge;
+    }
+}
 
-    uint8_t last = gpio_get(PROBE_PIN);
+/**
+ * @brief Wait for the trigger, store the capture, stop, then print it.
+ *
+ * @return true if the ring overflowed before the capture was complete
+ */
+static bool triggered_capture(void) {
+    capture_trigger_config_t cfg = {
+        .type = PROBE_TRIGGER,
+        .mask = PROBE_TRIGGER_MASK,
+        .value = PROBE_TRIGGER_VALUE,
+        .pin = PROBE_TRIGGER_PIN,
+        .pretrigger = PROBE_PRETRIGGER,
+        .length = PROBE_CAPTURE_EDGES - PROBE_PRETRIGGER,
+    };
+    capture_trigger_t trigger;
+    capture_trigger_init(&trigger, &cfg, history);
+    edge_count = 0;
+
+    bool done = false;
+    while (!done && !capture_overflowed(&capture)) {
+        size_t n = capture_read(&capture, words, sizeof(words) / sizeof(words[0]));
+        capture_edge_t edge;
+        for (size_t i = 0; i < n && !done; i++) {
+            if (capture_decode_word(&decoder, words[i], &edge)) {
+                sync_edge(&edge, false);  // Converted with the fit at the end of the capture
+                done = capture_trigger_feed(&trigger, &edge, store_edge, NULL);
+            }
+        }
+    }
+    if (!done) {
+        return true;
+    }
+
+    capture_stop(&capture);
+    output_begin(trigger.start_state);
+    for (uint32_t i = 0; i < edge_count; i++) {
+        output_edge(&edges[i], NULL);
+    }
+    output_end();
+    return false;
+}
+
+/**
+ * @brief Run the GPIO edge logger.
+ *
+ * Starts a capture on PROBE_PIN_COUNT pins from PROBE_PIN_BASE and prints
+ * edges in the configured format. Captures are restarted after each
+ * triggered capture and after an overflow, so the tool runs indefinitely.
+ *
+ * @return void (only if the PIO or DMA resources are not available)
+ */
+void run_gpio_probe(void) {
+    clk_hz = clock_get_hz(clk_sys);
+    printf("GPIO Probe Ready (GPIO%d x%d, %lu Hz)\n", PROBE_PIN_BASE, PROBE_PIN_COUNT,
+           (unsigned long)clk_hz);
 
     while (true) {
-        uint8_t current = gpio_get(PROBE_PIN);
-        if (current != last) {
-            uint32_t timestamp = time_us_32();
-            printf("%lu,%d\n", timestamp, current);
-            last = current;
+        if (!capture_start(&capture, PROBE_PIN_BASE, PROBE_PIN_COUNT)) {
+            printf("GPIO Probe: no free PIO state machine or DMA channel\n");
+            return;
         }
+        capture_decoder_init(&decoder, PROBE_PIN_COUNT);
+        sync_begin();
 
-        sleep_us(DEBOUNCE_US);  // Sampling interval / pacing
+        bool lost = false;
+        if (PROBE_OUTPUT == PROBE_OUTPUT_STATS) {
+            stream_stats();
+        } else if (PROBE_OUTPUT == PROBE_OUTPUT_RAW) {
+            lost = stream_raw();
+        } else if (PROBE_TRIGGER == CAPTURE_TRIGGER_NONE) {
+            lost = stream_edges();
+        } else {
+            lost = triggered_capture();
+        }
+
+        capture_stop(&capture);
+        if (lost) {
+            printf("GPIO Probe: capture overflowed, restarting\n");
+        }
     }
 }
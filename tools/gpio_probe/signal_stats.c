@@ -0,0 +1,144 @@
+/**
+ * @file signal_stats.c
+ * @brief Incremental pulse statistics of a digital signal (see signal_stats.h).
+ *
+ * No Pico SDK dependencies: this file is also built by tools/host.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <string.h>
+#include "signal_stats.h"
+
+void signal_stats_init(signal_stats_t* s) {
+    memset(s, 0, sizeof(*s));
+}
+
+void signal_stats_set_level(signal_stats_t* s, uint8_t level) {
+    s->level = level ? 1 : 0;
+    s->have_edge = false;
+    s->have_rise = false;
+}
+
+unsigned signal_stats_bucket(uint64_t width) {
+    unsigned bucket = 0;
+    while (width > 1 && bucket < SIGNAL_STATS_BUCKETS - 1) {
+        width >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+static void add_width(signal_widths_t* w, uint64_t width) {
+    if (w->count == 0 || width < w->min) {
+        w->min = width;
+    }
+    if (width > w->max) {
+        w->max = width;
+    }
+    w->count++;
+    w->sum += width;
+    w->hist[signal_stats_bucket(width)]++;
+}
+
+void signal_stats_edge(signal_stats_t* s, uint64_t ticks, uint8_t level) {
+    level = level ? 1 : 0;
+    if (s->have_edge && level == s->level) {
+        // The edge in between was lost: neither pulse nor period is known
+        s->dropped++;
+        s->last_edge = ticks;
+        s->have_rise = level;
+        s->last_rise = ticks;
+        return;
+    }
+
+    if (s->have_edge) {
+        add_width(level ? &s->low : &s->high, ticks - s->last_edge);
+    }
+    if (level) {
+        if (s->have_rise) {
+            add_width(&s->period, ticks - s->last_rise);
+        }
+        s->have_rise = true;
+        s->last_rise = ticks;
+    }
+    s->edges++;
+    s->level = level;
+    s->last_edge = ticks;
+    s->have_edge = true;
+}
+
+void signal_stats_dropped(signal_stats_t* s, uint32_t edges) {
+    s->dropped += edges;
+    s->have_edge = false;
+    s->have_rise = false;
+}
+
+void signal_stats_next_window(signal_stats_t* s) {
+    s->edges = 0;
+    s->dropped = 0;
+    memset(&s->high, 0, sizeof(s->high));
+    memset(&s->low, 0, sizeof(s->low));
+    memset(&s->period, 0, sizeof(s->period));
+}
+
+void signal_stats_write_header(FILE* out) {
+    fprintf(out, "pin,window_us,edges,dropped,period_us,freq_hz,duty_pct,"
+                 "high_min_us,high_mean_us,high_max_us,low_min_us,low_mean_us,low_max_us,"
+                 "high_hist,low_hist\n");
+}
+
+static void write_us(FILE* out, double ticks, uint32_t tick_hz) {
+    fprintf(out, ",%.3f", ticks * 1e6 / tick_hz);
+}
+
+/**
+ * @brief Write ",min,mean,max" of a width set (empty fields without data).
+ */
+static void write_widths(FILE* out, const signal_widths_t* w, uint32_t tick_hz) {
+    if (w->count == 0) {
+        fprintf(out, ",,,");
+        return;
+    }
+    write_us(out, (double)w->min, tick_hz);
+    write_us(out, (double)w->sum / w->count, tick_hz);
+    write_us(out, (double)w->max, tick_hz);
+}
+
+static void write_hist(FILE* out, const signal_widths_t* w) {
+    const char* sep = "";
+    fputc(',', out);
+    for (unsigned b = 0; b < SIGNAL_STATS_BUCKETS; b++) {
+        if (w->hist[b]) {
+            fprintf(out, "%s%u:%lu", sep, b, (unsigned long)w->hist[b]);
+            sep = " ";
+        }
+    }
+}
+
+void signal_stats_write_row(FILE* out, const signal_stats_t* s, unsigned pin,
+                            uint64_t window_ticks, uint32_t tick_hz) {
+    fprintf(out, "%u", pin);
+    write_us(out, (double)window_ticks, tick_hz);
+    fprintf(out, ",%lu,%lu", (unsigned long)s->edges, (unsigned long)s->dropped);
+
+    if (s->period.count) {
+        double period = (double)s->period.sum / s->period.count;
+        write_us(out, period, tick_hz);
+        fprintf(out, ",%.3f", tick_hz / period);
+    } else {
+        fprintf(out, ",,");
+    }
+    uint64_t total = s->high.sum + s->low.sum;
+    if (total) {
+        fprintf(out, ",%.2f", 100.0 * (double)s->high.sum / (double)total);
+    } else {
+        fprintf(out, ",");
+    }
+
+    write_widths(out, &s->high, tick_hz);
+    write_widths(out, &s->low, tick_hz);
+    write_hist(out, &s->high);
+    write_hist(out, &s->low);
+    fputc('\n', out);
+}
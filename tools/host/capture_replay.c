@@ -0,0 +1,470 @@
+/**
+ * @file capture_replay.c
+ * @brief Decode, trigger and export GPIO probe captures on the Linux host.
+ *
+ * Runs the probe's decoder, trigger and exporters (gpio_probe/capture_decode.c,
+ * built unchanged) in one of two ways:
+ *
+ *   - Replay: reads a raw capture (PROBE_OUTPUT_RAW: a `capture_raw,pin_base,
+ *     pin_count,clk_hz` line followed by the PIO words in hex) and writes the
+ *     edges as CSV or VCD, applying the trigger on the host. Only the first
+ *     capture of a log is used; text around it is ignored.
+ *   - Self-check (-s): builds the word stream the PIO programs would push for
+ *     a random signal, with gaps long enough to wrap the 32-bit slot counter
+ *     several times, and checks that decoding returns every edge, that each
+ *     kind of trigger keeps exactly the expected window and that the VCD export reads
+ *     back to the same edges. Exits 1 on the first mismatch.
+ *
+ * Usage:
+ *   capture_replay [-f csv|vcd] [TRIGGER] [RAW_LOG]
+ *   capture_replay -s [-c PINS] [-e EDGES] [-S SEED] [TRIGGER]
+ *
+ *   -f FORMAT  Output format (default: csv)
+ *   -t TYPE    Trigger: none, pattern, rising, falling, edge (default: none; -s: each)
+ *   -p PIN     Edge triggers: pin index within the capture (default: 0)
+ *   -m MASK    Pattern trigger: pins that take part (default: 0x01)
+ *   -v VALUE   Pattern trigger: their levels (default: 0x01)
+ *   -P EDGES   Pre-trigger depth (default: 64)
+ *   -n EDGES   Edges from the trigger on, 0 = all (default: 0; -s: 1000)
+ *   -c PINS    Self-check one pin count (default: every count from 1 to 8)
+ *   -e EDGES   Self-check edges per stream (default: 100000)
+ *   -S SEED    Self-check generator seed (default: 1)
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_data.h"
+#include "capture_decode.h"
+
+#define SYNTHETIC_CLK_HZ 125000000u
+#define MAX_LINE 256
+
+typedef enum { FORMAT_CSV, FORMAT_VCD } format_t;
+
+static format_t format = FORMAT_CSV;
+static capture_trigger_config_t trigger_cfg = {
+    .type = CAPTURE_TRIGGER_NONE, .mask = 0x01, .value = 0x01, .pretrigger = 64,
+};
+static bool trigger_set;
+static bool length_set;
+
+/**
+ * @brief A growable list of edges.
+ */
+typedef struct {
+    capture_edge_t* edges;
+    size_t count;
+    size_t capacity;
+} edge_list_t;
+
+static void* xrealloc(void* p, size_t size) {
+    p = realloc(p, size);
+    if (!p) {
+        fprintf(stderr, "capture_replay: out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+static void collect_edge(const capture_edge_t* edge, void* ctx) {
+    edge_list_t* list = ctx;
+    if (list->count == list->capacity) {
+        list->capacity = list->capacity ? 2 * list->capacity : 1024;
+        list->edges = xrealloc(list->edges, list->capacity * sizeof(capture_edge_t));
+    }
+    list->edges[list->count++] = *edge;
+}
+
+static bool parse_trigger(const char* name, capture_trigger_type_t* type) {
+    static const char* const names[] = {"none", "pattern", "rising", "falling", "edge"};
+    for (int i = 0; i < 5; i++) {
+        if (strcmp(name, names[i]) == 0) {
+            *type = (capture_trigger_type_t)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// Replay
+// ----------------------------------------------------------------------------
+
+/**
+ * @brief Writes the triggered edges; the header goes out with the first one.
+ */
+typedef struct {
+    const capture_trigger_t* trigger;
+    uint8_t pin_base;
+    uint8_t pin_count;
+    uint32_t clk_hz;
+    bool started;
+    uint8_t state;
+} writer_t;
+
+static void write_begin(writer_t* w, uint8_t initial_state) {
+    w->started = true;
+    w->state = initial_state;
+    if (format == FORMAT_VCD) {
+        capture_write_vcd_header(stdout, w->pin_base, w->pin_count, initial_state);
+    } else {
+        capture_write_csv_header(stdout);
+    }
+}
+
+static void write_edge(const capture_edge_t* edge, void* ctx) {
+    writer_t* w = ctx;
+    if (!w->started) {
+        write_begin(w, w->trigger->start_state);
+    }
+    if (format == FORMAT_VCD) {
+        capture_write_vcd_edge(stdout, edge, w->state, w->pin_count, w->clk_hz);
+    } else {
+        capture_write_csv_edge(stdout, edge, w->clk_hz);
+    }
+    w->state = edge->state;
+}
+
+static int replay(const char* path) {
+    FILE* in = strcmp(path, "-") == 0 ? stdin : fopen(path, "r");
+    if (!in) {
+        perror(path);
+        return 1;
+    }
+
+    capture_decoder_t decoder;
+    capture_trigger_t trigger;
+    capture_edge_t* history = NULL;
+    writer_t writer = {.trigger = &trigger};
+    bool in_capture = false;
+    bool done = false;
+    uint64_t words = 0;
+    char line[MAX_LINE];
+
+    while (!done && fgets(line, sizeof(line), in)) {
+        unsigned base, count;
+        unsigned long hz;
+        if (sscanf(line, "capture_raw,%u,%u,%lu", &base, &count, &hz) == 3) {
+            if (in_capture) {
+                break;  // the probe restarted: keep the first capture only
+            }
+            if (count < 1 || count > CAPTURE_MAX_PINS || hz == 0) {
+                fprintf(stderr, "capture_replay: bad capture header: %s", line);
+                break;
+            }
+            in_capture = true;
+            writer.pin_base = (uint8_t)base;
+            writer.pin_count = (uint8_t)count;
+            writer.clk_hz = (uint32_t)hz;
+            capture_decoder_init(&decoder, (uint8_t)count);
+            history = xrealloc(NULL, (trigger_cfg.pretrigger + 1) * sizeof(capture_edge_t));
+            capture_trigger_init(&trigger, &trigger_cfg, history);
+            continue;
+        }
+
+        char* end;
+        line[strcspn(line, "\r\n")] = '\0';
+        unsigned long word = strtoul(line, &end, 16);
+        if (!in_capture || strlen(line) != 8 || *end) {
+            continue;  // banners and notices
+        }
+        words++;
+        capture_edge_t edge;
+        if (capture_decode_word(&decoder, (uint32_t)word, &edge)) {
+            done = capture_trigger_feed(&trigger, &edge, write_edge, &writer);
+        }
+    }
+    if (in != stdin) {
+        fclose(in);
+    }
+
+    if (!in_capture) {
+        fprintf(stderr, "capture_replay: no capture_raw header in %s\n", path);
+        return 1;
+    }
+    if (!writer.started) {
+        write_begin(&writer, trigger.start_state);
+        fprintf(stderr, "capture_replay: the trigger did not fire\n");
+    }
+    fprintf(stderr, "capture_replay: %" PRIu64 " words, %" PRIu32 " edges from the trigger on\n",
+            words, trigger.emitted);
+    free(history);
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Self-check
+// ----------------------------------------------------------------------------
+
+/**
+ * @brief Independent statement of the trigger condition for the reference window.
+ */
+static bool reference_fires(const capture_trigger_config_t* cfg, uint8_t before, uint8_t after) {
+    uint8_t bit = (uint8_t)(1u << cfg->pin);
+    switch (cfg->type) {
+        case CAPTURE_TRIGGER_PATTERN: return (after & cfg->mask) == (cfg->value & cfg->mask);
+        case CAPTURE_TRIGGER_RISING:  return !(before & bit) && (after & bit);
+        case CAPTURE_TRIGGER_FALLING: return (before & bit) && !(after & bit);
+        case CAPTURE_TRIGGER_EDGE:    return ((before ^ after) & bit) != 0;
+        default:                      return true;
+    }
+}
+
+static bool same_edge(const capture_edge_t* a, const capture_edge_t* b) {
+    return a->cycles == b->cycles && a->state == b->state;
+}
+
+/**
+ * @brief Read back a VCD written by capture_write_vcd_*; edge "cycles" hold nanoseconds.
+ */
+static void read_vcd(FILE* in, uint8_t* initial_state, edge_list_t* out) {
+    char line[MAX_LINE];
+    bool in_dumpvars = false;
+    bool pending = false;
+    capture_edge_t edge = {0};
+    *initial_state = 0;
+    while (fgets(line, sizeof(line), in)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (strcmp(line, "$dumpvars") == 0) {
+            in_dumpvars = true;
+        } else if (strcmp(line, "$end") == 0) {
+            in_dumpvars = false;
+            edge.state = *initial_state;
+        } else if (line[0] == '#') {
+            if (pending) {
+                collect_edge(&edge, out);
+                pending = false;
+            }
+            edge.cycles = strtoull(line + 1, NULL, 10);
+        } else if ((line[0] == '0' || line[0] == '1') && line[1] >= '!' && line[2] == '\0') {
+            uint8_t bit = (uint8_t)(1u << (line[1] - '!'));
+            uint8_t* state = in_dumpvars ? initial_state : &edge.state;
+            *state = line[0] == '1' ? (uint8_t)(*state | bit) : (uint8_t)(*state & ~bit);
+            pending = !in_dumpvars;
+        }
+    }
+    if (pending) {
+        collect_edge(&edge, out);
+    }
+}
+
+/**
+ * @brief Check one trigger on decoded edges, and the VCD export of its window.
+ */
+static bool check_trigger(uint8_t pins, const capture_trigger_config_t* cfg,
+                          const capture_edge_t* expected, size_t num_edges) {
+    static const char* const names[] = {"none", "pattern", "rising", "falling", "edge"};
+    bool ok = true;
+    edge_list_t window = {0};
+    edge_list_t exported = {0};
+
+    capture_trigger_t trigger;
+    capture_edge_t* history = xrealloc(NULL, (cfg->pretrigger + 1) * sizeof(capture_edge_t));
+    capture_trigger_init(&trigger, cfg, history);
+    for (size_t i = 0; i < num_edges; i++) {
+        if (capture_trigger_feed(&trigger, &expected[i], collect_edge, &window)) {
+            break;
+        }
+    }
+
+    // The window computed directly from the edges
+    size_t fire = num_edges;
+    for (size_t i = 0; i < num_edges && fire == num_edges; i++) {
+        if (reference_fires(cfg, i ? expected[i - 1].state : 0, expected[i].state)) {
+            fire = i;
+        }
+    }
+    size_t first = fire >= cfg->pretrigger ? fire - cfg->pretrigger : 0;
+    size_t last = cfg->length && fire + cfg->length < num_edges ? fire + cfg->length : num_edges;
+    if (fire == num_edges) {
+        first = last = num_edges;
+    }
+    uint8_t start_state = first ? expected[first - 1].state : 0;
+    ok = window.count == last - first && trigger.start_state == start_state;
+    for (size_t i = 0; ok && i < window.count; i++) {
+        ok = same_edge(&window.edges[i], &expected[first + i]);
+    }
+    if (!ok) {
+        fprintf(stderr, "capture_replay: %u pins: %s trigger kept %zu edges, expected %zu from edge %zu\n",
+                pins, names[cfg->type], window.count, last - first, first);
+    }
+
+    // VCD round trip of the window
+    FILE* vcd = tmpfile();
+    if (!vcd) {
+        perror("tmpfile");
+        exit(1);
+    }
+    capture_write_vcd_header(vcd, 2, pins, trigger.start_state);
+    uint8_t previous = trigger.start_state;
+    for (size_t i = 0; i < window.count; i++) {
+        capture_write_vcd_edge(vcd, &window.edges[i], previous, pins, SYNTHETIC_CLK_HZ);
+        previous = window.edges[i].state;
+    }
+    rewind(vcd);
+    uint8_t vcd_initial;
+    read_vcd(vcd, &vcd_initial, &exported);
+    fclose(vcd);
+    if (ok && (vcd_initial != trigger.start_state || exported.count != window.count)) {
+        fprintf(stderr, "capture_replay: %u pins: VCD holds %zu edges, expected %zu\n",
+                pins, exported.count, window.count);
+        ok = false;
+    }
+    for (size_t i = 0; ok && i < window.count; i++) {
+        capture_edge_t edge = {capture_cycles_to_ns(window.edges[i].cycles, SYNTHETIC_CLK_HZ),
+                               window.edges[i].state};
+        if (!same_edge(&exported.edges[i], &edge)) {
+            fprintf(stderr, "capture_replay: %u pins: VCD edge %zu does not read back\n", pins, i);
+            ok = false;
+        }
+    }
+
+    if (ok) {
+        printf("capture_replay: %u pin%s, %s trigger: %zu edges from edge %zu: OK\n",
+               pins, pins > 1 ? "s" : "", names[cfg->type], window.count, first);
+    }
+    free(history);
+    free(window.edges);
+    free(exported.edges);
+    return ok;
+}
+
+/**
+ * @brief Check decoding of one synthetic stream, then the triggers on it.
+ */
+static bool self_check(uint8_t pins, size_t num_edges, uint64_t seed) {
+    capture_edge_t* expected = xrealloc(NULL, num_edges * sizeof(capture_edge_t));
+    uint32_t* words = xrealloc(NULL, 2 * num_edges * sizeof(uint32_t));
+    uint32_t slot_cycles = pins > 1 ? CAPTURE_MULTI_SLOT_CYCLES : CAPTURE_SINGLE_SLOT_CYCLES;
+    bench_rng_t rng;
+    bench_rng_seed(&rng, seed, pins);
+
+    // Gaps of at least two slots (the PIO edge path), one in ~500 long enough to wrap
+    size_t num_words = 0;
+    uint64_t slot = 0;
+    uint8_t state = 0;
+    for (size_t i = 0; i < num_edges; i++) {
+        slot += bench_rng_below(&rng, 500) == 0 ? 0x80000000u + bench_rng_below(&rng, 0x7FFFFFFFu)
+                                                : 2 + bench_rng_below(&rng, 1000);
+        uint8_t next = (uint8_t)(state ^ 1);
+        while (pins > 1 && (next = (uint8_t)bench_rng_below(&rng, 1u << pins)) == state) {
+        }
+        state = next;
+        words[num_words++] = CAPTURE_COUNTER_START - (uint32_t)slot;
+        if (pins > 1) {
+            words[num_words++] = state;
+        }
+        expected[i] = (capture_edge_t){slot * slot_cycles, state};
+    }
+
+    bool ok = true;
+    capture_decoder_t decoder;
+    capture_decoder_init(&decoder, pins);
+    size_t decoded = 0;
+    for (size_t i = 0; i < num_words && ok; i++) {
+        capture_edge_t edge;
+        if (capture_decode_word(&decoder, words[i], &edge)) {
+            ok = decoded < num_edges && same_edge(&edge, &expected[decoded]);
+            decoded++;
+        }
+    }
+    if (!ok || decoded != num_edges) {
+        fprintf(stderr, "capture_replay: %u pins: edge %zu decoded wrongly\n", pins, decoded - 1);
+        ok = false;
+    } else {
+        printf("capture_replay: %u pin%s, %zu edges, %" PRIu64 " counter wraps: decode OK\n",
+               pins, pins > 1 ? "s" : "", num_edges, slot >> 32);
+    }
+
+    // The requested trigger, or each kind with a pattern that first occurs mid-stream
+    capture_trigger_config_t cfg = trigger_cfg;
+    if (trigger_set) {
+        ok &= check_trigger(pins, &cfg, expected, num_edges);
+    } else {
+        cfg.mask = (uint8_t)((1u << pins) - 1);
+        cfg.value = expected[num_edges / 2].state;
+        for (int type = CAPTURE_TRIGGER_NONE; type <= CAPTURE_TRIGGER_EDGE; type++) {
+            cfg.type = (capture_trigger_type_t)type;
+            ok &= check_trigger(pins, &cfg, expected, num_edges);
+        }
+    }
+
+    free(expected);
+    free(words);
+    return ok;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: capture_replay [-f csv|vcd] [TRIGGER] [RAW_LOG]\n"
+            "       capture_replay -s [-c PINS] [-e EDGES] [-S SEED] [TRIGGER]\n"
+            "TRIGGER: [-t none|pattern|rising|falling|edge] [-p PIN] [-m MASK] [-v VALUE]\n"
+            "         [-P PRETRIGGER] [-n LENGTH]\n");
+}
+
+int main(int argc, char** argv) {
+    bool synthetic = false;
+    int pins = 0;
+    size_t num_edges = 100000;
+    uint64_t seed = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "f:t:p:m:v:P:n:sc:e:S:")) != -1) {
+        switch (opt) {
+            case 'f':
+                if (strcmp(optarg, "csv") != 0 && strcmp(optarg, "vcd") != 0) {
+                    usage();
+                    return 2;
+                }
+                format = strcmp(optarg, "vcd") == 0 ? FORMAT_VCD : FORMAT_CSV;
+                break;
+            case 't':
+                if (!parse_trigger(optarg, &trigger_cfg.type)) {
+                    usage();
+                    return 2;
+                }
+                trigger_set = true;
+                break;
+            case 'p': trigger_cfg.pin = (uint8_t)strtoul(optarg, NULL, 0); break;
+            case 'm': trigger_cfg.mask = (uint8_t)strtoul(optarg, NULL, 0); break;
+            case 'v': trigger_cfg.value = (uint8_t)strtoul(optarg, NULL, 0); break;
+            case 'P': trigger_cfg.pretrigger = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'n':
+                trigger_cfg.length = (uint32_t)strtoul(optarg, NULL, 0);
+                length_set = true;
+                break;
+            case 's': synthetic = true; break;
+            case 'c': pins = atoi(optarg); break;
+            case 'e': num_edges = strtoull(optarg, NULL, 0); break;
+            case 'S': seed = strtoull(optarg, NULL, 0); break;
+            default:
+                usage();
+                return 2;
+        }
+    }
+    if (trigger_cfg.pin >= CAPTURE_MAX_PINS || pins < 0 || pins > CAPTURE_MAX_PINS ||
+        optind < argc - 1 || (synthetic && (optind < argc || num_edges == 0))) {
+        usage();
+        return 2;
+    }
+
+    if (!synthetic) {
+        return replay(optind < argc ? argv[optind] : "-");
+    }
+
+    if (!length_set) {
+        trigger_cfg.length = 1000;
+    }
+    bool ok = true;
+    for (int p = pins ? pins : 1; p <= (pins ? pins : CAPTURE_MAX_PINS); p++) {
+        if (trigger_cfg.pin < p) {
+            ok &= self_check((uint8_t)p, num_edges, seed);
+        }
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,574 @@
+/**
+ * @file edge_unpack.c
+ * @brief Decompress GPIO probe edge streams (edge_pack.h) on the Linux host.
+ *
+ * Runs the probe's codec (gpio_probe/edge_pack.c, built unchanged) in one of
+ * two ways:
+ *
+ *   - Unpack: reads a captured serial stream (PROBE_OUTPUT_PACKED) that may
+ *     mix text and frames, and writes the edges as CSV (`timestamp_us,state`,
+ *     as the probe prints them) or VCD. Text is passed through (to stderr
+ *     with VCD). Frames with a bad CRC are skipped, and frames missing from
+ *     the sequence and edges the probe dropped are counted on stderr. A frame
+ *     numbered 0 starts a new capture; VCD keeps the first capture only.
+ *   - Self-check (-s): encodes synthetic signals (steady PWM with jitter, an
+ *     exact clock, random edges with gaps of over 2^32 cycles, a 4-pin bus)
+ *     with dropped-edge notices, interleaves the frames with text, and checks
+ *     that unpacking returns every edge and notice exactly. It then corrupts
+ *     one byte in every 7th frame and checks that exactly those frames are
+ *     rejected and reported missing while the others still decode exactly.
+ *     Prints the size per edge against CSV and the encoder time per edge.
+ *     Exits 1 on the first mismatch.
+ *
+ * Usage:
+ *   edge_unpack [-f csv|vcd] [FILE]
+ *   edge_unpack -s [-n EDGES] [-S SEED]
+ *
+ *   -f FORMAT  Output format (default: csv)
+ *   -n EDGES   Self-check edges per signal (default: 200000)
+ *   -S SEED    Self-check generator seed (default: 1)
+ *
+ * Example:
+ *   cat /dev/ttyACM0 > probe.bin        # PROBE_OUTPUT_PACKED
+ *   edge_unpack -f vcd probe.bin > probe.vcd
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "bench_data.h"
+#include "bench_wire.h"
+#include "capture_decode.h"
+#include "edge_pack.h"
+
+#define WINDOW_SIZE (2u * (BENCH_WIRE_HEADER_SIZE + BENCH_WIRE_MAX_PAYLOAD + BENCH_WIRE_CRC_SIZE))
+#define SYNTHETIC_CLK_HZ 125000000u
+#define PROBE_FRAME_BYTES 1024   ///< Matches PROBE_PACK_FRAME_BYTES in probe.c
+#define PROBE_SYNC_EDGES 4096    ///< Matches PROBE_PACK_SYNC_EDGES in probe.c
+
+typedef enum { FORMAT_CSV, FORMAT_VCD } format_t;
+
+static format_t format = FORMAT_CSV;
+static capture_edge_t frame_edges[EDGE_PACK_MAX_FRAME_EDGES];
+
+static void* xrealloc(void* p, size_t size) {
+    p = realloc(p, size);
+    if (!p) {
+        fprintf(stderr, "edge_unpack: out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+// ----------------------------------------------------------------------------
+// Stream scanning (shared by unpack and the self-check)
+// ----------------------------------------------------------------------------
+
+/**
+ * @brief Splits a serial stream into text and decoded packed frames.
+ */
+typedef struct {
+    void (*on_text)(uint8_t c, void* ctx);
+    void (*on_frame)(const edge_pack_frame_t* info, const capture_edge_t* edges,
+                     size_t frame_len, void* ctx);
+    void* ctx;
+    unsigned long bad_frames;    ///< Bad CRC or malformed payload
+    unsigned long other_frames;  ///< Valid frames of other bench_wire types
+} unpacker_t;
+
+static void store_edge(const capture_edge_t* edge, void* ctx) {
+    uint32_t* count = ctx;
+    frame_edges[(*count)++] = *edge;  // edge_pack_decode stops at EDGE_PACK_MAX_FRAME_EDGES
+}
+
+/**
+ * @brief Consume as much of `data` as possible.
+ *
+ * @param eof No more data follows, so an incomplete frame is not waited for.
+ * @return Bytes consumed; the rest must be passed again with more data.
+ */
+static size_t unpack(unpacker_t* u, const uint8_t* data, size_t len, bool eof) {
+    size_t start = 0;
+    while (start < len) {
+        if (data[start] != BENCH_WIRE_MAGIC0) {
+            u->on_text(data[start++], u->ctx);
+            continue;
+        }
+
+        bench_wire_type_t type;
+        const uint8_t* payload;
+        size_t payload_len;
+        size_t frame_len;
+        bench_wire_frame_status_t status = bench_wire_parse_frame(
+            data + start, len - start, &type, &payload, &payload_len, &frame_len);
+
+        if (status == BENCH_WIRE_FRAME_OK) {
+            if (type == BENCH_WIRE_EDGES_PACKED) {
+                edge_pack_frame_t info;
+                uint32_t count = 0;
+                if (edge_pack_decode(payload, payload_len, &info, store_edge, &count)) {
+                    u->on_frame(&info, frame_edges, frame_len, u->ctx);
+                } else {
+                    u->bad_frames++;
+                }
+            } else {
+                u->other_frames++;
+            }
+            start += frame_len;
+        } else if (status == BENCH_WIRE_FRAME_INCOMPLETE && !eof) {
+            break;  // Read more
+        } else {
+            u->bad_frames++;
+            start++;  // Resynchronise on the next magic byte
+        }
+    }
+    return start;
+}
+
+// ----------------------------------------------------------------------------
+// Unpack
+// ----------------------------------------------------------------------------
+
+/**
+ * @brief Output state: the current capture and the totals for stderr.
+ */
+typedef struct {
+    bool started;        ///< A capture is being written
+    bool header_due;     ///< CSV: text came in between, repeat the header
+    bool vcd_done;       ///< VCD: a second capture began and is ignored
+    uint32_t next_seq;
+    uint8_t state;
+    uint64_t edges;
+    uint64_t frames;
+    uint64_t frame_bytes;
+    uint64_t lost_edges;
+    uint64_t lost_frames;
+} output_t;
+
+static void output_text(uint8_t c, void* ctx) {
+    output_t* o = ctx;
+    fputc(c, format == FORMAT_VCD ? stderr : stdout);
+    if (c == '\n') {
+        o->header_due = true;
+    }
+}
+
+static void output_frame(const edge_pack_frame_t* info, const capture_edge_t* edges,
+                         size_t frame_len, void* ctx) {
+    output_t* o = ctx;
+    if (o->vcd_done) {
+        return;
+    }
+    if (!o->started || info->seq == 0) {
+        if (o->started && format == FORMAT_VCD) {
+            fprintf(stderr, "edge_unpack: the probe restarted; VCD keeps the first capture\n");
+            o->vcd_done = true;
+            return;
+        }
+        o->started = true;
+        o->header_due = true;
+        o->state = 0;
+        if (format == FORMAT_VCD) {
+            capture_write_vcd_header(stdout, info->pin_base, info->pin_count, 0);
+            o->header_due = false;
+        }
+    } else if (info->seq != o->next_seq) {
+        o->lost_frames += info->seq - o->next_seq;
+    }
+    o->next_seq = info->seq + 1;
+    o->lost_edges += info->lost;
+    o->frames++;
+    o->frame_bytes += frame_len;
+    o->edges += info->num_edges;
+
+    if (format == FORMAT_CSV && o->header_due) {
+        capture_write_csv_header(stdout);
+        o->header_due = false;
+    }
+    for (uint32_t i = 0; i < info->num_edges; i++) {
+        if (format == FORMAT_VCD) {
+            capture_write_vcd_edge(stdout, &edges[i], o->state, info->pin_count, info->clk_hz);
+        } else {
+            capture_write_csv_edge(stdout, &edges[i], info->clk_hz);
+        }
+        o->state = edges[i].state;
+    }
+}
+
+static int unpack_file(const char* path) {
+    FILE* in = strcmp(path, "-") == 0 ? stdin : fopen(path, "rb");
+    if (!in) {
+        perror(path);
+        return 1;
+    }
+
+    static uint8_t window[WINDOW_SIZE];
+    output_t out = {0};
+    unpacker_t u = {.on_text = output_text, .on_frame = output_frame, .ctx = &out};
+    size_t end = 0;
+    bool eof = false;
+    while (!eof || end > 0) {
+        if (!eof) {
+            size_t got = fread(window + end, 1, sizeof(window) - end, in);
+            end += got;
+            eof = got == 0;
+        }
+        size_t used = unpack(&u, window, end, eof);
+        memmove(window, window + used, end - used);
+        end -= used;
+    }
+    if (in != stdin) {
+        fclose(in);
+    }
+    fflush(stdout);
+
+    fprintf(stderr, "edge_unpack: %" PRIu64 " edges in %" PRIu64 " frames (%.2f bytes/edge)",
+            out.edges, out.frames, out.edges ? (double)out.frame_bytes / (double)out.edges : 0.0);
+    if (out.lost_edges || out.lost_frames) {
+        fprintf(stderr, ", %" PRIu64 " edges dropped by the probe, %" PRIu64 " frames missing",
+                out.lost_edges, out.lost_frames);
+    }
+    fprintf(stderr, "\n");
+    if (u.other_frames) {
+        fprintf(stderr, "edge_unpack: %lu other frame(s) skipped, decode them with bench_decode\n",
+                u.other_frames);
+    }
+    if (u.bad_frames) {
+        fprintf(stderr, "edge_unpack: %lu bad frame(s) skipped\n", u.bad_frames);
+        return 1;
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Self-check
+// ----------------------------------------------------------------------------
+
+typedef enum { SIGNAL_PWM, SIGNAL_CLOCK, SIGNAL_RANDOM, SIGNAL_BUS } signal_t;
+
+static const char* const signal_names[] = {"jittered PWM", "exact clock", "random", "4-pin bus"};
+
+/**
+ * @brief A synthetic capture: its edges and the drops reported before some of them.
+ */
+typedef struct {
+    uint8_t pins;
+    size_t num_edges;
+    capture_edge_t* edges;
+    uint32_t* lost_before;  ///< Edges dropped just before edges[i]
+} signal_data_t;
+
+/**
+ * @brief Generate edges on the capture's slot grid, as the PIO programs timestamp them.
+ */
+static void generate(signal_t kind, size_t num_edges, uint64_t seed, signal_data_t* s) {
+    s->pins = kind == SIGNAL_BUS ? 4 : 1;
+    s->num_edges = num_edges;
+    s->edges = xrealloc(NULL, num_edges * sizeof(capture_edge_t));
+    s->lost_before = xrealloc(NULL, num_edges * sizeof(uint32_t));
+    uint32_t slot_cycles = s->pins > 1 ? CAPTURE_MULTI_SLOT_CYCLES : CAPTURE_SINGLE_SLOT_CYCLES;
+    bench_rng_t rng;
+    bench_rng_seed(&rng, seed, kind);
+
+    uint64_t slot = 1000;
+    uint8_t state = 0;
+    for (size_t i = 0; i < num_edges; i++) {
+        switch (kind) {
+            case SIGNAL_PWM:
+                // 1 kHz, 25 % duty, +-100 ns of jitter around each ideal edge
+                slot += (state ? 46875u : 15625u) + bench_rng_below(&rng, 25) - 12;
+                state ^= 1;
+                break;
+            case SIGNAL_CLOCK:
+                slot += 31;
+                state ^= 1;
+                break;
+            case SIGNAL_RANDOM:
+                slot += bench_rng_below(&rng, 500) == 0 ? 0x80000000u + bench_rng_below(&rng, 0x7FFFFFFFu)
+                                                        : 2 + bench_rng_below(&rng, 1000);
+                state ^= 1;
+                break;
+            case SIGNAL_BUS:
+                // Pin 0 clocks at a fixed rate; the data pins change on some falling edges
+                slot += 10;
+                if (state & 1u) {
+                    state &= (uint8_t)~1u;
+                    if (bench_rng_below(&rng, 4) == 0) {
+                        state = (uint8_t)(state ^ (bench_rng_below(&rng, 7) + 1) << 1);
+                    }
+                } else {
+                    state |= 1u;
+                }
+                break;
+        }
+        s->edges[i] = (capture_edge_t){slot * slot_cycles, state};
+        s->lost_before[i] = i > 0 && bench_rng_below(&rng, 5000) == 0 ? 1 + bench_rng_below(&rng, 100) : 0;
+    }
+}
+
+/**
+ * @brief Bytes of the encoded stream, and where each frame starts.
+ */
+typedef struct {
+    uint8_t* data;
+    size_t len;
+    size_t capacity;
+    size_t* frame_starts;
+    size_t num_frames;
+    size_t frame_capacity;
+    bench_rng_t rng;
+} stream_t;
+
+static void append(stream_t* s, const void* data, size_t len) {
+    if (s->len + len > s->capacity) {
+        s->capacity = 2 * (s->len + len);
+        s->data = xrealloc(s->data, s->capacity);
+    }
+    memcpy(s->data + s->len, data, len);
+    s->len += len;
+}
+
+static void collect_frame(const uint8_t* frame, size_t len, void* ctx) {
+    stream_t* s = ctx;
+    if (bench_rng_below(&s->rng, 16) == 0) {
+        static const char notice[] = "GPIO Probe: text between frames\n";
+        append(s, notice, sizeof(notice) - 1);
+    }
+    if (s->num_frames == s->frame_capacity) {
+        s->frame_capacity = s->frame_capacity ? 2 * s->frame_capacity : 1024;
+        s->frame_starts = xrealloc(s->frame_starts, s->frame_capacity * sizeof(size_t));
+    }
+    s->frame_starts[s->num_frames++] = s->len;
+    append(s, frame, len);
+}
+
+/**
+ * @brief What unpacking a synthetic stream produced.
+ */
+typedef struct {
+    const signal_data_t* signal;
+    size_t* first_edge;      ///< Per sequence number: index of its first edge (clean pass)
+    size_t num_seq;
+    bool clean;              ///< Clean pass: frames must follow each other
+    bool ok;
+    uint32_t next_seq;
+    size_t next_edge;
+    uint64_t frames;
+    uint64_t lost_edges;
+    uint64_t missing_frames;
+    size_t text_bytes;
+} check_t;
+
+static void check_text(uint8_t c, void* ctx) {
+    (void)c;
+    ((check_t*)ctx)->text_bytes++;
+}
+
+static void check_frame(const edge_pack_frame_t* info, const capture_edge_t* edges,
+                        size_t frame_len, void* ctx) {
+    (void)frame_len;
+    check_t* c = ctx;
+    const signal_data_t* s = c->signal;
+    if (!c->ok) {
+        return;
+    }
+    if (info->seq < c->next_seq || (c->clean && info->seq != c->next_seq) ||
+        (!c->clean && info->seq >= c->num_seq) || info->pin_count != s->pins ||
+        info->clk_hz != SYNTHETIC_CLK_HZ) {
+        fprintf(stderr, "edge_unpack: unexpected frame %" PRIu32 " (expected %" PRIu32 ")\n",
+                info->seq, c->next_seq);
+        c->ok = false;
+        return;
+    }
+    c->missing_frames += info->seq - c->next_seq;
+    c->next_seq = info->seq + 1;
+
+    size_t first = c->clean ? c->next_edge : c->first_edge[info->seq];
+    if (c->clean) {
+        c->first_edge = xrealloc(c->first_edge, (info->seq + 1) * sizeof(size_t));
+        c->first_edge[info->seq] = first;
+        c->num_seq = info->seq + 1;
+    }
+    if (first + info->num_edges > s->num_edges) {
+        fprintf(stderr, "edge_unpack: frame %" PRIu32 " holds too many edges\n", info->seq);
+        c->ok = false;
+        return;
+    }
+    for (uint32_t i = 0; i < info->num_edges; i++) {
+        const capture_edge_t* want = &s->edges[first + i];
+        if (edges[i].cycles != want->cycles || edges[i].state != want->state ||
+            (i > 0 && s->lost_before[first + i])) {
+            fprintf(stderr, "edge_unpack: frame %" PRIu32 " edge %" PRIu32 " decoded wrongly\n",
+                    info->seq, i);
+            c->ok = false;
+            return;
+        }
+    }
+    if (info->lost != s->lost_before[first]) {
+        fprintf(stderr, "edge_unpack: frame %" PRIu32 " reports %" PRIu32 " dropped edges, expected %" PRIu32 "\n",
+                info->seq, info->lost, s->lost_before[first]);
+        c->ok = false;
+        return;
+    }
+    c->lost_edges += info->lost;
+    c->next_edge = first + info->num_edges;
+    c->frames++;
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Encode one signal with one frame size, unpack it clean and corrupted.
+ */
+static bool check_signal(signal_t kind, const signal_data_t* s, size_t frame_bytes,
+                         uint32_t sync_edges, uint64_t seed) {
+    stream_t stream = {0};
+    bench_rng_seed(&stream.rng, seed, 100 + kind);
+    uint8_t* frame = xrealloc(NULL, frame_bytes);
+    edge_pack_t enc;
+    edge_pack_init(&enc, frame, frame_bytes, 2, s->pins, SYNTHETIC_CLK_HZ, sync_edges,
+                   collect_frame, &stream);
+
+    // Grow the buffers first so the timing below is the encoder's
+    stream.capacity = 16 * s->num_edges + 4096;
+    stream.data = xrealloc(NULL, stream.capacity);
+    double t0 = now_seconds();
+    uint64_t expected_lost = 0;
+    for (size_t i = 0; i < s->num_edges; i++) {
+        if (s->lost_before[i]) {
+            edge_pack_lost(&enc, s->lost_before[i]);
+            expected_lost += s->lost_before[i];
+        }
+        edge_pack_add(&enc, &s->edges[i]);
+    }
+    edge_pack_flush(&enc);
+    double encode_s = now_seconds() - t0;
+
+    // Clean round trip
+    check_t clean = {.signal = s, .clean = true, .ok = true};
+    unpacker_t u = {.on_text = check_text, .on_frame = check_frame, .ctx = &clean};
+    unpack(&u, stream.data, stream.len, true);
+    bool ok = clean.ok;
+    if (ok && (clean.next_edge != s->num_edges || clean.lost_edges != expected_lost ||
+               clean.frames != stream.num_frames || u.bad_frames)) {
+        fprintf(stderr, "edge_unpack: %s: %zu of %zu edges, %" PRIu64 " of %" PRIu64
+                " dropped, %lu bad frames\n", signal_names[kind], clean.next_edge, s->num_edges,
+                clean.lost_edges, expected_lost, u.bad_frames);
+        ok = false;
+    }
+
+    // One byte flipped in every 7th frame (the magic byte stays, so each is seen and rejected)
+    size_t corrupted = 0;
+    if (ok) {
+        uint8_t* copy = xrealloc(NULL, stream.len);
+        memcpy(copy, stream.data, stream.len);
+        for (size_t f = 3; f < stream.num_frames; f += 7) {
+            size_t start = stream.frame_starts[f];
+            size_t len = BENCH_WIRE_HEADER_SIZE + BENCH_WIRE_CRC_SIZE +
+                         (stream.data[start + 4] | (size_t)stream.data[start + 5] << 8);
+            copy[start + 1 + bench_rng_below(&stream.rng, (uint32_t)len - 1)] ^=
+                (uint8_t)(1u + bench_rng_below(&stream.rng, 255));
+            corrupted++;
+        }
+        check_t damaged = {.signal = s, .first_edge = clean.first_edge, .num_seq = clean.num_seq, .ok = true};
+        unpacker_t ud = {.on_text = check_text, .on_frame = check_frame, .ctx = &damaged};
+        unpack(&ud, copy, stream.len, true);
+        damaged.missing_frames += stream.num_frames - damaged.next_seq;
+        ok = damaged.ok;
+        if (ok && (damaged.frames != stream.num_frames - corrupted ||
+                   damaged.missing_frames != corrupted || ud.bad_frames < corrupted)) {
+            fprintf(stderr, "edge_unpack: %s: %" PRIu64 " frames decoded and %" PRIu64
+                    " missing after corrupting %zu of %zu\n", signal_names[kind],
+                    damaged.frames, damaged.missing_frames, corrupted, stream.num_frames);
+            ok = false;
+        }
+        free(copy);
+    }
+
+    if (ok) {
+        FILE* csv = tmpfile();
+        if (!csv) {
+            perror("tmpfile");
+            exit(1);
+        }
+        for (size_t i = 0; i < s->num_edges; i++) {
+            capture_write_csv_edge(csv, &s->edges[i], SYNTHETIC_CLK_HZ);
+        }
+        double csv_bytes = (double)ftell(csv);
+        fclose(csv);
+        double packed = (double)(stream.len - clean.text_bytes);
+        printf("edge_unpack: %s, %zu B frames: %zu edges in %zu frames, %.3f B/edge "
+               "(CSV %.1f, %.0fx), encode %.1f ns/edge, %zu corrupted frames rejected: OK\n",
+               signal_names[kind], frame_bytes, s->num_edges, stream.num_frames,
+               packed / (double)s->num_edges, csv_bytes / (double)s->num_edges, csv_bytes / packed,
+               encode_s * 1e9 / (double)s->num_edges, corrupted);
+    }
+
+    free(clean.first_edge);
+    free(stream.data);
+    free(stream.frame_starts);
+    free(frame);
+    return ok;
+}
+
+static bool self_check(size_t num_edges, uint64_t seed) {
+    bool ok = true;
+    for (int kind = SIGNAL_PWM; kind <= SIGNAL_BUS; kind++) {
+        signal_data_t s;
+        generate((signal_t)kind, num_edges, seed, &s);
+        ok &= check_signal((signal_t)kind, &s, PROBE_FRAME_BYTES, PROBE_SYNC_EDGES, seed);
+        ok &= check_signal((signal_t)kind, &s, EDGE_PACK_MIN_FRAME, PROBE_SYNC_EDGES, seed);
+        free(s.edges);
+        free(s.lost_before);
+    }
+    return ok;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: edge_unpack [-f csv|vcd] [FILE]\n"
+            "       edge_unpack -s [-n EDGES] [-S SEED]\n");
+}
+
+int main(int argc, char** argv) {
+    bool synthetic = false;
+    size_t num_edges = 200000;
+    uint64_t seed = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "f:sn:S:")) != -1) {
+        switch (opt) {
+            case 'f':
+                if (strcmp(optarg, "csv") != 0 && strcmp(optarg, "vcd") != 0) {
+                    usage();
+                    return 2;
+                }
+                format = strcmp(optarg, "vcd") == 0 ? FORMAT_VCD : FORMAT_CSV;
+                break;
+            case 's': synthetic = true; break;
+            case 'n': num_edges = strtoull(optarg, NULL, 0); break;
+            case 'S': seed = strtoull(optarg, NULL, 0); break;
+            default:
+                usage();
+                return 2;
+        }
+    }
+    if (optind < argc - 1 || (synthetic && (optind < argc || num_edges == 0))) {
+        usage();
+        return 2;
+    }
+
+    if (!synthetic) {
+        return unpack_file(optind < argc ? argv[optind] : "-");
+    }
+    return self_check(num_edges, seed) ? 0 : 1;
+}
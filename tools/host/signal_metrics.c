@@ -0,0 +1,377 @@
+/**
+ * @file signal_metrics.c
+ * @brief Pulse statistics of recorded probe traces on the Linux host.
+ *
+ * Runs the probe's statistics core (gpio_probe/signal_stats.c, built
+ * unchanged) in one of two ways:
+ *
+ *   - Traces: reads `timestamp_us,state` logs (probe CSV output, bench_decode
+ *     or capture_replay output) and prints the same summary rows as the
+ *     probe's STATS output, one per pin and window of the trace's own time.
+ *     A repeated `timestamp_us,state` header starts a new capture (the probe
+ *     restarted); rows in the first 48 ns of a capture hold initial levels,
+ *     and a row that changes no level counts as a dropped edge on every pin.
+ *   - Self-check (-s): generates a jittered PWM signal with isolated lost
+ *     edges, feeds it through the core and compares every window (edge and
+ *     drop counts, count/sum/min/max and histogram of high, low and period
+ *     widths) with values computed directly from the generated pulses.
+ *     Exits 1 on the first mismatch.
+ *
+ * Usage:
+ *   signal_metrics [-w WINDOW_US] [-b PIN_BASE] [-c PINS] [TRACE...]
+ *   signal_metrics -s [-f FREQ_HZ] [-d DUTY_PCT] [-j JITTER_NS] [-n PERIODS] [-S SEED]
+ *
+ *   -w WINDOW_US  Summary window (default: 1000000, as the probe)
+ *   -b PIN_BASE   GPIO of state bit 0, for the pin column (default: 2)
+ *   -c PINS       Pins in the state mask (default: 1)
+ *   -f FREQ_HZ    Self-check PWM frequency (default: 1000)
+ *   -d DUTY_PCT   Self-check duty cycle (default: 25)
+ *   -j JITTER_NS  Self-check edge jitter, uniform ± (default: 200)
+ *   -n PERIODS    Self-check length (default: 100000)
+ *   -S SEED       Self-check generator seed (default: 1)
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_data.h"
+#include "capture_decode.h"
+#include "signal_stats.h"
+
+#define TICK_HZ 1000000000u     // Traces are read in nanoseconds
+#define INITIAL_LEVEL_NS 48     // Rows this early are initial levels (two multi-pin slots)
+#define MAX_LINE 256
+
+typedef void (*window_fn)(const signal_stats_t* stats, unsigned pins, uint64_t index,
+                          uint64_t ticks, void* ctx);
+
+/**
+ * @brief Splits a stream of edges into fixed windows, one signal_stats_t per pin.
+ */
+typedef struct {
+    signal_stats_t stats[CAPTURE_MAX_PINS];
+    unsigned pins;
+    uint64_t window;
+    bool started;
+    uint64_t start;
+    uint64_t last;
+    uint64_t index;
+    uint8_t state;
+    window_fn fn;
+    void* ctx;
+} windows_t;
+
+static void windows_init(windows_t* w, unsigned pins, uint64_t window, window_fn fn, void* ctx) {
+    memset(w, 0, sizeof(*w));
+    w->pins = pins;
+    w->window = window;
+    w->fn = fn;
+    w->ctx = ctx;
+    for (unsigned i = 0; i < pins; i++) {
+        signal_stats_init(&w->stats[i]);
+    }
+}
+
+static void windows_close(windows_t* w, uint64_t ticks) {
+    w->fn(w->stats, w->pins, w->index++, ticks, w->ctx);
+    for (unsigned i = 0; i < w->pins; i++) {
+        signal_stats_next_window(&w->stats[i]);
+    }
+}
+
+/**
+ * @brief Feed the levels at `t`; the first call of a capture only sets them if `initial`.
+ */
+static void windows_edge(windows_t* w, uint64_t t, uint8_t state, bool initial) {
+    if (!w->started) {
+        w->started = true;
+        w->start = t;
+        if (initial) {
+            for (unsigned i = 0; i < w->pins; i++) {
+                signal_stats_set_level(&w->stats[i], (state >> i) & 1u);
+            }
+            w->state = state;
+            w->last = t;
+            return;
+        }
+    }
+    while (t >= w->start + w->window) {
+        windows_close(w, w->window);
+        w->start += w->window;
+    }
+    uint8_t changed = state ^ w->state;
+    if (changed == 0) {
+        changed = 0xFF;  // a row that changes nothing: the edges in between were lost
+    }
+    for (unsigned i = 0; i < w->pins; i++) {
+        if (changed & (1u << i)) {
+            signal_stats_edge(&w->stats[i], t, (state >> i) & 1u);
+        }
+    }
+    w->state = state;
+    w->last = t;
+}
+
+/**
+ * @brief Close the last, partial window.
+ */
+static void windows_finish(windows_t* w) {
+    if (w->started) {
+        windows_close(w, w->last - w->start);
+        w->started = false;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Traces
+// ----------------------------------------------------------------------------
+
+static unsigned pin_base = 2;
+
+static void print_window(const signal_stats_t* stats, unsigned pins, uint64_t index,
+                         uint64_t ticks, void* ctx) {
+    (void)index;
+    (void)ctx;
+    for (unsigned i = 0; i < pins; i++) {
+        signal_stats_write_row(stdout, &stats[i], pin_base + i, ticks, TICK_HZ);
+    }
+}
+
+static bool read_trace(const char* path, windows_t* w) {
+    FILE* in = strcmp(path, "-") == 0 ? stdin : fopen(path, "r");
+    if (!in) {
+        perror(path);
+        return false;
+    }
+    char line[MAX_LINE];
+    bool in_table = false;
+    while (fgets(line, sizeof(line), in)) {
+        if (strncmp(line, "timestamp_us,state", 18) == 0) {
+            // A new capture: timestamps start again from zero
+            windows_finish(w);
+            windows_init(w, w->pins, w->window, w->fn, w->ctx);
+            in_table = true;
+            continue;
+        }
+        char* end;
+        double us = strtod(line, &end);
+        if (!in_table || end == line || *end != ',') {
+            continue;
+        }
+        char* state_end;
+        unsigned long state = strtoul(end + 1, &state_end, 0);
+        if (state_end == end + 1 || us < 0) {
+            continue;
+        }
+        uint64_t ns = (uint64_t)llround(us * 1000.0);
+        windows_edge(w, ns, (uint8_t)state, !w->started && ns <= INITIAL_LEVEL_NS);
+    }
+    if (in != stdin) {
+        fclose(in);
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Self-check
+// ----------------------------------------------------------------------------
+
+/**
+ * @brief Expected contents of one window.
+ */
+typedef struct {
+    uint32_t edges;
+    uint32_t dropped;
+    signal_widths_t high;
+    signal_widths_t low;
+    signal_widths_t period;
+} expected_window_t;
+
+typedef struct {
+    const expected_window_t* expected;
+    uint64_t num_windows;
+    uint64_t checked;
+    bool ok;
+} check_t;
+
+static void expect_width(signal_widths_t* w, uint64_t width) {
+    w->min = w->count == 0 || width < w->min ? width : w->min;
+    w->max = width > w->max ? width : w->max;
+    w->count++;
+    w->sum += width;
+    w->hist[signal_stats_bucket(width)]++;
+}
+
+static bool same_widths(const signal_widths_t* a, const signal_widths_t* b) {
+    return a->count == b->count && a->sum == b->sum && (a->count == 0 || (a->min == b->min && a->max == b->max)) &&
+           memcmp(a->hist, b->hist, sizeof(a->hist)) == 0;
+}
+
+static void check_window(const signal_stats_t* stats, unsigned pins, uint64_t index,
+                         uint64_t ticks, void* ctx) {
+    (void)pins;
+    (void)ticks;
+    check_t* check = ctx;
+    check->checked++;
+    if (!check->ok) {
+        return;
+    }
+    if (index >= check->num_windows) {
+        fprintf(stderr, "signal_metrics: unexpected window %llu\n", (unsigned long long)index);
+        check->ok = false;
+        return;
+    }
+    const expected_window_t* e = &check->expected[index];
+    const char* field = NULL;
+    if (stats->edges != e->edges) {
+        field = "edges";
+    } else if (stats->dropped != e->dropped) {
+        field = "dropped";
+    } else if (!same_widths(&stats->high, &e->high)) {
+        field = "high widths";
+    } else if (!same_widths(&stats->low, &e->low)) {
+        field = "low widths";
+    } else if (!same_widths(&stats->period, &e->period)) {
+        field = "periods";
+    }
+    if (field) {
+        fprintf(stderr, "signal_metrics: window %llu: %s differ\n", (unsigned long long)index, field);
+        check->ok = false;
+    }
+}
+
+static bool self_check(double freq, double duty, uint32_t jitter, uint64_t periods,
+                       uint64_t window, uint64_t seed) {
+    uint64_t period = (uint64_t)llround(TICK_HZ / freq);
+    uint64_t high = (uint64_t)llround(period * duty / 100.0);
+    if (high < 2 || period - high < 2 || 2 * (uint64_t)jitter >= (high < period - high ? high : period - high)) {
+        fprintf(stderr, "signal_metrics: the jitter must be below half the shorter pulse\n");
+        return false;
+    }
+
+    // Edges from one period in (the signal starts low), isolated drops
+    size_t num_edges = 2 * periods;
+    uint64_t* t = malloc(num_edges * sizeof(uint64_t));
+    bool* kept = malloc(num_edges * sizeof(bool));
+    if (!t || !kept) {
+        fprintf(stderr, "signal_metrics: out of memory\n");
+        exit(1);
+    }
+    bench_rng_t rng;
+    bench_rng_seed(&rng, seed, 0);
+    uint64_t drops = 0;
+    for (size_t i = 0; i < num_edges; i++) {
+        uint64_t nominal = period + (i / 2) * period + (i % 2 ? high : 0);
+        t[i] = nominal + bench_rng_below(&rng, 2 * jitter + 1) - jitter;
+        kept[i] = i < 2 || !kept[i - 1] || bench_rng_below(&rng, 500) != 0;
+        drops += !kept[i];
+    }
+
+    // Expected windows, straight from the generated pulses (rises are even edges)
+    uint64_t t0 = t[0];
+    uint64_t num_windows = (t[num_edges - 1] - t0) / window + 1;
+    expected_window_t* expected = calloc(num_windows, sizeof(expected_window_t));
+    for (size_t i = 0; i < num_edges; i++) {
+        if (!kept[i]) {
+            continue;
+        }
+        expected_window_t* e = &expected[(t[i] - t0) / window];
+        if (i > 0 && !kept[i - 1]) {
+            e->dropped++;
+            continue;
+        }
+        e->edges++;
+        if (i > 0) {
+            expect_width(i % 2 ? &e->high : &e->low, t[i] - t[i - 1]);
+        }
+        if (i % 2 == 0 && i >= 2 && kept[i - 2]) {
+            expect_width(&e->period, t[i] - t[i - 2]);
+        }
+    }
+
+    check_t check = {expected, num_windows, 0, true};
+    windows_t w;
+    windows_init(&w, 1, window, check_window, &check);
+    for (size_t i = 0; i < num_edges; i++) {
+        if (kept[i]) {
+            windows_edge(&w, t[i], (uint8_t)(i % 2 == 0), false);
+        }
+    }
+    windows_finish(&w);
+    if (check.ok && check.checked != num_windows) {
+        fprintf(stderr, "signal_metrics: %llu windows, expected %llu\n",
+                (unsigned long long)check.checked, (unsigned long long)num_windows);
+        check.ok = false;
+    }
+    if (check.ok) {
+        printf("signal_metrics: %llu periods at %g Hz, %g%% duty, ±%u ns jitter, %llu dropped edges, "
+               "%llu windows: OK\n", (unsigned long long)periods, freq, duty, jitter,
+               (unsigned long long)drops, (unsigned long long)num_windows);
+    }
+    free(t);
+    free(kept);
+    free(expected);
+    return check.ok;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: signal_metrics [-w WINDOW_US] [-b PIN_BASE] [-c PINS] [TRACE...]\n"
+            "       signal_metrics -s [-f FREQ_HZ] [-d DUTY_PCT] [-j JITTER_NS] [-n PERIODS] [-S SEED]\n");
+}
+
+int main(int argc, char** argv) {
+    bool synthetic = false;
+    double window_us = 1000000.0;
+    unsigned pins = 1;
+    double freq = 1000.0;
+    double duty = 25.0;
+    uint32_t jitter = 200;
+    uint64_t periods = 100000;
+    uint64_t seed = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "w:b:c:sf:d:j:n:S:")) != -1) {
+        switch (opt) {
+            case 'w': window_us = atof(optarg); break;
+            case 'b': pin_base = (unsigned)atoi(optarg); break;
+            case 'c': pins = (unsigned)atoi(optarg); break;
+            case 's': synthetic = true; break;
+            case 'f': freq = atof(optarg); break;
+            case 'd': duty = atof(optarg); break;
+            case 'j': jitter = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'n': periods = strtoull(optarg, NULL, 0); break;
+            case 'S': seed = strtoull(optarg, NULL, 0); break;
+            default:
+                usage();
+                return 2;
+        }
+    }
+    uint64_t window = (uint64_t)llround(window_us * 1000.0);
+    if (window == 0 || pins < 1 || pins > CAPTURE_MAX_PINS || freq <= 0 || duty <= 0 || duty >= 100 ||
+        periods == 0 || (synthetic && optind < argc)) {
+        usage();
+        return 2;
+    }
+
+    if (synthetic) {
+        return self_check(freq, duty, jitter, periods, window, seed) ? 0 : 1;
+    }
+
+    windows_t w;
+    windows_init(&w, pins, window, print_window, NULL);
+    signal_stats_write_header(stdout);
+    bool ok = true;
+    if (optind == argc) {
+        ok = read_trace("-", &w);
+    }
+    for (int i = optind; i < argc; i++) {
+        ok &= read_trace(argv[i], &w);
+    }
+    windows_finish(&w);
+    return ok ? 0 : 1;
+}
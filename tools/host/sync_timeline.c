@@ -0,0 +1,737 @@
+/**
+ * @file sync_timeline.c
+ * @brief Cross-board timelines from probe traces on the Linux host.
+ *
+ * Runs the probe's clock sync estimator (gpio_probe/clock_sync.c, built
+ * unchanged) in one of three ways:
+ *
+ *   - Traces: reads `timestamp_us,state` logs (probe CSV, bench_decode,
+ *     edge_unpack or capture_replay output) in which state bit SYNC_PIN is
+ *     the bench_sync.h line, and prints them as `timestamp_us,state,main_us`:
+ *     every edge also on the main board's timeline, or an empty main_us
+ *     while unlocked. This covers the probe outputs that cannot carry the
+ *     column themselves (VCD aside). A repeated header starts a new capture
+ *     and the estimator starts again.
+ *   - Marks (-m MAIN_LOG): reads the `sync_mark,<label>,<main_us>` lines the
+ *     benchmark firmware printed (bench_sync_mark()) and, instead of the
+ *     edges, prints for each mark the first data edge (any pin but the sync
+ *     pin) at or after it on the main timeline, within one second:
+ *       label,mark_us,edge_us,probe_us,latency_us
+ *     Marks are matched on one main timeline, so the log must come from a
+ *     single sync session (`sync pin=` and clock changes restart it).
+ *   - Self-check (-s): simulates both boards. The probe's clock runs off the
+ *     main one by a constant offset plus a sinusoidal wander, the capture
+ *     quantises every edge to its sample slot with extra jitter, and the
+ *     main board starts its sync long before the capture (large frame
+ *     numbers). The disturbances are missed pulses, glitches in the low and
+ *     high times, late symbols (a main-board interrupt held off) and a sync
+ *     restart halfway. Data edges follow known main-board times by a fixed
+ *     latency. The check requires every converted edge to be within
+ *     ERROR_LIMIT_NS of its true main-board time, no edge left unconverted
+ *     while locked, a lock within LOCK_LIMIT_MS of the start and of the
+ *     restart, exactly one loss (the restart) and the drift estimate within
+ *     DRIFT_LIMIT_PPM. One scenario also goes through the CSV and mark paths
+ *     and must recover the latency of every mark. Finally, ideal pulses with
+ *     one 0 bit or marker set to the width limits (clock_sync.h) check that
+ *     a 0 bit of CLOCK_SYNC_MIN_WIDTH_US and a marker 1 ns short of
+ *     CLOCK_SYNC_MAX_WIDTH_US are read as symbols, and that 1 ns less and
+ *     CLOCK_SYNC_MAX_WIDTH_US exactly are glitches. Exits 1 on a failure.
+ *
+ * Usage:
+ *   sync_timeline [-p SYNC_PIN] [-m MAIN_LOG] [TRACE...]
+ *   sync_timeline -s [-d DRIFT_PPM] [-n SECONDS] [-S SEED]
+ *
+ *   -p SYNC_PIN   State bit of the sync line (default: 1)
+ *   -m MAIN_LOG   Match the log's sync marks to edges instead of printing edges
+ *   -d DRIFT_PPM  Self-check probe clock offset, for every scenario (default: per scenario)
+ *   -n SECONDS    Self-check capture length (default: 20)
+ *   -S SEED       Self-check generator seed (default: 1)
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_data.h"
+#include "bench_sync.h"
+#include "capture_decode.h"
+#include "clock_sync.h"
+
+#define TICK_HZ 1000000000u      // Traces are read in nanoseconds
+#define INITIAL_LEVEL_NS 48      // Rows this early are initial levels (two multi-pin slots)
+#define MARK_WINDOW_NS 1000000000 // Longest mark-to-edge distance matched
+#define MAX_LINE 256
+#define MAX_LABEL MAX_LINE  // A mark label can fill its whole main-log line
+
+#define PERIOD_NS ((int64_t)BENCH_SYNC_PERIOD_US * 1000)
+#define ERROR_LIMIT_NS 150       // Per-edge error allowed in the self-check
+#define LOCK_LIMIT_MS 2000       // Two good frames after a marker, with room for broken ones
+#define DRIFT_LIMIT_PPM 0.5
+
+// ----------------------------------------------------------------------------
+// Timeline: estimator plus the state of the other pins
+// ----------------------------------------------------------------------------
+
+typedef struct {
+    clock_sync_t sync;
+    unsigned pin;
+    uint8_t state;
+    bool started;
+    uint32_t locks;
+    uint32_t losses;
+    bool verbose;       ///< Report lock and loss on stderr
+} timeline_t;
+
+static void timeline_init(timeline_t* tl, uint32_t tick_hz, unsigned pin, bool verbose) {
+    memset(tl, 0, sizeof(*tl));
+    clock_sync_init(&tl->sync, tick_hz);
+    tl->pin = pin;
+    tl->verbose = verbose;
+}
+
+/**
+ * @brief Feed one capture record; `initial` records only set the levels.
+ *
+ * @return Bits other than the sync pin that changed (data edges).
+ */
+static uint8_t timeline_edge(timeline_t* tl, const capture_edge_t* edge, bool initial) {
+    if (!tl->started && initial) {
+        tl->started = true;
+        tl->state = edge->state;
+        tl->sync.high = edge->state >> tl->pin & 1u;  // A pulse in progress is skipped
+        return 0;
+    }
+    tl->started = true;
+    clock_sync_event_t event = clock_sync_capture_edge(&tl->sync, edge, tl->state, tl->pin);
+    if (event == CLOCK_SYNC_LOCKED) {
+        tl->locks++;
+    } else if (event == CLOCK_SYNC_LOST) {
+        tl->losses++;
+    }
+    if (event != CLOCK_SYNC_NONE && tl->verbose) {
+        fprintf(stderr, "sync_timeline: ");
+        clock_sync_write_event(stderr, &tl->sync, event);
+    }
+    uint8_t changed = (edge->state ^ tl->state) & (uint8_t)~(1u << tl->pin);
+    tl->state = edge->state;
+    return changed;
+}
+
+// ----------------------------------------------------------------------------
+// Marks
+// ----------------------------------------------------------------------------
+
+typedef struct {
+    char label[MAX_LABEL];
+    int64_t main_ns;
+    bool matched;
+    int64_t edge_ns;        ///< Main time of the matched edge
+    uint64_t probe_ns;      ///< Its probe timestamp
+} mark_t;
+
+typedef struct {
+    mark_t* marks;
+    size_t num;
+    size_t cap;
+    size_t next;            ///< First mark not yet matched or passed
+} marks_t;
+
+static void marks_add(marks_t* m, const char* label, int64_t main_ns) {
+    if (m->num == m->cap) {
+        m->cap = m->cap ? 2 * m->cap : 256;
+        m->marks = realloc(m->marks, m->cap * sizeof(mark_t));
+        if (!m->marks) {
+            fprintf(stderr, "sync_timeline: out of memory\n");
+            exit(1);
+        }
+    }
+    mark_t* mark = &m->marks[m->num++];
+    memset(mark, 0, sizeof(*mark));
+    snprintf(mark->label, sizeof(mark->label), "%s", label);
+    mark->main_ns = main_ns;
+}
+
+static int compare_marks(const void* a, const void* b) {
+    const mark_t* x = a;
+    const mark_t* y = b;
+    return x->main_ns < y->main_ns ? -1 : x->main_ns > y->main_ns;
+}
+
+/**
+ * @brief Parse a microsecond value with up to three decimals into ns.
+ */
+static bool parse_us(const char* s, char** end, int64_t* ns) {
+    double us = strtod(s, end);
+    if (*end == s) {
+        return false;
+    }
+    *ns = (int64_t)llround(us * 1000.0);
+    return true;
+}
+
+static bool read_marks(const char* path, marks_t* m) {
+    FILE* in = fopen(path, "r");
+    if (!in) {
+        perror(path);
+        return false;
+    }
+    char line[MAX_LINE];
+    while (fgets(line, sizeof(line), in)) {
+        if (strncmp(line, "sync_mark,", 10) != 0) {
+            continue;
+        }
+        char* label = line + 10;
+        char* comma = strchr(label, ',');
+        char* end;
+        int64_t ns;
+        if (!comma || !parse_us(comma + 1, &end, &ns)) {
+            continue;
+        }
+        *comma = '\0';
+        marks_add(m, label, ns);
+    }
+    fclose(in);
+    qsort(m->marks, m->num, sizeof(mark_t), compare_marks);
+    return true;
+}
+
+/**
+ * @brief Pass over the marks before `from_ns` unmatched: edges before a lock
+ *        have no main time, so the edge after such a mark may be missing.
+ */
+static void marks_skip(marks_t* m, int64_t from_ns) {
+    while (m->next < m->num && m->marks[m->next].main_ns < from_ns) {
+        m->next++;
+    }
+}
+
+/**
+ * @brief Match the marks up to a data edge at main time `edge_ns`.
+ */
+static void marks_edge(marks_t* m, int64_t edge_ns, uint64_t probe_ns) {
+    while (m->next < m->num && m->marks[m->next].main_ns <= edge_ns) {
+        mark_t* mark = &m->marks[m->next++];
+        if (edge_ns - mark->main_ns <= MARK_WINDOW_NS) {
+            mark->matched = true;
+            mark->edge_ns = edge_ns;
+            mark->probe_ns = probe_ns;
+        }
+    }
+}
+
+static void print_ns(FILE* out, int64_t ns) {
+    uint64_t m = ns < 0 ? (uint64_t)-ns : (uint64_t)ns;
+    fprintf(out, "%s%" PRIu64 ".%03u", ns < 0 ? "-" : "", m / 1000, (unsigned)(m % 1000));
+}
+
+static void print_marks(const marks_t* m) {
+    printf("label,mark_us,edge_us,probe_us,latency_us\n");
+    for (size_t i = 0; i < m->num; i++) {
+        const mark_t* mark = &m->marks[i];
+        printf("%s,", mark->label);
+        print_ns(stdout, mark->main_ns);
+        if (mark->matched) {
+            putchar(',');
+            print_ns(stdout, mark->edge_ns);
+            putchar(',');
+            print_ns(stdout, (int64_t)mark->probe_ns);
+            putchar(',');
+            print_ns(stdout, mark->edge_ns - mark->main_ns);
+        } else {
+            printf(",,,");
+        }
+        putchar('\n');
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Traces
+// ----------------------------------------------------------------------------
+
+/**
+ * @brief Convert a trace: edges to `out` (if not NULL), data edges to `marks` (if not NULL).
+ */
+static void read_trace(FILE* in, timeline_t* tl, FILE* out, marks_t* marks) {
+    char line[MAX_LINE];
+    bool in_table = false;
+    while (fgets(line, sizeof(line), in)) {
+        if (strncmp(line, "timestamp_us,state", 18) == 0) {
+            // A new capture: timestamps start again from zero
+            timeline_init(tl, TICK_HZ, tl->pin, tl->verbose);
+            if (out) {
+                clock_sync_write_csv_header(out);
+            }
+            in_table = true;
+            continue;
+        }
+        char* end;
+        int64_t ns;
+        if (!in_table || !parse_us(line, &end, &ns) || *end != ',' || ns < 0) {
+            continue;
+        }
+        char* state_end;
+        unsigned long state = strtoul(end + 1, &state_end, 0);
+        if (state_end == end + 1) {
+            continue;
+        }
+        capture_edge_t edge = { (uint64_t)ns, (uint8_t)state };
+        bool was_locked = tl->sync.locked;
+        uint8_t changed = timeline_edge(tl, &edge, ns <= INITIAL_LEVEL_NS);
+        int64_t main_ns;
+        if (marks && !was_locked && clock_sync_to_main(&tl->sync, edge.cycles, &main_ns)) {
+            marks_skip(marks, main_ns);  // Locked just now
+        }
+        if (out) {
+            clock_sync_write_csv_edge(out, &tl->sync, &edge, TICK_HZ);
+        }
+        if (marks && changed && clock_sync_to_main(&tl->sync, edge.cycles, &main_ns)) {
+            marks_edge(marks, main_ns, edge.cycles);
+        }
+    }
+}
+
+static bool read_trace_file(const char* path, timeline_t* tl, FILE* out, marks_t* marks) {
+    FILE* in = strcmp(path, "-") == 0 ? stdin : fopen(path, "r");
+    if (!in) {
+        perror(path);
+        return false;
+    }
+    read_trace(in, tl, out, marks);
+    if (in != stdin) {
+        fclose(in);
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Self-check
+// ----------------------------------------------------------------------------
+
+#define SIM_SYNC_PIN 1
+#define SIM_DATA_PIN 0
+#define SIM_LATENCY_NS 2345      // Main-board action to data edge
+
+typedef struct {
+    const char* name;
+    uint32_t probe_hz;
+    unsigned slot;              ///< Capture sample slot in cycles
+    double drift_ppm;           ///< Probe clock offset from main (+ = fast)
+    double wander_ppm;          ///< Amplitude of the sinusoidal drift on top
+    double wander_s;            ///< ... and its period
+    uint32_t jitter_ns;         ///< Uniform ± on every edge
+    bool disturb;               ///< Missed pulses, glitches, late symbols and a restart
+} scenario_t;
+
+static const scenario_t scenarios[] = {
+    { "steady",  125000000, 6,  35.0, 0.0,  0.0, 10, false },
+    { "wander",  125000000, 6, -80.0, 2.0, 60.0, 20, true },
+    { "fast",    200000000, 6, 150.0, 5.0, 40.0, 20, true },
+    { "1-pin",   133000000, 2, -20.0, 1.0, 30.0, 10, true },
+};
+
+#define NUM_SCENARIOS (sizeof(scenarios) / sizeof(scenarios[0]))
+
+typedef enum { SIM_SYNC_RISE, SIM_SYNC_FALL, SIM_DATA } sim_kind_t;
+
+/**
+ * @brief One simulated level change, in main-board time of the first sync session.
+ */
+typedef struct {
+    double t;                   ///< ns, main clock
+    sim_kind_t kind;
+    int64_t main_ns;            ///< Data: true main timeline value (session of the edge)
+    int64_t mark_ns;            ///< Data: the main-board action it follows
+    bool excluded;              ///< Data: between a restart and its detection
+    bool first_session;
+} sim_event_t;
+
+typedef struct {
+    sim_event_t* events;
+    size_t num;
+    size_t cap;
+} sim_t;
+
+static void sim_add(sim_t* sim, double t, sim_kind_t kind) {
+    if (sim->num == sim->cap) {
+        sim->cap = sim->cap ? 2 * sim->cap : 4096;
+        sim->events = realloc(sim->events, sim->cap * sizeof(sim_event_t));
+        if (!sim->events) {
+            fprintf(stderr, "sync_timeline: out of memory\n");
+            exit(1);
+        }
+    }
+    sim_event_t* e = &sim->events[sim->num++];
+    memset(e, 0, sizeof(*e));
+    e->t = t;
+    e->kind = kind;
+}
+
+static int compare_events(const void* a, const void* b) {
+    const sim_event_t* x = a;
+    const sim_event_t* y = b;
+    return x->t < y->t ? -1 : x->t > y->t;
+}
+
+/**
+ * @brief High time the main board sends for pulse k (bench_sync.h).
+ */
+static double sim_width_ns(uint64_t k) {
+    uint32_t j = (uint32_t)(k % BENCH_SYNC_FRAME_PULSES);
+    uint32_t us = j == 0 ? BENCH_SYNC_MARKER_US
+                : (k / BENCH_SYNC_FRAME_PULSES) >> (j - 1) & 1u ? BENCH_SYNC_ONE_US
+                : BENCH_SYNC_ZERO_US;
+    return us * 1000.0;
+}
+
+static double sim_uniform(bench_rng_t* rng, double lo, double hi) {
+    return lo + (hi - lo) * (bench_rng_next(rng) / 4294967296.0);
+}
+
+/**
+ * @brief Pulses of one sync session from pulse `k` at `t`, while before `until`.
+ */
+static void sim_pulses(sim_t* sim, bench_rng_t* rng, const scenario_t* sc, uint64_t k, double t,
+                       double from, double until, uint32_t* counts) {
+    for (; t < until; k++, t += PERIOD_NS) {
+        if (t < from) {
+            continue;
+        }
+        // A late interrupt leaves the previous pulse's width in place
+        bool late = sc->disturb && k > 0 && bench_rng_below(rng, 1000) == 0;
+        double width = sim_width_ns(late ? k - 1 : k);
+        counts[2] += late && width != sim_width_ns(k);
+        if (sc->disturb && bench_rng_below(rng, 500) == 0) {
+            counts[0]++;  // Missed pulse
+            continue;
+        }
+        sim_add(sim, t, SIM_SYNC_RISE);
+        if (sc->disturb && bench_rng_below(rng, 1000) == 0) {
+            // Dip inside the high time
+            double dip = t + sim_uniform(rng, 100e3, width - 100e3);
+            sim_add(sim, dip, SIM_SYNC_FALL);
+            sim_add(sim, dip + sim_uniform(rng, 1e3, 5e3), SIM_SYNC_RISE);
+            counts[1]++;
+        }
+        sim_add(sim, t + width, SIM_SYNC_FALL);
+        if (sc->disturb && bench_rng_below(rng, 100) == 0) {
+            // Glitch in the low time
+            double g = t + sim_uniform(rng, 5e6, 9e6);
+            sim_add(sim, g, SIM_SYNC_RISE);
+            sim_add(sim, g + sim_uniform(rng, 1e3, 100e3), SIM_SYNC_FALL);
+            counts[1]++;
+        }
+    }
+}
+
+/**
+ * @brief Probe clk_sys cycles at main time `u` after the capture start.
+ */
+static double sim_probe_cycles(const scenario_t* sc, double drift_ppm, double u) {
+    double ns = u * (1.0 + drift_ppm * 1e-6);
+    if (sc->wander_ppm != 0) {
+        double period = sc->wander_s * 1e9;
+        ns += sc->wander_ppm * 1e-6 * period / (2 * M_PI) * (1.0 - cos(2 * M_PI * u / period));
+    }
+    return ns * sc->probe_hz / 1e9;
+}
+
+typedef struct {
+    capture_edge_t edge;
+    int32_t data;               ///< Event index of a data edge in this record, or -1
+} sim_record_t;
+
+static bool run_scenario(const scenario_t* sc, double drift_ppm, double seconds, uint64_t seed,
+                         bool through_csv) {
+    bench_rng_t rng;
+    bench_rng_seed(&rng, seed, (uint64_t)(sc - scenarios));
+
+    // Main board: sync started long ago, the capture starts at a random phase
+    uint64_t k0 = 1234567u * BENCH_SYNC_FRAME_PULSES + bench_rng_below(&rng, BENCH_SYNC_FRAME_PULSES);
+    double start = (double)k0 * PERIOD_NS + sim_uniform(&rng, 0, PERIOD_NS);
+    double end = start + seconds * 1e9;
+    double restart = end + 1;  // Never, unless disturbed
+    if (sc->disturb) {
+        // Between two pulses, after every width has ended
+        restart = floor((start + (end - start) * 0.55) / PERIOD_NS) * PERIOD_NS + 7.5e6;
+    }
+
+    sim_t sim = { NULL, 0, 0 };
+    uint32_t counts[3] = { 0, 0, 0 };  // Missed pulses, glitches, late symbols
+    sim_pulses(&sim, &rng, sc, k0, (double)k0 * PERIOD_NS, start, fmin(restart, end), counts);
+    if (restart < end) {
+        sim_pulses(&sim, &rng, sc, 0, restart, start, end, counts);
+    }
+    for (double t = start + 1e6; t < end; t += sim_uniform(&rng, 200e3, 1800e3)) {
+        double edge_t = t + SIM_LATENCY_NS;
+        sim_add(&sim, edge_t, SIM_DATA);
+        sim_event_t* e = &sim.events[sim.num - 1];
+        e->first_session = edge_t < restart;
+        double origin = e->first_session ? 0 : restart;
+        e->mark_ns = (int64_t)llround(t - origin);
+        e->main_ns = (int64_t)llround(edge_t - origin);
+        e->excluded = !e->first_session && edge_t < restart + 2 * PERIOD_NS;
+    }
+    qsort(sim.events, sim.num, sizeof(sim_event_t), compare_events);
+
+    // Probe: quantise to sample slots; edges in one slot share a record
+    sim_record_t* records = malloc((sim.num + 1) * sizeof(sim_record_t));
+    if (!records) {
+        fprintf(stderr, "sync_timeline: out of memory\n");
+        exit(1);
+    }
+    size_t num_records = 1;
+    records[0].edge.cycles = 0;  // Initial levels, both low
+    records[0].edge.state = 0;
+    records[0].data = -1;
+    uint8_t state = 0;
+    for (size_t i = 0; i < sim.num; i++) {
+        const sim_event_t* e = &sim.events[i];
+        double u = e->t - start + sim_uniform(&rng, -(double)sc->jitter_ns, sc->jitter_ns);
+        uint64_t cycles = (uint64_t)ceil(sim_probe_cycles(sc, drift_ppm, u) / sc->slot) * sc->slot;
+        if (cycles <= records[num_records - 1].edge.cycles) {
+            cycles = records[num_records - 1].edge.cycles + sc->slot;
+        }
+        if (e->kind == SIM_DATA) {
+            state ^= 1u << SIM_DATA_PIN;
+        } else {
+            state = e->kind == SIM_SYNC_RISE ? state | 1u << SIM_SYNC_PIN
+                                             : state & ~(1u << SIM_SYNC_PIN);
+        }
+        sim_record_t* r = &records[num_records++];
+        r->edge.cycles = cycles;
+        r->edge.state = state;
+        r->data = e->kind == SIM_DATA ? (int32_t)i : -1;
+    }
+
+    // Estimate and compare every data edge with its true main time
+    timeline_t tl;
+    timeline_init(&tl, sc->probe_hz, SIM_SYNC_PIN, false);
+    bool ok = true;
+    double first_lock = -1, relock = -1;
+    uint64_t checked = 0, excluded = 0, unlocked = 0, missing = 0;
+    double max_error = 0, sum_sq = 0, sum_latency = 0;
+    for (size_t i = 0; i < num_records; i++) {
+        const sim_record_t* r = &records[i];
+        uint32_t losses = tl.losses;
+        uint32_t locks = tl.locks;
+        timeline_edge(&tl, &r->edge, i == 0);
+        double t = (double)r->edge.cycles / sc->probe_hz;
+        if (tl.locks != locks) {
+            if (first_lock < 0) {
+                first_lock = t;
+            } else if (relock < 0) {
+                relock = t;
+            }
+        }
+        if (tl.losses != losses) {
+            relock = -1;
+        }
+        if (r->data < 0) {
+            continue;
+        }
+        const sim_event_t* e = &sim.events[r->data];
+        int64_t main_ns;
+        bool converted = clock_sync_to_main(&tl.sync, r->edge.cycles, &main_ns);
+        if (e->excluded) {
+            excluded++;
+        } else if (!converted) {
+            unlocked++;
+            missing += tl.sync.locked;
+        } else {
+            double error = (double)(main_ns - e->main_ns);
+            max_error = fmax(max_error, fabs(error));
+            sum_sq += error * error;
+            sum_latency += (double)(main_ns - e->mark_ns);
+            checked++;
+        }
+    }
+
+    double restart_s = (restart - start) / 1e9;
+    double rms = checked ? sqrt(sum_sq / checked) : 0;
+    double u_end = end - start;
+    double true_drift = drift_ppm
+                      + (sc->wander_ppm != 0 ? sc->wander_ppm * sin(2 * M_PI * u_end / (sc->wander_s * 1e9)) : 0);
+    const char* failure = NULL;
+    if (first_lock < 0 || first_lock * 1000 > LOCK_LIMIT_MS) {
+        failure = "no lock in time";
+    } else if (restart < end && (relock < 0 || (relock - restart_s) * 1000 > LOCK_LIMIT_MS)) {
+        failure = "no relock in time after the restart";
+    } else if (tl.losses != (restart < end ? 1u : 0u)) {
+        failure = "unexpected number of losses";
+    } else if (max_error > ERROR_LIMIT_NS) {
+        failure = "edge error above the limit";
+    } else if (missing) {
+        failure = "edges left unconverted while locked";
+    } else if (!tl.sync.locked || fabs(tl.sync.drift_ppm - true_drift) > DRIFT_LIMIT_PPM) {
+        failure = "drift estimate off";
+    }
+
+    printf("sync_timeline: %-6s %+8.3f ppm (estimated %+8.3f), lock %.2f s", sc->name, true_drift,
+           tl.sync.drift_ppm, first_lock);
+    if (restart < end) {
+        printf(", relock %.2f s after restart", relock - restart_s);
+    }
+    printf(", %lu pulses, %u missed, %lu glitches, %u late symbols, %llu edges "
+           "(%llu before lock, %llu at restart), error max %.0f ns rms %.1f ns, latency %.1f ns: %s\n",
+           (unsigned long)tl.sync.pulses, counts[0], (unsigned long)tl.sync.glitches, counts[2],
+           (unsigned long long)checked, (unsigned long long)unlocked, (unsigned long long)excluded,
+           max_error, rms, checked ? sum_latency / checked : 0, failure ? failure : "OK");
+    ok = failure == NULL;
+
+    if (ok && through_csv) {
+        // Same capture as probe CSV plus a main log of marks, through the CLI paths
+        FILE* trace = tmpfile();
+        if (!trace) {
+            perror("tmpfile");
+            exit(1);
+        }
+        fprintf(trace, "GPIO Probe Ready (GPIO2 x2, %lu Hz)\n", (unsigned long)sc->probe_hz);
+        capture_write_csv_header(trace);
+        for (size_t i = 0; i < num_records; i++) {
+            capture_write_csv_edge(trace, &records[i].edge, sc->probe_hz);
+        }
+        rewind(trace);
+
+        marks_t marks = { NULL, 0, 0, 0 };
+        char label[MAX_LABEL];
+        for (size_t i = 0; i < sim.num; i++) {
+            if (sim.events[i].kind == SIM_DATA && sim.events[i].first_session) {
+                snprintf(label, sizeof(label), "edge%zu", i);
+                marks_add(&marks, label, sim.events[i].mark_ns);
+            }
+        }
+        timeline_init(&tl, TICK_HZ, SIM_SYNC_PIN, false);
+        read_trace(trace, &tl, NULL, &marks);
+        fclose(trace);
+
+        // Every mark after the lock must find its own edge
+        size_t matched = 0, expected = 0;
+        double worst = 0;
+        for (size_t i = 0; i < marks.num; i++) {
+            const mark_t* mark = &marks.marks[i];
+            expected += mark->main_ns > start + first_lock * 1e9 + PERIOD_NS;
+            if (mark->matched) {
+                matched++;
+                worst = fmax(worst, fabs((double)(mark->edge_ns - mark->main_ns) - SIM_LATENCY_NS));
+            }
+        }
+        ok = matched >= expected && worst <= ERROR_LIMIT_NS;
+        printf("sync_timeline: %-6s CSV and marks: %zu of %zu marks matched, latency error max %.0f ns: %s\n",
+               sc->name, matched, marks.num, worst, ok ? "OK" : "FAILED");
+        free(marks.marks);
+    }
+
+    free(records);
+    free(sim.events);
+    return ok;
+}
+
+/**
+ * @brief Feed four frames of ideal pulses with pulse `changed` `width_ns` high.
+ *
+ * @return true if the estimator ends locked with no bad symbols and
+ *         `glitches` glitches.
+ */
+static bool boundary_case(uint64_t k0, uint64_t changed, uint64_t width_ns, uint32_t glitches) {
+    clock_sync_t cs;
+    clock_sync_init(&cs, TICK_HZ);
+    for (uint64_t k = k0; k < k0 + 4 * BENCH_SYNC_FRAME_PULSES; k++) {
+        uint64_t t = (k - k0 + 1) * PERIOD_NS;
+        clock_sync_edge(&cs, t, true);
+        clock_sync_edge(&cs, t + (k == changed ? width_ns : (uint64_t)sim_width_ns(k)), false);
+    }
+    return cs.locked && cs.glitches == glitches && cs.bad_symbols == 0;
+}
+
+/**
+ * @brief Pulses exactly at the width limits between a symbol and a glitch.
+ */
+static bool check_width_limits(void) {
+    uint64_t k0 = 1234567u * BENCH_SYNC_FRAME_PULSES;
+    uint64_t marker = k0 + 2 * BENCH_SYNC_FRAME_PULSES;
+    uint64_t zero = marker + 1;
+    while (sim_width_ns(zero) != BENCH_SYNC_ZERO_US * 1000.0) {
+        zero++;
+    }
+    uint64_t min_ns = CLOCK_SYNC_MIN_WIDTH_US * 1000u;
+    uint64_t max_ns = CLOCK_SYNC_MAX_WIDTH_US * 1000u;
+
+    bool ok = boundary_case(k0, zero, min_ns, 0) && boundary_case(k0, zero, min_ns - 1, 1) &&
+              boundary_case(k0, marker, max_ns - 1, 0) && boundary_case(k0, marker, max_ns, 1);
+    printf("sync_timeline: width limits %u and %u us: %s\n", CLOCK_SYNC_MIN_WIDTH_US,
+           CLOCK_SYNC_MAX_WIDTH_US, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+static bool self_check(bool have_drift, double drift_ppm, double seconds, uint64_t seed) {
+    bool ok = true;
+    for (size_t i = 0; i < NUM_SCENARIOS; i++) {
+        const scenario_t* sc = &scenarios[i];
+        ok &= run_scenario(sc, have_drift ? drift_ppm : sc->drift_ppm, seconds, seed, i == 0);
+    }
+    return check_width_limits() && ok;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: sync_timeline [-p SYNC_PIN] [-m MAIN_LOG] [TRACE...]\n"
+            "       sync_timeline -s [-d DRIFT_PPM] [-n SECONDS] [-S SEED]\n");
+}
+
+int main(int argc, char** argv) {
+    bool synthetic = false;
+    unsigned pin = 1;
+    const char* main_log = NULL;
+    bool have_drift = false;
+    double drift_ppm = 0;
+    double seconds = 20;
+    uint64_t seed = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "p:m:sd:n:S:")) != -1) {
+        switch (opt) {
+            case 'p': pin = (unsigned)atoi(optarg); break;
+            case 'm': main_log = optarg; break;
+            case 's': synthetic = true; break;
+            case 'd': have_drift = true; drift_ppm = atof(optarg); break;
+            case 'n': seconds = atof(optarg); break;
+            case 'S': seed = strtoull(optarg, NULL, 0); break;
+            default:
+                usage();
+                return 2;
+        }
+    }
+    if (pin >= CAPTURE_MAX_PINS || seconds < 5 || fabs(drift_ppm) > 1000 ||
+        (synthetic && (optind < argc || main_log))) {
+        usage();
+        return 2;
+    }
+
+    if (synthetic) {
+        return self_check(have_drift, drift_ppm, seconds, seed) ? 0 : 1;
+    }
+
+    marks_t marks = { NULL, 0, 0, 0 };
+    if (main_log && !read_marks(main_log, &marks)) {
+        return 1;
+    }
+    timeline_t tl;
+    timeline_init(&tl, TICK_HZ, pin, true);
+    FILE* out = main_log ? NULL : stdout;
+    bool ok = true;
+    if (optind == argc) {
+        ok = read_trace_file("-", &tl, out, main_log ? &marks : NULL);
+    }
+    for (int i = optind; i < argc; i++) {
+        ok &= read_trace_file(argv[i], &tl, out, main_log ? &marks : NULL);
+    }
+    if (main_log) {
+        print_marks(&marks);
+        free(marks.marks);
+    }
+    return ok ? 0 : 1;
+}
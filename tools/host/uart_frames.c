@@ -0,0 +1,785 @@
+/**
+ * @file uart_frames.c
+ * @brief UART framing and statistics of recorded traces on the Linux host.
+ *
+ * Runs the UART logger's framer (uart_logger/uart_frame.c, built unchanged)
+ * in one of two ways:
+ *
+ *   - Traces: decodes 8N1 characters from a probe trace of the TX line
+ *     (`timestamp_us,state` CSV from the probe, bench_decode or
+ *     edge_unpack), with framing errors and breaks, and prints the same
+ *     frame rows as the logger's FRAMES output, or with -w its STATS rows.
+ *     Each byte is stamped at the middle of its stop bit, so this is a
+ *     reference for what the logger reports. A repeated header starts a new
+ *     capture.
+ *   - Self-check (-s): simulates the logger's main loop against a sender.
+ *     The DMA ring, polls at random intervals, USB stalls that overflow the
+ *     ring, and receive errors are all modelled. Three scenarios: text lines
+ *     at 115200 baud, idle-separated binary packets at 3 Mbaud, and
+ *     continuous lines with overflows at 6 Mbaud. Every frame (bytes, end
+ *     reason, errors, lost bytes before it) must match the frames computed
+ *     from the sent bytes. Its first and last stamps must not be early and,
+ *     if their poll drained the ring, not later than the poll interval they
+ *     arrived in. The window totals must match too. A trace stage then
+ *     encodes characters with errors and bit-time jitter as edges, and
+ *     checks that the decoder recovers every byte and its stop-bit time.
+ *     Exits 1 on a failure.
+ *
+ * Usage:
+ *   uart_frames [-b BAUD] [-p PIN] [-d DELIM|none] [-i IDLE_US] [-w WINDOW_US] [TRACE...]
+ *   uart_frames -s [-S SEED]
+ *
+ *   -b BAUD       Baud rate of the trace (default: 115200)
+ *   -p PIN        State bit of the TX line (default: 0)
+ *   -d DELIM      Frame end byte, a number or `none` (default: 10, newline)
+ *   -i IDLE_US    Silence that ends a frame, 0 for none (default: 1000)
+ *   -w WINDOW_US  Print statistics per window instead of frames
+ *   -S SEED       Self-check generator seed (default: 1)
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_data.h"
+#include "uart_frame.h"
+
+#define TICK_HZ 1000000000u     // Traces are read in nanoseconds
+#define INITIAL_LEVEL_NS 48     // Rows this early are initial levels (two multi-pin slots)
+#define MAX_LINE 256
+#define READ_WORDS 256          // Words per poll, as the logger
+#define HALF_RING (8192 / 2)    // UART_RX_RING_WORDS / 2
+
+// ----------------------------------------------------------------------------
+// 8N1 decoder
+// ----------------------------------------------------------------------------
+
+typedef void (*char_fn)(uint64_t arrival, uint16_t word, void* ctx);
+
+/**
+ * @brief Samples a line at bit centres from its edges, like the UART does.
+ */
+typedef struct {
+    double bit_ns;
+    bool level;
+    bool in_char;
+    double start;        ///< Falling edge of the start bit
+    int next_sample;     ///< 0 start bit, 1-8 data bits, 9 stop bit
+    uint16_t word;
+    char_fn fn;
+    void* ctx;
+} decoder_t;
+
+static void decoder_init(decoder_t* d, uint32_t baud, char_fn fn, void* ctx) {
+    memset(d, 0, sizeof(*d));
+    d->bit_ns = 1e9 / baud;
+    d->level = true;
+    d->fn = fn;
+    d->ctx = ctx;
+}
+
+/**
+ * @brief Take the samples due before `t` at the current level.
+ */
+static void decoder_advance(decoder_t* d, double t) {
+    while (d->in_char) {
+        double sample = d->start + (d->next_sample + 0.5) * d->bit_ns;
+        if (sample >= t) {
+            return;
+        }
+        int k = d->next_sample++;
+        if (k == 0) {
+            d->in_char = !d->level;  // A start bit must still be low at its middle
+        } else if (k <= 8) {
+            d->word |= (uint16_t)(d->level << (k - 1));
+        } else {
+            if (!d->level) {
+                d->word |= (d->word & 0xFFu) ? UART_FRAME_FE : UART_FRAME_FE | UART_FRAME_BE;
+            }
+            d->in_char = false;
+            d->fn((uint64_t)llround(sample), d->word, d->ctx);
+        }
+    }
+}
+
+static void decoder_edge(decoder_t* d, double t, bool level) {
+    decoder_advance(d, t);
+    if (!d->in_char && d->level && !level) {
+        d->in_char = true;
+        d->start = t;
+        d->next_sample = 0;
+        d->word = 0;
+    }
+    d->level = level;
+}
+
+// ----------------------------------------------------------------------------
+// Traces
+// ----------------------------------------------------------------------------
+
+/**
+ * @brief Framer fed with decoded characters, with optional statistics windows.
+ */
+typedef struct {
+    uart_framer_t framer;
+    decoder_t decoder;
+    uint64_t window;        ///< 0: print frames
+    bool started;
+    uint64_t window_start;
+    uint64_t last;
+} trace_t;
+
+static void print_frame(const uart_frame_t* frame, void* ctx) {
+    (void)ctx;
+    uart_frame_write_csv(stdout, frame, TICK_HZ);
+}
+
+static void ignore_frame(const uart_frame_t* frame, void* ctx) {
+    (void)frame;
+    (void)ctx;
+}
+
+static void trace_char(uint64_t arrival, uint16_t word, void* ctx) {
+    trace_t* tr = ctx;
+    if (tr->window) {
+        if (!tr->started) {
+            tr->started = true;
+            tr->window_start = arrival;
+        }
+        while (arrival >= tr->window_start + tr->window) {
+            uart_stats_write_row(stdout, &tr->framer.stats, tr->window, TICK_HZ, tr->framer.baud);
+            uart_framer_next_window(&tr->framer);
+            tr->window_start += tr->window;
+        }
+    }
+    uart_framer_receive(&tr->framer, arrival, &word, 1);
+    tr->last = arrival;
+}
+
+/**
+ * @brief End a capture: the open frame, and the last partial window.
+ */
+static void trace_finish(trace_t* tr) {
+    uart_framer_flush(&tr->framer);
+    if (tr->window && tr->started) {
+        uart_stats_write_row(stdout, &tr->framer.stats, tr->last - tr->window_start, TICK_HZ,
+                             tr->framer.baud);
+    }
+}
+
+static void trace_init(trace_t* tr, uint32_t baud, int delimiter, uint64_t idle, uint64_t window) {
+    memset(tr, 0, sizeof(*tr));
+    tr->window = window;
+    uart_framer_init(&tr->framer, TICK_HZ, baud, delimiter, idle, window ? ignore_frame : print_frame,
+                     NULL);
+    decoder_init(&tr->decoder, baud, trace_char, tr);
+}
+
+static bool read_trace(const char* path, trace_t* tr, unsigned pin) {
+    FILE* in = strcmp(path, "-") == 0 ? stdin : fopen(path, "r");
+    if (!in) {
+        perror(path);
+        return false;
+    }
+    char line[MAX_LINE];
+    bool in_table = false;
+    bool first = true;
+    while (fgets(line, sizeof(line), in)) {
+        if (strncmp(line, "timestamp_us,state", 18) == 0) {
+            // A new capture: timestamps start again from zero
+            if (in_table) {
+                trace_finish(tr);
+                trace_init(tr, tr->framer.baud, tr->framer.delimiter, tr->framer.idle_ticks, tr->window);
+            }
+            in_table = true;
+            first = true;
+            continue;
+        }
+        char* end;
+        double us = strtod(line, &end);
+        if (!in_table || end == line || *end != ',') {
+            continue;
+        }
+        char* state_end;
+        unsigned long state = strtoul(end + 1, &state_end, 0);
+        if (state_end == end + 1 || us < 0) {
+            continue;
+        }
+        double ns = us * 1000.0;
+        bool level = (state >> pin) & 1u;
+        if (first && ns <= INITIAL_LEVEL_NS) {
+            tr->decoder.level = level;
+        } else {
+            decoder_edge(&tr->decoder, ns, level);
+        }
+        first = false;
+    }
+    decoder_advance(&tr->decoder, INFINITY);  // A character cut off by the end is dropped
+    if (in != stdin) {
+        fclose(in);
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Self-check: the logger's main loop against a simulated sender
+// ----------------------------------------------------------------------------
+
+typedef struct {
+    const char* name;
+    uint32_t baud;
+    int delimiter;
+    uint32_t idle_us;          ///< Framer idle end (0: none)
+    bool text;                 ///< Printable lines ending in the delimiter, else binary packets
+    uint32_t max_length;       ///< Lines or packets of 1..max_length bytes
+    uint32_t pause_every;      ///< A pause inside a frame every ~n bytes (0: none)
+    uint32_t pause_max_us;
+    uint32_t gap_min_us;       ///< Silence between frames, half of them back-to-back (0: never silent)
+    uint32_t gap_max_us;
+    uint32_t poll_max_ns;      ///< Polls every 1..poll_max_ns
+    uint32_t stall_min_ms;     ///< USB stalls (0: none)
+    uint32_t stall_max_ms;
+    double seconds;
+} scenario_t;
+
+static const scenario_t scenarios[] = {
+    {"lines",    115200,  '\n', 1000, true,  400,  100, 400,  2000, 20000, 200000, 0, 0,  20},
+    {"packets",  3000000, UART_FRAME_NO_DELIMITER, 100, false, 600, 200, 40, 250, 2000, 25000, 0, 0, 2},
+    {"overflow", 6000000, '\n', 0,    true,  200,  0,   0,    0,    0,     10000,  2, 25, 2},
+};
+
+/**
+ * @brief Sent bytes: true arrival (end of the character), word with error flags.
+ */
+typedef struct {
+    uint64_t* t;
+    uint16_t* word;
+    size_t count;
+    size_t cap;
+} sent_t;
+
+static void sent_add(sent_t* s, uint64_t t, uint16_t word) {
+    if (s->count == s->cap) {
+        s->cap = s->cap ? 2 * s->cap : 65536;
+        s->t = realloc(s->t, s->cap * sizeof(uint64_t));
+        s->word = realloc(s->word, s->cap * sizeof(uint16_t));
+        if (!s->t || !s->word) {
+            fprintf(stderr, "uart_frames: out of memory\n");
+            exit(1);
+        }
+    }
+    s->t[s->count] = t;
+    s->word[s->count] = word;
+    s->count++;
+}
+
+static double uniform(bench_rng_t* rng, double lo, double hi) {
+    return lo + (hi - lo) * (bench_rng_next(rng) / 4294967296.0);
+}
+
+/**
+ * @brief A received byte with some receive errors: framing, parity, overrun, break.
+ */
+static uint16_t with_errors(bench_rng_t* rng, uint8_t c) {
+    uint16_t word = c;
+    if (bench_rng_below(rng, 20000) == 0) {
+        return UART_FRAME_BE | UART_FRAME_FE;  // A break reads as 0 with both flags
+    }
+    if (bench_rng_below(rng, 3000) == 0) {
+        word |= UART_FRAME_FE;
+    }
+    if (bench_rng_below(rng, 5000) == 0) {
+        word |= UART_FRAME_PE;
+    }
+    if (bench_rng_below(rng, 8000) == 0) {
+        word |= UART_FRAME_OE;
+    }
+    return word;
+}
+
+/**
+ * @brief Generate the sender's bytes. Arrival times are rounded up to whole
+ * ns, so consecutive characters stay at least the framer's char_ticks apart.
+ */
+static void send(const scenario_t* sc, bench_rng_t* rng, sent_t* s) {
+    double char_ns = 1e9 * UART_FRAME_BITS_PER_CHAR / sc->baud;
+    double t = 1e6;
+    while (t < sc->seconds * 1e9) {
+        uint32_t length = 1 + bench_rng_below(rng, sc->max_length);
+        for (uint32_t i = 0; i < length; i++) {
+            uint8_t c;
+            if (sc->text) {
+                c = i + 1 == length ? (uint8_t)sc->delimiter : (uint8_t)(' ' + bench_rng_below(rng, 95));
+            } else {
+                c = (uint8_t)bench_rng_next(rng);
+            }
+            if (i > 0 && sc->pause_every && bench_rng_below(rng, sc->pause_every) == 0) {
+                t += uniform(rng, 1e3, sc->pause_max_us * 1e3);
+            }
+            t += char_ns;
+            uint16_t word = with_errors(rng, c);
+            if (sc->text && c == sc->delimiter) {
+                word = c;  // Keep line ends intact, so the frames are the lines
+            }
+            sent_add(s, (uint64_t)ceil(t), word);
+        }
+        if (sc->gap_max_us && bench_rng_below(rng, 2) == 0) {
+            t += uniform(rng, sc->gap_min_us * 1e3, sc->gap_max_us * 1e3);
+        }
+    }
+}
+
+/**
+ * @brief A frame as the framer reported it.
+ */
+typedef struct {
+    uint64_t start;
+    uint64_t end;
+    uint32_t length;
+    uint32_t lost;
+    uint16_t errors;
+    uart_frame_end_t reason;
+    size_t data;             ///< Offset in the data buffer
+} got_frame_t;
+
+typedef struct {
+    got_frame_t* frames;
+    size_t count;
+    size_t cap;
+    uint8_t* data;
+    size_t data_count;
+    size_t data_cap;
+} got_t;
+
+static void collect_frame(const uart_frame_t* frame, void* ctx) {
+    got_t* g = ctx;
+    if (g->count == g->cap) {
+        g->cap = g->cap ? 2 * g->cap : 4096;
+        g->frames = realloc(g->frames, g->cap * sizeof(got_frame_t));
+    }
+    while (g->data_count + frame->length > g->data_cap) {
+        g->data_cap = g->data_cap ? 2 * g->data_cap : 65536;
+        g->data = realloc(g->data, g->data_cap);
+    }
+    if (!g->frames || !g->data) {
+        fprintf(stderr, "uart_frames: out of memory\n");
+        exit(1);
+    }
+    got_frame_t* f = &g->frames[g->count++];
+    f->start = frame->start;
+    f->end = frame->end;
+    f->length = frame->length;
+    f->lost = frame->lost;
+    f->errors = frame->errors;
+    f->reason = frame->reason;
+    f->data = g->data_count;
+    memcpy(g->data + g->data_count, frame->data, frame->length);
+    g->data_count += frame->length;
+}
+
+/**
+ * @brief What the logger's loop delivered for one sent byte.
+ */
+typedef struct {
+    bool delivered;
+    uint32_t lost_before;    ///< Bytes skipped right before it
+    bool bounded;            ///< Arrived after the previous poll and its poll drained the ring
+    uint64_t poll;           ///< Its poll
+    uint64_t previous_poll;
+} delivery_t;
+
+/**
+ * @brief Run the logger's loop: polls, ring overflows and resyncs, reads of up to READ_WORDS.
+ *
+ * @return Total bytes lost
+ */
+static uint64_t run_logger(const scenario_t* sc, bench_rng_t* rng, const sent_t* s,
+                           uart_framer_t* framer, delivery_t* d) {
+    uint64_t now = 0, previous = 0;
+    uint64_t next_stall = sc->stall_min_ms ? (uint64_t)uniform(rng, 20e6, 80e6) : UINT64_MAX;
+    size_t written = 0, read = 0;
+    uint64_t lost = 0;
+    uint32_t pending = 0;
+    while (read < s->count) {
+        previous = now;
+        now += 1 + bench_rng_below(rng, sc->poll_max_ns);
+        if (now >= next_stall) {
+            now += (uint64_t)uniform(rng, sc->stall_min_ms * 1e6, sc->stall_max_ms * 1e6);  // USB blocked
+            next_stall = now + (uint64_t)uniform(rng, 20e6, 80e6);
+        }
+        while (written < s->count && s->t[written] <= now) {
+            written++;
+        }
+        if (written - read > 2 * HALF_RING) {
+            uint32_t skipped = (uint32_t)(written - HALF_RING - read);
+            uart_framer_lost(framer, skipped);
+            read += skipped;
+            lost += skipped;
+            pending += skipped;
+        }
+        size_t n = written - read < READ_WORDS ? written - read : READ_WORDS;
+        bool drained = n == written - read;
+        for (size_t i = read; i < read + n; i++) {
+            d[i].delivered = true;
+            d[i].lost_before = i == read ? pending : 0;
+            d[i].bounded = drained && s->t[i] > previous;
+            d[i].poll = now;
+            d[i].previous_poll = previous;
+        }
+        if (n) {
+            pending = 0;
+        }
+        uart_framer_receive(framer, now, &s->word[read], n);
+        read += n;
+    }
+    uart_framer_flush(framer);
+    return lost;
+}
+
+/**
+ * @brief A frame as computed from the delivered bytes.
+ */
+typedef struct {
+    size_t first;
+    size_t last;
+    uint32_t length;
+    uint32_t lost;
+    uint16_t errors;
+    uart_frame_end_t reason;
+} want_frame_t;
+
+/**
+ * @brief Split the delivered bytes by the framer's rules, on their true arrival times.
+ *
+ * The scenarios keep pauses inside frames below half the idle time and
+ * silences between them above twice it, so stamp errors (a quarter of it at
+ * most) cannot change an idle decision.
+ */
+static size_t expect_frames(const scenario_t* sc, const sent_t* s, const delivery_t* d, want_frame_t* out) {
+    size_t count = 0;
+    want_frame_t* open = NULL;
+    size_t previous = 0;
+    uint32_t pending = 0;
+    for (size_t i = 0; i < s->count; i++) {
+        if (!d[i].delivered) {
+            continue;
+        }
+        if (d[i].lost_before) {
+            if (open) {
+                open->reason = UART_FRAME_END_LOST;
+                open = NULL;
+            }
+            pending += d[i].lost_before;
+        } else if (open && sc->idle_us && s->t[i] - s->t[previous] >= sc->idle_us * 1000u) {
+            open->reason = UART_FRAME_END_IDLE;
+            open = NULL;
+        }
+        if (!open) {
+            open = &out[count++];
+            memset(open, 0, sizeof(*open));
+            open->first = i;
+            open->lost = pending;
+            pending = 0;
+        }
+        open->last = i;
+        open->length++;
+        open->errors |= s->word[i] & UART_FRAME_ERRORS;
+        previous = i;
+        if (sc->delimiter >= 0 && (s->word[i] & 0xFFu) == (unsigned)sc->delimiter &&
+            !(s->word[i] & UART_FRAME_BE)) {
+            open->reason = UART_FRAME_END_DELIMITER;
+            open = NULL;
+        } else if (open->length == UART_FRAME_MAX_BYTES) {
+            open->reason = UART_FRAME_END_FULL;
+            open = NULL;
+        }
+    }
+    if (open) {
+        open->reason = UART_FRAME_END_INPUT;
+    }
+    return count;
+}
+
+static bool run_scenario(const scenario_t* sc, uint64_t seed) {
+    bench_rng_t rng;
+    bench_rng_seed(&rng, seed, (uint64_t)(sc - scenarios));
+    sent_t s = {0};
+    send(sc, &rng, &s);
+
+    delivery_t* d = calloc(s.count, sizeof(delivery_t));
+    want_frame_t* want = malloc(s.count * sizeof(want_frame_t));
+    if (!d || !want) {
+        fprintf(stderr, "uart_frames: out of memory\n");
+        exit(1);
+    }
+    got_t got = {0};
+    uart_framer_t framer;
+    uart_framer_init(&framer, TICK_HZ, sc->baud, sc->delimiter, (uint64_t)sc->idle_us * 1000u,
+                     collect_frame, &got);
+    uint64_t lost = run_logger(sc, &rng, &s, &framer, d);
+    size_t num_want = expect_frames(sc, &s, d, want);
+
+    // Every frame: contents, end, errors, losses and the stamps of both ends
+    const char* failure = NULL;
+    size_t frame = 0;
+    uint64_t checked_stamps = 0;
+    double max_stamp_error = 0;
+    uint32_t reasons[UART_FRAME_END_INPUT + 1] = {0};
+    if (got.count != num_want) {
+        failure = "frame count differs";
+    }
+    for (; frame < num_want && !failure; frame++) {
+        const want_frame_t* w = &want[frame];
+        const got_frame_t* g = &got.frames[frame];
+        reasons[w->reason]++;
+        if (g->reason != w->reason) {
+            failure = "end reason differs";
+        } else if (g->length != w->length) {
+            failure = "frame length differs";
+        } else if (g->errors != w->errors) {
+            failure = "error flags differ";
+        } else if (g->lost != w->lost) {
+            failure = "lost count differs";
+        }
+        for (size_t j = w->first, k = 0; j <= w->last && !failure; j++) {
+            if (d[j].delivered && (uint8_t)s.word[j] != got.data[g->data + k++]) {
+                failure = "frame data differs";
+            }
+        }
+        size_t ends[2] = {w->first, w->last};
+        uint64_t stamps[2] = {g->start, g->end};
+        for (int e = 0; e < 2 && !failure; e++) {
+            const delivery_t* dd = &d[ends[e]];
+            uint64_t arrival = s.t[ends[e]];
+            if (stamps[e] < arrival) {
+                failure = "byte stamped before its arrival";
+            } else if (dd->bounded) {
+                if (stamps[e] - arrival > dd->poll - dd->previous_poll) {
+                    failure = "byte stamped later than its poll interval";
+                }
+                max_stamp_error = fmax(max_stamp_error, (double)(stamps[e] - arrival));
+                checked_stamps++;
+            }
+        }
+    }
+
+    // Window totals over the whole run
+    uint64_t bytes = 0, lost_events = 0, errors[4] = {0};
+    for (size_t i = 0; i < s.count; i++) {
+        if (d[i].delivered) {
+            bytes++;
+            lost_events += d[i].lost_before != 0;
+            for (int e = 0; e < 4; e++) {
+                errors[e] += (s.word[i] & (UART_FRAME_FE << e)) != 0;
+            }
+        }
+    }
+    const uart_stats_t* st = &framer.stats;
+    if (failure) {
+        fprintf(stderr, "uart_frames: %s: frame %llu\n", sc->name, (unsigned long long)frame);
+    } else if (st->bytes != bytes || st->frames != got.count || st->lost != lost) {
+        failure = "window totals differ";
+    } else if (st->framing != errors[0] || st->parity != errors[1] || st->breaks != errors[2] ||
+               st->overruns != errors[3]) {
+        failure = "error counts differ";
+    } else if (st->gap_count != bytes - 1 - lost_events) {
+        failure = "gap count differs";
+    } else if (sc->stall_min_ms && lost == 0) {
+        failure = "the stalls never overflowed the ring";
+    }
+
+    printf("uart_frames: %-8s %7lu baud, %llu bytes, %llu frames (%u delim, %u idle, %u full, "
+           "%u lost, %u end), F/P/B/O %llu/%llu/%llu/%llu, %llu bytes lost, "
+           "stamp error max %.1f us over %llu stamps: %s\n",
+           sc->name, (unsigned long)sc->baud, (unsigned long long)bytes, (unsigned long long)got.count,
+           reasons[UART_FRAME_END_DELIMITER], reasons[UART_FRAME_END_IDLE], reasons[UART_FRAME_END_FULL],
+           reasons[UART_FRAME_END_LOST], reasons[UART_FRAME_END_INPUT], (unsigned long long)errors[0],
+           (unsigned long long)errors[1], (unsigned long long)errors[2], (unsigned long long)errors[3],
+           (unsigned long long)lost, max_stamp_error / 1000.0, (unsigned long long)checked_stamps,
+           failure ? failure : "OK");
+    free(s.t);
+    free(s.word);
+    free(d);
+    free(want);
+    free(got.frames);
+    free(got.data);
+    return failure == NULL;
+}
+
+// ----------------------------------------------------------------------------
+// Self-check: decoding characters from line edges
+// ----------------------------------------------------------------------------
+
+#define TRACE_CHARS 5000
+#define TRACE_BAUD 1000000u
+#define TRACE_JITTER 0.05        // Edge jitter, ± bit times
+#define TRACE_STOP_LIMIT_NS 150  // Stop-bit time error: jitter plus rounding
+
+typedef struct {
+    const uint16_t* words;
+    const double* stops;
+    size_t count;
+    size_t next;
+    double max_error;
+    const char* failure;
+} trace_check_t;
+
+static void check_char(uint64_t arrival, uint16_t word, void* ctx) {
+    trace_check_t* c = ctx;
+    if (c->failure) {
+        return;
+    }
+    if (c->next == c->count) {
+        c->failure = "more characters than sent";
+    } else if (word != c->words[c->next]) {
+        c->failure = "character or flags differ";
+    } else {
+        double error = fabs((double)arrival - c->stops[c->next]);
+        c->max_error = fmax(c->max_error, error);
+        if (error > TRACE_STOP_LIMIT_NS) {
+            c->failure = "stop-bit time off";
+        }
+    }
+    c->next++;
+}
+
+/**
+ * @brief Encode characters (framing errors, breaks, pauses) as jittered edges and decode them.
+ */
+static bool check_decoder(uint64_t seed) {
+    bench_rng_t rng;
+    bench_rng_seed(&rng, seed, 100);
+    double bit = 1e9 / TRACE_BAUD;
+    uint16_t* words = malloc(TRACE_CHARS * sizeof(uint16_t));
+    double* stops = malloc(TRACE_CHARS * sizeof(double));
+    if (!words || !stops) {
+        fprintf(stderr, "uart_frames: out of memory\n");
+        exit(1);
+    }
+
+    trace_check_t check = {words, stops, TRACE_CHARS, 0, 0, NULL};
+    decoder_t d;
+    decoder_init(&d, TRACE_BAUD, check_char, &check);
+    bool level = true;
+    double t = 10 * bit;
+    uint32_t framing = 0, breaks = 0;
+    for (size_t i = 0; i < TRACE_CHARS; i++) {
+        uint8_t c = (uint8_t)(1 + bench_rng_below(&rng, 255));
+        uint16_t word = c;
+        bool stop = true;
+        if (bench_rng_below(&rng, 200) == 0) {
+            c = 0;
+            stop = false;
+            word = UART_FRAME_BE | UART_FRAME_FE;
+            breaks++;
+        } else if (bench_rng_below(&rng, 100) == 0) {
+            stop = false;
+            word |= UART_FRAME_FE;
+            framing++;
+        }
+        words[i] = word;
+        stops[i] = t + 9.5 * bit;
+
+        // Start, data LSB first, stop; then back to idle for at least a bit
+        bool bits[10] = {false};
+        for (int k = 0; k < 8; k++) {
+            bits[k + 1] = (c >> k) & 1u;
+        }
+        bits[9] = stop;
+        for (int k = 0; k < 10; k++) {
+            if (bits[k] != level) {
+                level = bits[k];
+                decoder_edge(&d, t + k * bit + uniform(&rng, -TRACE_JITTER, TRACE_JITTER) * bit, level);
+            }
+        }
+        t += 10 * bit;
+        if (!stop) {
+            t += bit;
+            level = true;
+            decoder_edge(&d, t, level);
+        }
+        if (bench_rng_below(&rng, 4) == 0) {
+            t += uniform(&rng, 1, 50) * bit;
+        }
+    }
+    decoder_advance(&d, INFINITY);
+    if (!check.failure && check.next != TRACE_CHARS) {
+        check.failure = "characters missing";
+    }
+    printf("uart_frames: trace    %7lu baud, %u chars, ±%.0f%% bit jitter, %u framing errors, %u breaks, "
+           "stop time error max %.0f ns: %s\n",
+           (unsigned long)TRACE_BAUD, TRACE_CHARS, TRACE_JITTER * 100, framing, breaks, check.max_error,
+           check.failure ? check.failure : "OK");
+    free(words);
+    free(stops);
+    return check.failure == NULL;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: uart_frames [-b BAUD] [-p PIN] [-d DELIM|none] [-i IDLE_US] [-w WINDOW_US] [TRACE...]\n"
+            "       uart_frames -s [-S SEED]\n");
+}
+
+int main(int argc, char** argv) {
+    bool synthetic = false;
+    uint32_t baud = 115200;
+    unsigned pin = 0;
+    int delimiter = '\n';
+    double idle_us = 1000.0;
+    double window_us = 0;
+    uint64_t seed = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "b:p:d:i:w:sS:")) != -1) {
+        switch (opt) {
+            case 'b': baud = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'p': pin = (unsigned)atoi(optarg); break;
+            case 'd':
+                delimiter = strcmp(optarg, "none") == 0 ? UART_FRAME_NO_DELIMITER : (int)strtol(optarg, NULL, 0);
+                break;
+            case 'i': idle_us = atof(optarg); break;
+            case 'w': window_us = atof(optarg); break;
+            case 's': synthetic = true; break;
+            case 'S': seed = strtoull(optarg, NULL, 0); break;
+            default:
+                usage();
+                return 2;
+        }
+    }
+    if (baud == 0 || pin > 7 || delimiter > 255 || idle_us < 0 || window_us < 0 ||
+        (synthetic && optind < argc)) {
+        usage();
+        return 2;
+    }
+
+    if (synthetic) {
+        bool ok = true;
+        for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+            ok &= run_scenario(&scenarios[i], seed);
+        }
+        ok &= check_decoder(seed);
+        return ok ? 0 : 1;
+    }
+
+    trace_t tr;
+    uint64_t window = (uint64_t)llround(window_us * 1000.0);
+    trace_init(&tr, baud, delimiter, (uint64_t)llround(idle_us * 1000.0), window);
+    if (window) {
+        uart_stats_write_header(stdout);
+    } else {
+        uart_frame_write_header(stdout);
+    }
+    bool ok = true;
+    if (optind == argc) {
+        ok = read_trace("-", &tr, pin);
+    }
+    for (int i = optind; i < argc; i++) {
+        ok &= read_trace(argv[i], &tr, pin);
+    }
+    trace_finish(&tr);
+    return ok ? 0 : 1;
+}
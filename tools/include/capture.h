@@ -0,0 +1,84 @@
+/**
+ * @file capture.h
+ * @brief PIO + DMA edge capture engine for the GPIO probe (device only).
+ *
+ * One PIO state machine timestamps every edge on 1-8 consecutive pins in
+ * clk_sys cycles (gpio_probe/capture.pio) and two DMA channels move its
+ * words from the RX FIFO into a ring split into two halves. Each channel
+ * fills one half and chains to the other, so the FIFO is drained without
+ * CPU involvement; the CPU only copies words out of the ring with
+ * capture_read() and decodes them with capture_decode.h.
+ *
+ * Resolution is one sample slot: 2 cycles for one pin (16 ns at 125 MHz)
+ * and 6 cycles for several pins (48 ns). A pulse shorter than a slot can be
+ * missed. The ring absorbs bursts of up to CAPTURE_RING_WORDS words; if the
+ * reader falls further behind, or the FIFO fills because DMA could not keep
+ * up, the capture is marked as overflowed.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "hardware/pio.h"
+
+#define CAPTURE_RING_WORDS 4096  ///< Two halves of 2048 words (16 KB)
+
+/**
+ * @brief A running capture.
+ */
+typedef struct {
+    PIO pio;
+    uint sm;
+    uint offset;
+    const pio_program_t* program;
+    int dma[2];                   ///< Ping-pong channels, dma[i] fills half i
+    uint8_t pin_base;
+    uint8_t pin_count;
+    uint32_t read_words;          ///< Words consumed by capture_read()
+    bool overflow;
+} capture_t;
+
+/**
+ * @brief Load the PIO program, claim a state machine and two DMA channels and start capturing.
+ *
+ * @param pin_base  First GPIO.
+ * @param pin_count Consecutive pins to capture (1-8); 1 selects the faster single-pin program.
+ * @return false if no state machine, program space or DMA channel is free
+ */
+bool capture_start(capture_t* cap, uint8_t pin_base, uint8_t pin_count);
+
+/**
+ * @brief Copy words captured since the last call.
+ *
+ * @return Number of words stored in `out` (at most `max`)
+ */
+size_t capture_read(capture_t* cap, uint32_t* out, size_t max);
+
+/**
+ * @brief Has any data been lost since the capture started (or the last capture_resync())?
+ */
+bool capture_overflowed(capture_t* cap);
+
+/**
+ * @brief After an overflow, skip to recent data and carry on capturing.
+ *
+ * The read position moves to half a ring behind the DMA, on a record
+ * boundary. Pass the result to capture_decoder_skip() so the decoder stays
+ * in step. If the PIO itself stalled, the slot counter paused and later
+ * timestamps are late by the stall.
+ *
+ * @return Number of words skipped
+ */
+uint32_t capture_resync(capture_t* cap);
+
+/**
+ * @brief Stop the state machine and release the PIO and DMA resources.
+ */
+void capture_stop(capture_t* cap);
+
+#endif  // CAPTURE_H
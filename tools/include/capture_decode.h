@@ -0,0 +1,174 @@
+/**
+ * @file capture_decode.h
+ * @brief Decoding, triggering and export of PIO edge captures (portable C).
+ *
+ * The capture engine (capture.h) leaves a stream of 32-bit words from the PIO
+ * RX FIFO in memory. This module turns that stream into timestamped edges,
+ * applies the logic-analyser trigger and writes the result as CSV or VCD.
+ * It has no Pico SDK dependencies, so the same code runs on the probe and in
+ * the Linux host build (tools/host), where capture_replay feeds it synthetic
+ * and recorded word streams.
+ *
+ * Word stream (see gpio_probe/capture.pio):
+ *
+ *   - Both PIO programs count down a 32-bit slot counter from 0xFFFFFFFF,
+ *     so slot = 0xFFFFFFFF - counter and cycles = slot * slot_cycles.
+ *   - Single pin (2 cycles per slot): one word per edge, the counter. The
+ *     level alternates and the first edge is always a rise.
+ *   - Multi pin (6 cycles per slot): two words per edge, the counter and
+ *     then the new level of every pin (bit 0 = first pin). The first
+ *     record gives the initial levels if any pin starts high.
+ *
+ * The counter wraps every 2^32 slots (about 68 s for one pin, 206 s for
+ * several at 125 MHz). Timestamps are unwrapped into 64 bits under the
+ * assumption that no gap between two edges is longer than that.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef CAPTURE_DECODE_H
+#define CAPTURE_DECODE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define CAPTURE_MAX_PINS 8
+#define CAPTURE_SINGLE_SLOT_CYCLES 2   ///< clk_sys cycles per sample, one pin
+#define CAPTURE_MULTI_SLOT_CYCLES 6    ///< clk_sys cycles per sample, 2-8 pins
+#define CAPTURE_COUNTER_START 0xFFFFFFFFu
+
+/**
+ * @brief One edge: the level of every captured pin from `cycles` onwards.
+ */
+typedef struct {
+    uint64_t cycles;  ///< clk_sys cycles since the capture started
+    uint8_t state;    ///< Bit i = level of pin_base + i
+} capture_edge_t;
+
+/**
+ * @brief Word stream decoder state.
+ */
+typedef struct {
+    uint8_t pin_count;
+    uint32_t slot_cycles;
+    uint32_t last_slot;     ///< Slot of the previous edge (mod 2^32)
+    uint64_t slots;         ///< Unwrapped slot of the previous edge
+    uint8_t state;          ///< Level after the previous edge
+    bool have_counter;      ///< Multi pin: counter word seen, state word pending
+    uint32_t counter;
+} capture_decoder_t;
+
+/**
+ * @brief Prepare a decoder for a capture of `pin_count` pins (1-8).
+ */
+void capture_decoder_init(capture_decoder_t* dec, uint8_t pin_count);
+
+/**
+ * @brief Feed one word of the stream.
+ *
+ * @return true if the word completed an edge, which is stored in `edge`
+ */
+bool capture_decode_word(capture_decoder_t* dec, uint32_t word, capture_edge_t* edge);
+
+/**
+ * @brief Skip words lost by the capture (capture_resync()).
+ *
+ * With one pin the level stays right (it alternates with every word); with
+ * several, the levels are known again from the next record.
+ *
+ * @return Number of edges lost
+ */
+uint32_t capture_decoder_skip(capture_decoder_t* dec, uint32_t words);
+
+/**
+ * @brief Trigger conditions, evaluated on every decoded edge.
+ */
+typedef enum {
+    CAPTURE_TRIGGER_NONE,     ///< Start at the first edge
+    CAPTURE_TRIGGER_PATTERN,  ///< First edge after which (state & mask) == value
+    CAPTURE_TRIGGER_RISING,   ///< `pin` goes high
+    CAPTURE_TRIGGER_FALLING,  ///< `pin` goes low
+    CAPTURE_TRIGGER_EDGE,     ///< `pin` changes
+} capture_trigger_type_t;
+
+/**
+ * @brief Trigger configuration.
+ */
+typedef struct {
+    capture_trigger_type_t type;
+    uint8_t mask;          ///< PATTERN: pins that take part
+    uint8_t value;         ///< PATTERN: their levels
+    uint8_t pin;           ///< Edge triggers: pin index within the capture
+    uint32_t pretrigger;   ///< Edges kept from before the trigger
+    uint32_t length;       ///< Edges from the trigger on (0 = unlimited)
+} capture_trigger_config_t;
+
+typedef void (*capture_edge_fn)(const capture_edge_t* edge, void* ctx);
+
+/**
+ * @brief Trigger state; the pre-trigger history lives in a caller buffer.
+ */
+typedef struct {
+    capture_trigger_config_t cfg;
+    capture_edge_t* history;    ///< Ring of cfg.pretrigger edges
+    uint32_t history_head;
+    uint32_t history_count;
+    uint8_t state;              ///< Level before the edge being tested
+    uint8_t start_state;        ///< Level before the first edge passed on
+    bool triggered;
+    bool done;
+    uint32_t emitted;           ///< Edges passed on since the trigger
+    capture_edge_t trigger;     ///< The edge that fired
+} capture_trigger_t;
+
+/**
+ * @brief Arm a trigger.
+ *
+ * @param history Room for cfg->pretrigger edges (may be NULL if 0).
+ */
+void capture_trigger_init(capture_trigger_t* trig, const capture_trigger_config_t* cfg,
+                          capture_edge_t* history);
+
+/**
+ * @brief Test one edge against the trigger.
+ *
+ * Before the trigger, edges only enter the history. When it fires, the
+ * history (oldest first) and the trigger edge are passed to fn, then every
+ * following edge until cfg.length edges have been passed from the trigger on.
+ *
+ * @return true once the capture is complete (later edges are ignored)
+ */
+bool capture_trigger_feed(capture_trigger_t* trig, const capture_edge_t* edge,
+                          capture_edge_fn fn, void* ctx);
+
+/**
+ * @brief Convert cycles to nanoseconds without overflowing 64 bits.
+ */
+uint64_t capture_cycles_to_ns(uint64_t cycles, uint32_t clk_hz);
+
+/**
+ * @brief Write the CSV header: `timestamp_us,state`.
+ */
+void capture_write_csv_header(FILE* out);
+
+/**
+ * @brief Write one edge as CSV (microseconds to the nanosecond, state as a pin mask).
+ */
+void capture_write_csv_edge(FILE* out, const capture_edge_t* edge, uint32_t clk_hz);
+
+/**
+ * @brief Write the VCD header and the initial levels (1 ns timescale, one wire per pin).
+ *
+ * The pins are named gpio<pin_base + i>, so PulseView/sigrok-cli and GTKWave
+ * show the real GPIO numbers.
+ */
+void capture_write_vcd_header(FILE* out, uint8_t pin_base, uint8_t pin_count, uint8_t initial_state);
+
+/**
+ * @brief Write the value changes of one edge relative to the previous state.
+ */
+void capture_write_vcd_edge(FILE* out, const capture_edge_t* edge, uint8_t previous_state,
+                            uint8_t pin_count, uint32_t clk_hz);
+
+#endif  // CAPTURE_DECODE_H
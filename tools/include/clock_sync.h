@@ -0,0 +1,173 @@
+/**
+ * @file clock_sync.h
+ * @brief Probe-side clock sync estimator: probe ticks to main-board time (portable C).
+ *
+ * The probe's edge timestamps count its own clk_sys, which differs from the
+ * benchmark Pico's by the two crystals' tolerances (tens of ppm, drifting
+ * with temperature). With the main board running bench_sync.h pulses on a
+ * dedicated line, and that line captured as one of the probe's pins, this
+ * estimator places every probe timestamp on the main board's timeline:
+ *
+ *   - Pulse widths are classified as marker / 1 / 0, split halfway between
+ *     the nominal widths. High times under CLOCK_SYNC_MIN_WIDTH_US or of
+ *     CLOCK_SYNC_MAX_WIDTH_US and more (whole microseconds, rounded down)
+ *     are glitches and ignored.
+ *   - Rising edges must lie a whole number of periods apart, so missed
+ *     pulses are skipped over. A pulse off that grid is a glitch unless the
+ *     next pulse lies on a grid through it instead: then the main board
+ *     restarted its sync, the chain of pulses breaks and the estimator
+ *     unlocks, one period after the restart.
+ *   - A complete frame (marker and 31 bits) gives the absolute number of
+ *     every pulse in the chain. Two frames must agree before the numbering
+ *     is used, so one misread symbol cannot shift the timeline by whole
+ *     periods; later symbols are checked against it, and a few wrong ones
+ *     without a good frame in between unlock.
+ *   - Once numbered, a least-squares line through the last
+ *     CLOCK_SYNC_WINDOW pulses (probe ticks against main ns) is refitted at
+ *     every pulse. It follows drift and wander, and averages out the capture
+ *     quantisation of single pulses. Rising edges more than
+ *     CLOCK_SYNC_OUTLIER_NS off the line (the tail of a pulse split by a
+ *     glitch) are left out of it.
+ *
+ * Conversion is integer arithmetic from the newest pulse (a Q32 slope), so
+ * it is cheap enough per edge on the probe. It fails while unlocked or
+ * more than CLOCK_SYNC_HOLDOVER_US from the newest pulse, rather than
+ * extrapolate blindly.
+ *
+ * Times are in capture ticks at tick_hz: clk_sys cycles on the probe, ns
+ * on the host (tools/host/sync_timeline).
+ *
+ * CSV with the main timeline (clock_sync_write_csv_edge):
+ *
+ *   timestamp_us,state,main_us
+ *
+ * where main_us is microseconds since pulse 0 on the main board, with ns
+ * digits, or empty while unlocked.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef CLOCK_SYNC_H
+#define CLOCK_SYNC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "bench_sync.h"
+#include "capture_decode.h"
+
+#define CLOCK_SYNC_WINDOW 32              ///< Pulses in the fit (0.32 s)
+#define CLOCK_SYNC_HOLDOVER_US 1000000u   ///< Longest conversion distance from the newest pulse
+#define CLOCK_SYNC_MAX_SYMBOL_ERRORS 4    ///< Wrong symbols since the last good frame before unlocking
+#define CLOCK_SYNC_OUTLIER_NS 1000        ///< Largest distance of a rising edge from the fit
+#define CLOCK_SYNC_MIN_WIDTH_US (BENCH_SYNC_ZERO_US / 2)        ///< Shortest pulse that is a symbol (500)
+#define CLOCK_SYNC_MAX_WIDTH_US (BENCH_SYNC_MARKER_US * 3 / 2)  ///< Pulses this long or longer are glitches (6000)
+
+/**
+ * @brief What a sync line edge changed.
+ */
+typedef enum {
+    CLOCK_SYNC_NONE,
+    CLOCK_SYNC_LOCKED,  ///< First fit after numbering the pulses
+    CLOCK_SYNC_LOST,    ///< Chain broken; no conversions until locked again
+} clock_sync_event_t;
+
+/**
+ * @brief A sync pulse in the current chain.
+ */
+typedef struct {
+    uint64_t ticks;   ///< Rising edge
+    uint32_t index;   ///< Pulses since the start of the chain
+    bool outlier;     ///< Left out of the fit
+} clock_sync_pulse_t;
+
+/**
+ * @brief Estimator state.
+ */
+typedef struct {
+    uint32_t tick_hz;
+
+    // Sync line
+    bool high;
+    bool have_rise;                ///< rise is a real rising edge
+    uint64_t rise;
+    uint64_t holdover_ticks;
+    double outlier_ticks;
+
+    // Chain of pulses on one period grid
+    bool chained;
+    clock_sync_pulse_t window[CLOCK_SYNC_WINDOW];  ///< Ring of the newest pulses
+    uint32_t num_window;
+    uint32_t next;                 ///< Ring position of the next pulse
+    clock_sync_pulse_t last;
+    bool have_held;                ///< A pulse off the grid, waiting for the next
+    clock_sync_pulse_t held;
+    uint8_t held_symbol;
+    bool have_marker;              ///< A marker was seen and its bits follow
+    uint32_t marker_index;
+    uint32_t frame_bits;
+    uint32_t num_bits;
+    bool have_candidate;           ///< One frame decoded, waiting for a second to agree
+    int64_t candidate;
+    bool numbered;
+    int64_t base;                  ///< Absolute pulse number of chain index 0
+    uint32_t symbol_errors;        ///< Since the last good frame
+
+    // Fit, valid while locked
+    bool locked;
+    uint64_t anchor_ticks;         ///< Newest pulse
+    int64_t anchor_ns;             ///< Fitted main time at anchor_ticks
+    uint64_t slope_int;            ///< Main ns per tick, integer part
+    uint32_t slope_frac;           ///< ... and fraction, Q32
+    double period_ticks;           ///< Fitted ticks per sync period
+    double drift_ppm;              ///< Probe clock rate relative to main (+ = probe fast)
+    double residual_ns;            ///< RMS residual of the fit
+
+    // Totals
+    uint32_t pulses;               ///< Pulses accepted into a chain
+    uint32_t glitches;             ///< Pulses rejected by width or position, outliers
+    uint32_t bad_symbols;          ///< Symbols that disagreed with the numbering
+    uint32_t breaks;               ///< Chains broken (restarts, gaps, bad frames)
+} clock_sync_t;
+
+/**
+ * @brief Start unlocked, with the sync line low.
+ */
+void clock_sync_init(clock_sync_t* cs, uint32_t tick_hz);
+
+/**
+ * @brief Feed one level change of the sync line (in time order).
+ */
+clock_sync_event_t clock_sync_edge(clock_sync_t* cs, uint64_t ticks, bool level);
+
+/**
+ * @brief Feed a capture edge; only a change of bit `pin` is passed on.
+ */
+clock_sync_event_t clock_sync_capture_edge(clock_sync_t* cs, const capture_edge_t* edge,
+                                           uint8_t previous_state, unsigned pin);
+
+/**
+ * @brief Main-board time of a probe timestamp.
+ *
+ * @param main_ns Nanoseconds since the main board's pulse 0.
+ * @return false while unlocked or more than the holdover from the newest pulse.
+ */
+bool clock_sync_to_main(const clock_sync_t* cs, uint64_t ticks, int64_t* main_ns);
+
+/**
+ * @brief Write the CSV header: `timestamp_us,state,main_us`.
+ */
+void clock_sync_write_csv_header(FILE* out);
+
+/**
+ * @brief Write one edge as CSV with its main-board time (empty if unknown).
+ */
+void clock_sync_write_csv_edge(FILE* out, const clock_sync_t* cs, const capture_edge_t* edge,
+                               uint32_t clk_hz);
+
+/**
+ * @brief Print a one-line lock or loss notice for an event (nothing for NONE).
+ */
+void clock_sync_write_event(FILE* out, const clock_sync_t* cs, clock_sync_event_t event);
+
+#endif  // CLOCK_SYNC_H
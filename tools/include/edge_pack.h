@@ -0,0 +1,149 @@
+/**
+ * @file edge_pack.h
+ * @brief Compressed edge stream of the GPIO probe (portable C).
+ *
+ * Printing `timestamp_us,state` costs about 15 bytes per edge over USB
+ * serial, which caps the edge rate the probe can stream far below what the
+ * PIO capture resolves. This codec sends the same edges, exactly, in about
+ * one or two bytes per edge for jittery signals and a few bytes per frame
+ * for strictly periodic ones:
+ *
+ *   - Timestamps are sent as the difference between an edge's delta (in
+ *     clk_sys cycles since the previous edge) and the delta two edges back,
+ *     so a steady PWM or clock leaves only its jitter. The residual is
+ *     zigzag coded into an LEB128 varint.
+ *   - A run of edges that match the prediction exactly (residual 0, the
+ *     predicted level) becomes one RUN token.
+ *   - Every frame starts with an absolute sync point (the full cycle count
+ *     and level of its first edge) and resets the prediction, so frames
+ *     decode independently: a frame lost to a bad CRC costs only its own
+ *     edges, and the sequence number tells the host that it happened.
+ *
+ * Frames are bench_wire.h frames of type BENCH_WIRE_EDGES_PACKED (magic,
+ * length, CRC-16), so they share the serial stream with text as the other
+ * binary frames do. Payload (uv = unsigned LEB128 varint):
+ *
+ *   seq uv        Frame number since the probe started (mod 2^32)
+ *   pin_base u8, pin_count u8, clk_hz uv
+ *   lost uv       Edges the capture dropped since the previous frame
+ *   cycles uv     Sync point: clk_sys cycles of the first edge
+ *   state u8      Level of every pin after the first edge (bit 0 = pin_base)
+ *   tokens...     One per edge or run, to the end of the payload
+ *
+ * Token: uv t, kind = t & 3, value = t >> 2
+ *
+ *   EDGE        residual = unzigzag(value), level as predicted
+ *   RUN         value + 1 edges with residual 0 and the level as predicted
+ *   EDGE_STATE  residual = unzigzag(value), then the level as a u8
+ *
+ * Prediction, reset at every sync point (both deltas 0):
+ *   delta[i] = delta[i-2] + residual, cycles[i] = cycles[i-1] + delta[i]
+ *   level: one pin toggles; several pins repeat the level two edges back
+ *
+ * Encoding an edge is a few 64-bit additions and a short varint loop, with
+ * no division and no bounds check per byte (room is reserved per edge), so
+ * the probe keeps up with the PIO capture on one core; USB throughput is
+ * what limits the sustained edge rate.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef EDGE_PACK_H
+#define EDGE_PACK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "capture_decode.h"
+
+#define EDGE_PACK_EDGE 0u
+#define EDGE_PACK_RUN 1u
+#define EDGE_PACK_EDGE_STATE 2u
+
+#define EDGE_PACK_MAX_FRAME_EDGES 65535u  ///< Upper bound on edges per frame (sync interval)
+#define EDGE_PACK_MAX_TOKEN 11u           ///< Longest token: 10-byte varint + level
+#define EDGE_PACK_MIN_FRAME 64u           ///< Smallest usable frame buffer
+
+/**
+ * @brief Called with every completed frame, ready to send.
+ */
+typedef void (*edge_pack_frame_fn)(const uint8_t* frame, size_t len, void* ctx);
+
+/**
+ * @brief Encoder state; frames are built in a caller buffer.
+ */
+typedef struct {
+    uint8_t* frame;
+    uint8_t* p;             ///< Write position in the payload
+    uint8_t* limit;         ///< Last position with room for a run, an edge and the CRC
+    uint8_t pin_base;
+    uint8_t pin_count;
+    uint32_t clk_hz;
+    uint32_t sync_edges;    ///< Edges per frame before a new sync point
+    edge_pack_frame_fn fn;
+    void* ctx;
+
+    uint32_t seq;
+    uint32_t lost;          ///< Edges lost since the previous frame
+    uint32_t edges;         ///< Edges in the open frame (0 = no frame open)
+    uint32_t run;           ///< Predicted edges not yet written
+    uint64_t last;          ///< Cycles of the previous edge
+    uint64_t delta1;        ///< Delta of the previous edge
+    uint64_t delta2;        ///< Delta two edges back
+    uint8_t state1;         ///< Level after the previous edge
+    uint8_t state2;         ///< Level two edges back
+
+    uint64_t total_edges;   ///< Edges sent, for the compression ratio
+    uint64_t total_bytes;   ///< Frame bytes sent
+} edge_pack_t;
+
+/**
+ * @brief Prepare an encoder.
+ *
+ * @param frame      Frame buffer, at least EDGE_PACK_MIN_FRAME bytes (at
+ *                   most a full bench_wire frame is used).
+ * @param sync_edges Edges per frame (1 to EDGE_PACK_MAX_FRAME_EDGES); a
+ *                   frame also ends early when its buffer is full.
+ * @param fn         Receives each frame; the buffer is reused afterwards.
+ */
+void edge_pack_init(edge_pack_t* enc, uint8_t* frame, size_t cap, uint8_t pin_base,
+                    uint8_t pin_count, uint32_t clk_hz, uint32_t sync_edges,
+                    edge_pack_frame_fn fn, void* ctx);
+
+/**
+ * @brief Add one edge (edges in capture order, cycles non-decreasing).
+ */
+void edge_pack_add(edge_pack_t* enc, const capture_edge_t* edge);
+
+/**
+ * @brief Record edges lost by the capture; the open frame is sent first.
+ */
+void edge_pack_lost(edge_pack_t* enc, uint32_t edges);
+
+/**
+ * @brief Send the open frame, if any (e.g. when the input goes idle).
+ */
+void edge_pack_flush(edge_pack_t* enc);
+
+/**
+ * @brief Header of a decoded frame.
+ */
+typedef struct {
+    uint32_t seq;
+    uint8_t pin_base;
+    uint8_t pin_count;
+    uint32_t clk_hz;
+    uint32_t lost;
+    uint32_t num_edges;
+} edge_pack_frame_t;
+
+/**
+ * @brief Decode a BENCH_WIRE_EDGES_PACKED payload, passing each edge to fn.
+ *
+ * The header is checked before any edge is passed on. A payload that turns
+ * out malformed later returns false after the edges before the error.
+ */
+bool edge_pack_decode(const uint8_t* payload, size_t len, edge_pack_frame_t* info,
+                      capture_edge_fn fn, void* ctx);
+
+#endif  // EDGE_PACK_H
@@ -0,0 +1,120 @@
+/**
+ * @file signal_stats.h
+ * @brief Incremental pulse statistics of a digital signal (portable C).
+ *
+ * Instead of sending every edge, the probe can feed edges into one of these
+ * per pin and print a summary per window: period, frequency, duty cycle,
+ * min/mean/max high and low times, log2 histograms of both and the number
+ * of edges lost. Each edge costs a few additions, so the statistics keep up
+ * with signals far faster than USB serial could carry edge by edge.
+ *
+ * Times are in capture ticks (clk_sys cycles on the probe; any unit on the
+ * host, given the matching rate). A pulse is counted in the window in which
+ * it ends; pulses that span a drop are not counted. The same code runs in
+ * the Linux host build (tools/host/signal_metrics).
+ *
+ * Summary row (signal_stats_write_row):
+ *
+ *   pin,window_us,edges,dropped,period_us,freq_hz,duty_pct,
+ *   high_min_us,high_mean_us,high_max_us,low_min_us,low_mean_us,low_max_us,
+ *   high_hist,low_hist
+ *
+ *   - period_us is the mean rising-to-rising time, freq_hz its inverse.
+ *   - duty_pct is total high time over total high and low time.
+ *   - The histograms list the non-empty buckets as `bucket:count`, separated
+ *     by spaces; bucket b holds widths of [2^b, 2^(b+1)) ticks, so the
+ *     buckets are in clk_sys cycles on the probe and in ns on the host.
+ *   - Fields without data (no complete pulse yet) are empty.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef SIGNAL_STATS_H
+#define SIGNAL_STATS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define SIGNAL_STATS_BUCKETS 40  ///< Up to 2^40 ticks; longer widths go in the last bucket
+
+/**
+ * @brief Count, sum, extremes and log2 histogram of one kind of width.
+ */
+typedef struct {
+    uint32_t count;
+    uint64_t sum;
+    uint64_t min;
+    uint64_t max;
+    uint32_t hist[SIGNAL_STATS_BUCKETS];
+} signal_widths_t;
+
+/**
+ * @brief Statistics of one signal: the current level plus the open window.
+ */
+typedef struct {
+    bool have_edge;        ///< last_edge is a real edge (widths can be measured)
+    bool have_rise;        ///< last_rise is a real rising edge (periods can be measured)
+    uint8_t level;
+    uint64_t last_edge;
+    uint64_t last_rise;
+
+    // Window
+    uint32_t edges;
+    uint32_t dropped;
+    signal_widths_t high;
+    signal_widths_t low;
+    signal_widths_t period;
+} signal_stats_t;
+
+/**
+ * @brief Start with no edge seen and an empty window.
+ */
+void signal_stats_init(signal_stats_t* s);
+
+/**
+ * @brief Set the level without an edge (e.g. the initial level of a capture).
+ *
+ * Widths are measured again from the next edge on.
+ */
+void signal_stats_set_level(signal_stats_t* s, uint8_t level);
+
+/**
+ * @brief Record an edge to `level` at `ticks`.
+ *
+ * An edge to the level the signal already has means the opposite edge was
+ * lost: it counts as dropped and the pulse around it is not measured.
+ */
+void signal_stats_edge(signal_stats_t* s, uint64_t ticks, uint8_t level);
+
+/**
+ * @brief Record `edges` edges lost by the capture; the level is unknown until the next edge.
+ */
+void signal_stats_dropped(signal_stats_t* s, uint32_t edges);
+
+/**
+ * @brief Clear the window, keeping the level and the open pulse.
+ */
+void signal_stats_next_window(signal_stats_t* s);
+
+/**
+ * @brief Bucket of a width: floor(log2(width)), capped to the last bucket.
+ */
+unsigned signal_stats_bucket(uint64_t width);
+
+/**
+ * @brief Write the summary header (see file comment).
+ */
+void signal_stats_write_header(FILE* out);
+
+/**
+ * @brief Write the summary of the open window.
+ *
+ * @param pin          GPIO number shown in the row.
+ * @param window_ticks Length of the window.
+ * @param tick_hz      Ticks per second.
+ */
+void signal_stats_write_row(FILE* out, const signal_stats_t* s, unsigned pin,
+                            uint64_t window_ticks, uint32_t tick_hz);
+
+#endif  // SIGNAL_STATS_H
@@ -21,9 +21,11 @@
 #define TOOL_FUNCTIONS_H
 
 /**
- * @brief GPIO edge logger (Tool Mode 1).
+ * @brief GPIO edge logger / logic analyser (Tool Mode 1).
  *
- * Continuously monitors GPIO2 and logs rising/falling edges with timestamps.
+ * Timestamps edges on GPIO2 (or up to 8 pins from it) in clk_sys cycles with
+ * the PIO + DMA capture engine, optionally behind a trigger, and prints them
+ * as CSV, VCD or binary frames, or summarises them as periodic statistics.
  * Used to validate toggling or PWM signals.
  */
 void run_gpio_probe(void);
@@ -31,8 +33,9 @@ void run_gpio_probe(void);
 /**
  * @brief UART receiver/logger (Tool Mode 2).
  *
- * Listens on GPIO1 (UART RX) and prints received characters to USB serial.
- * Used to validate UART output from the main Pico.
+ * Receives on GPIO1 (UART RX) by DMA and prints the characters, timestamped
+ * frames or throughput and error statistics to USB serial. Used to validate
+ * UART output from the main Pico.
  */
 void run_uart_logger(void);
 
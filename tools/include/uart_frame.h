@@ -0,0 +1,209 @@
+/**
+ * @file uart_frame.h
+ * @brief UART byte stream framing, arrival timestamps and statistics (portable C).
+ *
+ * The UART logger receives by DMA (uart_rx.h) and only sees how many bytes
+ * arrived since its last look, not when each one did. The framer stamps
+ * every byte of such a batch, splits the stream into frames and keeps a
+ * window of statistics:
+ *
+ *   - Arrival stamps: the newest byte of a batch arrived at or before the
+ *     poll, and bytes are at least one character time apart, so byte i of n
+ *     is stamped `now - (n-1-i) * char time`, but no earlier than a
+ *     character after the previous byte or the previous poll. Stamps are
+ *     never early. They are late by at most the time between two polls
+ *     only if the poll drained the ring: a poll that reads part of a
+ *     backlog (the logger reads up to 256 words) stamps its newest byte
+ *     `now` although it arrived before the rest of the backlog, so its
+ *     bytes are late by up to the whole backlog.
+ *   - Frames end at the delimiter byte (kept in the frame), after
+ *     `idle_ticks` without a byte, when UART_FRAME_MAX_BYTES are buffered,
+ *     or where bytes were lost (the ring overflowed).
+ *   - Statistics per window: bytes, frames, throughput and line use,
+ *     receive errors by kind, lost bytes, and the gaps between byte arrivals
+ *     (min/mean/max and a log2 histogram).
+ *
+ * Each byte is the 16-bit data register word as DMA read it, so the error
+ * flags the UART raised for that byte (UART_FRAME_FE etc.) travel with it.
+ *
+ * Times are in ticks at tick_hz: nanoseconds, on the logger and on the host
+ * (tools/host/uart_frames).
+ *
+ * Frame row (uart_frame_write_csv):
+ *
+ *   timestamp_us,duration_us,gap_us,bytes,lost,errors,end,data
+ *
+ *   - timestamp_us is the arrival of the first byte, duration_us the time
+ *     to the last; gap_us the silence before the frame (empty if unknown).
+ *   - lost is the bytes lost right before the frame; errors lists the error
+ *     kinds among its bytes (F framing, P parity, B break, O overrun).
+ *   - end is delim, idle, full, lost or end (input ended).
+ *   - data is the bytes, with `\`, `,`, `"` and non-printable bytes escaped
+ *     as \xHH (`\n`, `\r` and `\t` as such).
+ *
+ * Statistics row (uart_stats_write_row):
+ *
+ *   window_us,bytes,frames,bytes_per_s,line_pct,framing,parity,break,overrun,
+ *   lost,gap_min_us,gap_mean_us,gap_max_us,gap_hist
+ *
+ *   - line_pct is the share of the window the line carried characters.
+ *   - gap_hist lists the non-empty buckets as `bucket:count`; bucket b holds
+ *     gaps of [2^b, 2^(b+1)) ns. Back-to-back bytes sit in the bucket of one
+ *     character time.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef UART_FRAME_H
+#define UART_FRAME_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define UART_FRAME_MAX_BYTES 256     ///< Longer frames are split (end = full)
+#define UART_FRAME_BUCKETS 40        ///< Up to 2^40 ticks; longer gaps go in the last bucket
+#define UART_FRAME_NO_DELIMITER -1   ///< Frames end on idle, full or lost only
+#define UART_FRAME_BITS_PER_CHAR 10  ///< 8N1: start, 8 data, stop
+
+// Error flags of the data register word (RP2040 UARTDR, PL011 layout)
+#define UART_FRAME_FE 0x100u  ///< Framing error: no stop bit
+#define UART_FRAME_PE 0x200u  ///< Parity error
+#define UART_FRAME_BE 0x400u  ///< Break: line held low for a whole character
+#define UART_FRAME_OE 0x800u  ///< Overrun: the receive FIFO was full, bytes before this one were lost
+#define UART_FRAME_ERRORS (UART_FRAME_FE | UART_FRAME_PE | UART_FRAME_BE | UART_FRAME_OE)
+
+/**
+ * @brief Why a frame ended.
+ */
+typedef enum {
+    UART_FRAME_END_DELIMITER,
+    UART_FRAME_END_IDLE,
+    UART_FRAME_END_FULL,
+    UART_FRAME_END_LOST,
+    UART_FRAME_END_INPUT,   ///< uart_framer_flush()
+} uart_frame_end_t;
+
+/**
+ * @brief A complete frame, valid during the callback.
+ */
+typedef struct {
+    uint64_t start;          ///< Arrival of the first byte
+    uint64_t end;            ///< Arrival of the last byte
+    bool have_gap;
+    uint64_t gap;            ///< From the byte before (in another frame) to the first
+    uint32_t length;
+    uint32_t lost;           ///< Bytes lost right before the frame
+    uint16_t errors;         ///< UART_FRAME_* flags of its bytes, or-ed
+    uart_frame_end_t reason;
+    const uint8_t* data;
+} uart_frame_t;
+
+/**
+ * @brief Statistics of one window.
+ */
+typedef struct {
+    uint64_t bytes;
+    uint32_t frames;
+    uint32_t framing;
+    uint32_t parity;
+    uint32_t breaks;
+    uint32_t overruns;
+    uint64_t lost;
+    uint64_t gap_count;
+    uint64_t gap_sum;
+    uint64_t gap_min;
+    uint64_t gap_max;
+    uint32_t gap_hist[UART_FRAME_BUCKETS];
+} uart_stats_t;
+
+typedef void (*uart_frame_fn)(const uart_frame_t* frame, void* ctx);
+
+/**
+ * @brief Framer state: stamping, the open frame and the window.
+ */
+typedef struct {
+    uint32_t tick_hz;
+    uint32_t baud;
+    int delimiter;
+    uint64_t idle_ticks;        ///< 0: no idle frame ends
+    uint64_t char_ticks;        ///< One character on the line
+    uart_frame_fn fn;
+    void* ctx;
+
+    // Arrival stamps
+    bool have_poll;
+    uint64_t last_poll;
+    bool have_last;             ///< last is the stamp of the previous byte (no loss since)
+    uint64_t last;
+
+    // Open frame
+    uart_frame_t frame;
+    uint8_t data[UART_FRAME_MAX_BYTES];
+    uint32_t pending_lost;      ///< For the next frame
+
+    uart_stats_t stats;
+} uart_framer_t;
+
+/**
+ * @brief Start with no frame open and an empty window.
+ *
+ * @param delimiter  Byte that ends a frame, or UART_FRAME_NO_DELIMITER.
+ * @param idle_ticks Silence that ends a frame (0: never).
+ * @param fn         Called with each complete frame.
+ */
+void uart_framer_init(uart_framer_t* f, uint32_t tick_hz, uint32_t baud, int delimiter,
+                      uint64_t idle_ticks, uart_frame_fn fn, void* ctx);
+
+/**
+ * @brief Feed the words received since the previous call, read just before `now`.
+ *
+ * Call at every poll, also with no words, so frames can end on idle.
+ */
+void uart_framer_receive(uart_framer_t* f, uint64_t now, const uint16_t* words, size_t n);
+
+/**
+ * @brief Record `bytes` bytes lost (skipped after a ring overflow); ends the open frame.
+ */
+void uart_framer_lost(uart_framer_t* f, uint32_t bytes);
+
+/**
+ * @brief End the open frame, if any (end of input).
+ */
+void uart_framer_flush(uart_framer_t* f);
+
+/**
+ * @brief Clear the window statistics.
+ */
+void uart_framer_next_window(uart_framer_t* f);
+
+/**
+ * @brief Bucket of a gap: floor(log2(gap)), capped to the last bucket.
+ */
+unsigned uart_frame_bucket(uint64_t gap);
+
+/**
+ * @brief Write the frame header (see file comment).
+ */
+void uart_frame_write_header(FILE* out);
+
+/**
+ * @brief Write one frame as CSV.
+ */
+void uart_frame_write_csv(FILE* out, const uart_frame_t* frame, uint32_t tick_hz);
+
+/**
+ * @brief Write the statistics header (see file comment).
+ */
+void uart_stats_write_header(FILE* out);
+
+/**
+ * @brief Write the statistics of a window.
+ *
+ * @param window_ticks Length of the window.
+ */
+void uart_stats_write_row(FILE* out, const uart_stats_t* s, uint64_t window_ticks,
+                          uint32_t tick_hz, uint32_t baud);
+
+#endif  // UART_FRAME_H
@@ -0,0 +1,72 @@
+/**
+ * @file uart_rx.h
+ * @brief DMA UART receiver for the UART logger (device only).
+ *
+ * Two DMA channels move the UART's data register into a ring split into two
+ * halves, paced by its RX DREQ. Each channel fills one half and chains to
+ * the other, so the 32-byte receive FIFO is drained without CPU involvement
+ * while the logger is busy printing to USB. Each transfer is 16 bits wide
+ * and keeps the error flags the UART stored with the byte (uart_frame.h).
+ *
+ * The ring absorbs UART_RX_RING_WORDS bytes (about 11 ms at 7.8 Mbaud,
+ * 0.7 s at 115200); if the reader falls further behind, the receiver is
+ * marked as overflowed and uart_rx_resync() skips to recent data.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#ifndef UART_RX_H
+#define UART_RX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "hardware/uart.h"
+
+#define UART_RX_RING_WORDS 8192  ///< Two halves of 4096 bytes (16 KB)
+
+/**
+ * @brief A running receiver.
+ */
+typedef struct {
+    uart_inst_t* uart;
+    uint rx_pin;
+    int dma[2];                   ///< Ping-pong channels, dma[i] fills half i
+    uint32_t read_words;          ///< Words consumed by uart_rx_read()
+    bool overflow;
+} uart_rx_t;
+
+/**
+ * @brief Initialise the UART (8N1) on `rx_pin`, claim two DMA channels and start receiving.
+ *
+ * @param baud   Requested baud rate, up to clk_peri / 16.
+ * @param actual Set to the baud rate the divider achieved.
+ * @return false if no DMA channel is free
+ */
+bool uart_rx_start(uart_rx_t* rx, uart_inst_t* uart, uint rx_pin, uint32_t baud, uint32_t* actual);
+
+/**
+ * @brief Copy the words received since the last call.
+ *
+ * @return Number of words stored in `out` (at most `max`)
+ */
+size_t uart_rx_read(uart_rx_t* rx, uint16_t* out, size_t max);
+
+/**
+ * @brief Have bytes been lost since the start (or the last uart_rx_resync())?
+ */
+bool uart_rx_overflowed(const uart_rx_t* rx);
+
+/**
+ * @brief After an overflow, skip to half a ring behind the DMA and carry on.
+ *
+ * @return Number of bytes skipped (pass to uart_framer_lost())
+ */
+uint32_t uart_rx_resync(uart_rx_t* rx);
+
+/**
+ * @brief Stop receiving and release the UART and the DMA channels.
+ */
+void uart_rx_stop(uart_rx_t* rx);
+
+#endif  // UART_RX_H
@@ -8,7 +8,7 @@
  * The active tool is selected by modifying the TOOL_MODE value below.
  *
  * Tool Mode Mapping:
- *   1 → GPIO Probe (edge logger on GPIO2)
+ *   1 → GPIO Probe (PIO edge logger / logic analyser from GPIO2)
  *   2 → UART Logger (listens on GPIO1)
  *   3 → I2C Passive Responder (SDA=GPIO8, SCL=GPIO9)
  *
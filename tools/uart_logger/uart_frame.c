@@ -0,0 +1,217 @@
+/**
+ * @file uart_frame.c
+ * @brief UART byte stream framing, arrival timestamps and statistics (see uart_frame.h).
+ *
+ * No Pico SDK dependencies: this file is also built by tools/host.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <string.h>
+#include "uart_frame.h"
+
+void uart_framer_init(uart_framer_t* f, uint32_t tick_hz, uint32_t baud, int delimiter,
+                      uint64_t idle_ticks, uart_frame_fn fn, void* ctx) {
+    memset(f, 0, sizeof(*f));
+    f->tick_hz = tick_hz;
+    f->baud = baud;
+    f->delimiter = delimiter;
+    f->idle_ticks = idle_ticks;
+    f->char_ticks = (uint64_t)tick_hz * UART_FRAME_BITS_PER_CHAR / baud;
+    f->fn = fn;
+    f->ctx = ctx;
+    f->stats.gap_min = UINT64_MAX;
+}
+
+unsigned uart_frame_bucket(uint64_t gap) {
+    unsigned bucket = 0;
+    while (gap > 1 && bucket < UART_FRAME_BUCKETS - 1) {
+        gap >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+static void end_frame(uart_framer_t* f, uart_frame_end_t reason) {
+    if (f->frame.length == 0) {
+        return;
+    }
+    f->frame.reason = reason;
+    f->frame.data = f->data;
+    f->stats.frames++;
+    f->fn(&f->frame, f->ctx);
+    f->frame.length = 0;
+}
+
+static void add_gap(uart_stats_t* s, uint64_t gap) {
+    if (gap < s->gap_min) {
+        s->gap_min = gap;
+    }
+    if (gap > s->gap_max) {
+        s->gap_max = gap;
+    }
+    s->gap_count++;
+    s->gap_sum += gap;
+    s->gap_hist[uart_frame_bucket(gap)]++;
+}
+
+/**
+ * @brief Add one stamped byte to the open frame (starting one if needed).
+ */
+static void add_byte(uart_framer_t* f, uint64_t t, uint16_t word) {
+    uart_stats_t* s = &f->stats;
+    if (f->have_last) {
+        uint64_t gap = t - f->last;
+        if (f->idle_ticks && gap >= f->idle_ticks) {
+            end_frame(f, UART_FRAME_END_IDLE);
+        }
+        add_gap(s, gap);
+    }
+
+    uart_frame_t* frame = &f->frame;
+    if (frame->length == 0) {
+        frame->start = t;
+        frame->have_gap = f->have_last;
+        frame->gap = f->have_last ? t - f->last : 0;
+        frame->lost = f->pending_lost;
+        frame->errors = 0;
+        f->pending_lost = 0;
+    }
+    f->data[frame->length++] = (uint8_t)word;
+    frame->end = t;
+    frame->errors |= word & UART_FRAME_ERRORS;
+    f->have_last = true;
+    f->last = t;
+
+    s->bytes++;
+    s->framing += (word & UART_FRAME_FE) != 0;
+    s->parity += (word & UART_FRAME_PE) != 0;
+    s->breaks += (word & UART_FRAME_BE) != 0;
+    s->overruns += (word & UART_FRAME_OE) != 0;
+
+    if (f->delimiter >= 0 && (word & 0xFFu) == (unsigned)f->delimiter && !(word & UART_FRAME_BE)) {
+        end_frame(f, UART_FRAME_END_DELIMITER);
+    } else if (frame->length == UART_FRAME_MAX_BYTES) {
+        end_frame(f, UART_FRAME_END_FULL);
+    }
+}
+
+void uart_framer_receive(uart_framer_t* f, uint64_t now, const uint16_t* words, size_t n) {
+    if (n == 0 && f->frame.length && f->idle_ticks && now - f->last >= f->idle_ticks) {
+        end_frame(f, UART_FRAME_END_IDLE);
+    }
+    for (size_t i = 0; i < n; i++) {
+        // The bytes after this one took at least a character each
+        uint64_t behind = (uint64_t)(n - 1 - i) * f->char_ticks;
+        uint64_t t = now > behind ? now - behind : 0;
+        uint64_t earliest = f->have_poll ? f->last_poll : 0;
+        if (f->have_last && f->last + f->char_ticks > earliest) {
+            earliest = f->last + f->char_ticks;
+        }
+        if (t < earliest) {
+            t = earliest;
+        }
+        if (t > now) {
+            t = now;  // The sender runs fast: never stamp past the poll
+        }
+        add_byte(f, t, words[i]);
+    }
+    f->have_poll = true;
+    f->last_poll = now;
+}
+
+void uart_framer_lost(uart_framer_t* f, uint32_t bytes) {
+    end_frame(f, UART_FRAME_END_LOST);
+    f->pending_lost += bytes;
+    f->stats.lost += bytes;
+    f->have_last = false;  // The gap to the next byte is unknown
+}
+
+void uart_framer_flush(uart_framer_t* f) {
+    end_frame(f, UART_FRAME_END_INPUT);
+}
+
+void uart_framer_next_window(uart_framer_t* f) {
+    memset(&f->stats, 0, sizeof(f->stats));
+    f->stats.gap_min = UINT64_MAX;
+}
+
+void uart_frame_write_header(FILE* out) {
+    fprintf(out, "timestamp_us,duration_us,gap_us,bytes,lost,errors,end,data\n");
+}
+
+static void write_us(FILE* out, double ticks, uint32_t tick_hz) {
+    fprintf(out, "%.3f", ticks * 1e6 / tick_hz);
+}
+
+void uart_frame_write_csv(FILE* out, const uart_frame_t* frame, uint32_t tick_hz) {
+    static const char* const reasons[] = {"delim", "idle", "full", "lost", "end"};
+
+    write_us(out, (double)frame->start, tick_hz);
+    fputc(',', out);
+    write_us(out, (double)(frame->end - frame->start), tick_hz);
+    fputc(',', out);
+    if (frame->have_gap) {
+        write_us(out, (double)frame->gap, tick_hz);
+    }
+    fprintf(out, ",%lu,%lu,%s%s%s%s,%s,", (unsigned long)frame->length, (unsigned long)frame->lost,
+            frame->errors & UART_FRAME_FE ? "F" : "", frame->errors & UART_FRAME_PE ? "P" : "",
+            frame->errors & UART_FRAME_BE ? "B" : "", frame->errors & UART_FRAME_OE ? "O" : "",
+            reasons[frame->reason]);
+
+    for (uint32_t i = 0; i < frame->length; i++) {
+        uint8_t c = frame->data[i];
+        if (c == '\n') {
+            fputs("\\n", out);
+        } else if (c == '\r') {
+            fputs("\\r", out);
+        } else if (c == '\t') {
+            fputs("\\t", out);
+        } else if (c < 0x20 || c >= 0x7F || c == '\\' || c == ',' || c == '"') {
+            fprintf(out, "\\x%02x", c);
+        } else {
+            fputc(c, out);
+        }
+    }
+    fputc('\n', out);
+}
+
+void uart_stats_write_header(FILE* out) {
+    fprintf(out, "window_us,bytes,frames,bytes_per_s,line_pct,framing,parity,break,overrun,"
+                 "lost,gap_min_us,gap_mean_us,gap_max_us,gap_hist\n");
+}
+
+void uart_stats_write_row(FILE* out, const uart_stats_t* s, uint64_t window_ticks,
+                          uint32_t tick_hz, uint32_t baud) {
+    double seconds = (double)window_ticks / tick_hz;
+    write_us(out, (double)window_ticks, tick_hz);
+    fprintf(out, ",%llu,%lu", (unsigned long long)s->bytes, (unsigned long)s->frames);
+    if (seconds > 0) {
+        fprintf(out, ",%.1f,%.2f", (double)s->bytes / seconds,
+                100.0 * (double)s->bytes * UART_FRAME_BITS_PER_CHAR / baud / seconds);
+    } else {
+        fprintf(out, ",,");
+    }
+    fprintf(out, ",%lu,%lu,%lu,%lu,%llu,", (unsigned long)s->framing, (unsigned long)s->parity,
+            (unsigned long)s->breaks, (unsigned long)s->overruns, (unsigned long long)s->lost);
+
+    if (s->gap_count) {
+        write_us(out, (double)s->gap_min, tick_hz);
+        fputc(',', out);
+        write_us(out, (double)s->gap_sum / s->gap_count, tick_hz);
+        fputc(',', out);
+        write_us(out, (double)s->gap_max, tick_hz);
+    } else {
+        fprintf(out, ",,");
+    }
+
+    const char* sep = "";
+    fputc(',', out);
+    for (unsigned b = 0; b < UART_FRAME_BUCKETS; b++) {
+        if (s->gap_hist[b]) {
+            fprintf(out, "%s%u:%lu", sep, b, (unsigned long)s->gap_hist[b]);
+            sep = " ";
+        }
+    }
+    fputc('\n', out);
+}
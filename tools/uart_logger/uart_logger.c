@@ -2,14 +2,30 @@
  * @file uart_logger.c
  * @brief UART Logger Tool for RP2040 (Tool Mode 2)
  *
- * This utility configures the RP2040 as a UART receiver (RX only) and echoes
- * incoming serial characters received on GPIO1 to USB serial output. It allows
- * a second Pico to monitor UART transmissions from a primary benchmarking device.
+ * This utility configures the RP2040 as a UART receiver (RX only) on GPIO1
+ * and reports what a second Pico transmits, to verify UART TX behaviour in
+ * the C vs TinyGo benchmarking project.
  *
- * Used to verify UART TX behaviour in the C vs TinyGo benchmarking project.
+ * Bytes are received by DMA into a 16 KB ring (uart_rx.h), so the 32-byte
+ * UART FIFO never overruns while USB stalls, up to BAUD_RATE of several
+ * Mbaud (clk_peri / 16, 7.8 Mbaud at 125 MHz). The framer (uart_frame.h)
+ * stamps every byte on arrival, to within one pass of the main loop while
+ * each pass drains the ring, and splits the stream into frames. Bytes read
+ * from a backlog after a stall are stamped late by up to the backlog.
  *
- * Output:
- *   - Received characters printed in real-time via USB
+ * Output (UART_LOGGER_OUTPUT):
+ *   - TEXT:   received bytes as they are, like a terminal.
+ *   - FRAMES: one CSV row per frame (line, idle-separated packet or
+ *             UART_FRAME_MAX_BYTES chunk): arrival time, duration, gap
+ *             before it, length, lost bytes, receive errors and the escaped
+ *             data. See uart_frame.h.
+ *   - STATS:  one row every UART_LOGGER_STATS_WINDOW_MS: bytes, frames,
+ *             throughput and line use, framing/parity/break/overrun error
+ *             counts, lost bytes and a log2 histogram of the gaps between
+ *             bytes.
+ *
+ * If printing falls so far behind that the ring overflows, the logger skips
+ * to recent data and counts the skipped bytes as lost (TEXT prints a notice).
  *
  * Wiring:
  *   - GPIO1 (Logger RX) ← GPIO0 (Main Pico TX)
@@ -21,33 +37,88 @@
 #include "pico/stdlib.h"
 #include "hardware/uart.h"
 #include <stdio.h>
+#include "uart_frame.h"
+#include "uart_rx.h"
 
 #define UART_ID uart0
-#define BAUD_RATE 115200
-#define UART_RX_PIN 1  // GPIO1 = physical pin 2
+#define BAUD_RATE 115200   // Up to clk_peri / 16; the achieved rate is printed
+#define UART_RX_PIN 1      // GPIO1 = physical pin 2
+
+#define UART_LOGGER_OUTPUT_TEXT 0
+#define UART_LOGGER_OUTPUT_FRAMES 1
+#define UART_LOGGER_OUTPUT_STATS 2
+#define UART_LOGGER_OUTPUT UART_LOGGER_OUTPUT_FRAMES
+
+#define UART_LOGGER_DELIMITER '\n'        // Frame end byte, or UART_FRAME_NO_DELIMITER
+#define UART_LOGGER_IDLE_US 1000          // A frame also ends after this long without a byte
+#define UART_LOGGER_STATS_WINDOW_MS 1000  // Summary period of the STATS output
+
+#define TICK_HZ 1000000000u  // Framer times are in ns
+
+static uart_rx_t rx;
+static uart_framer_t framer;
+static uint16_t words[256];
+static char text[256];
+
+static void output_frame(const uart_frame_t* frame, void* ctx) {
+    (void)ctx;
+#if UART_LOGGER_OUTPUT == UART_LOGGER_OUTPUT_FRAMES
+    uart_frame_write_csv(stdout, frame, TICK_HZ);
+#else
+    (void)frame;
+#endif
+}
 
 /**
  * @brief Starts the UART logger tool on GPIO1.
  *
- * Continuously listens for characters over UART at 115200 baud and echoes
- * them to the USB serial interface. Useful for validating UART benchmark output.
+ * Receives continuously at BAUD_RATE and prints the bytes, frames or
+ * statistics to the USB serial interface. Runs indefinitely.
  *
- * @return void
+ * @return void (only if no DMA channel is available)
  */
 void run_uart_logger(void) {
-    // Initialise UART0 at specified baud rate
-    uart_init(UART_ID, BAUD_RATE);
-
-    // Set GPIO1 as UART RX
-    gpio_set_function(UART_RX_PIN, GPIO_FUNC_UART);
+    uint32_t baud;
+    if (!uart_rx_start(&rx, UART_ID, UART_RX_PIN, BAUD_RATE, &baud)) {
+        printf("UART Logger: no free DMA channel\n");
+        return;
+    }
+    printf("UART Logger Ready (RX on GPIO%d, %lu baud)\n", UART_RX_PIN, (unsigned long)baud);
 
-    printf("UART Logger Ready (RX on GPIO1)\n");
+    uart_framer_init(&framer, TICK_HZ, baud, UART_LOGGER_DELIMITER,
+                     (uint64_t)UART_LOGGER_IDLE_US * 1000u, output_frame, NULL);
+    if (UART_LOGGER_OUTPUT == UART_LOGGER_OUTPUT_FRAMES) {
+        uart_frame_write_header(stdout);
+    } else if (UART_LOGGER_OUTPUT == UART_LOGGER_OUTPUT_STATS) {
+        uart_stats_write_header(stdout);
+    }
 
-    // Main loop: Echo any received UART characters over USB
+    uint64_t window_start = time_us_64();
     while (true) {
-        if (uart_is_readable(UART_ID)) {
-            char c = uart_getc(UART_ID);
-            putchar(c);  // Forward to USB
+        if (uart_rx_overflowed(&rx)) {
+            uint32_t lost = uart_rx_resync(&rx);
+            uart_framer_lost(&framer, lost);
+            if (UART_LOGGER_OUTPUT == UART_LOGGER_OUTPUT_TEXT) {
+                printf("\nUART Logger: %lu bytes lost\n", (unsigned long)lost);
+            }
+        }
+
+        size_t n = uart_rx_read(&rx, words, sizeof(words) / sizeof(words[0]));
+        uint64_t now = time_us_64();  // After the read: every byte read arrived before it
+        uart_framer_receive(&framer, now * 1000u, words, n);
+
+        if (UART_LOGGER_OUTPUT == UART_LOGGER_OUTPUT_TEXT && n) {
+            for (size_t i = 0; i < n; i++) {
+                text[i] = (char)words[i];
+            }
+            fwrite(text, 1, n, stdout);
+            fflush(stdout);
+        } else if (UART_LOGGER_OUTPUT == UART_LOGGER_OUTPUT_STATS &&
+                   now - window_start >= UART_LOGGER_STATS_WINDOW_MS * 1000u) {
+            uart_stats_write_row(stdout, &framer.stats, (now - window_start) * 1000u, TICK_HZ, baud);
+            uart_framer_next_window(&framer);
+            fflush(stdout);
+            window_start = now;
         }
     }
 }
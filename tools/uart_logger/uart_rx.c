@@ -0,0 +1,153 @@
+/**
+ * @file uart_rx.c
+ * @brief DMA UART receiver for the UART logger (see uart_rx.h).
+ *
+ * Same ring scheme as the probe's capture engine (gpio_probe/capture.c):
+ * channel i writes half i and chains to the other channel when it is full;
+ * its completion interrupt only rewinds its write address and counts the
+ * half. The number of words written so far is the count of completed
+ * halves plus the progress of the active channel.
+ *
+ * @author Samuel Ivuerah
+ */
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/uart.h"
+#include "uart_rx.h"
+
+#define HALF_WORDS (UART_RX_RING_WORDS / 2)
+
+static uint16_t ring[UART_RX_RING_WORDS];
+static volatile uint32_t halves_done;   // Halves completed by DMA since the start
+static uart_rx_t* active;               // The receiver the interrupt belongs to
+
+static void __isr uart_rx_dma_irq(void) {
+    for (int i = 0; i < 2; i++) {
+        uint ch = (uint)active->dma[i];
+        if (dma_channel_get_irq0_status(ch)) {
+            dma_channel_acknowledge_irq0(ch);
+            dma_channel_set_write_addr(ch, &ring[i * HALF_WORDS], false);
+            halves_done++;
+        }
+    }
+}
+
+/**
+ * @brief Words written into the ring since the start (mod 2^32).
+ */
+static uint32_t written_words(const uart_rx_t* rx) {
+    uint32_t done;
+    uint32_t remaining;
+    do {
+        done = halves_done;
+        remaining = dma_channel_hw_addr((uint)rx->dma[done & 1])->transfer_count;
+    } while (done != halves_done);  // a half completed while reading
+    return done * HALF_WORDS + (HALF_WORDS - remaining);
+}
+
+bool uart_rx_start(uart_rx_t* rx, uart_inst_t* uart, uint rx_pin, uint32_t baud, uint32_t* actual) {
+    memset(rx, 0, sizeof(*rx));
+    rx->dma[0] = rx->dma[1] = -1;
+    if (active) {
+        return false;
+    }
+    rx->dma[0] = dma_claim_unused_channel(false);
+    rx->dma[1] = dma_claim_unused_channel(false);
+    if (rx->dma[0] < 0 || rx->dma[1] < 0) {
+        uart_rx_stop(rx);
+        return false;
+    }
+    rx->uart = uart;
+    rx->rx_pin = rx_pin;
+
+    // uart_init() enables the FIFOs and the DMA requests
+    *actual = uart_init(uart, baud);
+    gpio_set_function(rx_pin, GPIO_FUNC_UART);
+
+    active = rx;
+    halves_done = 0;
+    for (int i = 0; i < 2; i++) {
+        uint ch = (uint)rx->dma[i];
+        dma_channel_config d = dma_channel_get_default_config(ch);
+        channel_config_set_transfer_data_size(&d, DMA_SIZE_16);  // data and error flags
+        channel_config_set_read_increment(&d, false);
+        channel_config_set_write_increment(&d, true);
+        channel_config_set_dreq(&d, uart_get_dreq(uart, false));
+        channel_config_set_chain_to(&d, (uint)rx->dma[i ^ 1]);
+        dma_channel_configure(ch, &d, &ring[i * HALF_WORDS], &uart_get_hw(uart)->dr, HALF_WORDS, false);
+        dma_channel_set_irq0_enabled(ch, true);
+    }
+    irq_add_shared_handler(DMA_IRQ_0, uart_rx_dma_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+    dma_channel_start((uint)rx->dma[0]);
+    return true;
+}
+
+size_t uart_rx_read(uart_rx_t* rx, uint16_t* out, size_t max) {
+    if (rx->overflow) {
+        return 0;
+    }
+    uint32_t available = written_words(rx) - rx->read_words;
+    if (available > UART_RX_RING_WORDS) {
+        rx->overflow = true;
+        return 0;
+    }
+
+    size_t n = available < max ? available : max;
+    for (size_t i = 0; i < n; i++) {
+        out[i] = ring[(rx->read_words + i) % UART_RX_RING_WORDS];
+    }
+
+    // DMA may have lapped the reader while copying
+    if (written_words(rx) - rx->read_words > UART_RX_RING_WORDS) {
+        rx->overflow = true;
+        return 0;
+    }
+    rx->read_words += (uint32_t)n;
+    return n;
+}
+
+bool uart_rx_overflowed(const uart_rx_t* rx) {
+    return rx->overflow;
+}
+
+uint32_t uart_rx_resync(uart_rx_t* rx) {
+    uint32_t target = written_words(rx) - HALF_WORDS;
+    uint32_t skipped = target - rx->read_words;
+    rx->read_words = target;
+    rx->overflow = false;
+    return skipped;
+}
+
+void uart_rx_stop(uart_rx_t* rx) {
+    for (int i = 0; i < 2; i++) {
+        if (rx->dma[i] < 0) {
+            continue;
+        }
+        uint ch = (uint)rx->dma[i];
+        dma_channel_set_irq0_enabled(ch, false);
+        // Chain to itself first so aborting one channel cannot start the other
+        hw_write_masked(&dma_hw->ch[ch].al1_ctrl, ch << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB,
+                        DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS);
+    }
+    for (int i = 0; i < 2; i++) {
+        if (rx->dma[i] >= 0) {
+            dma_channel_abort((uint)rx->dma[i]);
+            dma_channel_acknowledge_irq0((uint)rx->dma[i]);
+            dma_channel_unclaim((uint)rx->dma[i]);
+            rx->dma[i] = -1;
+        }
+    }
+    if (active == rx) {
+        irq_remove_handler(DMA_IRQ_0, uart_rx_dma_irq);
+        active = NULL;
+    }
+    if (rx->uart) {
+        uart_deinit(rx->uart);
+        gpio_deinit(rx->rx_pin);
+        rx->uart = NULL;
+    }
+}